@@ -147,6 +147,11 @@ extern "C" {
 */
 #include "dart_synchronization.h"
 
+/*
+   --- DART communication counters and tracing ---
+*/
+#include "dart_trace.h"
+
 
 #ifdef __cplusplus
 } // extern "C"
@@ -164,6 +164,59 @@ dart_ret_t dart_allgatherv(
   const size_t    * recvdispls,
   dart_team_t       teamid);
 
+/**
+ * DART Equivalent to MPI alltoall.
+ *
+ * \param sendbuf The buffer containing \c nelem values to be sent to each
+ *                unit, ordered by unit id.
+ * \param recvbuf The buffer to hold \c nelem values received from each unit.
+ * \param nelem   Number of values sent to and received from each unit.
+ * \param dtype   The data type of values in \c sendbuf and \c recvbuf.
+ * \param teamid  The team to participate in the alltoall.
+ *
+ * \return \c DART_OK on success, any other of \ref dart_ret_t otherwise.
+ *
+ * \threadsafe_data{team}
+ * \ingroup DartCommunication
+ */
+dart_ret_t dart_alltoall(
+  const void      * sendbuf,
+  void            * recvbuf,
+  size_t            nelem,
+  dart_datatype_t   dtype,
+  dart_team_t       teamid);
+
+/**
+ * DART Equivalent to MPI alltoallv.
+ *
+ * \param sendbuf     The buffer containing the data to be sent to each unit.
+ * \param nsendelem   Array containing the number of values to send to
+ *                    each unit.
+ * \param senddispls  Array containing the displacements of data sent to
+ *                    each unit in \c sendbuf.
+ * \param dtype       The data type of values in \c sendbuf and \c recvbuf.
+ * \param recvbuf     The buffer to hold the received data.
+ * \param nrecvelem   Array containing the number of values to receive from
+ *                    each unit.
+ * \param recvdispls  Array containing the displacements of data received
+ *                    from each unit in \c recvbuf.
+ * \param teamid      The team to participate in the alltoallv.
+ *
+ * \return \c DART_OK on success, any other of \ref dart_ret_t otherwise.
+ *
+ * \threadsafe_data{team}
+ * \ingroup DartCommunication
+ */
+dart_ret_t dart_alltoallv(
+  const void      * sendbuf,
+  const size_t    * nsendelem,
+  const size_t    * senddispls,
+  dart_datatype_t   dtype,
+  void            * recvbuf,
+  const size_t    * nrecvelem,
+  const size_t    * recvdispls,
+  dart_team_t       teamid);
+
 /**
  * DART Equivalent to MPI allreduce.
  *
@@ -212,6 +265,63 @@ dart_ret_t dart_reduce(
   dart_team_unit_t    root,
   dart_team_t         team);
 
+/**
+ * DART Equivalent to MPI exscan.
+ * Unit \c i receives the element-wise reduction of the values in
+ * \c sendbuf of units \c 0 to \c i-1 in the team, combined in the order
+ * of their ids so \c op is not required to be commutative.
+ * The contents of \c recvbuf are undefined at unit 0.
+ *
+ * \param sendbuf Buffer containing \c nelem elements to reduce using \c op.
+ * \param recvbuf Buffer of size \c nelem to store the result of the element-wise operation \c op in.
+ * \param nelem   The number of elements of type \c dtype in \c sendbuf and \c recvbuf.
+ * \param dtype   The data type of values stored in \c sendbuf and \c recvbuf.
+ * \param op      The reduce operation to perform.
+ * \param team    The team to perform the prefix reduction on.
+ *
+ * \return \c DART_OK on success, any other of \ref dart_ret_t otherwise.
+ *
+ * \threadsafe_data{team}
+ * \ingroup DartCommunication
+ */
+dart_ret_t dart_exscan(
+  const void        * sendbuf,
+  void              * recvbuf,
+  size_t              nelem,
+  dart_datatype_t     dtype,
+  dart_operation_t    op,
+  dart_team_t         team);
+
+/**
+ * DART Equivalent to MPI reduce_scatter.
+ * The element-wise reduction of the values in \c sendbuf of all units is
+ * scattered to the units in the team: unit \c i receives
+ * \c nrecvelem[i] elements of the result, following the elements
+ * received by units \c 0 to \c i-1.
+ *
+ * \param sendbuf   Buffer containing the sum of \c nrecvelem elements to
+ *                  reduce using \c op.
+ * \param recvbuf   Buffer to store the \c nrecvelem[i] elements of the
+ *                  result received by the calling unit \c i in.
+ * \param nrecvelem Array containing the number of elements received by
+ *                  each unit.
+ * \param dtype     The data type of values stored in \c sendbuf and \c recvbuf.
+ * \param op        The reduce operation to perform.
+ * \param team      The team to perform the reduction on.
+ *
+ * \return \c DART_OK on success, any other of \ref dart_ret_t otherwise.
+ *
+ * \threadsafe_data{team}
+ * \ingroup DartCommunication
+ */
+dart_ret_t dart_reduce_scatter(
+  const void        * sendbuf,
+  void              * recvbuf,
+  const size_t      * nrecvelem,
+  dart_datatype_t     dtype,
+  dart_operation_t    op,
+  dart_team_t         team);
+
 /**
  * DART Equivalent to MPI_Accumulate.
  *
@@ -235,6 +345,37 @@ dart_ret_t dart_accumulate(
   dart_operation_t op,
   dart_team_t      team);
 
+/**
+ * Accumulate blocks of values at non-contiguous offsets in the memory of
+ * a single unit in one operation.
+ *
+ * \param gptr      A global pointer determining the target unit and the
+ *                  origin of block displacements.
+ * \param values    The local buffer holding the values of all blocks
+ *                  consecutively.
+ * \param nblocks   The number of blocks.
+ * \param blocklens The number of elements in every block.
+ * \param displs    The displacement of every block from \c gptr, in
+ *                  elements.
+ * \param dtype     The data type to use in the accumulate operation \c op.
+ * \param op        The accumulation operation to perform.
+ * \param team      The team to participate in the accumulate.
+ *
+ * \return \c DART_OK on success, any other of \ref dart_ret_t otherwise.
+ *
+ * \threadsafe_data{team}
+ * \ingroup DartCommunication
+ */
+dart_ret_t dart_accumulate_indexed(
+  dart_gptr_t      gptr,
+  const void     * values,
+  size_t           nblocks,
+  const size_t   * blocklens,
+  const size_t   * displs,
+  dart_datatype_t  dtype,
+  dart_operation_t op,
+  dart_team_t      team);
+
 /**
  * DART Equivalent to MPI_Fetch_and_op.
  *
@@ -429,6 +570,36 @@ dart_ret_t dart_get_handle(
   dart_datatype_t   dtype,
   dart_handle_t   * handle);
 
+/**
+ * 'HANDLE' variant of dart_get with different layouts of the elements
+ * at the source and in the destination buffer, e.g. to transfer
+ * non-contiguous elements in a single operation.
+ * Neither local nor remote completion is guaranteed. A later
+ * dart_wait*() call or a fence/flush operation is needed to guarantee
+ * completion.
+ *
+ * \param dest       Local target memory to store the data.
+ * \param dest_type  The data type of a single value at \c dest, e.g.
+ *                   created by \c dart_type_create_indexed.
+ * \param gptr       Global pointer being the source of the data transfer.
+ * \param src_type   The data type of a single value at \c gptr, must
+ *                   consist of the same sequence of basic types as
+ *                   \c dest_type.
+ * \param[out] handle Pointer to DART handle to instantiate for later use
+ *                   with \c dart_wait, \c dart_wait_all etc.
+ *
+ * \return \c DART_OK on success, any other of \ref dart_ret_t otherwise.
+ *
+ * \threadsafe
+ * \ingroup DartCommunication
+ */
+dart_ret_t dart_get_typed_handle(
+  void            * dest,
+  dart_datatype_t   dest_type,
+  dart_gptr_t       gptr,
+  dart_datatype_t   src_type,
+  dart_handle_t   * handle);
+
 /**
  * 'HANDLE' variant of dart_put.
  * Neither local nor remote completion is guaranteed. A later
@@ -453,6 +624,35 @@ dart_ret_t dart_put_handle(
   dart_datatype_t   dtype,
   dart_handle_t   * handle);
 
+/**
+ * 'HANDLE' variant of dart_allreduce, equivalent to MPI iallreduce.
+ * The operation is started collectively, the contents of \c recvbuf are
+ * valid after local completion of the operation, e.g. in \c dart_wait or
+ * \c dart_test_local.
+ * Neither \c sendbuf nor \c recvbuf must be accessed before completion.
+ *
+ * \param sendbuf The buffer containing the data to be sent by each unit.
+ * \param recvbuf The buffer to hold the received data.
+ * \param nelem   Number of elements sent by each process and received from each unit.
+ * \param dtype   The data type of values in \c sendbuf and \c recvbuf to use in \c op.
+ * \param op      The reduction operation to perform.
+ * \param team    The team to participate in the allreduce.
+ * \param[out] handle Pointer to DART handle to instantiate for later use with \c dart_wait, \c dart_test_local etc.
+ *
+ * \return \c DART_OK on success, any other of \ref dart_ret_t otherwise.
+ *
+ * \threadsafe_data{team}
+ * \ingroup DartCommunication
+ */
+dart_ret_t dart_allreduce_handle(
+  const void       * sendbuf,
+  void             * recvbuf,
+  size_t             nelem,
+  dart_datatype_t    dtype,
+  dart_operation_t   op,
+  dart_team_t        team,
+  dart_handle_t    * handle);
+
 /**
  * Wait for the local and remote completion of an operation.
  *
@@ -176,6 +176,24 @@ dart_ret_t dart_gptr_incaddr(dart_gptr_t *gptr, int32_t offs);
  */
 dart_ret_t dart_gptr_setunit(dart_gptr_t *gptr, dart_global_unit_t unit);
 
+/**
+ * Test whether the memory of the specified global unit is accessible
+ * from the calling unit via shared memory, i.e. whether both units are
+ * located on the same node.
+ *
+ * \param unit           The global unit to test.
+ * \param is_shmem_local Set to \c 1 if memory of \c unit is accessible
+ *                       via shared memory, \c 0 otherwise.
+ *
+ * \return \c DART_OK on success, any other of \ref dart_ret_t otherwise.
+ *
+ * \threadsafe
+ * \ingroup DartGlobMem
+ */
+dart_ret_t dart_unit_shmem_local(
+  dart_global_unit_t   unit,
+  int32_t            * is_shmem_local);
+
 /**
  * Allocates memory for \c nelem elements of type \c dtype in the global
  * address space of the calling unit and returns a global pointer to it.
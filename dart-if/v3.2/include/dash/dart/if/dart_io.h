@@ -8,6 +8,7 @@
 #define DART__IO_H_
 
 #include <dash/dart/if/dart_types.h>
+#include <stddef.h>
 
 
 /**
@@ -19,12 +20,154 @@ extern "C" {
 #endif
 
 #define DART_INTERFACE_ON
+
+#if defined(DART_ENABLE_HDF5) || defined(DASH_ENABLE_HDF5)
+#include <hdf5.h>
+
 /**
  * setup hdf5 for parallel io using mpi-io
  */
 dart_ret_t dart__io__hdf5__prep_mpio(
     hid_t plist_id,
     dart_team_t teamid);
+#endif
+
+/**
+ * File opened by all units in a team for parallel IO.
+ * \ingroup DartIO
+ */
+typedef struct dart_file_struct * dart_file_t;
+
+/**
+ * Access modes of files, can be combined.
+ * \ingroup DartIO
+ */
+typedef enum
+{
+  /// Open for reading
+  DART_FILE_READ   = 1 << 0,
+  /// Open for writing
+  DART_FILE_WRITE  = 1 << 1,
+  /// Create the file if it does not exist, truncate it otherwise
+  DART_FILE_CREATE = 1 << 2
+} dart_file_mode_t;
+
+/**
+ * Open a file for parallel IO.
+ *
+ * \param teamid    Team of all units accessing the file.
+ * \param filename  Path of the file, identical on all units.
+ * \param mode      Combination of \ref dart_file_mode_t flags.
+ * \param[out] file The opened file.
+ *
+ * \return \c DART_OK on success or an error code from \see dart_ret_t
+ *         otherwise.
+ *
+ * \threadsafe_none
+ * \ingroup DartIO
+ */
+dart_ret_t dart__io__file_open(
+    dart_team_t   teamid,
+    const char  * filename,
+    int           mode,
+    dart_file_t * file);
+
+/**
+ * Close a file opened with \ref dart__io__file_open.
+ *
+ * Collective operation.
+ *
+ * \threadsafe_none
+ * \ingroup DartIO
+ */
+dart_ret_t dart__io__file_close(
+    dart_file_t * file);
+
+/**
+ * Size of a file in bytes.
+ *
+ * \threadsafe_none
+ * \ingroup DartIO
+ */
+dart_ret_t dart__io__file_size(
+    dart_file_t   file,
+    size_t      * nbytes);
+
+/**
+ * Set the view of the calling unit on a file to a sequence of byte runs.
+ * Subsequent accesses address the concatenation of the runs.
+ *
+ * Collective operation, every unit may specify different runs.
+ *
+ * \param file        The file.
+ * \param disp        Displacement of the view in bytes.
+ * \param nruns       Number of runs, the entire file following \c disp
+ *                    is visible if 0.
+ * \param run_offsets Offsets of the runs relative to \c disp in bytes,
+ *                    in ascending order and not overlapping.
+ * \param run_nbytes  Sizes of the runs in bytes.
+ *
+ * \threadsafe_none
+ * \ingroup DartIO
+ */
+dart_ret_t dart__io__file_set_view(
+    dart_file_t    file,
+    size_t         disp,
+    size_t         nruns,
+    const size_t * run_offsets,
+    const size_t * run_nbytes);
+
+/**
+ * Write bytes at an offset in the view of the calling unit.
+ * Independent operation.
+ *
+ * \threadsafe_none
+ * \ingroup DartIO
+ */
+dart_ret_t dart__io__file_write_at(
+    dart_file_t   file,
+    size_t        offset,
+    const void  * buf,
+    size_t        nbytes);
+
+/**
+ * Read bytes at an offset in the view of the calling unit.
+ * Independent operation.
+ *
+ * \threadsafe_none
+ * \ingroup DartIO
+ */
+dart_ret_t dart__io__file_read_at(
+    dart_file_t   file,
+    size_t        offset,
+    void        * buf,
+    size_t        nbytes);
+
+/**
+ * Write bytes at an offset in the view of the calling unit.
+ * Collective operation, units may write any number of bytes including 0.
+ *
+ * \threadsafe_none
+ * \ingroup DartIO
+ */
+dart_ret_t dart__io__file_write_at_all(
+    dart_file_t   file,
+    size_t        offset,
+    const void  * buf,
+    size_t        nbytes);
+
+/**
+ * Read bytes at an offset in the view of the calling unit.
+ * Collective operation, units may read any number of bytes including 0.
+ *
+ * \threadsafe_none
+ * \ingroup DartIO
+ */
+dart_ret_t dart__io__file_read_at_all(
+    dart_file_t   file,
+    size_t        offset,
+    void        * buf,
+    size_t        nbytes);
 
 #define DART_INTERFACE_OFF
 
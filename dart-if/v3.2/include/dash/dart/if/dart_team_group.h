@@ -357,6 +357,38 @@ dart_ret_t dart_team_create(dart_team_t          teamid,
                             const dart_group_t   group,
                             dart_team_t        * newteam);
 
+/**
+ * Create sub-teams of the specified team from disjoint groups in a single
+ * collective operation.
+ *
+ * Every unit becomes member of the team created from the group containing
+ * it. Units not contained in any group obtain \c DART_TEAM_NULL.
+ * In contrast to calling \ref dart_team_create for every group, the team
+ * IDs are agreed on and the communicators of all teams are created in a
+ * single collective operation on the parent team, respectively.
+ * Communication resources of destroyed teams consisting of the same units
+ * are reused.
+ *
+ * \param      teamid      The parent team to use whose units participate
+ *                         in the collective operation.
+ * \param      num_groups  The number of groups.
+ * \param      groups      Disjoint groups of units in the parent team.
+ * \param[out] newteam     The ID of the team the calling unit is member
+ *                         of, or \c DART_TEAM_NULL.
+ * \param[out] group_idx   The index of the group containing the calling
+ *                         unit, or \c num_groups.
+ *
+ * \return \c DART_OK on success, any other of \ref dart_ret_t otherwise.
+ *
+ * \threadsafe_none
+ * \ingroup DartGroupTeam
+ */
+dart_ret_t dart_team_split(dart_team_t          teamid,
+                           size_t               num_groups,
+                           const dart_group_t * groups,
+                           dart_team_t        * newteam,
+                           size_t             * group_idx);
+
 /**
  * Free up resources associated with the specified team
  *
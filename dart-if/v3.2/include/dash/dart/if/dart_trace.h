@@ -0,0 +1,211 @@
+/**
+ * \file dash/dart/if/dart_trace.h
+ *
+ * Counters and event traces of communication operations.
+ */
+#ifndef DART__TRACE_H_
+#define DART__TRACE_H_
+
+#include <dash/dart/if/dart_types.h>
+#include <stddef.h>
+#include <stdint.h>
+
+
+/**
+ * \defgroup  DartTrace  Communication counters and tracing
+ * \ingroup   DartInterface
+ *
+ * Records the number of communication operations, transferred bytes and
+ * time spent in blocking operations for every target unit, histograms of
+ * message sizes and, optionally, a trace of events in per-thread ring
+ * buffers.
+ *
+ * Tracing is disabled by default and is configured by environment
+ * variables read in \c dart_init:
+ *
+ * - \c DART_TRACE: \c counters to record counters and histograms,
+ *   \c events to additionally record events.
+ * - \c DART_TRACE_BUFFER: capacity of the event ring buffer of every
+ *   thread, in number of events. When exceeded, oldest events are
+ *   overwritten. Defaults to 65536.
+ * - \c DART_TRACE_FILE: if set, every unit writes its counters and
+ *   events to the file <tt>DART_TRACE_FILE.<unit></tt> in \c dart_exit.
+ *
+ * Recording is performed by the calling thread in thread-private buffers
+ * and does not require synchronization.
+ */
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#define DART_INTERFACE_ON
+
+/**
+ * Number of bins in message size histograms. Bin \c 0 counts messages of
+ * 0 bytes, bin \c b > 0 counts messages of \c [2^(b-1), 2^b) bytes, the
+ * last bin counts all larger messages.
+ *
+ * \ingroup DartTrace
+ */
+#define DART_TRACE_HISTOGRAM_BINS 32
+
+/**
+ * Kinds of recorded operations.
+ *
+ * \ingroup DartTrace
+ */
+typedef enum
+{
+  /// One-sided get, blocking or non-blocking
+  DART_TRACE_OP_GET = 0,
+  /// One-sided put, blocking or non-blocking
+  DART_TRACE_OP_PUT,
+  /// Accumulate
+  DART_TRACE_OP_ACCUMULATE,
+  /// Fetch-and-op and compare-and-swap
+  DART_TRACE_OP_FETCH_OP,
+  /// Flush of one-sided operations
+  DART_TRACE_OP_FLUSH,
+  /// Wait for completion of non-blocking operations
+  DART_TRACE_OP_WAIT,
+  /// Collective operation, barriers included
+  DART_TRACE_OP_COLLECTIVE,
+  /// Two-sided send and receive
+  DART_TRACE_OP_P2P,
+  /** \cond DART_HIDDEN_SYMBOLS */
+  DART_TRACE_OP_COUNT
+  /** \endcond */
+} dart_trace_op_t;
+
+/**
+ * Level of detail of recorded data.
+ *
+ * \ingroup DartTrace
+ */
+typedef enum
+{
+  /// Nothing is recorded
+  DART_TRACE_OFF = 0,
+  /// Counters and message size histograms are recorded
+  DART_TRACE_COUNTERS,
+  /// Counters, histograms and events are recorded
+  DART_TRACE_EVENTS
+} dart_trace_level_t;
+
+/**
+ * Accumulated statistics of operations of a kind.
+ *
+ * \ingroup DartTrace
+ */
+typedef struct
+{
+  /// Number of operations
+  uint64_t count;
+  /// Number of bytes transferred, or contributed to collectives
+  uint64_t nbytes;
+  /// Time spent in blocking operations, in nanoseconds
+  uint64_t time_ns;
+} dart_trace_counter_t;
+
+/**
+ * A recorded event.
+ *
+ * \ingroup DartTrace
+ */
+typedef struct
+{
+  /// Begin of the operation in nanoseconds since \c dart_init
+  uint64_t timestamp_ns;
+  /// Duration of blocking operations in nanoseconds, \c 0 otherwise
+  uint64_t duration_ns;
+  /// Number of bytes transferred
+  uint64_t nbytes;
+  /// Global id of the target unit, \c -1 for operations without target
+  int32_t  target;
+  /// Segment id of one-sided operations, team id of collectives
+  int16_t  id;
+  /// Index of the recording thread
+  uint16_t thread;
+  /// Kind of operation, see \ref dart_trace_op_t
+  uint8_t  op;
+} dart_trace_event_t;
+
+/**
+ * Set the level of detail of recorded data.
+ *
+ * \ingroup DartTrace
+ */
+dart_ret_t dart_trace_set_level(
+  dart_trace_level_t   level);
+
+/**
+ * The level of detail of recorded data.
+ *
+ * \ingroup DartTrace
+ */
+dart_ret_t dart_trace_level(
+  dart_trace_level_t * level);
+
+/**
+ * Statistics of operations of a kind issued by the calling unit on a
+ * target unit, accumulated over all threads.
+ * Operations without target unit like collectives and \c dart_flush_all
+ * are accounted to target unit id \c -1.
+ *
+ * \ingroup DartTrace
+ */
+dart_ret_t dart_trace_counter(
+  dart_trace_op_t        op,
+  dart_global_unit_t     target,
+  dart_trace_counter_t * counter);
+
+/**
+ * Histogram of message sizes of operations of a kind issued by the
+ * calling unit, accumulated over all threads and target units.
+ *
+ * \param op    Kind of operation.
+ * \param bins  Array of \ref DART_TRACE_HISTOGRAM_BINS counts.
+ *
+ * \ingroup DartTrace
+ */
+dart_ret_t dart_trace_histogram(
+  dart_trace_op_t        op,
+  uint64_t             * bins);
+
+/**
+ * Reset counters and histograms and discard recorded events of the
+ * calling unit.
+ *
+ * Must not be called concurrently with recorded operations.
+ *
+ * \ingroup DartTrace
+ */
+dart_ret_t dart_trace_reset();
+
+/**
+ * Write counters, histograms and events of the calling unit to a binary
+ * file.
+ *
+ * The file consists of a header of fields of type \c uint64_t:
+ * magic number \c 0x3230435254524144 (<tt>"DARTRC02"</tt>), unit id,
+ * number of units, number of operation kinds, number of histogram bins
+ * and number of events. It is followed by the counters of all operation
+ * kinds and target units (target \c -1 last) as
+ * \ref dart_trace_counter_t, the histograms of all operation kinds and
+ * the events as \ref dart_trace_event_t in chronological order per
+ * thread.
+ *
+ * Must not be called concurrently with recorded operations.
+ *
+ * \ingroup DartTrace
+ */
+dart_ret_t dart_trace_write(
+  const char         * filename);
+
+#define DART_INTERFACE_OFF
+
+#ifdef __cplusplus
+} /* extern "C" */
+#endif
+
+#endif /* DART__TRACE_H_ */
@@ -68,7 +68,13 @@ typedef enum
   /** Binary XOR */
   DART_OP_BXOR,
   /** Logical XOR */
-  DART_OP_LXOR
+  DART_OP_LXOR,
+  /** \cond DART_HIDDEN_SYMBOLS */
+  /** Operations created by \ref dart_op_create start at this value */
+  DART_OP_USER_BASE,
+  /** Maximum value of an operation, reserves the range of int32_t */
+  DART_OP_USER_MAX = INT32_MAX
+  /** \endcond */
 } dart_operation_t;
 
 /**
@@ -87,7 +93,13 @@ typedef enum
     DART_TYPE_ULONG,
     DART_TYPE_LONGLONG,
     DART_TYPE_FLOAT,
-    DART_TYPE_DOUBLE
+    DART_TYPE_DOUBLE,
+    /** \cond DART_HIDDEN_SYMBOLS */
+    /** Types created by \c dart_type_create_* start at this value */
+    DART_TYPE_USER_BASE,
+    /** Maximum value of a data type, reserves the range of int32_t */
+    DART_TYPE_USER_MAX = INT32_MAX
+    /** \endcond */
 } dart_datatype_t;
 
 
@@ -634,6 +646,113 @@ typedef struct
 }
 dart_config_t;
 
+/**
+ * Signature of user-defined reduce operations, see \ref dart_op_create.
+ *
+ * Combines the \c len values in \c invec with the values in
+ * \c inoutvec element-wise and stores the results in \c inoutvec, i.e.
+ * <tt>inoutvec[i] = invec[i] (op) inoutvec[i]</tt>.
+ * \c userdata is the pointer specified in \ref dart_op_create.
+ *
+ * \ingroup DartTypes
+ */
+typedef void (*dart_operator_t)(
+  const void * invec,
+  void       * inoutvec,
+  size_t       len,
+  void       * userdata);
+
+/**
+ * Create a reduce operation on values of type \c dtype from a
+ * user-defined function, to be used in \ref dart_allreduce and
+ * \ref dart_reduce.
+ *
+ * User-defined operations can not be used in one-sided atomic
+ * operations like \ref dart_accumulate.
+ *
+ * \param op          The function applied to the reduced values.
+ * \param userdata    Pointer passed to every invocation of \c op.
+ * \param commutative Whether the operation is commutative. Values of
+ *                    non-commutative operations are combined in order of
+ *                    unit ids.
+ * \param dtype       The type of the reduced values.
+ * \param new_op      The created operation.
+ *
+ * \return \c DART_OK on success, any other of \ref dart_ret_t otherwise.
+ *
+ * \threadsafe_none
+ * \ingroup DartTypes
+ */
+dart_ret_t dart_op_create(
+  dart_operator_t    op,
+  void             * userdata,
+  int32_t            commutative,
+  dart_datatype_t    dtype,
+  dart_operation_t * new_op);
+
+/**
+ * Destroy an operation created by \ref dart_op_create and set it to
+ * \c DART_OP_UNDEFINED.
+ *
+ * \threadsafe_none
+ * \ingroup DartTypes
+ */
+dart_ret_t dart_op_destroy(
+  dart_operation_t * op);
+
+/**
+ * Create a data type of \c nelem consecutive values of type
+ * \c base_type.
+ *
+ * \threadsafe_none
+ * \ingroup DartTypes
+ */
+dart_ret_t dart_type_create_contiguous(
+  dart_datatype_t    base_type,
+  size_t             nelem,
+  dart_datatype_t  * new_type);
+
+/**
+ * Create a data type of a struct consisting of \c nblocks blocks of
+ * \c blocklens[i] values of type \c types[i] at byte offset
+ * \c offsets[i]. The size of the struct including padding, as obtained
+ * from \c sizeof, is specified in \c extent.
+ *
+ * \threadsafe_none
+ * \ingroup DartTypes
+ */
+dart_ret_t dart_type_create_struct(
+  size_t                  nblocks,
+  const size_t          * blocklens,
+  const size_t          * offsets,
+  const dart_datatype_t * types,
+  size_t                  extent,
+  dart_datatype_t       * new_type);
+
+/**
+ * Create a data type of \c nblocks blocks of \c blocklens[i] values of
+ * type \c base_type at displacement \c displs[i], in number of values.
+ *
+ * \threadsafe_none
+ * \ingroup DartTypes
+ */
+dart_ret_t dart_type_create_indexed(
+  dart_datatype_t         base_type,
+  size_t                  nblocks,
+  const size_t          * blocklens,
+  const size_t          * displs,
+  dart_datatype_t       * new_type);
+
+/**
+ * Destroy a data type created by \c dart_type_create_* and set it to
+ * \c DART_TYPE_UNDEFINED.
+ *
+ * \threadsafe_none
+ * \ingroup DartTypes
+ */
+dart_ret_t dart_type_destroy(
+  dart_datatype_t  * dtype);
+
 /** \cond DART_HIDDEN_SYMBOLS */
 #define DART_INTERFACE_OFF
 /** \endcond */
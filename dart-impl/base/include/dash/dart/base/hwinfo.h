@@ -25,4 +25,27 @@ dart_ret_t dart_hwinfo_init(
 dart_ret_t dart_hwinfo(
   dart_hwinfo_t * hwinfo);
 
+/**
+ * Resolves the hardware locality information of units on the local node
+ * and the locations of the node's modules, e.g. accelerators.
+ *
+ * The hardware topology is loaded once for all units, so a single unit
+ * per node has to resolve the locality of its node's units.
+ *
+ * \param num_units         Number of units on the local node.
+ * \param cpu_ids           Physical index of the CPU every unit is
+ *                          running on, or -1 for the calling unit.
+ * \param hwinfos           Array of \c num_units entries to store the
+ *                          units' hardware locality information.
+ * \param module_locations  Array of module locations allocated in this
+ *                          function, must be freed by the caller.
+ * \param num_modules       Number of entries in \c module_locations.
+ */
+dart_ret_t dart_hwinfo_node(
+  int                        num_units,
+  const int                * cpu_ids,
+  dart_hwinfo_t            * hwinfos,
+  dart_module_location_t  ** module_locations,
+  int                      * num_modules);
+
 #endif /* DART__BASE__HWINFO_H__ */
@@ -44,10 +44,27 @@ dart_host_topology_t;
  * team.
  * Expects host names in array ordered by unit rank such that the jth entry
  * in the array contains the host name of unit j.
+ *
+ * Local operation, module locations of all nodes are specified by the
+ * caller.
  */
 dart_ret_t dart__base__host_topology__create(
-  dart_unit_mapping_t   * unit_mapping,
-  dart_host_topology_t ** topo);
+  dart_unit_mapping_t          * unit_mapping,
+  const dart_module_location_t * module_locations,
+  int                            num_modules,
+  dart_host_topology_t        ** topo);
+
+/**
+ * Resolve the locations of modules like accelerators in the local node
+ * from the node's hwloc topology.
+ *
+ * NOTE: Array returned in output parameter `module_locations` is
+ *       allocated in this function and must be deallocated by the caller.
+ */
+dart_ret_t dart__base__host_topology__module_locations(
+  void                    * hwloc_topology,
+  dart_module_location_t ** module_locations,
+  int                     * num_modules);
 
 dart_ret_t dart__base__host_topology__destruct(
   dart_host_topology_t  * topo);
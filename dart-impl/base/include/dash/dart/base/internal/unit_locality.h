@@ -17,6 +17,11 @@ dart_ret_t dart__base__unit_locality__create(
   dart_team_t             team,
   dart_unit_mapping_t  ** unit_mapping);
 
+dart_ret_t dart__base__unit_locality__derive(
+  const dart_unit_mapping_t  * parent_mapping,
+  dart_team_t                  team,
+  dart_unit_mapping_t       ** unit_mapping);
+
 dart_ret_t dart__base__unit_locality__destruct(
   dart_unit_mapping_t   * unit_mapping);
 
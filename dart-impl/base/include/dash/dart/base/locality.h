@@ -7,13 +7,29 @@
 #include <dash/dart/if/dart_types.h>
 
 #include <dash/dart/base/internal/domain_locality.h>
+#include <dash/dart/base/internal/unit_locality.h>
 
 
 /* ======================================================================== *
  * Init / Finalize                                                          *
  * ======================================================================== */
 
-dart_ret_t dart__base__locality__init();
+/**
+ * Initialize locality data from the locality information of all units
+ * and the locations of modules in all nodes, collected by the DART
+ * backend. Ownership of \c unit_mapping and \c module_locations is
+ * transferred.
+ * If \c unit_mapping is \c NULL, unit locality information is exchanged
+ * in an allgather operation.
+ *
+ * Locality data of teams is created lazily on first query.
+ *
+ * Collective operation on \c DART_TEAM_ALL if \c unit_mapping is \c NULL.
+ */
+dart_ret_t dart__base__locality__init(
+  dart_unit_mapping_t    * unit_mapping,
+  dart_module_location_t * module_locations,
+  int                      num_modules);
 
 dart_ret_t dart__base__locality__finalize();
 
@@ -0,0 +1,104 @@
+/**
+ * \file dash/dart/base/trace.h
+ *
+ * Recording of communication counters and events, see
+ * \c dash/dart/if/dart_trace.h.
+ */
+#ifndef DART__BASE__TRACE_H__
+#define DART__BASE__TRACE_H__
+
+#include <dash/dart/if/dart_types.h>
+#include <dash/dart/if/dart_trace.h>
+
+#include <stdint.h>
+
+
+/**
+ * Level of detail of recorded data, tested before every recording so
+ * disabled tracing only costs a branch.
+ */
+extern dart_trace_level_t dart__base__trace__level_;
+
+/**
+ * Whether communication operations are recorded.
+ */
+#define DART__BASE__TRACE__ENABLED() \
+  (dart__base__trace__level_ != DART_TRACE_OFF)
+
+/**
+ * Timestamp for the begin of a blocking operation, \c 0 if tracing is
+ * disabled.
+ */
+#define DART__BASE__TRACE__BEGIN() \
+  (DART__BASE__TRACE__ENABLED() ? dart__base__trace__now() : 0)
+
+/**
+ * Record a non-blocking operation of kind \c op on unit \c target.
+ */
+#define DART__BASE__TRACE__OP(op, target, nbytes, id) \
+  do { \
+    if (DART__BASE__TRACE__ENABLED()) { \
+      dart__base__trace__record((op), (target), (nbytes), (id), 0); \
+    } \
+  } while (0)
+
+/**
+ * Record a blocking operation of kind \c op on unit \c target, started at
+ * timestamp \c begin obtained from \c DART__BASE__TRACE__BEGIN.
+ */
+#define DART__BASE__TRACE__TIMED(op, target, nbytes, id, begin) \
+  do { \
+    if (DART__BASE__TRACE__ENABLED()) { \
+      dart__base__trace__record((op), (target), (nbytes), (id), (begin)); \
+    } \
+  } while (0)
+
+/**
+ * Initialize tracing for \c nunits units, configured by the environment
+ * variables \c DART_TRACE, \c DART_TRACE_BUFFER and \c DART_TRACE_FILE.
+ */
+dart_ret_t dart__base__trace__init(
+  dart_global_unit_t   myid,
+  size_t               nunits);
+
+/**
+ * Write recorded data to the file specified in \c DART_TRACE_FILE, if
+ * any, and release all buffers.
+ */
+dart_ret_t dart__base__trace__finalize();
+
+/**
+ * Monotonic timestamp in nanoseconds since \c dart__base__trace__init.
+ */
+uint64_t dart__base__trace__now();
+
+/**
+ * Record an operation in the buffers of the calling thread.
+ * Operations with \c begin \c > \c 0 are blocking and their duration
+ * is accounted.
+ */
+void dart__base__trace__record(
+  dart_trace_op_t      op,
+  int32_t              target,
+  uint64_t             nbytes,
+  int16_t              id,
+  uint64_t             begin);
+
+dart_ret_t dart__base__trace__set_level(
+  dart_trace_level_t   level);
+
+dart_ret_t dart__base__trace__counter(
+  dart_trace_op_t        op,
+  int32_t                target,
+  dart_trace_counter_t * counter);
+
+dart_ret_t dart__base__trace__histogram(
+  dart_trace_op_t        op,
+  uint64_t             * bins);
+
+dart_ret_t dart__base__trace__reset();
+
+dart_ret_t dart__base__trace__write(
+  const char           * filename);
+
+#endif /* DART__BASE__TRACE_H__ */
@@ -18,6 +18,7 @@
 #include <dash/dart/base/internal/papi.h>
 #include <dash/dart/base/internal/hwloc.h>
 #include <dash/dart/base/internal/unit_locality.h>
+#include <dash/dart/base/internal/host_topology.h>
 
 #include <dash/dart/base/hwinfo.h>
 
@@ -106,10 +107,18 @@ dart_ret_t dart_hwinfo_init(
   return DART_OK;
 }
 
-dart_ret_t dart_hwinfo(
-  dart_hwinfo_t * hwinfo)
+/**
+ * Resolves hardware locality information of a unit running on the CPU
+ * with the specified physical index, or of the calling unit if the index
+ * is negative.
+ * Queries the hwloc topology of the local node if specified.
+ */
+static dart_ret_t dart__base__hwinfo__resolve(
+  dart_hwinfo_t * hwinfo,
+  int             cpu_os_id,
+  void          * hwloc_topology)
 {
-  DART_LOG_DEBUG("dart_hwinfo()");
+  DART_LOG_DEBUG("dart_hwinfo() cpu_os_id:%d", cpu_os_id);
 
   dart_hwinfo_t hw;
   dart_hwinfo_init(&hw);
@@ -163,18 +172,7 @@ dart_ret_t dart_hwinfo(
 #ifdef DART_ENABLE_HWLOC
   DART_LOG_TRACE("dart_hwinfo: using hwloc");
 
-  hwloc_topology_t topology;
-  hwloc_topology_init(&topology);
-  hwloc_topology_set_flags(topology,
-#if HWLOC_API_VERSION < 0x00020000
-                             HWLOC_TOPOLOGY_FLAG_IO_DEVICES
-                           | HWLOC_TOPOLOGY_FLAG_IO_BRIDGES
-  /*                       | HWLOC_TOPOLOGY_FLAG_WHOLE_IO  */
-#else
-                             HWLOC_TOPOLOGY_FLAG_WHOLE_SYSTEM
-#endif
-                          );
-  hwloc_topology_load(topology);
+  hwloc_topology_t topology = (hwloc_topology_t)(hwloc_topology);
 
   /* hwloc can resolve the physical index (os_index) of the active unit,
    * not the logical index.
@@ -183,15 +181,16 @@ dart_ret_t dart_hwinfo(
    * CPU object that has a matching physical index.
    */
 
-  /* Get PU of active thread: */
-  hwloc_cpuset_t cpuset = hwloc_bitmap_alloc();
-  int flags     = 0; // HWLOC_CPUBIND_PROCESS;
-  int cpu_os_id = -1;
-  int ret       = hwloc_get_last_cpu_location(topology, cpuset, flags);
-  if (!ret) {
-    cpu_os_id = hwloc_bitmap_first(cpuset);
+  if (cpu_os_id < 0) {
+    /* Get PU of active thread: */
+    hwloc_cpuset_t cpuset = hwloc_bitmap_alloc();
+    int flags = 0; // HWLOC_CPUBIND_PROCESS;
+    int ret   = hwloc_get_last_cpu_location(topology, cpuset, flags);
+    if (!ret) {
+      cpu_os_id = hwloc_bitmap_first(cpuset);
+    }
+    hwloc_bitmap_free(cpuset);
   }
-  hwloc_bitmap_free(cpuset);
 
   hwloc_obj_t cpu_obj;
   for (cpu_obj =
@@ -326,7 +325,6 @@ dart_ret_t dart_hwinfo(
     }
   }
 
-  hwloc_topology_destroy(topology);
   DART_LOG_TRACE("dart_hwinfo: hwloc: "
                  "num_numa:%d numa_id:%d "
                  "num_cores:%d core_id:%d cpu_id:%d",
@@ -358,7 +356,7 @@ dart_ret_t dart_hwinfo(
 
 #ifdef DART__PLATFORM__LINUX
   if (hw.cpu_id < 0) {
-    hw.cpu_id = sched_getcpu();
+    hw.cpu_id = (cpu_os_id >= 0) ? cpu_os_id : sched_getcpu();
   }
 #else
   DART_LOG_ERROR("dart_hwinfo: "
@@ -439,3 +437,63 @@ dart_ret_t dart_hwinfo(
   DART_LOG_DEBUG("dart_hwinfo >");
   return DART_OK;
 }
+
+#ifdef DART_ENABLE_HWLOC
+static hwloc_topology_t dart__base__hwinfo__load_topology()
+{
+  hwloc_topology_t topology;
+  hwloc_topology_init(&topology);
+  hwloc_topology_set_flags(topology,
+#if HWLOC_API_VERSION < 0x00020000
+                             HWLOC_TOPOLOGY_FLAG_IO_DEVICES
+                           | HWLOC_TOPOLOGY_FLAG_IO_BRIDGES
+  /*                       | HWLOC_TOPOLOGY_FLAG_WHOLE_IO  */
+#else
+                             HWLOC_TOPOLOGY_FLAG_WHOLE_SYSTEM
+#endif
+                          );
+  hwloc_topology_load(topology);
+  return topology;
+}
+#endif
+
+dart_ret_t dart_hwinfo(
+  dart_hwinfo_t * hwinfo)
+{
+  void * topology = NULL;
+#ifdef DART_ENABLE_HWLOC
+  topology = dart__base__hwinfo__load_topology();
+#endif
+  dart_ret_t ret = dart__base__hwinfo__resolve(hwinfo, -1, topology);
+#ifdef DART_ENABLE_HWLOC
+  hwloc_topology_destroy((hwloc_topology_t)(topology));
+#endif
+  return ret;
+}
+
+dart_ret_t dart_hwinfo_node(
+  int                        num_units,
+  const int                * cpu_ids,
+  dart_hwinfo_t            * hwinfos,
+  dart_module_location_t  ** module_locations,
+  int                      * num_modules)
+{
+  DART_LOG_DEBUG("dart_hwinfo_node() num_units:%d", num_units);
+  void * topology = NULL;
+#ifdef DART_ENABLE_HWLOC
+  topology = dart__base__hwinfo__load_topology();
+#endif
+  dart_ret_t ret = DART_OK;
+  for (int u = 0; u < num_units && ret == DART_OK; ++u) {
+    ret = dart__base__hwinfo__resolve(&hwinfos[u], cpu_ids[u], topology);
+  }
+  if (ret == DART_OK) {
+    ret = dart__base__host_topology__module_locations(
+            topology, module_locations, num_modules);
+  }
+#ifdef DART_ENABLE_HWLOC
+  hwloc_topology_destroy((hwloc_topology_t)(topology));
+#endif
+  DART_LOG_DEBUG("dart_hwinfo_node > num_modules:%d", *num_modules);
+  return ret;
+}
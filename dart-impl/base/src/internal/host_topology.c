@@ -41,7 +41,8 @@ static int cmpstr_(const void * p1, const void * p2) {
   return strcmp(* (char * const *) p1, * (char * const *) p2);
 }
 
-static dart_ret_t dart__base__host_topology__module_locations(
+dart_ret_t dart__base__host_topology__module_locations(
+  void                    * hwloc_topology,
   dart_module_location_t ** module_locations,
   int                     * num_modules)
 {
@@ -51,18 +52,7 @@ static dart_ret_t dart__base__host_topology__module_locations(
 #if defined(DART_ENABLE_HWLOC) && defined(DART_ENABLE_HWLOC_PCI)
   DART_LOG_TRACE("dart__base__host_topology__module_locations: using hwloc");
 
-  hwloc_topology_t topology;
-  hwloc_topology_init(&topology);
-  hwloc_topology_set_flags(topology,
-#if HWLOC_API_VERSION < 0x00020000
-                             HWLOC_TOPOLOGY_FLAG_IO_DEVICES
-                           | HWLOC_TOPOLOGY_FLAG_IO_BRIDGES
-  /*                       | HWLOC_TOPOLOGY_FLAG_WHOLE_IO  */
-#else
-                             HWLOC_TOPOLOGY_FLAG_WHOLE_SYSTEM
-#endif
-                          );
-  hwloc_topology_load(topology);
+  hwloc_topology_t topology = (hwloc_topology_t)(hwloc_topology);
   DART_LOG_TRACE("dart__base__host_topology__module_locations: "
                  "hwloc: indexing PCI devices");
   /* Alternative: HWLOC_TYPE_DEPTH_PCI_DEVICE */
@@ -92,7 +82,7 @@ static dart_ret_t dart__base__host_topology__module_locations(
                                        *num_modules *
                                          sizeof(dart_module_location_t));
             dart_module_location_t * module_loc =
-              module_locations[(*num_modules)-1];
+              &(*module_locations)[(*num_modules)-1];
 
             char * hostname     = module_loc->host;
             char * mic_hostname = module_loc->module;
@@ -135,327 +125,48 @@ static dart_ret_t dart__base__host_topology__module_locations(
       }
     }
   }
-  hwloc_topology_destroy(topology);
   DART_LOG_TRACE("dart__base__host_topology__module_locations > "
                  "num_modules:%d", *num_modules);
+#else
+  (void)(hwloc_topology);
 #endif /* ifdef DART_ENABLE_HWLOC */
   return DART_OK;
 }
 
 static dart_ret_t dart__base__host_topology__update_module_locations(
-  dart_unit_mapping_t  * unit_mapping,
-  dart_host_topology_t * topo)
+  dart_host_topology_t         * topo,
+  const dart_module_location_t * module_locations,
+  int                            num_modules)
 {
-  int num_hosts    = topo->num_hosts;
-  dart_team_t team = unit_mapping->team;
-
-  /*
-   * Initiate all-to-all exchange of module locations like Xeon Phi
-   * hostnames and their assiocated NUMA domain in their parent node.
-   *
-   * Select one leader unit per node for communication:
-   */
-
-  dart_unit_locality_t * my_uloc;
-
-  /*
-   * unit ID of leader unit (relative to the team specified in unit_mapping)
-   * of the active unit's local compute node.
-   * Example:
-   *
-   *  node 0:                     node 1:
-   *    unit ids: { 0, 1, 2 }       unit ids: { 3, 4, 5 }
-   *
-   * leader unit at units 0,1,2: 0
-   * leader unit at units 3,4,5: 3
-   */
-  dart_team_unit_t       local_leader_unit_id = DART_UNDEFINED_TEAM_UNIT_ID;
-  dart_team_unit_t       my_id;
-  dart_group_t           leader_group;
-  dart_group_t           local_group;
-  dart_team_t            leader_team; /* team of all node leaders   */
-
-  DART_ASSERT_RETURNS(
-    dart_team_myid(team, &my_id),
-    DART_OK);
-  DART_ASSERT_RETURNS(
-    dart__base__unit_locality__at(
-      unit_mapping, my_id, &my_uloc),
-    DART_OK);
-  DART_ASSERT_RETURNS(
-    dart_group_create(&leader_group),
-    DART_OK);
-  DART_ASSERT_RETURNS(
-    dart_group_create(&local_group),
-    DART_OK);
-
-  dart_unit_locality_t * unit_locality;
-  dart__base__unit_locality__at(
-    unit_mapping, my_id, &unit_locality);
-
-  char * local_hostname = unit_locality->hwinfo.host;
-  DART_LOG_TRACE("dart__base__host_topology__init: "
-                 "local_hostname:%s", local_hostname);
-
-
-  /* Compose leader group and local group: */
-  for (int h = 0; h < num_hosts; h++) {
-    /* Get unit ids at local unit's host */
-    dart_host_units_t  * host_units  = &topo->host_units[h];
-    dart_host_domain_t * host_domain = &topo->host_domains[h];
-    /* Select first unit id at local host as leader: */
-    dart_global_unit_t leader_unit_id = host_units->units[0];
-    dart_group_addmember(leader_group, leader_unit_id);
-    DART_LOG_TRACE("dart__base__host_topology__init: "
-                   "num. units on host %s: %d",
-                   topo->host_names[h], host_units->num_units);
-    DART_LOG_TRACE("dart__base__host_topology__init: "
-                   "leader unit on host %s: %d",
-                   topo->host_names[h], leader_unit_id.id);
-    DART_ASSERT(
-      strncmp(topo->host_names[h], host_domain->host,
-              DART_LOCALITY_HOST_MAX_SIZE) == 0);
-    if (strncmp(host_domain->host, local_hostname,
-                DART_LOCALITY_HOST_MAX_SIZE) == 0) {
-      /* set local leader: */
-      DART_ASSERT_RETURNS(
-        dart_team_unit_g2l(team, leader_unit_id,
-                           &local_leader_unit_id),
-        DART_OK);
-      /* collect units in local group: */
-      for (int u_idx = 0; u_idx < host_units->num_units; u_idx++) {
-        DART_LOG_TRACE("dart__base__host_topology__init: "
-                       "add unit %d to local group",
-                       host_units->units[u_idx].id);
-        dart_group_addmember(local_group, host_units->units[u_idx]);
-      }
-    }
-  }
-
-  DART_LOG_TRACE("dart__base__host_topology__init: "
-                 "myid:%d (in team %d) local_leader_unit_id:%d",
-                 my_id.id, team, local_leader_unit_id.id);
-
-  size_t num_leaders;
-  DART_ASSERT_RETURNS(
-    dart_group_size(leader_group, &num_leaders),
-    DART_OK);
-  DART_LOG_TRACE("dart__base__host_topology__init: num_leaders:%zu",
-                 num_leaders);
-
-  if (num_leaders > 1) {
-    DART_LOG_TRACE("dart__base__host_topology__init: create leader team");
-    DART_ASSERT_RETURNS(
-      dart_team_create(team, leader_group, &leader_team),
-      DART_OK);
-    DART_LOG_TRACE("dart__base__host_topology__init: leader team: %d",
-                   leader_team);
-  } else {
-    leader_team = team;
-  }
-
-  DART_ASSERT_RETURNS(
-    dart_group_destroy(&leader_group),
-    DART_OK);
-
-  if (my_id.id == local_leader_unit_id.id) {
-    dart_module_location_t * module_locations = NULL;
-    dart_team_unit_t my_leader_id;
-    DART_ASSERT_RETURNS(
-      dart_team_myid(leader_team, &my_leader_id),
-      DART_OK);
-    DART_LOG_TRACE("dart__base__host_topology__init: "
-                   "num_leaders:%zu my_leader_id:%d (in team %d)",
-                   num_leaders, my_leader_id.id, leader_team);
-
-    /* local module locations to send: */
-    int max_node_modules  = 2;
-    int num_local_modules = 0;
-    dart_module_location_t * local_module_locations;
-    DART_ASSERT_RETURNS(
-      dart__base__host_topology__module_locations(
-        &local_module_locations, &num_local_modules),
-      DART_OK);
-    /* Number of bytes to receive from each leader unit in allgatherv: */
-    size_t * recvcounts      = calloc(num_leaders, sizeof(size_t));
-    /* Displacement at which to place data received from each leader:  */
-    size_t * displs          = calloc(num_leaders, sizeof(size_t));
-    recvcounts[my_leader_id.id] = num_local_modules *
-                                 sizeof(dart_module_location_t);
-    /*
-     * Allgather of leaders is only required if there is more than
-     * one leader unit.
-     */
-    if (num_leaders > 1) {
-      /* all module locations to receive: */
-      module_locations = malloc(sizeof(dart_module_location_t) *
-                                max_node_modules * num_leaders);
-      DART_ASSERT_RETURNS(
-        dart_allgather(
-          NULL,
-          recvcounts,
-          1,
-          DART_TYPE_SIZET,
-          leader_team),
-        DART_OK);
-
-      displs[0] = 0;
-      for (size_t lu = 1; lu < num_leaders; lu++) {
-        DART_LOG_TRACE("dart__base__host_topology__init: "
-                       "allgather: leader unit %zu sent %zu",
-                       lu, recvcounts[lu]);
-        displs[lu] = displs[lu-1] + recvcounts[lu];
-      }
-
-      DART_ASSERT_RETURNS(
-        dart_allgatherv(
-          local_module_locations,
-          recvcounts[my_leader_id.id],
-          DART_TYPE_BYTE,
-          module_locations,
-          recvcounts,
-          displs,
-          leader_team),
-        DART_OK);
-
-      DART_LOG_DEBUG("dart__base__host_topology__init: "
-                     "free(local_module_locations)");
-      free(local_module_locations);
-    } else {
-      module_locations = local_module_locations;
-    }
-
-    topo->num_nodes       = topo->num_hosts;
-    topo->num_host_levels = 0;
-    for (size_t lu = 0; lu < num_leaders; lu++) {
-      /* Number of modules received from leader unit lu: */
-      size_t lu_num_modules = recvcounts[lu] /
-                              sizeof(dart_module_location_t);
-      for (size_t m = 0; m < lu_num_modules; m++) {
-        int m_displ = displs[lu] / sizeof(dart_module_location_t);
-        dart_module_location_t * module_loc =
-          &module_locations[m_displ + m];
-#ifdef DART_ENABLE_LOGGING
-        dart_team_unit_t   luid = {lu};
-        dart_global_unit_t gu;
-        DART_ASSERT_RETURNS(
-          dart_team_unit_l2g(leader_team, luid, &gu),
-          DART_OK);
-        DART_LOG_TRACE("dart__base__host_topology__init: "
-                       "leader unit id: %d (global unit id: %d) "
-                       "module_location { "
-                       "host:%s module:%s scope:%d rel.idx:%d } "
-                       "num_hosts:%d",
-                       luid.id, gu.id, module_loc->host, module_loc->module,
-                       module_loc->pos.scope, module_loc->pos.index,
-                       num_hosts);
-#endif // DART_ENABLE_LOGGING
-        for (int h = 0; h < num_hosts; ++h) {
-          dart_host_domain_t * host_domain = &topo->host_domains[h];
-          if (strncmp(host_domain->host, module_loc->module,
-                      DART_LOCALITY_HOST_MAX_SIZE)
-              == 0) {
-            DART_LOG_TRACE("dart__base__host_topology__init: "
-                           "setting parent of %s to %s",
-                           host_domain->host, module_loc->host);
-            /* Classify host as module: */
-            strncpy(host_domain->parent, module_loc->host,
-                    DART_LOCALITY_HOST_MAX_SIZE);
-            host_domain->scope_pos = module_loc->pos;
-            host_domain->level = 1;
-            if (topo->num_host_levels < host_domain->level) {
-              topo->num_host_levels = host_domain->level;
-            }
-            break;
-          }
-        }
-      }
-    }
-    if (num_leaders > 1) {
-      dart_barrier(leader_team);
-    }
-
-    DART_LOG_DEBUG("dart__base__host_topology__init: "
-                   "free(module_locations)");
-    free(module_locations);
-
-    DART_LOG_DEBUG("dart__base__host_topology__init: "
-                   "free(displs)");
-    free(displs);
-
-    DART_LOG_DEBUG("dart__base__host_topology__init: "
-                   "free(recvcounts)");
-    free(recvcounts);
-
-    if (num_leaders > 1) {
-      DART_LOG_TRACE("dart__base__host_topology__init: finalize leader team");
-      DART_ASSERT_RETURNS(
-        dart_team_destroy(&leader_team),
-        DART_OK);
-    }
-  }
-  dart_barrier(team);
+  int num_hosts = topo->num_hosts;
 
   /*
-   * Broadcast updated host topology data from leader to all units at
-   * local node:
+   * Module locations like Xeon Phi hostnames and their associated NUMA
+   * domain in their parent node have been resolved by one leader unit
+   * per node and exchanged between leaders on initialization, so no
+   * communication is required here.
    */
-  if (DART_UNDEFINED_UNIT_ID != local_leader_unit_id.id) {
-    dart_team_t      local_team; 
-    dart_team_unit_t host_topo_bcast_root = local_leader_unit_id;
-    dart_team_t      host_topo_bcast_team = team;
-    if (num_hosts > 1) {
-      DART_LOG_TRACE("dart__base__host_topology__init: create local team");
-      DART_ASSERT_RETURNS(
-        dart_team_create(team, local_group, &local_team),
-        DART_OK);
-      /* Leader unit ID local team is always 0: */
-      host_topo_bcast_team    = local_team;
-      host_topo_bcast_root.id = 0;
-    }
-
+  for (int m = 0; m < num_modules; m++) {
+    const dart_module_location_t * module_loc = &module_locations[m];
     DART_LOG_TRACE("dart__base__host_topology__init: "
-                   "broadcasting module locations from leader unit %d "
-                   "to units in team %d",
-                   local_leader_unit_id.id, host_topo_bcast_team);
-
-    DART_ASSERT_RETURNS(
-      dart_bcast(
-        topo->host_domains,
-        sizeof(dart_host_domain_t) * num_hosts,
-        DART_TYPE_BYTE,
-        host_topo_bcast_root,
-        host_topo_bcast_team),
-      DART_OK);
-
-    if (num_hosts > 1) {
-      DART_LOG_TRACE("dart__base__host_topology__init: finalize local team");
-      DART_ASSERT_RETURNS(
-        dart_team_destroy(&local_team),
-        DART_OK);
-    }
-
-    DART_LOG_TRACE("dart__base__host_topology__init: updated host topology:");
-    topo->num_nodes = num_hosts;
+                   "module_location { "
+                   "host:%s module:%s scope:%d rel.idx:%d } ",
+                   module_loc->host, module_loc->module,
+                   module_loc->pos.scope, module_loc->pos.index);
     for (int h = 0; h < num_hosts; ++h) {
-      /* Get unit ids at local unit's host */
-      dart_host_domain_t * hdom = &topo->host_domains[h];
-      if (hdom->level > 0) {
-        topo->num_nodes--;
+      dart_host_domain_t * host_domain = &topo->host_domains[h];
+      if (strncmp(host_domain->host, module_loc->module,
+                  DART_LOCALITY_HOST_MAX_SIZE)
+          == 0) {
+        DART_LOG_TRACE("dart__base__host_topology__init: "
+                       "setting scope position of module %s in %s",
+                       host_domain->host, module_loc->host);
+        host_domain->scope_pos = module_loc->pos;
+        break;
       }
-      DART_LOG_TRACE("dart__base__host_topology__init: "
-                     "host[%d]: (host:%s parent:%s level:%d, scope_pos:"
-                     "(scope:%d rel.idx:%d))",
-                     h, hdom->host, hdom->parent, hdom->level,
-                     hdom->scope_pos.scope, hdom->scope_pos.index);
     }
   }
 
-
-  DART_ASSERT_RETURNS(
-    dart_group_destroy(&local_group),
-    DART_OK);
-
 #if 1
   /* Classify hostnames into categories 'node' and 'module'.
    * Typically, modules have the hostname of their nodes as prefix in their
@@ -538,8 +249,10 @@ static dart_ret_t dart__base__host_topology__update_module_locations(
  * ===================================================================== */
 
 dart_ret_t dart__base__host_topology__create(
-  dart_unit_mapping_t   * unit_mapping,
-  dart_host_topology_t ** host_topology)
+  dart_unit_mapping_t          * unit_mapping,
+  const dart_module_location_t * module_locations,
+  int                            num_modules,
+  dart_host_topology_t        ** host_topology)
 {
   *host_topology   = NULL;
   dart_team_t team = unit_mapping->team;
@@ -697,7 +410,7 @@ dart_ret_t dart__base__host_topology__create(
 
   DART_ASSERT_RETURNS(
     dart__base__host_topology__update_module_locations(
-      unit_mapping, topo),
+      topo, module_locations, num_modules),
     DART_OK);
 
 #if 0
@@ -179,6 +179,61 @@ dart_ret_t dart__base__unit_locality__destruct(
   return DART_OK;
 }
 
+/**
+ * Derive the locality information of units in the specified team from
+ * the unit mapping of a parent team containing all units of the team,
+ * typically \c DART_TEAM_ALL.
+ *
+ * \note
+ * Local operation, no locality information is exchanged.
+ */
+dart_ret_t dart__base__unit_locality__derive(
+  const dart_unit_mapping_t  * parent_mapping,
+  dart_team_t                  team,
+  dart_unit_mapping_t       ** unit_mapping)
+{
+  size_t nunits = 0;
+  *unit_mapping = NULL;
+  DART_LOG_DEBUG("dart__base__unit_locality__derive() "
+                 "parent team: %d team: %d", parent_mapping->team, team);
+
+  DART_ASSERT_RETURNS(dart_team_size(team, &nunits), DART_OK);
+
+  dart_unit_mapping_t * mapping = malloc(sizeof(dart_unit_mapping_t));
+  mapping->num_units            = nunits;
+  mapping->team                 = team;
+  mapping->unit_localities      = (dart_unit_locality_t *)(
+                                    malloc(nunits *
+                                           sizeof(dart_unit_locality_t)));
+  for (size_t u = 0; u < nunits; ++u) {
+    dart_team_unit_t   luid = { u };
+    dart_global_unit_t guid;
+    dart_team_unit_t   parent_uid;
+    DART_ASSERT_RETURNS(dart_team_unit_l2g(team, luid, &guid), DART_OK);
+    DART_ASSERT_RETURNS(
+      dart_team_unit_g2l(parent_mapping->team, guid, &parent_uid),
+      DART_OK);
+    if (parent_uid.id < 0 ||
+        (size_t)(parent_uid.id) >= parent_mapping->num_units) {
+      DART_LOG_ERROR("dart__base__unit_locality__derive ! "
+                     "unit %d not in parent team %d",
+                     guid.id, parent_mapping->team);
+      dart__base__unit_locality__destruct(mapping);
+      return DART_ERR_INVAL;
+    }
+    dart_unit_locality_t * uloc = &mapping->unit_localities[u];
+    *uloc = parent_mapping->unit_localities[parent_uid.id];
+    /* Domain tags are assigned in the team's domain hierarchy: */
+    uloc->unit          = luid;
+    uloc->team          = team;
+    uloc->domain_tag[0] = '\0';
+  }
+  *unit_mapping = mapping;
+
+  DART_LOG_DEBUG("dart__base__unit_locality__derive >");
+  return DART_OK;
+}
+
 /* ======================================================================== *
  * Lookup                                                                   *
  * ======================================================================== */
@@ -231,14 +286,6 @@ dart_ret_t dart__base__unit_locality__local_unit_new(
   dart_hwinfo_t hwinfo;
   DART_ASSERT_RETURNS(dart_hwinfo(&hwinfo), DART_OK);
 
-#if 1 || __TODO__CLARIFY__
-  /* Is this call required? */
-  dart_domain_locality_t * tloc;
-  DART_ASSERT_RETURNS(
-    dart_domain_team_locality(team, ".", &tloc),
-    DART_OK);
-#endif
-
   uloc->unit   = myid;
   uloc->team   = team;
   uloc->hwinfo = hwinfo;
@@ -16,6 +16,7 @@
 #include <dash/dart/base/logging.h>
 #include <dash/dart/base/assert.h>
 #include <dash/dart/base/hwinfo.h>
+#include <dash/dart/base/mutex.h>
 
 #include <dash/dart/base/internal/host_topology.h>
 #include <dash/dart/base/internal/unit_locality.h>
@@ -31,16 +32,27 @@
  * Private Data                                                           *
  * ====================================================================== */
 
-#define DART__BASE__LOCALITY__MAX_TEAM_DOMAINS 32
+/* Locality data is indexed by team ID, tables grow on demand as team IDs
+ * are not reused: */
+#define DART__BASE__LOCALITY__INIT_TEAM_DOMAINS 32
 
-static dart_host_topology_t *
-dart__base__locality__host_topology_[DART__BASE__LOCALITY__MAX_TEAM_DOMAINS];
+static int dart__base__locality__num_teams_ = 0;
 
-static dart_unit_mapping_t *
-dart__base__locality__unit_mapping_[DART__BASE__LOCALITY__MAX_TEAM_DOMAINS];
+static dart_host_topology_t   ** dart__base__locality__host_topology_ = NULL;
 
-static dart_domain_locality_t *
-dart__base__locality__global_domain_[DART__BASE__LOCALITY__MAX_TEAM_DOMAINS];
+static dart_unit_mapping_t    ** dart__base__locality__unit_mapping_  = NULL;
+
+static dart_domain_locality_t ** dart__base__locality__global_domain_ = NULL;
+
+/* Whether locality data of a team is available, data is created lazily
+ * on first query: */
+static int                     * dart__base__locality__registered_    = NULL;
+
+/* Locations of modules in all nodes, resolved on initialization: */
+static dart_module_location_t * dart__base__locality__modules_     = NULL;
+static int                      dart__base__locality__num_modules_ = 0;
+
+static dart_mutex_t dart__base__locality__mutex_;
 
 /* ====================================================================== *
  * Private Functions                                                      *
@@ -63,25 +75,99 @@ dart_ret_t dart__base__locality__group_subdomains(
   int                              num_group_subdomain_tags,
   char                           * group_domain_tag_out);
 
+/**
+ * Grow the tables of locality data to the given number of teams.
+ */
+static dart_ret_t dart__base__locality__grow(
+  int num_teams)
+{
+  dart_host_topology_t   ** host_topology = realloc(
+                               dart__base__locality__host_topology_,
+                               num_teams * sizeof(dart_host_topology_t *));
+  if (NULL != host_topology) {
+    dart__base__locality__host_topology_ = host_topology;
+  }
+  dart_unit_mapping_t    ** unit_mapping  = realloc(
+                               dart__base__locality__unit_mapping_,
+                               num_teams * sizeof(dart_unit_mapping_t *));
+  if (NULL != unit_mapping) {
+    dart__base__locality__unit_mapping_ = unit_mapping;
+  }
+  dart_domain_locality_t ** global_domain = realloc(
+                               dart__base__locality__global_domain_,
+                               num_teams * sizeof(dart_domain_locality_t *));
+  if (NULL != global_domain) {
+    dart__base__locality__global_domain_ = global_domain;
+  }
+  int                     * registered    = realloc(
+                               dart__base__locality__registered_,
+                               num_teams * sizeof(int));
+  if (NULL != registered) {
+    dart__base__locality__registered_ = registered;
+  }
+  if (NULL == host_topology || NULL == unit_mapping ||
+      NULL == global_domain || NULL == registered) {
+    DART_LOG_ERROR("dart__base__locality__grow ! "
+                   "failed to allocate locality data of %d teams",
+                   num_teams);
+    return DART_ERR_OTHER;
+  }
+  for (int td = dart__base__locality__num_teams_; td < num_teams; ++td) {
+    dart__base__locality__global_domain_[td] = NULL;
+    dart__base__locality__host_topology_[td] = NULL;
+    dart__base__locality__unit_mapping_[td]  = NULL;
+    dart__base__locality__registered_[td]    = 0;
+  }
+  dart__base__locality__num_teams_ = num_teams;
+  return DART_OK;
+}
+
 /* ====================================================================== *
  * Init / Finalize                                                        *
  * ====================================================================== */
 
-dart_ret_t dart__base__locality__init()
+dart_ret_t dart__base__locality__init(
+  dart_unit_mapping_t    * unit_mapping,
+  dart_module_location_t * module_locations,
+  int                      num_modules)
 {
-  for (int td = 0; td < DART__BASE__LOCALITY__MAX_TEAM_DOMAINS; ++td) {
-    dart__base__locality__global_domain_[td] = NULL;
-    dart__base__locality__host_topology_[td] = NULL;
-    dart__base__locality__unit_mapping_[td]  = NULL;
+  DART_ASSERT_RETURNS(
+    dart__base__locality__grow(DART__BASE__LOCALITY__INIT_TEAM_DOMAINS),
+    DART_OK);
+  dart_mutex_init(&dart__base__locality__mutex_);
+
+  if (NULL == unit_mapping) {
+    /* Exchange unit locality information between all units:
+     */
+    DART_ASSERT_RETURNS(
+      dart__base__unit_locality__create(DART_TEAM_ALL, &unit_mapping),
+      DART_OK);
   }
+  dart__base__locality__unit_mapping_[DART_TEAM_ALL] = unit_mapping;
+  dart__base__locality__modules_                     = module_locations;
+  dart__base__locality__num_modules_                 = num_modules;
+
   return dart__base__locality__create(DART_TEAM_ALL);
 }
 
 dart_ret_t dart__base__locality__finalize()
 {
-  for (dart_team_t t = 0; t < DART__BASE__LOCALITY__MAX_TEAM_DOMAINS; ++t) {
+  for (dart_team_t t = 0; t < dart__base__locality__num_teams_; ++t) {
     dart__base__locality__delete(t);
   }
+  free(dart__base__locality__host_topology_);
+  free(dart__base__locality__unit_mapping_);
+  free(dart__base__locality__global_domain_);
+  free(dart__base__locality__registered_);
+  dart__base__locality__host_topology_ = NULL;
+  dart__base__locality__unit_mapping_  = NULL;
+  dart__base__locality__global_domain_ = NULL;
+  dart__base__locality__registered_    = NULL;
+  dart__base__locality__num_teams_     = 0;
+  free(dart__base__locality__modules_);
+  dart__base__locality__modules_     = NULL;
+  dart__base__locality__num_modules_ = 0;
+  dart_mutex_destroy(&dart__base__locality__mutex_);
 
   dart_barrier(DART_TEAM_ALL);
   return DART_OK;
@@ -92,48 +178,85 @@ dart_ret_t dart__base__locality__finalize()
  * ====================================================================== */
 
 /**
- * Exchange and collect locality information of all units in the specified
- * team.
- *
- * The team's unit locality information is stored in private array
- * \c dart__base__locality__unit_mapping_[team] with a capacity for
- * \c DART__BASE__LOCALITY__MAX_TEAM_DOMAINS teams.
- *
- * Outline of the locality initialization procedure:
- *
- * 1. All units collect their local hardware locality information
- *    -> dart_hwinfo_t
- *
- * 2. All-to-all exchange of hardware locality data
- *    -> dart_unit_mapping_t { unit, team, hwinfo, domain }
- *
- * 3. Construct host topology from unit mapping data
- *    -> dart_host_topology_t
+ * Register the specified team for locality queries.
  *
- * 4. Initialize locality domain hierarchy from unit mapping data and
- *    host topology
- *    -> dart_domain_locality_t
+ * Locality data of the team is created lazily on first query, see
+ * \c dart__base__locality__team_data. Locality information of units has
+ * been exchanged on initialization for all units, so no collective
+ * operations are required to create locality data of teams.
  */
 dart_ret_t dart__base__locality__create(
   dart_team_t team)
 {
   DART_LOG_DEBUG("dart__base__locality__create() team(%d)", team);
 
+  if (team < 0) {
+    DART_LOG_ERROR("dart__base__locality__create ! "
+                   "invalid team id %d", team);
+    return DART_ERR_INVAL;
+  }
+  /* Queries of other teams must not access the tables while they are
+   * reallocated: */
+  dart_mutex_lock(&dart__base__locality__mutex_);
+  if (team >= dart__base__locality__num_teams_) {
+    int num_teams = 2 * dart__base__locality__num_teams_;
+    if (num_teams <= team) {
+      num_teams = team + 1;
+    }
+    dart_ret_t ret = dart__base__locality__grow(num_teams);
+    if (ret != DART_OK) {
+      dart_mutex_unlock(&dart__base__locality__mutex_);
+      return ret;
+    }
+  }
+
   /*
    * TODO: Clarify if returning would be sufficient instead of failing
    *       assertion.
    */
   DART_ASSERT_MSG(
-    (NULL == dart__base__locality__unit_mapping_[team]  &&
+    (0    == dart__base__locality__registered_[team]     &&
      NULL == dart__base__locality__global_domain_[team] &&
      NULL == dart__base__locality__host_topology_[team]),
     "dash__base__locality__create(): "
     "locality data of team is already initialized");
 
+  dart__base__locality__registered_[team] = 1;
+  dart_mutex_unlock(&dart__base__locality__mutex_);
+
+  DART_LOG_DEBUG("dart__base__locality__create >");
+  return DART_OK;
+}
+
+/**
+ * Create locality data of the specified team.
+ *
+ * Outline of the locality initialization procedure:
+ *
+ * 1. Locality information of all units has been collected on
+ *    initialization
+ *    -> dart_unit_mapping_t { unit, team, hwinfo, domain } of
+ *       DART_TEAM_ALL
+ *
+ * 2. Derive unit mapping of the team from the unit mapping of
+ *    DART_TEAM_ALL
+ *
+ * 3. Construct host topology from unit mapping data
+ *    -> dart_host_topology_t
+ *
+ * 4. Initialize locality domain hierarchy from unit mapping data and
+ *    host topology
+ *    -> dart_domain_locality_t
+ *
+ * Local operation, the locality mutex must be held by the caller.
+ */
+static void dart__base__locality__team_data_create(
+  dart_team_t team)
+{
+  DART_LOG_DEBUG("dart__base__locality__team_data_create() team(%d)", team);
+
   dart_domain_locality_t * team_global_domain =
     malloc(sizeof(dart_domain_locality_t));
-  dart__base__locality__global_domain_[team] =
-    team_global_domain;
 
   /* Initialize the global domain as the root entry in the locality
    * hierarchy:
@@ -161,23 +284,32 @@ dart_ret_t dart__base__locality__create(
       DART_OK);
   }
 
-  /* Exchange unit locality information between all units:
+  /* Derive unit locality information from locality information of all
+   * units:
    */
-  dart_unit_mapping_t * unit_mapping;
-  DART_ASSERT_RETURNS(
-    dart__base__unit_locality__create(team, &unit_mapping),
-    DART_OK);
-  dart__base__locality__unit_mapping_[team] = unit_mapping;
+  if (NULL == dart__base__locality__unit_mapping_[team]) {
+    dart_unit_mapping_t * unit_mapping;
+    DART_ASSERT_RETURNS(
+      dart__base__unit_locality__derive(
+        dart__base__locality__unit_mapping_[DART_TEAM_ALL], team,
+        &unit_mapping),
+      DART_OK);
+    dart__base__locality__unit_mapping_[team] = unit_mapping;
+  }
 
   /* Resolve host topology from the unit's host names:
    */
   dart_host_topology_t * topo;
   DART_ASSERT_RETURNS(
-    dart__base__host_topology__create(unit_mapping, &topo),
+    dart__base__host_topology__create(
+      dart__base__locality__unit_mapping_[team],
+      dart__base__locality__modules_,
+      dart__base__locality__num_modules_,
+      &topo),
     DART_OK);
   dart__base__locality__host_topology_[team] = topo;
   size_t num_nodes = topo->num_nodes;
-  DART_LOG_TRACE("dart__base__locality__create: nodes: %ld", num_nodes);
+  DART_LOG_TRACE("dart__base__locality__team_data_create: nodes: %ld", num_nodes);
 
   team_global_domain->num_nodes = num_nodes;
 
@@ -186,39 +318,78 @@ dart_ret_t dart__base__locality__create(
     dart_host_units_t  * node_units  = &topo->host_units[h];
     dart_host_domain_t * node_domain = &topo->host_domains[h];
     char * hostname = topo->host_names[h];
-    DART_LOG_TRACE("dart__base__locality__create: "
+    DART_LOG_TRACE("dart__base__locality__team_data_create: "
                    "host %s: units:%d level:%d parent:%s", hostname,
                    node_units->num_units,
                    node_domain->level, node_domain->parent);
     for (int u = 0; u < node_units->num_units; ++u) {
-      DART_LOG_TRACE("dart__base__locality__create: %s unit[%d]: %d",
+      DART_LOG_TRACE("dart__base__locality__team_data_create: %s unit[%d]: %d",
                      hostname, u, node_units->units[u].id);
     }
   }
 #endif
 
-  DART_LOG_DEBUG("dart__base__locality__create: "
+  DART_LOG_DEBUG("dart__base__locality__team_data_create: "
                  "constructing domain hierarchy");
   /* Recursively create locality information of the global domain's
    * sub-domains:
    */
   DART_ASSERT_RETURNS(
     dart__base__locality__domain__create_subdomains(
-      dart__base__locality__global_domain_[team],
+      team_global_domain,
       dart__base__locality__host_topology_[team],
       dart__base__locality__unit_mapping_[team]),
     DART_OK);
 
-  DART_LOG_DEBUG("dart__base__locality__create >");
+  dart__base__locality__global_domain_[team] = team_global_domain;
+
+  DART_LOG_DEBUG("dart__base__locality__team_data_create >");
+}
+
+/**
+ * Locality data of the specified team, created on first query.
+ *
+ * The tables of locality data are reallocated when teams are created
+ * concurrently, so they are only accessed while holding the locality
+ * mutex. Locality data referenced by the tables remains valid until the
+ * team is deleted.
+ *
+ * Local operation.
+ */
+static dart_ret_t dart__base__locality__team_data(
+  dart_team_t                team,
+  dart_domain_locality_t  ** global_domain_out,
+  dart_unit_mapping_t     ** unit_mapping_out)
+{
+  dart_mutex_lock(&dart__base__locality__mutex_);
+  if (team < 0 || team >= dart__base__locality__num_teams_ ||
+      !dart__base__locality__registered_[team]) {
+    dart_mutex_unlock(&dart__base__locality__mutex_);
+    DART_LOG_ERROR("dart__base__locality__team_data ! "
+                   "no locality data for team %d", team);
+    return DART_ERR_NOTFOUND;
+  }
+  if (NULL == dart__base__locality__global_domain_[team]) {
+    dart__base__locality__team_data_create(team);
+  }
+  *global_domain_out = dart__base__locality__global_domain_[team];
+  *unit_mapping_out  = dart__base__locality__unit_mapping_[team];
+  dart_mutex_unlock(&dart__base__locality__mutex_);
   return DART_OK;
 }
 
-dart_ret_t dart__base__locality__delete(
+/**
+ * Delete locality data of the specified team, the locality mutex must be
+ * held by the caller.
+ */
+static dart_ret_t dart__base__locality__delete_data(
   dart_team_t team)
 {
   dart_ret_t ret = DART_OK;
 
-  DART_LOG_DEBUG("dart__base__locality__delete() team(%d)", team);
+  if (team < 0 || team >= dart__base__locality__num_teams_) {
+    return DART_OK;
+  }
 
   if (NULL != dart__base__locality__global_domain_[team]) {
     ret = dart__base__locality__domain__destruct(
@@ -261,10 +432,23 @@ dart_ret_t dart__base__locality__delete(
     dart__base__locality__unit_mapping_[team] = NULL;
   }
 
-  DART_LOG_DEBUG("dart__base__locality__delete > team(%d)", team);
+  dart__base__locality__registered_[team] = 0;
   return DART_OK;
 }
 
+dart_ret_t dart__base__locality__delete(
+  dart_team_t team)
+{
+  DART_LOG_DEBUG("dart__base__locality__delete() team(%d)", team);
+
+  dart_mutex_lock(&dart__base__locality__mutex_);
+  dart_ret_t ret = dart__base__locality__delete_data(team);
+  dart_mutex_unlock(&dart__base__locality__mutex_);
+
+  DART_LOG_DEBUG("dart__base__locality__delete > team(%d)", team);
+  return ret;
+}
+
 /* ====================================================================== *
  * Domain Locality                                                        *
  * ====================================================================== */
@@ -277,8 +461,12 @@ dart_ret_t dart__base__locality__team_domain(
   dart_ret_t ret = DART_ERR_NOTFOUND;
 
   *domain_out = NULL;
-  dart_domain_locality_t * domain =
-    dart__base__locality__global_domain_[team];
+  dart_domain_locality_t * domain;
+  dart_unit_mapping_t    * unit_mapping;
+  ret = dart__base__locality__team_data(team, &domain, &unit_mapping);
+  if (ret != DART_OK) {
+    return ret;
+  }
 
   ret = dart__base__locality__domain(domain, ".", domain_out);
 
@@ -730,10 +918,16 @@ dart_ret_t dart__base__locality__unit(
                  team, unit.id);
   *locality = NULL;
 
+  /* Domain tags of units are assigned in the team's domain hierarchy: */
+  dart_domain_locality_t * domain;
+  dart_unit_mapping_t    * unit_mapping;
+  dart_ret_t ret = dart__base__locality__team_data(
+                     team, &domain, &unit_mapping);
+  if (ret != DART_OK) {
+    return ret;
+  }
   dart_unit_locality_t * uloc;
-  dart_ret_t ret = dart__base__unit_locality__at(
-                     dart__base__locality__unit_mapping_[team], unit,
-                     &uloc);
+  ret = dart__base__unit_locality__at(unit_mapping, unit, &uloc);
   if (ret != DART_OK) {
     DART_LOG_ERROR("dart_unit_locality: "
                    "dart__base__locality__unit(team:%d unit:%d) "
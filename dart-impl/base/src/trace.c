@@ -0,0 +1,418 @@
+/**
+ * \file dart/base/trace.c
+ *
+ * Every thread records into its own buffers: counters of all operation
+ * kinds and target units, message size histograms and a ring buffer of
+ * events. Buffers are allocated on the first recording of a thread and
+ * registered in a list, which is only traversed to query or export the
+ * recorded data.
+ */
+#include <dash/dart/base/config.h>
+#if defined(DART__PLATFORM__LINUX) && !defined(_GNU_SOURCE)
+#  define _GNU_SOURCE
+#endif
+#include <dash/dart/base/trace.h>
+#include <dash/dart/base/mutex.h>
+#include <dash/dart/base/logging.h>
+
+#include <dash/dart/if/dart_types.h>
+#include <dash/dart/if/dart_trace.h>
+
+#include <inttypes.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <strings.h>
+#include <time.h>
+
+#ifdef DART_ENABLE_THREADING
+#define DART__BASE__TRACE__THREAD_LOCAL __thread
+#else
+#define DART__BASE__TRACE__THREAD_LOCAL
+#endif
+
+#define DART__BASE__TRACE__FILE_MAGIC       0x3230435254524144ULL
+#define DART__BASE__TRACE__DEFAULT_CAPACITY (1 << 16)
+
+typedef struct dart__base__trace__thread_s
+{
+  /// Counters of all operation kinds and target units, indexed by
+  /// op * (nunits + 1) + target + 1
+  dart_trace_counter_t                * counters;
+  /// Message size histograms, indexed by op * DART_TRACE_HISTOGRAM_BINS
+  uint64_t                            * histograms;
+  /// Ring buffer of events, allocated on the first recorded event
+  dart_trace_event_t                  * events;
+  /// Number of events recorded, the last \c capacity are buffered
+  uint64_t                              num_events;
+  uint16_t                              index;
+  struct dart__base__trace__thread_s  * next;
+} dart__base__trace__thread_t;
+
+dart_trace_level_t dart__base__trace__level_ = DART_TRACE_OFF;
+
+static dart_global_unit_t             dart__base__trace__myid_;
+static size_t                         dart__base__trace__nunits_     = 0;
+/// Capacity of event ring buffers, a power of two
+static uint64_t                       dart__base__trace__capacity_   =
+                                        DART__BASE__TRACE__DEFAULT_CAPACITY;
+static char                         * dart__base__trace__filename_   = NULL;
+static struct timespec                dart__base__trace__t0_;
+static dart__base__trace__thread_t  * dart__base__trace__threads_    = NULL;
+static int                            dart__base__trace__num_threads_ = 0;
+/// Incremented in finalize to invalidate buffers of threads
+static unsigned                       dart__base__trace__epoch_      = 1;
+static dart_mutex_t                   dart__base__trace__mutex_;
+
+static DART__BASE__TRACE__THREAD_LOCAL
+  dart__base__trace__thread_t       * dart__base__trace__thread_     = NULL;
+static DART__BASE__TRACE__THREAD_LOCAL
+  unsigned                            dart__base__trace__thread_epoch_ = 0;
+
+/* ======================================================================== *
+ * Private Functions                                                        *
+ * ======================================================================== */
+
+static inline size_t dart__base__trace__num_counters()
+{
+  return DART_TRACE_OP_COUNT * (dart__base__trace__nunits_ + 1);
+}
+
+static inline int dart__base__trace__histogram_bin(
+  uint64_t nbytes)
+{
+  int bin = 0;
+  while (nbytes > 0 && bin < DART_TRACE_HISTOGRAM_BINS - 1) {
+    nbytes >>= 1;
+    ++bin;
+  }
+  return bin;
+}
+
+/**
+ * Buffers of the calling thread, allocated and registered on first use.
+ */
+static dart__base__trace__thread_t * dart__base__trace__thread_data()
+{
+  if (dart__base__trace__thread_ != NULL &&
+      dart__base__trace__thread_epoch_ == dart__base__trace__epoch_) {
+    return dart__base__trace__thread_;
+  }
+  dart__base__trace__thread_t * thread =
+    calloc(1, sizeof(dart__base__trace__thread_t));
+  thread->counters   = calloc(dart__base__trace__num_counters(),
+                              sizeof(dart_trace_counter_t));
+  thread->histograms = calloc(DART_TRACE_OP_COUNT *
+                                DART_TRACE_HISTOGRAM_BINS,
+                              sizeof(uint64_t));
+  dart_mutex_lock(&dart__base__trace__mutex_);
+  if (dart__base__trace__num_threads_ == UINT16_MAX + 1) {
+    DART_LOG_ERROR("dart__base__trace__thread_data ! "
+                   "more than %d threads, thread indices are reused",
+                   UINT16_MAX + 1);
+  }
+  thread->index = (uint16_t)(dart__base__trace__num_threads_++);
+  thread->next  = dart__base__trace__threads_;
+  dart__base__trace__threads_ = thread;
+  dart_mutex_unlock(&dart__base__trace__mutex_);
+
+  dart__base__trace__thread_       = thread;
+  dart__base__trace__thread_epoch_ = dart__base__trace__epoch_;
+  return thread;
+}
+
+static void dart__base__trace__parse_env()
+{
+  const char * level_str = getenv("DART_TRACE");
+  if (level_str != NULL) {
+    if (strcasecmp(level_str, "events") == 0) {
+      dart__base__trace__level_ = DART_TRACE_EVENTS;
+    } else if (strcasecmp(level_str, "counters") == 0 ||
+               strcmp(level_str, "1") == 0) {
+      dart__base__trace__level_ = DART_TRACE_COUNTERS;
+    } else {
+      dart__base__trace__level_ = DART_TRACE_OFF;
+    }
+  }
+  const char * capacity_str = getenv("DART_TRACE_BUFFER");
+  if (capacity_str != NULL) {
+    long long capacity = atoll(capacity_str);
+    if (capacity > 0) {
+      /* Round up to power of two for masking of ring buffer indices: */
+      uint64_t pow2 = 1;
+      while (pow2 < (uint64_t)capacity) {
+        pow2 <<= 1;
+      }
+      dart__base__trace__capacity_ = pow2;
+    }
+  }
+  const char * filename = getenv("DART_TRACE_FILE");
+  if (filename != NULL && strlen(filename) > 0) {
+    dart__base__trace__filename_ = strdup(filename);
+  }
+}
+
+/* ======================================================================== *
+ * Init / Finalize                                                          *
+ * ======================================================================== */
+
+dart_ret_t dart__base__trace__init(
+  dart_global_unit_t   myid,
+  size_t               nunits)
+{
+  dart__base__trace__myid_   = myid;
+  dart__base__trace__nunits_ = nunits;
+  dart_mutex_init(&dart__base__trace__mutex_);
+  clock_gettime(CLOCK_MONOTONIC, &dart__base__trace__t0_);
+  dart__base__trace__parse_env();
+  DART_LOG_DEBUG("dart__base__trace__init: level:%d capacity:%"PRIu64,
+                 dart__base__trace__level_, dart__base__trace__capacity_);
+  return DART_OK;
+}
+
+dart_ret_t dart__base__trace__finalize()
+{
+  dart_ret_t ret = DART_OK;
+  if (dart__base__trace__filename_ != NULL) {
+    char filename[4096];
+    snprintf(filename, sizeof(filename), "%s.%d",
+             dart__base__trace__filename_, dart__base__trace__myid_.id);
+    ret = dart__base__trace__write(filename);
+    free(dart__base__trace__filename_);
+    dart__base__trace__filename_ = NULL;
+  }
+  dart__base__trace__level_ = DART_TRACE_OFF;
+
+  dart__base__trace__thread_t * thread = dart__base__trace__threads_;
+  while (thread != NULL) {
+    dart__base__trace__thread_t * next = thread->next;
+    free(thread->counters);
+    free(thread->histograms);
+    free(thread->events);
+    free(thread);
+    thread = next;
+  }
+  dart__base__trace__threads_     = NULL;
+  dart__base__trace__num_threads_ = 0;
+  dart__base__trace__epoch_++;
+  dart_mutex_destroy(&dart__base__trace__mutex_);
+  return ret;
+}
+
+/* ======================================================================== *
+ * Recording                                                                *
+ * ======================================================================== */
+
+uint64_t dart__base__trace__now()
+{
+  struct timespec ts;
+  clock_gettime(CLOCK_MONOTONIC, &ts);
+  return (uint64_t)(ts.tv_sec - dart__base__trace__t0_.tv_sec)
+           * 1000000000ULL
+         + (uint64_t)ts.tv_nsec
+         - (uint64_t)dart__base__trace__t0_.tv_nsec;
+}
+
+void dart__base__trace__record(
+  dart_trace_op_t      op,
+  int32_t              target,
+  uint64_t             nbytes,
+  int16_t              id,
+  uint64_t             begin)
+{
+  dart__base__trace__thread_t * thread = dart__base__trace__thread_data();
+
+  uint64_t end      = 0;
+  uint64_t duration = 0;
+  if (begin > 0 || dart__base__trace__level_ == DART_TRACE_EVENTS) {
+    end      = dart__base__trace__now();
+    duration = (begin > 0) ? end - begin : 0;
+  }
+  if (target < -1 || target >= (int32_t)dart__base__trace__nunits_) {
+    target = -1;
+  }
+  dart_trace_counter_t * counter =
+    &thread->counters[op * (dart__base__trace__nunits_ + 1) + target + 1];
+  counter->count++;
+  counter->nbytes  += nbytes;
+  counter->time_ns += duration;
+  thread->histograms[op * DART_TRACE_HISTOGRAM_BINS +
+                     dart__base__trace__histogram_bin(nbytes)]++;
+
+  if (dart__base__trace__level_ != DART_TRACE_EVENTS) {
+    return;
+  }
+  if (thread->events == NULL) {
+    /* Zero-initialized, padding of events is written to trace files: */
+    thread->events = calloc(dart__base__trace__capacity_,
+                            sizeof(dart_trace_event_t));
+  }
+  dart_trace_event_t * event =
+    &thread->events[thread->num_events & (dart__base__trace__capacity_ - 1)];
+  event->timestamp_ns = (begin > 0) ? begin : end;
+  event->duration_ns  = duration;
+  event->nbytes       = nbytes;
+  event->target       = target;
+  event->id           = id;
+  event->op           = (uint8_t)op;
+  event->thread       = thread->index;
+  thread->num_events++;
+}
+
+/* ======================================================================== *
+ * Queries                                                                  *
+ * ======================================================================== */
+
+dart_ret_t dart__base__trace__set_level(
+  dart_trace_level_t   level)
+{
+  if (level < DART_TRACE_OFF || level > DART_TRACE_EVENTS) {
+    return DART_ERR_INVAL;
+  }
+  dart__base__trace__level_ = level;
+  return DART_OK;
+}
+
+dart_ret_t dart__base__trace__counter(
+  dart_trace_op_t        op,
+  int32_t                target,
+  dart_trace_counter_t * counter)
+{
+  if (op < 0 || op >= DART_TRACE_OP_COUNT ||
+      target < -1 || target >= (int32_t)dart__base__trace__nunits_) {
+    return DART_ERR_INVAL;
+  }
+  size_t idx = op * (dart__base__trace__nunits_ + 1) + target + 1;
+  memset(counter, 0, sizeof(dart_trace_counter_t));
+  dart_mutex_lock(&dart__base__trace__mutex_);
+  for (dart__base__trace__thread_t * thread = dart__base__trace__threads_;
+       thread != NULL; thread = thread->next) {
+    counter->count   += thread->counters[idx].count;
+    counter->nbytes  += thread->counters[idx].nbytes;
+    counter->time_ns += thread->counters[idx].time_ns;
+  }
+  dart_mutex_unlock(&dart__base__trace__mutex_);
+  return DART_OK;
+}
+
+dart_ret_t dart__base__trace__histogram(
+  dart_trace_op_t        op,
+  uint64_t             * bins)
+{
+  if (op < 0 || op >= DART_TRACE_OP_COUNT) {
+    return DART_ERR_INVAL;
+  }
+  memset(bins, 0, DART_TRACE_HISTOGRAM_BINS * sizeof(uint64_t));
+  dart_mutex_lock(&dart__base__trace__mutex_);
+  for (dart__base__trace__thread_t * thread = dart__base__trace__threads_;
+       thread != NULL; thread = thread->next) {
+    for (int b = 0; b < DART_TRACE_HISTOGRAM_BINS; ++b) {
+      bins[b] += thread->histograms[op * DART_TRACE_HISTOGRAM_BINS + b];
+    }
+  }
+  dart_mutex_unlock(&dart__base__trace__mutex_);
+  return DART_OK;
+}
+
+dart_ret_t dart__base__trace__reset()
+{
+  dart_mutex_lock(&dart__base__trace__mutex_);
+  for (dart__base__trace__thread_t * thread = dart__base__trace__threads_;
+       thread != NULL; thread = thread->next) {
+    memset(thread->counters, 0,
+           dart__base__trace__num_counters() * sizeof(dart_trace_counter_t));
+    memset(thread->histograms, 0,
+           DART_TRACE_OP_COUNT * DART_TRACE_HISTOGRAM_BINS *
+             sizeof(uint64_t));
+    thread->num_events = 0;
+  }
+  dart_mutex_unlock(&dart__base__trace__mutex_);
+  return DART_OK;
+}
+
+/* ======================================================================== *
+ * Export                                                                   *
+ * ======================================================================== */
+
+dart_ret_t dart__base__trace__write(
+  const char           * filename)
+{
+  FILE * file = fopen(filename, "wb");
+  if (file == NULL) {
+    DART_LOG_ERROR("dart__base__trace__write ! could not open %s",
+                   filename);
+    return DART_ERR_OTHER;
+  }
+
+  dart_mutex_lock(&dart__base__trace__mutex_);
+
+  size_t                 num_counters = dart__base__trace__num_counters();
+  size_t                 num_bins     = DART_TRACE_OP_COUNT *
+                                          DART_TRACE_HISTOGRAM_BINS;
+  dart_trace_counter_t * counters     = calloc(num_counters,
+                                               sizeof(dart_trace_counter_t));
+  uint64_t             * histograms   = calloc(num_bins, sizeof(uint64_t));
+  uint64_t               num_events   = 0;
+  dart__base__trace__thread_t * thread;
+  for (thread = dart__base__trace__threads_; thread != NULL;
+       thread = thread->next) {
+    for (size_t c = 0; c < num_counters; ++c) {
+      counters[c].count   += thread->counters[c].count;
+      counters[c].nbytes  += thread->counters[c].nbytes;
+      counters[c].time_ns += thread->counters[c].time_ns;
+    }
+    for (size_t b = 0; b < num_bins; ++b) {
+      histograms[b] += thread->histograms[b];
+    }
+    if (thread->events != NULL) {
+      num_events += (thread->num_events < dart__base__trace__capacity_)
+                    ? thread->num_events
+                    : dart__base__trace__capacity_;
+    }
+  }
+
+  uint64_t header[6] = {
+    DART__BASE__TRACE__FILE_MAGIC,
+    (uint64_t)dart__base__trace__myid_.id,
+    (uint64_t)dart__base__trace__nunits_,
+    DART_TRACE_OP_COUNT,
+    DART_TRACE_HISTOGRAM_BINS,
+    num_events
+  };
+  int ok = 1;
+  ok &= fwrite(header, sizeof(uint64_t), 6, file) == 6;
+  ok &= fwrite(counters, sizeof(dart_trace_counter_t), num_counters, file)
+        == num_counters;
+  ok &= fwrite(histograms, sizeof(uint64_t), num_bins, file) == num_bins;
+  for (thread = dart__base__trace__threads_; thread != NULL;
+       thread = thread->next) {
+    if (thread->events == NULL) {
+      continue;
+    }
+    if (thread->num_events <= dart__base__trace__capacity_) {
+      ok &= fwrite(thread->events, sizeof(dart_trace_event_t),
+                   thread->num_events, file) == thread->num_events;
+      continue;
+    }
+    /* Ring buffer wrapped, oldest buffered event first: */
+    uint64_t first = thread->num_events & (dart__base__trace__capacity_ - 1);
+    uint64_t ntail = dart__base__trace__capacity_ - first;
+    ok &= fwrite(thread->events + first, sizeof(dart_trace_event_t),
+                 ntail, file) == ntail;
+    ok &= fwrite(thread->events, sizeof(dart_trace_event_t),
+                 first, file) == first;
+  }
+
+  dart_mutex_unlock(&dart__base__trace__mutex_);
+
+  free(counters);
+  free(histograms);
+  ok &= fclose(file) == 0;
+  if (!ok) {
+    DART_LOG_ERROR("dart__base__trace__write ! writing %s failed", filename);
+    return DART_ERR_OTHER;
+  }
+  DART_LOG_DEBUG("dart__base__trace__write > %s events:%"PRIu64,
+                 filename, num_events);
+  return DART_OK;
+}
@@ -20,6 +20,50 @@ struct dart_handle_struct
 	dart_unit_t dest;
 };
 
+/**
+ * Reduce operation created by \c dart_op_create.
+ */
+typedef struct
+{
+  dart_operator_t   op;
+  void            * userdata;
+  MPI_Op            mpi_op;
+  /** Duplicate of the operand type, identifies the operation in
+   *  invocations of \c mpi_op */
+  MPI_Datatype      mpi_dtype;
+  dart_datatype_t   dtype;
+} dart__mpi__user_op_t;
+
+/** Operations created by \c dart_op_create, indexed by
+ *  <tt>op - DART_OP_USER_BASE</tt>, see dart_types.c */
+extern dart__mpi__user_op_t * dart__mpi__user_ops;
+extern size_t                 dart__mpi__num_user_ops;
+
+/** Types created by \c dart_type_create_*, indexed by
+ *  <tt>dtype - DART_TYPE_USER_BASE</tt>, see dart_types.c */
+extern MPI_Datatype         * dart__mpi__user_types;
+extern size_t                 dart__mpi__num_user_types;
+
+/**
+ * The user-defined operation \c dart_op, or \c NULL if \c dart_op is
+ * not a valid user-defined operation.
+ */
+static inline dart__mpi__user_op_t * dart__mpi__user_op(
+  dart_operation_t dart_op)
+{
+  size_t idx = (size_t)dart_op - (size_t)DART_OP_USER_BASE;
+  if (dart_op < DART_OP_USER_BASE || idx >= dart__mpi__num_user_ops ||
+      dart__mpi__user_ops[idx].op == NULL) {
+    return NULL;
+  }
+  return &dart__mpi__user_ops[idx];
+}
+
+/**
+ * Release all operations and types not destroyed by the user.
+ */
+void dart__mpi__types_finalize();
+
 static inline MPI_Op dart_mpi_op(dart_operation_t dart_op) {
   switch (dart_op) {
     case DART_OP_MIN  : return MPI_MIN;
@@ -32,7 +76,10 @@ static inline MPI_Op dart_mpi_op(dart_operation_t dart_op) {
     case DART_OP_LOR  : return MPI_LOR;
     case DART_OP_BXOR : return MPI_BXOR;
     case DART_OP_LXOR : return MPI_LXOR;
-    default           : return (MPI_Op)(-1);
+    default           : {
+      dart__mpi__user_op_t * user_op = dart__mpi__user_op(dart_op);
+      return (user_op != NULL) ? user_op->mpi_op : (MPI_Op)(-1);
+    }
   }
 }
 
@@ -47,15 +94,43 @@ static inline MPI_Datatype dart_mpi_datatype(dart_datatype_t dart_datatype) {
     case DART_TYPE_LONGLONG : return MPI_LONG_LONG_INT;
     case DART_TYPE_FLOAT    : return MPI_FLOAT;
     case DART_TYPE_DOUBLE   : return MPI_DOUBLE;
-    default                 : return (MPI_Datatype)(-1);
+    default                 : {
+      size_t idx = (size_t)dart_datatype - (size_t)DART_TYPE_USER_BASE;
+      if (dart_datatype >= DART_TYPE_USER_BASE &&
+          idx < dart__mpi__num_user_types) {
+        return dart__mpi__user_types[idx];
+      }
+      return (MPI_Datatype)(-1);
+    }
   }
 }
 
+/**
+ * The MPI type of operands of reductions with operation \c dart_op:
+ * user-defined operations are applied to a duplicate of their operand
+ * type.
+ */
+static inline MPI_Datatype dart_mpi_op_datatype(
+  dart_operation_t dart_op,
+  dart_datatype_t  dart_datatype)
+{
+  dart__mpi__user_op_t * user_op = dart__mpi__user_op(dart_op);
+  if (user_op != NULL && user_op->dtype == dart_datatype) {
+    return user_op->mpi_dtype;
+  }
+  return dart_mpi_datatype(dart_datatype);
+}
+
+/**
+ * Size of a value of type \c dart_datatype in bytes, including padding
+ * of user-defined struct types.
+ */
 static inline int dart_mpi_sizeof_datatype(dart_datatype_t dart_datatype) {
-  int native_size;
-  if (MPI_Type_size(dart_mpi_datatype(dart_datatype), &native_size)
+  MPI_Aint lb;
+  MPI_Aint extent;
+  if (MPI_Type_get_extent(dart_mpi_datatype(dart_datatype), &lb, &extent)
       == MPI_SUCCESS) {
-    return native_size;
+    return (int)extent;
   }
   return -1;
 }
@@ -180,7 +180,13 @@ typedef struct dart_team_data {
 
 } dart_team_data_t;
 
-extern dart_team_data_t dart_team_data[DART_MAX_TEAM_NUMBER];
+/* @brief Table of team data, indexed by the team's index from
+ * dart_adapt_teamlist_convert.
+ *
+ * The table grows on demand, pointers to its elements are invalidated
+ * when a team is created.
+ */
+extern dart_team_data_t * dart_team_data;
 
 
 #if !defined(DART_MPI_DISABLE_SHARED_WINDOWS)
@@ -190,8 +196,8 @@ extern char* *dart_sharedmem_local_baseptr_set;
 /* @brief Initiate the free-team-list and allocated-team-list.
  *
  * This call will be invoked within dart_init(), and the free teamlist consist of
- * 256 nodes with index ranging from 0 to 255. The allocated teamlist array is set to
- * be empty.
+ * DART_INIT_TEAM_NUMBER slots. The table of team data is doubled in size whenever
+ * all slots are allocated. The allocated teamlist array is set to be empty.
  */
 int dart_adapt_teamlist_init ();
 
@@ -223,6 +229,44 @@ int dart_adapt_teamlist_recycle(uint16_t index, int pos);
  */
 int dart_adapt_teamlist_convert (dart_team_t teamid, uint16_t* index);
 
+/* @brief Store the communicator and window of a destroyed team for reuse
+ * by a team with identical units.
+ *
+ * Collective operation on the team's communicator, units agree on whether
+ * the team is cached.
+ *
+ * @param[in]  teamid     The ID of the destroyed team.
+ * @param[in]  team_data  The data of the destroyed team.
+ * @return 1 if the team data has been cached, 0 if it must be released.
+ */
+int dart_adapt_teamcache_insert(
+  dart_team_t              teamid,
+  const dart_team_data_t * team_data);
+
+/* @brief Take the data of a destroyed team consisting of the units in the
+ * given group from the cache.
+ *
+ * Local operation. All units in the group share the same cache entries,
+ * so all members of the group either find an entry or none.
+ *
+ * @return 1 if an entry has been found and removed from the cache.
+ */
+int dart_adapt_teamcache_take(
+  MPI_Group          group,
+  dart_team_data_t * team_data);
+
+/* @brief Release all cached team data.
+ *
+ * Invoked in dart_exit(), collective on all units.
+ */
+int dart_adapt_teamcache_destroy();
+
+/* @brief Release the communicators and window of a team.
+ *
+ * Collective operation on the team's communicator.
+ */
+void dart_adapt_teamdata_free(dart_team_data_t * team_data);
+
 #if !defined(DART_MPI_DISABLE_SHARED_WINDOWS)
 /*
  * Allocate shared memory communicator for the given \c team_data.
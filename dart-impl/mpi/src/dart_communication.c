@@ -22,6 +22,7 @@
 
 #include <dash/dart/base/logging.h>
 #include <dash/dart/base/math.h>
+#include <dash/dart/base/trace.h>
 
 #include <stdio.h>
 #include <mpi.h>
@@ -51,6 +52,14 @@ static int unit_g2l(
   return 0;
 }
 
+static size_t team_size(
+  uint16_t index)
+{
+  int size;
+  MPI_Comm_size(dart_team_data[index].comm, &size);
+  return size;
+}
+
 #if !defined(DART_MPI_DISABLE_SHARED_WINDOWS)
 static dart_ret_t get_shared_mem(dart_team_data_t * team_data,
                           void             * dest,
@@ -61,7 +70,8 @@ static dart_ret_t get_shared_mem(dart_team_data_t * team_data,
   int16_t      seg_id            = gptr.segid;
   uint64_t     offset            = gptr.addr_or_offs.offset;
   DART_LOG_DEBUG("dart_get: shared windows enabled");
-  dart_team_unit_t luid = DART_TEAM_UNIT_ID(gptr.unitid);
+  /* Base pointers are indexed by the target's rank in the node: */
+  dart_team_unit_t luid = team_data->sharedmem_tab[gptr.unitid];
   char * baseptr;
   /*
    * Use memcpy if the target is in the same node as the calling unit:
@@ -107,6 +117,9 @@ dart_ret_t dart_get(
     return DART_ERR_INVAL;
   }
 
+  DART__BASE__TRACE__OP(DART_TRACE_OP_GET, gptr.unitid,
+                        nelem * dart_mpi_sizeof_datatype(dtype), gptr.segid);
+
   uint16_t index;
   if (dart_segment_get_teamidx(seg_id, &index) != DART_OK) {
     DART_LOG_ERROR("dart_get ! failed: Unknown segment %i!", seg_id);
@@ -197,6 +210,9 @@ dart_ret_t dart_put(
     return DART_ERR_INVAL;
   }
 
+  DART__BASE__TRACE__OP(DART_TRACE_OP_PUT, gptr.unitid,
+                        nelem * dart_mpi_sizeof_datatype(dtype), gptr.segid);
+
   if (seg_id) {
 
     uint16_t index;
@@ -277,6 +293,9 @@ dart_ret_t dart_accumulate(
     return DART_ERR_INVAL;
   }
 
+  DART__BASE__TRACE__OP(DART_TRACE_OP_ACCUMULATE, gptr.unitid,
+                        nelem * dart_mpi_sizeof_datatype(dtype), gptr.segid);
+
   if (seg_id) {
     dart_team_unit_t target_unitid_rel;
 
@@ -334,6 +353,114 @@ dart_ret_t dart_accumulate(
   return DART_OK;
 }
 
+dart_ret_t dart_accumulate_indexed(
+  dart_gptr_t      gptr,
+  const void     * values,
+  size_t           nblocks,
+  const size_t   * blocklens,
+  const size_t   * displs,
+  dart_datatype_t  dtype,
+  dart_operation_t op,
+  dart_team_t      team)
+{
+  MPI_Aint     disp_s,
+               disp_rel;
+  MPI_Datatype mpi_dtype;
+  MPI_Datatype mpi_target_dtype;
+  MPI_Op       mpi_op;
+  MPI_Win      win;
+  int          target_rank;
+  dart_global_unit_t  target_unitid_abs = DART_GLOBAL_UNIT_ID(gptr.unitid);
+  uint64_t offset   = gptr.addr_or_offs.offset;
+  int16_t  seg_id   = gptr.segid;
+  mpi_dtype         = dart_mpi_datatype(dtype);
+  mpi_op            = dart_mpi_op(op);
+
+  (void)(team); // To prevent compiler warning from unused parameter.
+
+  DART_LOG_DEBUG("dart_accumulate_indexed() nblocks:%zu dtype:%d op:%d "
+                 "unit:%d", nblocks, dtype, op, target_unitid_abs.id);
+
+  /*
+   * MPI uses offset type int, do not copy more than INT_MAX elements:
+   */
+  size_t nelem = 0;
+  for (size_t b = 0; b < nblocks; ++b) {
+    nelem += blocklens[b];
+  }
+  if (nblocks > INT_MAX || nelem > INT_MAX) {
+    DART_LOG_ERROR("dart_accumulate_indexed ! failed: nelem > INT_MAX");
+    return DART_ERR_INVAL;
+  }
+
+  DART__BASE__TRACE__OP(DART_TRACE_OP_ACCUMULATE, gptr.unitid,
+                        nelem * dart_mpi_sizeof_datatype(dtype), gptr.segid);
+
+  if (seg_id) {
+    dart_team_unit_t target_unitid_rel;
+
+    uint16_t index;
+    if (dart_segment_get_teamidx(seg_id, &index) != DART_OK) {
+      DART_LOG_ERROR("dart_accumulate_indexed ! failed: Unknown segment %i!",
+                     seg_id);
+      return DART_ERR_INVAL;
+    }
+
+    win = dart_team_data[index].window;
+    unit_g2l(index,
+             target_unitid_abs,
+             &target_unitid_rel);
+    if (dart_segment_get_disp(
+          seg_id,
+          target_unitid_rel,
+          &disp_s) != DART_OK) {
+      DART_LOG_ERROR("dart_accumulate_indexed ! "
+                     "dart_adapt_transtable_get_disp failed");
+      return DART_ERR_INVAL;
+    }
+    disp_rel    = disp_s + offset;
+    target_rank = target_unitid_rel.id;
+  } else {
+    win         = dart_win_local_alloc;
+    disp_rel    = offset;
+    target_rank = target_unitid_abs.id;
+  }
+
+  /* Values are packed at the origin and scattered to the blocks at the
+   * target: */
+  int * mpi_blocklens = malloc(nblocks * sizeof(int));
+  int * mpi_displs    = malloc(nblocks * sizeof(int));
+  for (size_t b = 0; b < nblocks; ++b) {
+    mpi_blocklens[b] = (int)blocklens[b];
+    mpi_displs[b]    = (int)displs[b];
+  }
+  MPI_Type_indexed(nblocks, mpi_blocklens, mpi_displs, mpi_dtype,
+                   &mpi_target_dtype);
+  MPI_Type_commit(&mpi_target_dtype);
+  free(mpi_blocklens);
+  free(mpi_displs);
+
+  MPI_Accumulate(
+    values,            // Origin address
+    nelem,             // Number of entries in buffer
+    mpi_dtype,         // Data type of each buffer entry
+    target_rank,       // Rank of target
+    disp_rel,          // Displacement from start of window to beginning
+                       // of target buffer
+    1,                 // Number of entries in target buffer
+    mpi_target_dtype,  // Blocks in target buffer
+    mpi_op,            // Reduce operation
+    win);
+  /* The type is released when the operation is completed: */
+  MPI_Type_free(&mpi_target_dtype);
+
+  DART_LOG_TRACE("dart_accumulate_indexed: nelem:%zu nblocks:%zu "
+                 "target unit: %d offset: %"PRIu64"",
+                 nelem, nblocks, target_unitid_abs.id, offset);
+  DART_LOG_DEBUG("dart_accumulate_indexed > finished");
+  return DART_OK;
+}
+
 dart_ret_t dart_fetch_and_op(
   dart_gptr_t      gptr,
   void *           value,
@@ -357,6 +484,8 @@ dart_ret_t dart_fetch_and_op(
 
   DART_LOG_DEBUG("dart_fetch_and_op() dtype:%d op:%d unit:%d",
                  dtype, op, target_unitid_abs.id);
+  DART__BASE__TRACE__OP(DART_TRACE_OP_FETCH_OP, gptr.unitid,
+                        dart_mpi_sizeof_datatype(dtype), gptr.segid);
   if (seg_id) {
     dart_team_unit_t target_unitid_rel;
 
@@ -441,6 +570,9 @@ dart_ret_t dart_get_handle(
     return DART_ERR_INVAL;
   }
 
+  DART__BASE__TRACE__OP(DART_TRACE_OP_GET, gptr.unitid,
+                        nelem * dart_mpi_sizeof_datatype(dtype), gptr.segid);
+
   uint16_t index;
   if (dart_segment_get_teamidx(seg_id, &index) != DART_OK) {
     DART_LOG_ERROR("dart_get_handle ! failed: Unknown segment %i!", seg_id);
@@ -571,6 +703,95 @@ dart_ret_t dart_get_handle(
   return DART_OK;
 }
 
+dart_ret_t dart_get_typed_handle(
+  void            * dest,
+  dart_datatype_t   dest_type,
+  dart_gptr_t       gptr,
+  dart_datatype_t   src_type,
+  dart_handle_t   * handle)
+{
+  MPI_Request  mpi_req;
+  MPI_Aint     disp_s,
+               disp_rel;
+  MPI_Datatype mpi_dest_type = dart_mpi_datatype(dest_type);
+  MPI_Datatype mpi_src_type  = dart_mpi_datatype(src_type);
+  MPI_Win      win;
+  int          target_rank;
+  dart_global_unit_t  target_unitid_abs = DART_GLOBAL_UNIT_ID(gptr.unitid);
+  uint64_t     offset = gptr.addr_or_offs.offset;
+  int16_t      seg_id = gptr.segid;
+
+  *handle = NULL;
+
+  if (mpi_dest_type == (MPI_Datatype)(-1) ||
+      mpi_src_type  == (MPI_Datatype)(-1)) {
+    DART_LOG_ERROR("dart_get_typed_handle ! invalid types %d, %d",
+                   dest_type, src_type);
+    return DART_ERR_INVAL;
+  }
+
+  DART__BASE__TRACE__OP(DART_TRACE_OP_GET, gptr.unitid,
+                        dart_mpi_sizeof_datatype(src_type), gptr.segid);
+
+  if (seg_id != 0) {
+    /*
+     * The memory accessed is allocated with collective allocation.
+     */
+    dart_team_unit_t target_unitid_rel;
+    uint16_t         index;
+    if (dart_segment_get_teamidx(seg_id, &index) != DART_OK) {
+      DART_LOG_ERROR("dart_get_typed_handle ! failed: Unknown segment %i!",
+                     seg_id);
+      return DART_ERR_INVAL;
+    }
+    win = dart_team_data[index].window;
+    unit_g2l(index, target_unitid_abs, &target_unitid_rel);
+    if (dart_segment_get_disp(
+          seg_id,
+          target_unitid_rel,
+          &disp_s) != DART_OK) {
+      DART_LOG_ERROR(
+        "dart_get_typed_handle ! dart_adapt_transtable_get_disp failed");
+      return DART_ERR_INVAL;
+    }
+    disp_rel    = disp_s + offset;
+    target_rank = target_unitid_rel.id;
+  } else {
+    /*
+     * The memory accessed is allocated with local allocation.
+     */
+    win         = dart_win_local_alloc;
+    disp_rel    = offset;
+    target_rank = target_unitid_abs.id;
+  }
+  DART_LOG_DEBUG("dart_get_typed_handle() from %d at offset %"PRIu64" "
+                 "segment:%d", target_rank, offset, seg_id);
+  /*
+   * Elements are not copied from shared windows directly as their
+   * layout at the source and in the destination differ:
+   */
+  if (MPI_Rget(
+        dest,              // origin address
+        1,                 // origin count
+        mpi_dest_type,     // origin data type
+        target_rank,       // target rank
+        disp_rel,          // target disp in window
+        1,                 // target count
+        mpi_src_type,      // target data type
+        win,               // window
+        &mpi_req) != MPI_SUCCESS) {
+    DART_LOG_ERROR("dart_get_typed_handle ! MPI_Rget failed");
+    return DART_ERR_INVAL;
+  }
+  *handle = (dart_handle_t) malloc(sizeof(struct dart_handle_struct));
+  (*handle)->dest    = target_rank;
+  (*handle)->request = mpi_req;
+  (*handle)->win     = win;
+  DART_LOG_TRACE("dart_get_typed_handle > handle(%p) dest:%d",
+                 (void*)(*handle), (*handle)->dest);
+  return DART_OK;
+}
+
 dart_ret_t dart_put_handle(
   dart_gptr_t       gptr,
   const void      * src,
@@ -597,6 +818,9 @@ dart_ret_t dart_put_handle(
     return DART_ERR_INVAL;
   }
 
+  DART__BASE__TRACE__OP(DART_TRACE_OP_PUT, gptr.unitid,
+                        nelem * dart_mpi_sizeof_datatype(dtype), gptr.segid);
+
   *handle = (dart_handle_t) malloc(sizeof(struct dart_handle_struct));
 
   if (seg_id != 0) {
@@ -693,6 +917,9 @@ dart_ret_t dart_put_blocking(
     return DART_ERR_INVAL;
   }
 
+  DART__BASE__TRACE__OP(DART_TRACE_OP_PUT, gptr.unitid,
+                        nelem * dart_mpi_sizeof_datatype(dtype), gptr.segid);
+
   uint16_t index;
   if (dart_segment_get_teamidx(seg_id, &index) != DART_OK) {
     DART_LOG_ERROR("dart_put_blocking ! failed: Unknown segment %i!", seg_id);
@@ -821,6 +1048,9 @@ dart_ret_t dart_get_blocking(
     return DART_ERR_INVAL;
   }
 
+  DART__BASE__TRACE__OP(DART_TRACE_OP_GET, gptr.unitid,
+                        nelem * dart_mpi_sizeof_datatype(dtype), gptr.segid);
+
   uint16_t index;
   if (dart_segment_get_teamidx(seg_id, &index) != DART_OK) {
     DART_LOG_ERROR("dart_get_blocking ! failed: Unknown segment %i!", seg_id);
@@ -907,6 +1137,7 @@ dart_ret_t dart_get_blocking(
 dart_ret_t dart_flush(
   dart_gptr_t gptr)
 {
+  uint64_t trace_begin = DART__BASE__TRACE__BEGIN();
   MPI_Win     win;
   dart_global_unit_t target_unitid_abs = DART_GLOBAL_UNIT_ID(gptr.unitid);
   int16_t     seg_id = gptr.segid;
@@ -937,12 +1168,15 @@ dart_ret_t dart_flush(
     return DART_ERR_OTHER;
   }
   DART_LOG_DEBUG("dart_flush > finished");
+  DART__BASE__TRACE__TIMED(DART_TRACE_OP_FLUSH, gptr.unitid,
+                           0, gptr.segid, trace_begin);
   return DART_OK;
 }
 
 dart_ret_t dart_flush_all(
   dart_gptr_t gptr)
 {
+  uint64_t trace_begin = DART__BASE__TRACE__BEGIN();
   int16_t seg_id;
   seg_id = gptr.segid;
   MPI_Win win;
@@ -975,12 +1209,15 @@ dart_ret_t dart_flush_all(
     return DART_ERR_OTHER;
   }
   DART_LOG_DEBUG("dart_flush_all > finished");
+  DART__BASE__TRACE__TIMED(DART_TRACE_OP_FLUSH, -1,
+                           0, gptr.segid, trace_begin);
   return DART_OK;
 }
 
 dart_ret_t dart_flush_local(
   dart_gptr_t gptr)
 {
+  uint64_t trace_begin = DART__BASE__TRACE__BEGIN();
   dart_global_unit_t target_unitid_abs = DART_GLOBAL_UNIT_ID(gptr.unitid);
   int16_t seg_id = gptr.segid;
   MPI_Win win;
@@ -1010,12 +1247,15 @@ dart_ret_t dart_flush_local(
     MPI_Win_flush_local(target_unitid_abs.id, win);
   }
   DART_LOG_DEBUG("dart_flush_local > finished");
+  DART__BASE__TRACE__TIMED(DART_TRACE_OP_FLUSH, gptr.unitid,
+                           0, gptr.segid, trace_begin);
   return DART_OK;
 }
 
 dart_ret_t dart_flush_local_all(
   dart_gptr_t gptr)
 {
+  uint64_t trace_begin = DART__BASE__TRACE__BEGIN();
   int16_t seg_id = gptr.segid;
   MPI_Win win;
   DART_LOG_DEBUG("dart_flush_local_all() gptr: "
@@ -1036,12 +1276,15 @@ dart_ret_t dart_flush_local_all(
   }
   MPI_Win_flush_local_all(win);
   DART_LOG_DEBUG("dart_flush_local_all > finished");
+  DART__BASE__TRACE__TIMED(DART_TRACE_OP_FLUSH, -1,
+                           0, gptr.segid, trace_begin);
   return DART_OK;
 }
 
 dart_ret_t dart_wait_local(
   dart_handle_t handle)
 {
+  uint64_t trace_begin = DART__BASE__TRACE__BEGIN();
   int mpi_ret;
   DART_LOG_DEBUG("dart_wait_local() handle:%p", (void*)(handle));
   if (handle != NULL) {
@@ -1072,12 +1315,15 @@ dart_ret_t dart_wait_local(
      */
   }
   DART_LOG_DEBUG("dart_wait_local > finished");
+  DART__BASE__TRACE__TIMED(DART_TRACE_OP_WAIT, -1,
+                           0, 0, trace_begin);
   return DART_OK;
 }
 
 dart_ret_t dart_wait(
   dart_handle_t handle)
 {
+  uint64_t trace_begin = DART__BASE__TRACE__BEGIN();
   int mpi_ret;
   DART_LOG_DEBUG("dart_wait() handle:%p", (void*)(handle));
   if (handle != NULL) {
@@ -1100,11 +1346,14 @@ dart_ret_t dart_wait(
         DART_LOG_DEBUG("dart_wait ! MPI_Wait failed");
         return DART_ERR_INVAL;
       }
-      DART_LOG_DEBUG("dart_wait:     -- MPI_Win_flush");
-      mpi_ret = MPI_Win_flush(handle->dest, handle->win);
-      if (mpi_ret != MPI_SUCCESS) {
-        DART_LOG_DEBUG("dart_wait ! MPI_Win_flush failed");
-        return DART_ERR_INVAL;
+      /* Handles of collective operations are not bound to a window: */
+      if (handle->win != MPI_WIN_NULL) {
+        DART_LOG_DEBUG("dart_wait:     -- MPI_Win_flush");
+        mpi_ret = MPI_Win_flush(handle->dest, handle->win);
+        if (mpi_ret != MPI_SUCCESS) {
+          DART_LOG_DEBUG("dart_wait ! MPI_Win_flush failed");
+          return DART_ERR_INVAL;
+        }
       }
     } else {
       DART_LOG_TRACE("dart_wait:     handle->request: MPI_REQUEST_NULL");
@@ -1115,6 +1364,8 @@ dart_ret_t dart_wait(
     handle = NULL;
   }
   DART_LOG_DEBUG("dart_wait > finished");
+  DART__BASE__TRACE__TIMED(DART_TRACE_OP_WAIT, -1,
+                           0, 0, trace_begin);
   return DART_OK;
 }
 
@@ -1122,6 +1373,7 @@ dart_ret_t dart_waitall_local(
   dart_handle_t * handle,
   size_t          num_handles)
 {
+  uint64_t trace_begin = DART__BASE__TRACE__BEGIN();
   dart_ret_t ret = DART_OK;
 
   DART_LOG_DEBUG("dart_waitall_local()");
@@ -1220,6 +1472,7 @@ dart_ret_t dart_waitall_local(
     DART_LOG_TRACE("dart_waitall_local: free MPI_Status temporaries");
     free(mpi_sta);
   }
+  DART__BASE__TRACE__TIMED(DART_TRACE_OP_WAIT, -1, 0, 0, trace_begin);
   DART_LOG_DEBUG("dart_waitall_local > %d", ret);
   return ret;
 }
@@ -1228,6 +1481,7 @@ dart_ret_t dart_waitall(
   dart_handle_t * handle,
   size_t          n)
 {
+  uint64_t trace_begin = DART__BASE__TRACE__BEGIN();
   size_t i, r_n;
   DART_LOG_DEBUG("dart_waitall()");
   if (n == 0) {
@@ -1375,6 +1629,8 @@ dart_ret_t dart_waitall(
     free(mpi_sta);
   }
   DART_LOG_DEBUG("dart_waitall > finished");
+  DART__BASE__TRACE__TIMED(DART_TRACE_OP_WAIT, -1,
+                           0, 0, trace_begin);
   return DART_OK;
 }
 
@@ -1432,6 +1688,7 @@ static int _dart_barrier_count = 0;
 dart_ret_t dart_barrier(
   dart_team_t teamid)
 {
+  uint64_t trace_begin = DART__BASE__TRACE__BEGIN();
   MPI_Comm comm;
   uint16_t index;
   int      result;
@@ -1446,6 +1703,8 @@ dart_ret_t dart_barrier(
   /* Fetch proper communicator from teams. */
   comm = dart_team_data[index].comm;
   if (MPI_Barrier(comm) == MPI_SUCCESS) {
+    DART__BASE__TRACE__TIMED(DART_TRACE_OP_COLLECTIVE, -1, 0, teamid,
+                             trace_begin);
     DART_LOG_DEBUG("dart_barrier > finished");
     return DART_OK;
   }
@@ -1460,6 +1719,7 @@ dart_ret_t dart_bcast(
   dart_team_unit_t    root,
   dart_team_t         teamid)
 {
+  uint64_t trace_begin = DART__BASE__TRACE__BEGIN();
   MPI_Comm comm;
   uint16_t index;
   MPI_Datatype mpi_dtype = dart_mpi_datatype(dtype);
@@ -1489,6 +1749,9 @@ dart_ret_t dart_bcast(
   }
   DART_LOG_TRACE("dart_bcast > root:%d team:%d nelem:%zu finished",
                  root.id, teamid, nelem);
+  DART__BASE__TRACE__TIMED(DART_TRACE_OP_COLLECTIVE, -1,
+                           nelem * dart_mpi_sizeof_datatype(dtype),
+                           teamid, trace_begin);
   return DART_OK;
 }
 
@@ -1500,6 +1763,7 @@ dart_ret_t dart_scatter(
   dart_team_unit_t    root,
   dart_team_t         teamid)
 {
+  uint64_t trace_begin = DART__BASE__TRACE__BEGIN();
   MPI_Datatype mpi_dtype = dart_mpi_datatype(dtype);
   MPI_Comm     comm;
   uint16_t     index;
@@ -1528,6 +1792,9 @@ dart_ret_t dart_scatter(
            comm) != MPI_SUCCESS) {
     return DART_ERR_INVAL;
   }
+  DART__BASE__TRACE__TIMED(DART_TRACE_OP_COLLECTIVE, -1,
+                           nelem * dart_mpi_sizeof_datatype(dtype),
+                           teamid, trace_begin);
   return DART_OK;
 }
 
@@ -1539,6 +1806,7 @@ dart_ret_t dart_gather(
   dart_team_unit_t     root,
   dart_team_t          teamid)
 {
+  uint64_t trace_begin = DART__BASE__TRACE__BEGIN();
   MPI_Datatype mpi_dtype = dart_mpi_datatype(dtype);
   MPI_Comm     comm;
   uint16_t     index;
@@ -1567,6 +1835,9 @@ dart_ret_t dart_gather(
            comm) != MPI_SUCCESS) {
     return DART_ERR_INVAL;
   }
+  DART__BASE__TRACE__TIMED(DART_TRACE_OP_COLLECTIVE, -1,
+                           nelem * dart_mpi_sizeof_datatype(dtype),
+                           teamid, trace_begin);
   return DART_OK;
 }
 
@@ -1577,6 +1848,7 @@ dart_ret_t dart_allgather(
   dart_datatype_t   dtype,
   dart_team_t       teamid)
 {
+  uint64_t trace_begin = DART__BASE__TRACE__BEGIN();
   MPI_Datatype mpi_dtype = dart_mpi_datatype(dtype);
   MPI_Comm     comm;
   uint16_t     index;
@@ -1616,6 +1888,9 @@ dart_ret_t dart_allgather(
   }
   DART_LOG_TRACE("dart_allgather > team:%d nelem:%"PRIu64"",
                  teamid, nelem);
+  DART__BASE__TRACE__TIMED(DART_TRACE_OP_COLLECTIVE, -1,
+                           nelem * dart_mpi_sizeof_datatype(dtype),
+                           teamid, trace_begin);
   return DART_OK;
 }
 
@@ -1628,6 +1903,7 @@ dart_ret_t dart_allgatherv(
   const size_t    * recvdispls,
   dart_team_t       teamid)
 {
+  uint64_t trace_begin = DART__BASE__TRACE__BEGIN();
   MPI_Datatype mpi_dtype = dart_mpi_datatype(dtype);
   MPI_Comm     comm;
   uint16_t     index;
@@ -1689,6 +1965,124 @@ dart_ret_t dart_allgatherv(
   free(irecvdispls);
   DART_LOG_TRACE("dart_allgatherv > team:%d nsendelem:%"PRIu64"",
                  teamid, nsendelem);
+  DART__BASE__TRACE__TIMED(DART_TRACE_OP_COLLECTIVE, -1,
+                           nsendelem * dart_mpi_sizeof_datatype(dtype),
+                           teamid, trace_begin);
+  return DART_OK;
+}
+
+dart_ret_t dart_alltoall(
+  const void      * sendbuf,
+  void            * recvbuf,
+  size_t            nelem,
+  dart_datatype_t   dtype,
+  dart_team_t       teamid)
+{
+  uint64_t trace_begin = DART__BASE__TRACE__BEGIN();
+  MPI_Datatype mpi_dtype = dart_mpi_datatype(dtype);
+  uint16_t     index;
+  DART_LOG_TRACE("dart_alltoall() team:%d nelem:%"PRIu64"", teamid, nelem);
+
+  /*
+   * MPI uses offset type int, do not copy more than INT_MAX elements:
+   */
+  if (nelem > INT_MAX) {
+    DART_LOG_ERROR("dart_alltoall ! failed: nelem > INT_MAX");
+    return DART_ERR_INVAL;
+  }
+  if (dart_adapt_teamlist_convert(teamid, &index) == -1) {
+    DART_LOG_ERROR("dart_alltoall ! team:%d "
+                   "dart_adapt_teamlist_convert failed", teamid);
+    return DART_ERR_INVAL;
+  }
+  if (sendbuf == recvbuf || NULL == sendbuf) {
+    sendbuf = MPI_IN_PLACE;
+  }
+  if (MPI_Alltoall(
+           sendbuf,
+           nelem,
+           mpi_dtype,
+           recvbuf,
+           nelem,
+           mpi_dtype,
+           dart_team_data[index].comm) != MPI_SUCCESS) {
+    DART_LOG_ERROR("dart_alltoall ! team:%d nelem:%"PRIu64" failed",
+                   teamid, nelem);
+    return DART_ERR_INVAL;
+  }
+  DART_LOG_TRACE("dart_alltoall > team:%d nelem:%"PRIu64"", teamid, nelem);
+  DART__BASE__TRACE__TIMED(DART_TRACE_OP_COLLECTIVE, -1,
+                           nelem * dart_mpi_sizeof_datatype(dtype) *
+                             team_size(index), teamid, trace_begin);
+  return DART_OK;
+}
+
+dart_ret_t dart_alltoallv(
+  const void      * sendbuf,
+  const size_t    * nsendcounts,
+  const size_t    * senddispls,
+  dart_datatype_t   dtype,
+  void            * recvbuf,
+  const size_t    * nrecvcounts,
+  const size_t    * recvdispls,
+  dart_team_t       teamid)
+{
+  uint64_t trace_begin = DART__BASE__TRACE__BEGIN();
+  MPI_Datatype mpi_dtype = dart_mpi_datatype(dtype);
+  MPI_Comm     comm;
+  uint16_t     index;
+  int          comm_size;
+  DART_LOG_TRACE("dart_alltoallv() team:%d", teamid);
+
+  if (dart_adapt_teamlist_convert(teamid, &index) == -1) {
+    DART_LOG_ERROR("dart_alltoallv ! team:%d "
+                   "dart_adapt_teamlist_convert failed", teamid);
+    return DART_ERR_INVAL;
+  }
+  comm = dart_team_data[index].comm;
+
+  // convert counts and displacements
+  MPI_Comm_size(comm, &comm_size);
+  int *counts = malloc(sizeof(int) * comm_size * 4);
+  int *isendcounts = counts;
+  int *isenddispls = counts + comm_size;
+  int *irecvcounts = counts + comm_size * 2;
+  int *irecvdispls = counts + comm_size * 3;
+  size_t nsendelem  = 0;
+  for (int i = 0; i < comm_size; i++) {
+    if (nsendcounts[i] > INT_MAX || senddispls[i] > INT_MAX ||
+        nrecvcounts[i] > INT_MAX || recvdispls[i] > INT_MAX) {
+      DART_LOG_ERROR("dart_alltoallv ! failed: counts or displacements "
+                     "of unit %i > INT_MAX", i);
+      free(counts);
+      return DART_ERR_INVAL;
+    }
+    isendcounts[i] = nsendcounts[i];
+    isenddispls[i] = senddispls[i];
+    nsendelem     += nsendcounts[i];
+    irecvcounts[i] = nrecvcounts[i];
+    irecvdispls[i] = recvdispls[i];
+  }
+
+  if (MPI_Alltoallv(
+           sendbuf,
+           isendcounts,
+           isenddispls,
+           mpi_dtype,
+           recvbuf,
+           irecvcounts,
+           irecvdispls,
+           mpi_dtype,
+           comm) != MPI_SUCCESS) {
+    DART_LOG_ERROR("dart_alltoallv ! team:%d failed", teamid);
+    free(counts);
+    return DART_ERR_INVAL;
+  }
+  free(counts);
+  DART_LOG_TRACE("dart_alltoallv > team:%d", teamid);
+  DART__BASE__TRACE__TIMED(DART_TRACE_OP_COLLECTIVE, -1,
+                           nsendelem * dart_mpi_sizeof_datatype(dtype),
+                           teamid, trace_begin);
   return DART_OK;
 }
 
@@ -1700,9 +2094,10 @@ dart_ret_t dart_allreduce(
   dart_operation_t   op,
   dart_team_t        team)
 {
+  uint64_t trace_begin = DART__BASE__TRACE__BEGIN();
   MPI_Comm     comm;
   MPI_Op       mpi_op    = dart_mpi_op(op);
-  MPI_Datatype mpi_dtype = dart_mpi_datatype(dtype);
+  MPI_Datatype mpi_dtype = dart_mpi_op_datatype(op, dtype);
 
   /*
    * MPI uses offset type int, do not copy more than INT_MAX elements:
@@ -1711,6 +2106,12 @@ dart_ret_t dart_allreduce(
     DART_LOG_ERROR("dart_allreduce ! failed: nelem > INT_MAX");
     return DART_ERR_INVAL;
   }
+  if (dart__mpi__user_op(op) != NULL &&
+      dart__mpi__user_op(op)->dtype != dtype) {
+    DART_LOG_ERROR("dart_allreduce ! failed: type %d does not match "
+                   "operation %d", dtype, op);
+    return DART_ERR_INVAL;
+  }
 
   uint16_t index;
   int result = dart_adapt_teamlist_convert(team, &index);
@@ -1728,6 +2129,68 @@ dart_ret_t dart_allreduce(
            comm) != MPI_SUCCESS) {
     return DART_ERR_INVAL;
   }
+  DART__BASE__TRACE__TIMED(DART_TRACE_OP_COLLECTIVE, -1,
+                           nelem * dart_mpi_sizeof_datatype(dtype),
+                           team, trace_begin);
+  return DART_OK;
+}
+
+dart_ret_t dart_allreduce_handle(
+  const void       * sendbuf,
+  void             * recvbuf,
+  size_t             nelem,
+  dart_datatype_t    dtype,
+  dart_operation_t   op,
+  dart_team_t        team,
+  dart_handle_t    * handle)
+{
+  uint64_t trace_begin = DART__BASE__TRACE__BEGIN();
+  MPI_Comm     comm;
+  MPI_Op       mpi_op    = dart_mpi_op(op);
+  MPI_Datatype mpi_dtype = dart_mpi_op_datatype(op, dtype);
+
+  *handle = NULL;
+  /*
+   * MPI uses offset type int, do not copy more than INT_MAX elements:
+   */
+  if (nelem > INT_MAX) {
+    DART_LOG_ERROR("dart_allreduce_handle ! failed: nelem > INT_MAX");
+    return DART_ERR_INVAL;
+  }
+  if (dart__mpi__user_op(op) != NULL &&
+      dart__mpi__user_op(op)->dtype != dtype) {
+    DART_LOG_ERROR("dart_allreduce_handle ! failed: type %d does not match "
+                   "operation %d", dtype, op);
+    return DART_ERR_INVAL;
+  }
+
+  uint16_t index;
+  int result = dart_adapt_teamlist_convert(team, &index);
+
+  if (result == -1) {
+    return DART_ERR_INVAL;
+  }
+  comm = dart_team_data[index].comm;
+
+  dart_handle_t coll_handle = malloc(sizeof(struct dart_handle_struct));
+  coll_handle->dest = -1;
+  coll_handle->win  = MPI_WIN_NULL;
+  if (MPI_Iallreduce(
+           sendbuf,   // send buffer
+           recvbuf,   // receive buffer
+           nelem,     // buffer size
+           mpi_dtype, // datatype
+           mpi_op,    // reduce operation
+           comm,
+           &(coll_handle->request)) != MPI_SUCCESS) {
+    free(coll_handle);
+    return DART_ERR_INVAL;
+  }
+  *handle = coll_handle;
+  DART__BASE__TRACE__TIMED(DART_TRACE_OP_COLLECTIVE, -1,
+                           nelem * dart_mpi_sizeof_datatype(dtype),
+                           team, trace_begin);
+  DART_LOG_DEBUG("dart_allreduce_handle > handle:%p", (void*)(*handle));
   return DART_OK;
 }
 
@@ -1740,10 +2203,11 @@ dart_ret_t dart_reduce(
   dart_team_unit_t    root,
   dart_team_t         team)
 {
+  uint64_t trace_begin = DART__BASE__TRACE__BEGIN();
   uint16_t     index;
   MPI_Comm     comm;
   MPI_Op       mpi_op    = dart_mpi_op(op);
-  MPI_Datatype mpi_dtype = dart_mpi_datatype(dtype);
+  MPI_Datatype mpi_dtype = dart_mpi_op_datatype(op, dtype);
 
   /*
    * MPI uses offset type int, do not copy more than INT_MAX elements:
@@ -1752,6 +2216,12 @@ dart_ret_t dart_reduce(
     DART_LOG_ERROR("dart_allreduce ! failed: nelem > INT_MAX");
     return DART_ERR_INVAL;
   }
+  if (dart__mpi__user_op(op) != NULL &&
+      dart__mpi__user_op(op)->dtype != dtype) {
+    DART_LOG_ERROR("dart_allreduce ! failed: type %d does not match "
+                   "operation %d", dtype, op);
+    return DART_ERR_INVAL;
+  }
 
   int result = dart_adapt_teamlist_convert (team, &index);
   if (result == -1) {
@@ -1768,6 +2238,117 @@ dart_ret_t dart_reduce(
            comm) != MPI_SUCCESS) {
     return DART_ERR_INVAL;
   }
+  DART__BASE__TRACE__TIMED(DART_TRACE_OP_COLLECTIVE, -1,
+                           nelem * dart_mpi_sizeof_datatype(dtype),
+                           team, trace_begin);
+  return DART_OK;
+}
+
+dart_ret_t dart_exscan(
+  const void        * sendbuf,
+  void              * recvbuf,
+  size_t              nelem,
+  dart_datatype_t     dtype,
+  dart_operation_t    op,
+  dart_team_t         team)
+{
+  uint64_t trace_begin = DART__BASE__TRACE__BEGIN();
+  uint16_t     index;
+  MPI_Comm     comm;
+  MPI_Op       mpi_op    = dart_mpi_op(op);
+  MPI_Datatype mpi_dtype = dart_mpi_op_datatype(op, dtype);
+
+  /*
+   * MPI uses offset type int, do not copy more than INT_MAX elements:
+   */
+  if (nelem > INT_MAX) {
+    DART_LOG_ERROR("dart_exscan ! failed: nelem > INT_MAX");
+    return DART_ERR_INVAL;
+  }
+  if (dart__mpi__user_op(op) != NULL &&
+      dart__mpi__user_op(op)->dtype != dtype) {
+    DART_LOG_ERROR("dart_exscan ! failed: type %d does not match "
+                   "operation %d", dtype, op);
+    return DART_ERR_INVAL;
+  }
+
+  int result = dart_adapt_teamlist_convert(team, &index);
+  if (result == -1) {
+    return DART_ERR_INVAL;
+  }
+  comm = dart_team_data[index].comm;
+  if (MPI_Exscan(
+           sendbuf,
+           recvbuf,
+           nelem,
+           mpi_dtype,
+           mpi_op,
+           comm) != MPI_SUCCESS) {
+    return DART_ERR_INVAL;
+  }
+  DART__BASE__TRACE__TIMED(DART_TRACE_OP_COLLECTIVE, -1,
+                           nelem * dart_mpi_sizeof_datatype(dtype),
+                           team, trace_begin);
+  return DART_OK;
+}
+
+dart_ret_t dart_reduce_scatter(
+  const void        * sendbuf,
+  void              * recvbuf,
+  const size_t      * nrecvelem,
+  dart_datatype_t     dtype,
+  dart_operation_t    op,
+  dart_team_t         team)
+{
+  uint64_t trace_begin = DART__BASE__TRACE__BEGIN();
+  uint16_t     index;
+  MPI_Comm     comm;
+  MPI_Op       mpi_op    = dart_mpi_op(op);
+  MPI_Datatype mpi_dtype = dart_mpi_op_datatype(op, dtype);
+  int          comm_size;
+
+  if (dart__mpi__user_op(op) != NULL &&
+      dart__mpi__user_op(op)->dtype != dtype) {
+    DART_LOG_ERROR("dart_reduce_scatter ! failed: type %d does not match "
+                   "operation %d", dtype, op);
+    return DART_ERR_INVAL;
+  }
+
+  int result = dart_adapt_teamlist_convert(team, &index);
+  if (result == -1) {
+    return DART_ERR_INVAL;
+  }
+  comm = dart_team_data[index].comm;
+
+  /*
+   * MPI uses offset type int, convert counts:
+   */
+  MPI_Comm_size(comm, &comm_size);
+  int    * counts = malloc(sizeof(int) * comm_size);
+  size_t   nelem  = 0;
+  for (int i = 0; i < comm_size; i++) {
+    nelem += nrecvelem[i];
+    if (nelem > INT_MAX) {
+      DART_LOG_ERROR("dart_reduce_scatter ! failed: nelem > INT_MAX");
+      free(counts);
+      return DART_ERR_INVAL;
+    }
+    counts[i] = nrecvelem[i];
+  }
+  if (MPI_Reduce_scatter(
+           sendbuf,
+           recvbuf,
+           counts,
+           mpi_dtype,
+           mpi_op,
+           comm) != MPI_SUCCESS) {
+    free(counts);
+    return DART_ERR_INVAL;
+  }
+  free(counts);
+  DART__BASE__TRACE__TIMED(DART_TRACE_OP_COLLECTIVE, -1,
+                           nelem * dart_mpi_sizeof_datatype(dtype),
+                           team, trace_begin);
   return DART_OK;
 }
 
@@ -1778,6 +2359,7 @@ dart_ret_t dart_send(
   int                 tag,
   dart_global_unit_t  unit)
 {
+  uint64_t trace_begin = DART__BASE__TRACE__BEGIN();
   MPI_Comm comm;
   MPI_Datatype mpi_dtype = dart_mpi_datatype(dtype);
   dart_team_t team = DART_TEAM_ALL;
@@ -1806,6 +2388,9 @@ dart_ret_t dart_send(
         comm) != MPI_SUCCESS) {
     return DART_ERR_INVAL;
   }
+  DART__BASE__TRACE__TIMED(DART_TRACE_OP_P2P, unit.id,
+                           nelem * dart_mpi_sizeof_datatype(dtype),
+                           0, trace_begin);
   return DART_OK;
 }
 
@@ -1816,6 +2401,7 @@ dart_ret_t dart_recv(
   int                   tag,
   dart_global_unit_t    unit)
 {
+  uint64_t trace_begin = DART__BASE__TRACE__BEGIN();
   MPI_Comm comm;
   MPI_Datatype mpi_dtype = dart_mpi_datatype(dtype);
   dart_team_t team = DART_TEAM_ALL;
@@ -1845,6 +2431,9 @@ dart_ret_t dart_recv(
         MPI_STATUS_IGNORE) != MPI_SUCCESS) {
     return DART_ERR_INVAL;
   }
+  DART__BASE__TRACE__TIMED(DART_TRACE_OP_P2P, unit.id,
+                           nelem * dart_mpi_sizeof_datatype(dtype),
+                           0, trace_begin);
   return DART_OK;
 }
 
@@ -1860,6 +2449,7 @@ dart_ret_t dart_sendrecv(
   int                  recv_tag,
   dart_global_unit_t   src)
 {
+  uint64_t trace_begin = DART__BASE__TRACE__BEGIN();
   MPI_Comm comm;
   MPI_Datatype mpi_send_dtype = dart_mpi_datatype(send_dtype);
   MPI_Datatype mpi_recv_dtype = dart_mpi_datatype(recv_dtype);
@@ -1894,6 +2484,9 @@ dart_ret_t dart_sendrecv(
         MPI_STATUS_IGNORE) != MPI_SUCCESS) {
     return DART_ERR_INVAL;
   }
+  DART__BASE__TRACE__TIMED(DART_TRACE_OP_P2P, dest.id,
+                           send_nelem * dart_mpi_sizeof_datatype(send_dtype),
+                           0, trace_begin);
   return DART_OK;
 }
 
@@ -101,6 +101,30 @@ dart_ret_t dart_gptr_setunit(dart_gptr_t* gptr, dart_global_unit_t unit_id)
 	return DART_OK;
 }
 
+dart_ret_t dart_unit_shmem_local(
+  dart_global_unit_t   unit,
+  int32_t            * is_shmem_local)
+{
+  size_t             nunits;
+  dart_global_unit_t myid;
+  dart_size(&nunits);
+  dart_myid(&myid);
+  if (unit.id < 0 || (size_t)unit.id >= nunits) {
+    DART_LOG_ERROR("dart_unit_shmem_local ! invalid unit id:%d", unit.id);
+    return DART_ERR_INVAL;
+  }
+  *is_shmem_local = (unit.id == myid.id);
+#if !defined(DART_MPI_DISABLE_SHARED_WINDOWS)
+  /* The shared memory table of DART_TEAM_ALL is indexed by global unit
+   * id and contains the unit's rank in the node communicator: */
+  if (dart_team_data[0].sharedmem_tab != NULL) {
+    *is_shmem_local =
+      (dart_team_data[0].sharedmem_tab[unit.id].id >= 0);
+  }
+#endif
+  return DART_OK;
+}
+
 dart_ret_t dart_memalloc(
   size_t            nelem,
   dart_datatype_t   dtype,
@@ -16,6 +16,9 @@
 #include <dash/dart/mpi/dart_globmem_priv.h>
 #include <dash/dart/mpi/dart_locality_priv.h>
 #include <dash/dart/mpi/dart_segment.h>
+#include <dash/dart/mpi/dart_communication_priv.h>
+
+#include <dash/dart/base/trace.h>
 
 #define DART_BUDDY_ORDER 24
 
@@ -161,6 +164,12 @@ dart_ret_t do_init()
 
   _dart_initialized = 2;
 
+  dart_global_unit_t myid;
+  int                nunits;
+  MPI_Comm_rank(DART_COMM_WORLD, &myid.id);
+  MPI_Comm_size(DART_COMM_WORLD, &nunits);
+  dart__base__trace__init(myid, nunits);
+
   DART_LOG_DEBUG("dart_init > initialization finished");
   return DART_OK;
 }
@@ -243,8 +252,14 @@ dart_ret_t dart_exit()
 	dart_global_unit_t unitid;
 	dart_myid(&unitid);
 
+  /* Write trace before releasing resources */
+  dart__base__trace__finalize();
+
   dart__mpi__locality_finalize();
 
+  /* Release communicators and windows of destroyed teams kept for reuse */
+  dart_adapt_teamcache_destroy();
+
   _dart_initialized = 0;
 
 	DART_LOG_DEBUG("%2d: dart_exit()", unitid.id);
@@ -290,6 +305,9 @@ dart_ret_t dart_exit()
 
   dart_segment_fini();
 
+  /* Release operations and types not destroyed by the user */
+  dart__mpi__types_finalize();
+
   MPI_Comm_free(&dart_comm_world);
 
   if (_init_by_dart) {
@@ -0,0 +1,277 @@
+/**
+ * \file dart_io_file.c
+ *
+ * Parallel file access using MPI-IO.
+ */
+
+#include <dash/dart/if/dart_types.h>
+#include <dash/dart/if/dart_io.h>
+
+#include <dash/dart/mpi/dart_team_private.h>
+
+#include <dash/dart/base/logging.h>
+
+#include <mpi.h>
+#include <stdlib.h>
+#include <limits.h>
+
+struct dart_file_struct
+{
+  MPI_File fh;
+};
+
+/**
+ * MPI uses count type int, transfers of more than INT_MAX bytes use
+ * a derived datatype of INT_MAX-sized chunks and the remainder.
+ */
+static void dart__io__byte_type(
+  size_t         nbytes,
+  MPI_Datatype * type,
+  int          * count)
+{
+  if (nbytes <= INT_MAX) {
+    *type  = MPI_BYTE;
+    *count = (int)nbytes;
+    return;
+  }
+  MPI_Datatype chunk_type;
+  MPI_Type_contiguous(INT_MAX, MPI_BYTE, &chunk_type);
+  size_t       nchunks      = nbytes / INT_MAX;
+  int          blocklens[2] = { (int)nchunks, (int)(nbytes % INT_MAX) };
+  MPI_Aint     displs[2]    = { 0, (MPI_Aint)(nchunks * INT_MAX) };
+  MPI_Datatype types[2]     = { chunk_type, MPI_BYTE };
+  MPI_Type_create_struct(2, blocklens, displs, types, type);
+  MPI_Type_commit(type);
+  MPI_Type_free(&chunk_type);
+  *count = 1;
+}
+
+static void dart__io__byte_type_free(
+  MPI_Datatype * type)
+{
+  if (*type != MPI_BYTE) {
+    MPI_Type_free(type);
+  }
+}
+
+dart_ret_t dart__io__file_open(
+  dart_team_t   teamid,
+  const char  * filename,
+  int           mode,
+  dart_file_t * file)
+{
+  uint16_t index;
+  DART_LOG_TRACE("dart__io__file_open() team:%d file:%s mode:%d",
+                 teamid, filename, mode);
+
+  if (dart_adapt_teamlist_convert(teamid, &index) == -1) {
+    DART_LOG_ERROR("dart__io__file_open ! team:%d "
+                   "dart_adapt_teamlist_convert failed", teamid);
+    return DART_ERR_INVAL;
+  }
+  MPI_Comm comm = dart_team_data[index].comm;
+
+  int amode = 0;
+  if ((mode & DART_FILE_READ) && (mode & DART_FILE_WRITE)) {
+    amode = MPI_MODE_RDWR;
+  } else if (mode & DART_FILE_WRITE) {
+    amode = MPI_MODE_WRONLY;
+  } else if (mode & DART_FILE_READ) {
+    amode = MPI_MODE_RDONLY;
+  } else {
+    DART_LOG_ERROR("dart__io__file_open ! invalid mode %d", mode);
+    return DART_ERR_INVAL;
+  }
+  if (mode & DART_FILE_CREATE) {
+    amode |= MPI_MODE_CREATE;
+  }
+
+  struct dart_file_struct * f = malloc(sizeof(struct dart_file_struct));
+  if (MPI_File_open(comm, (char *)filename, amode, MPI_INFO_NULL, &f->fh)
+      != MPI_SUCCESS) {
+    DART_LOG_ERROR("dart__io__file_open ! MPI_File_open failed for %s",
+                   filename);
+    free(f);
+    return DART_ERR_OTHER;
+  }
+  if ((mode & DART_FILE_CREATE) &&
+      MPI_File_set_size(f->fh, 0) != MPI_SUCCESS) {
+    DART_LOG_ERROR("dart__io__file_open ! MPI_File_set_size failed for %s",
+                   filename);
+    MPI_File_close(&f->fh);
+    free(f);
+    return DART_ERR_OTHER;
+  }
+  *file = f;
+  return DART_OK;
+}
+
+dart_ret_t dart__io__file_close(
+  dart_file_t * file)
+{
+  DART_LOG_TRACE("dart__io__file_close()");
+  if (file == NULL || *file == NULL) {
+    return DART_ERR_INVAL;
+  }
+  int ret = MPI_File_close(&(*file)->fh);
+  free(*file);
+  *file = NULL;
+  return (ret == MPI_SUCCESS) ? DART_OK : DART_ERR_OTHER;
+}
+
+dart_ret_t dart__io__file_size(
+  dart_file_t   file,
+  size_t      * nbytes)
+{
+  MPI_Offset size;
+  if (MPI_File_get_size(file->fh, &size) != MPI_SUCCESS) {
+    DART_LOG_ERROR("dart__io__file_size ! MPI_File_get_size failed");
+    return DART_ERR_OTHER;
+  }
+  *nbytes = (size_t)size;
+  return DART_OK;
+}
+
+dart_ret_t dart__io__file_set_view(
+  dart_file_t    file,
+  size_t         disp,
+  size_t         nruns,
+  const size_t * run_offsets,
+  const size_t * run_nbytes)
+{
+  DART_LOG_TRACE("dart__io__file_set_view() disp:%zu nruns:%zu",
+                 disp, nruns);
+  if (nruns == 0) {
+    if (MPI_File_set_view(file->fh, (MPI_Offset)disp, MPI_BYTE, MPI_BYTE,
+                          "native", MPI_INFO_NULL) != MPI_SUCCESS) {
+      DART_LOG_ERROR("dart__io__file_set_view ! MPI_File_set_view failed");
+      return DART_ERR_OTHER;
+    }
+    return DART_OK;
+  }
+
+  // Split runs exceeding the int block length of MPI
+  size_t nblocks = 0;
+  for (size_t r = 0; r < nruns; ++r) {
+    nblocks += (run_nbytes[r] + INT_MAX - 1) / INT_MAX;
+  }
+  if (nblocks > INT_MAX) {
+    DART_LOG_ERROR("dart__io__file_set_view ! failed: nblocks > INT_MAX");
+    return DART_ERR_INVAL;
+  }
+  int      * blocklens = malloc(nblocks * sizeof(int));
+  MPI_Aint * displs    = malloc(nblocks * sizeof(MPI_Aint));
+  size_t     b         = 0;
+  for (size_t r = 0; r < nruns; ++r) {
+    size_t offset = run_offsets[r];
+    size_t nbytes = run_nbytes[r];
+    while (nbytes > 0) {
+      size_t len   = (nbytes > INT_MAX) ? INT_MAX : nbytes;
+      blocklens[b] = (int)len;
+      displs[b]    = (MPI_Aint)offset;
+      offset      += len;
+      nbytes      -= len;
+      ++b;
+    }
+  }
+
+  MPI_Datatype filetype;
+  MPI_Type_create_hindexed((int)b, blocklens, displs, MPI_BYTE, &filetype);
+  MPI_Type_commit(&filetype);
+  int ret = MPI_File_set_view(file->fh, (MPI_Offset)disp, MPI_BYTE,
+                              filetype, "native", MPI_INFO_NULL);
+  MPI_Type_free(&filetype);
+  free(blocklens);
+  free(displs);
+  if (ret != MPI_SUCCESS) {
+    DART_LOG_ERROR("dart__io__file_set_view ! MPI_File_set_view failed");
+    return DART_ERR_OTHER;
+  }
+  return DART_OK;
+}
+
+dart_ret_t dart__io__file_write_at(
+  dart_file_t   file,
+  size_t        offset,
+  const void  * buf,
+  size_t        nbytes)
+{
+  MPI_Datatype type;
+  int          count;
+  DART_LOG_TRACE("dart__io__file_write_at() offset:%zu nbytes:%zu",
+                 offset, nbytes);
+  dart__io__byte_type(nbytes, &type, &count);
+  int ret = MPI_File_write_at(file->fh, (MPI_Offset)offset, (void *)buf,
+                              count, type, MPI_STATUS_IGNORE);
+  dart__io__byte_type_free(&type);
+  if (ret != MPI_SUCCESS) {
+    DART_LOG_ERROR("dart__io__file_write_at ! MPI_File_write_at failed");
+    return DART_ERR_OTHER;
+  }
+  return DART_OK;
+}
+
+dart_ret_t dart__io__file_read_at(
+  dart_file_t   file,
+  size_t        offset,
+  void        * buf,
+  size_t        nbytes)
+{
+  MPI_Datatype type;
+  int          count;
+  DART_LOG_TRACE("dart__io__file_read_at() offset:%zu nbytes:%zu",
+                 offset, nbytes);
+  dart__io__byte_type(nbytes, &type, &count);
+  int ret = MPI_File_read_at(file->fh, (MPI_Offset)offset, buf,
+                             count, type, MPI_STATUS_IGNORE);
+  dart__io__byte_type_free(&type);
+  if (ret != MPI_SUCCESS) {
+    DART_LOG_ERROR("dart__io__file_read_at ! MPI_File_read_at failed");
+    return DART_ERR_OTHER;
+  }
+  return DART_OK;
+}
+
+dart_ret_t dart__io__file_write_at_all(
+  dart_file_t   file,
+  size_t        offset,
+  const void  * buf,
+  size_t        nbytes)
+{
+  MPI_Datatype type;
+  int          count;
+  DART_LOG_TRACE("dart__io__file_write_at_all() offset:%zu nbytes:%zu",
+                 offset, nbytes);
+  dart__io__byte_type(nbytes, &type, &count);
+  int ret = MPI_File_write_at_all(file->fh, (MPI_Offset)offset, (void *)buf,
+                                  count, type, MPI_STATUS_IGNORE);
+  dart__io__byte_type_free(&type);
+  if (ret != MPI_SUCCESS) {
+    DART_LOG_ERROR("dart__io__file_write_at_all ! "
+                   "MPI_File_write_at_all failed");
+    return DART_ERR_OTHER;
+  }
+  return DART_OK;
+}
+
+dart_ret_t dart__io__file_read_at_all(
+  dart_file_t   file,
+  size_t        offset,
+  void        * buf,
+  size_t        nbytes)
+{
+  MPI_Datatype type;
+  int          count;
+  DART_LOG_TRACE("dart__io__file_read_at_all() offset:%zu nbytes:%zu",
+                 offset, nbytes);
+  dart__io__byte_type(nbytes, &type, &count);
+  int ret = MPI_File_read_at_all(file->fh, (MPI_Offset)offset, buf,
+                                 count, type, MPI_STATUS_IGNORE);
+  dart__io__byte_type_free(&type);
+  if (ret != MPI_SUCCESS) {
+    DART_LOG_ERROR("dart__io__file_read_at_all ! "
+                   "MPI_File_read_at_all failed");
+    return DART_ERR_OTHER;
+  }
+  return DART_OK;
+}
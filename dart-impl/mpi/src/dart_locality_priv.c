@@ -3,7 +3,9 @@
  *
  */
 
+#define _GNU_SOURCE
 #include <dash/dart/mpi/dart_locality_priv.h>
+#include <dash/dart/mpi/dart_team_private.h>
 
 #include <dash/dart/if/dart_types.h>
 #include <dash/dart/if/dart_communication.h>
@@ -11,14 +13,203 @@
 
 #include <dash/dart/base/logging.h>
 #include <dash/dart/base/locality.h>
+#include <dash/dart/base/hwinfo.h>
+#include <dash/dart/base/internal/unit_locality.h>
 
+#include <mpi.h>
+#include <sched.h>
+#include <string.h>
+#include <stdlib.h>
+
+/**
+ * Collects the locality information of all units in \c DART_TEAM_ALL and
+ * the locations of modules in all nodes.
+ *
+ * Hardware locality is resolved by a single leader unit per node, loading
+ * the node's hardware topology once for all units on the node. Locality
+ * information is then exchanged between node leaders only and broadcast
+ * to the units in every node, instead of an allgather across all units.
+ *
+ * This reduces the number of messages, not the memory footprint: every
+ * unit still receives the locality records of all units, i.e. O(P)
+ * memory per unit, as the locality domain hierarchy and
+ * \c dart_unit_locality resolve records of arbitrary units locally.
+ *
+ * Collective operation on \c DART_TEAM_ALL.
+ */
+static dart_ret_t dart__mpi__locality_exchange(
+  dart_unit_mapping_t     ** unit_mapping_out,
+  dart_module_location_t  ** module_locations_out,
+  int                      * num_modules_out)
+{
+  int myid, nunits;
+  MPI_Comm_rank(DART_COMM_WORLD, &myid);
+  MPI_Comm_size(DART_COMM_WORLD, &nunits);
+
+  DART_LOG_DEBUG("dart__mpi__locality_exchange()");
+
+  /* Units sharing memory, i.e. units in the same node: */
+  MPI_Comm node_comm;
+  MPI_Comm_split_type(DART_COMM_WORLD, MPI_COMM_TYPE_SHARED, myid,
+                      MPI_INFO_NULL, &node_comm);
+  int node_myid, node_nunits;
+  MPI_Comm_rank(node_comm, &node_myid);
+  MPI_Comm_size(node_comm, &node_nunits);
+  int is_leader = (node_myid == 0);
+
+  /* Leaders of all nodes: */
+  MPI_Comm leader_comm;
+  MPI_Comm_split(DART_COMM_WORLD, is_leader ? 0 : MPI_UNDEFINED, myid,
+                 &leader_comm);
+
+  /* Locality records are transferred as opaque bytes: */
+  MPI_Datatype uloc_type;
+  MPI_Type_contiguous(sizeof(dart_unit_locality_t), MPI_BYTE, &uloc_type);
+  MPI_Type_commit(&uloc_type);
+  MPI_Datatype hwinfo_type;
+  MPI_Type_contiguous(sizeof(dart_hwinfo_t), MPI_BYTE, &hwinfo_type);
+  MPI_Type_commit(&hwinfo_type);
+  MPI_Datatype module_type;
+  MPI_Type_contiguous(sizeof(dart_module_location_t), MPI_BYTE,
+                      &module_type);
+  MPI_Type_commit(&module_type);
+
+  /* Resolve hardware locality of all units in the node at the leader: */
+  int cpu_id = sched_getcpu();
+  int             * node_cpu_ids     = NULL;
+  dart_hwinfo_t   * node_hwinfos     = NULL;
+  dart_module_location_t * node_modules = NULL;
+  int               node_num_modules = 0;
+  if (is_leader) {
+    node_cpu_ids = malloc(node_nunits * sizeof(int));
+    node_hwinfos = malloc(node_nunits * sizeof(dart_hwinfo_t));
+  }
+  MPI_Gather(&cpu_id, 1, MPI_INT, node_cpu_ids, 1, MPI_INT, 0, node_comm);
+  dart_ret_t ret = DART_OK;
+  if (is_leader) {
+    ret = dart_hwinfo_node(node_nunits, node_cpu_ids, node_hwinfos,
+                           &node_modules, &node_num_modules);
+    if (ret != DART_OK) {
+      DART_LOG_ERROR("dart__mpi__locality_exchange ! "
+                     "dart_hwinfo_node failed: %d", ret);
+    }
+  }
+  dart_unit_locality_t uloc;
+  memset(&uloc, 0, sizeof(dart_unit_locality_t));
+  MPI_Scatter(node_hwinfos, 1, hwinfo_type, &uloc.hwinfo, 1, hwinfo_type,
+              0, node_comm);
+  uloc.unit.id       = myid;
+  uloc.team          = DART_TEAM_ALL;
+  uloc.domain_tag[0] = '\0';
+
+  /* Gather locality of units in the node at the leader: */
+  dart_unit_locality_t * node_ulocs = NULL;
+  if (is_leader) {
+    node_ulocs = malloc(node_nunits * sizeof(dart_unit_locality_t));
+  }
+  MPI_Gather(&uloc, 1, uloc_type, node_ulocs, 1, uloc_type, 0, node_comm);
+
+  /* Exchange locality of nodes between leaders: */
+  dart_unit_locality_t   * ulocs       = malloc(
+                                           nunits *
+                                           sizeof(dart_unit_locality_t));
+  dart_module_location_t * modules     = NULL;
+  int                      num_modules = 0;
+  if (is_leader) {
+    int   num_leaders;
+    MPI_Comm_size(leader_comm, &num_leaders);
+    int * counts = malloc(num_leaders * sizeof(int));
+    int * displs = malloc(num_leaders * sizeof(int));
+
+    MPI_Allgather(&node_nunits, 1, MPI_INT, counts, 1, MPI_INT,
+                  leader_comm);
+    displs[0] = 0;
+    for (int l = 1; l < num_leaders; ++l) {
+      displs[l] = displs[l-1] + counts[l-1];
+    }
+    MPI_Allgatherv(node_ulocs, node_nunits, uloc_type,
+                   ulocs, counts, displs, uloc_type, leader_comm);
+
+    MPI_Allgather(&node_num_modules, 1, MPI_INT, counts, 1, MPI_INT,
+                  leader_comm);
+    displs[0] = 0;
+    for (int l = 1; l < num_leaders; ++l) {
+      displs[l] = displs[l-1] + counts[l-1];
+    }
+    num_modules = displs[num_leaders-1] + counts[num_leaders-1];
+    if (num_modules > 0) {
+      modules = malloc(num_modules * sizeof(dart_module_location_t));
+    }
+    MPI_Allgatherv(node_modules, node_num_modules, module_type,
+                   modules, counts, displs, module_type, leader_comm);
+
+    free(counts);
+    free(displs);
+    MPI_Comm_free(&leader_comm);
+  }
+
+  /* Distribute locality of all units to the units in the node, every unit
+   * holds the records of all units: */
+  MPI_Bcast(ulocs, nunits, uloc_type, 0, node_comm);
+  MPI_Bcast(&num_modules, 1, MPI_INT, 0, node_comm);
+  if (num_modules > 0) {
+    if (!is_leader) {
+      modules = malloc(num_modules * sizeof(dart_module_location_t));
+    }
+    MPI_Bcast(modules, num_modules, module_type, 0, node_comm);
+  }
+  /* Fail at all units if locality of any node could not be resolved: */
+  int node_ret = ret;
+  int all_ret  = DART_OK;
+  MPI_Allreduce(&node_ret, &all_ret, 1, MPI_INT, MPI_MAX, DART_COMM_WORLD);
+  ret = all_ret;
+
+  /* Locality records are ordered by node, order them by unit id: */
+  dart_unit_mapping_t * mapping = malloc(sizeof(dart_unit_mapping_t));
+  mapping->num_units       = nunits;
+  mapping->team            = DART_TEAM_ALL;
+  mapping->unit_localities = malloc(nunits * sizeof(dart_unit_locality_t));
+  for (int u = 0; u < nunits; ++u) {
+    mapping->unit_localities[ulocs[u].unit.id] = ulocs[u];
+  }
+
+  free(ulocs);
+  free(node_ulocs);
+  free(node_modules);
+  free(node_hwinfos);
+  free(node_cpu_ids);
+  MPI_Type_free(&module_type);
+  MPI_Type_free(&hwinfo_type);
+  MPI_Type_free(&uloc_type);
+  MPI_Comm_free(&node_comm);
+
+  *unit_mapping_out     = mapping;
+  *module_locations_out = modules;
+  *num_modules_out      = num_modules;
+
+  DART_LOG_DEBUG("dart__mpi__locality_exchange > units:%d modules:%d",
+                 nunits, num_modules);
+  return ret;
+}
 
 dart_ret_t dart__mpi__locality_init()
 {
   DART_LOG_DEBUG("dart__mpi__locality_init()");
   dart_ret_t ret;
 
-  ret = dart__base__locality__init();
+  dart_unit_mapping_t    * unit_mapping;
+  dart_module_location_t * module_locations;
+  int                      num_modules;
+  ret = dart__mpi__locality_exchange(
+          &unit_mapping, &module_locations, &num_modules);
+  if (ret != DART_OK) {
+    DART_LOG_ERROR("dart__mpi__locality_init ! "
+                   "dart__mpi__locality_exchange failed: %d", ret);
+    return ret;
+  }
+
+  ret = dart__base__locality__init(
+          unit_mapping, module_locations, num_modules);
   if (ret != DART_OK) {
     DART_LOG_ERROR("dart__mpi__locality_init ! "
                    "dart__base__locality__init failed: %d", ret);
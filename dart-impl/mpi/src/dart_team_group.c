@@ -573,85 +573,159 @@ dart_ret_t dart_team_get_group(
 }
 
 /**
- * Create a team as child of the specified team with units in
- * given group.
+ * Create the team consisting of the units in the given group, or reuse
+ * the communicator and window of a destroyed team with identical units.
  *
+ * Collective operation on the parent team, \c group is \c MPI_GROUP_NULL
+ * at units not contained in the new team. Disjoint groups are specified
+ * by different values of \c color.
+ * The team ID and whether communicators have to be created is agreed on
+ * in a single reduction on the parent team, the communicators of all
+ * groups are then created in a single split of the parent team.
  */
-dart_ret_t dart_team_create(
+static dart_ret_t dart__mpi__team_create_from_group(
   dart_team_t          teamid,
-  const dart_group_t   group,
+  MPI_Group            group,
+  int                  color,
   dart_team_t        * newteam)
 {
-  MPI_Comm    comm;
-  MPI_Comm    subcomm;
-  MPI_Win     win;
   uint16_t    index,
               unique_id;
-  dart_team_t max_teamid = -1;
 
   *newteam = DART_TEAM_NULL;
 
-  if (group->mpi_group == MPI_GROUP_NULL) {
-    return DART_OK;
-  }
-
-  if (group == NULL) {
-    DART_LOG_ERROR("Invalid group argument: %p", group);
-    return DART_ERR_INVAL;
-  }
-
-
   int result = dart_adapt_teamlist_convert(teamid, &unique_id);
   if (result == -1) {
     return DART_ERR_INVAL;
   }
-  comm = dart_team_data[unique_id].comm;
-  subcomm = MPI_COMM_NULL;
+  MPI_Comm comm = dart_team_data[unique_id].comm;
+
+  int rank = MPI_UNDEFINED;
+  if (group != MPI_GROUP_NULL) {
+    MPI_Group_rank(group, &rank);
+  }
+  int is_member = (rank != MPI_UNDEFINED);
 
-  MPI_Comm_create(comm, group->mpi_group, &subcomm);
+  dart_team_data_t team_data;
+  int cached = is_member && dart_adapt_teamcache_take(group, &team_data);
 
   /* Get the maximum next_availteamid among all the units belonging to
-   * the parent team specified by 'teamid'. */
+   * the parent team specified by 'teamid', and whether any unit has to
+   * create a communicator. */
+  int32_t local[2]  = { dart_next_availteamid, is_member && !cached };
+  int32_t global[2] = { -1, 0 };
   MPI_Allreduce(
-    &dart_next_availteamid,
-    &max_teamid,
-    1,
+    local,
+    global,
+    2,
     MPI_INT32_T,
     MPI_MAX,
     comm);
-  dart_next_availteamid = max_teamid + 1;
-
-  dart_team_data_t * team_data = NULL;
-  if (subcomm != MPI_COMM_NULL) {
-    int result = dart_adapt_teamlist_alloc(max_teamid, &index);
-    if (result == -1) {
-      return DART_ERR_OTHER;
+  dart_team_t max_teamid = global[0];
+  dart_next_availteamid  = max_teamid + 1;
+
+  if (global[1]) {
+    /* Units reusing cached team data do not take part in the new
+     * communicators: */
+    MPI_Comm subcomm = MPI_COMM_NULL;
+    MPI_Comm_split(
+      comm,
+      (is_member && !cached) ? color : MPI_UNDEFINED,
+      rank,
+      &subcomm);
+    if (subcomm != MPI_COMM_NULL) {
+      team_data.comm = subcomm;
+      MPI_Win_create_dynamic(MPI_INFO_NULL, subcomm, &team_data.window);
+#if !defined(DART_MPI_DISABLE_SHARED_WINDOWS)
+      dart_allocate_shared_comm(&team_data);
+#endif
+      MPI_Win_lock_all(0, team_data.window);
     }
-    /* max_teamid is thought to be the new created team ID. */
-    *newteam = max_teamid;
-    team_data = &dart_team_data[index];
-    team_data->comm = subcomm;
-    MPI_Win_create_dynamic(MPI_INFO_NULL, subcomm, &win);
-    team_data->window = win;
+  }
+  if (!is_member) {
+    return DART_OK;
   }
 
-  if (subcomm != MPI_COMM_NULL) {
-#if !defined(DART_MPI_DISABLE_SHARED_WINDOWS)
-    dart_allocate_shared_comm(team_data);
-#endif
-    MPI_Win_lock_all(0, win);
-    DART_LOG_DEBUG("TEAMCREATE - create team %d from parent team %d",
-                   *newteam, teamid);
+  result = dart_adapt_teamlist_alloc(max_teamid, &index);
+  if (result == -1) {
+    dart_adapt_teamdata_free(&team_data);
+    return DART_ERR_OTHER;
   }
+  /* max_teamid is thought to be the new created team ID. */
+  *newteam = max_teamid;
+  dart_team_data[index] = team_data;
+  DART_LOG_DEBUG("TEAMCREATE - create team %d from parent team %d%s",
+                 *newteam, teamid, cached ? " (cached)" : "");
 
   return DART_OK;
 }
 
+/**
+ * Create a team as child of the specified team with units in
+ * given group.
+ *
+ */
+dart_ret_t dart_team_create(
+  dart_team_t          teamid,
+  const dart_group_t   group,
+  dart_team_t        * newteam)
+{
+  *newteam = DART_TEAM_NULL;
+
+  if (group == NULL) {
+    DART_LOG_ERROR("Invalid group argument: %p", group);
+    return DART_ERR_INVAL;
+  }
+  if (group->mpi_group == MPI_GROUP_NULL) {
+    return DART_OK;
+  }
+
+  return dart__mpi__team_create_from_group(
+           teamid, group->mpi_group, 0, newteam);
+}
+
+dart_ret_t dart_team_split(
+  dart_team_t          teamid,
+  size_t               num_groups,
+  const dart_group_t * groups,
+  dart_team_t        * newteam,
+  size_t             * group_idx)
+{
+  DART_LOG_DEBUG("dart_team_split() teamid:%d groups:%zu",
+                 teamid, num_groups);
+
+  *newteam   = DART_TEAM_NULL;
+  *group_idx = num_groups;
+
+  /* The groups are disjoint, find the group containing the calling unit: */
+  MPI_Group my_group = MPI_GROUP_NULL;
+  for (size_t g = 0; g < num_groups; ++g) {
+    if (groups[g] == NULL) {
+      DART_LOG_ERROR("Invalid group argument: %p", groups[g]);
+      return DART_ERR_INVAL;
+    }
+    if (groups[g]->mpi_group == MPI_GROUP_NULL) {
+      continue;
+    }
+    int rank;
+    MPI_Group_rank(groups[g]->mpi_group, &rank);
+    if (rank != MPI_UNDEFINED) {
+      my_group   = groups[g]->mpi_group;
+      *group_idx = g;
+      break;
+    }
+  }
+
+  dart_ret_t ret = dart__mpi__team_create_from_group(
+                     teamid, my_group, (int)(*group_idx), newteam);
+  DART_LOG_DEBUG("dart_team_split > teamid:%d newteam:%d group:%zu",
+                 teamid, *newteam, *group_idx);
+  return ret;
+}
+
 dart_ret_t dart_team_destroy(
   dart_team_t * teamid)
 {
-  MPI_Comm    comm;
-  MPI_Win     win;
   uint16_t    index;
 
   DART_LOG_DEBUG("dart_team_destroy() teamid:%d", *teamid);
@@ -665,23 +739,14 @@ dart_ret_t dart_team_destroy(
     return DART_ERR_INVAL;
   }
 
-  dart_team_data_t *team_data = &dart_team_data[index];
-
-  comm = team_data->comm;
-
-  // free(dart_unit_mapping[index]);
-
-  // MPI_Win_free (&(sharedmem_win_list[index]));
-#if !defined(DART_MPI_DISABLE_SHARED_WINDOWS)
-  free(team_data->sharedmem_tab);
-#endif
-  win = team_data->window;
-  MPI_Win_unlock_all(win);
-  MPI_Win_free(&win);
+  dart_team_data_t team_data = dart_team_data[index];
   dart_adapt_teamlist_recycle(index, result);
 
-  /* -- Release the communicator associated with teamid -- */
-  MPI_Comm_free(&comm);
+  /* -- Keep the communicator and window for teams with identical units,
+   *    or release them -- */
+  if (!dart_adapt_teamcache_insert(*teamid, &team_data)) {
+    dart_adapt_teamdata_free(&team_data);
+  }
 
   DART_LOG_DEBUG("dart_team_destroy > teamid:%d", *teamid);
 
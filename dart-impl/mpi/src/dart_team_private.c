@@ -3,6 +3,8 @@
  *  @brief Implementations for the operations on teamlist.
  */
 #include <stdio.h>
+#include <stdlib.h>
+#include <stdint.h>
 #include <dash/dart/if/dart_types.h>
 #include <dash/dart/if/dart_team_group.h>
 #include <dash/dart/mpi/dart_team_private.h>
@@ -12,32 +14,15 @@ dart_team_t dart_next_availteamid = (DART_TEAM_ALL + 1);
 
 MPI_Comm dart_comm_world;
 
-#if 0
-MPI_Comm dart_teams[DART_MAX_TEAM_NUMBER];
+dart_team_data_t * dart_team_data = NULL;
 
-#if !defined(DART_MPI_DISABLE_SHARED_WINDOWS)
-MPI_Comm dart_sharedmem_comm_list[DART_MAX_TEAM_NUMBER];
-#endif
-
-MPI_Win dart_win_lists[DART_MAX_TEAM_NUMBER];
-
-#if !defined(DART_MPI_DISABLE_SHARED_WINDOWS)
-int* dart_sharedmem_table[DART_MAX_TEAM_NUMBER];
-int dart_sharedmemnode_size[DART_MAX_TEAM_NUMBER];
-#endif
-
-#endif // 0
-
-dart_team_data_t dart_team_data[DART_MAX_TEAM_NUMBER];
+/* Number of slots in dart_team_data, the table grows on demand */
+static int dart_team_data_capacity = 0;
 
-struct dart_free_teamlist_entry {
-  struct dart_free_teamlist_entry * next;
-  uint16_t index;
-};
-typedef struct dart_free_teamlist_entry dart_free_entry;
-typedef dart_free_entry* dart_free_teamlist_ptr;
-
-dart_free_teamlist_ptr dart_free_teamlist_header;
+/* Stack of indices of free slots in dart_team_data, slots of destroyed
+ * teams are reused before the table grows */
+static uint16_t * dart_free_teamlist      = NULL;
+static int        dart_free_teamlist_size = 0;
 
 /* Structure of the allocated teamlist entry */
 struct dart_allocated_teamlist_entry
@@ -48,94 +33,97 @@ struct dart_allocated_teamlist_entry
 typedef struct dart_allocated_teamlist_entry dart_allocated_entry;
 
 /* This array is used to store all the correspondences between indice and teams */
-dart_allocated_entry dart_allocated_teamlist_array[DART_MAX_TEAM_NUMBER];
+dart_allocated_entry * dart_allocated_teamlist_array = NULL;
 
 
 /* Indicate the length of the allocated teamlist */
 int dart_allocated_teamlist_size;
 
-int dart_adapt_teamlist_init ()
+/* Grow the team table to the given number of slots and push the indices
+ * of new slots to the free list */
+static int dart_adapt_teamlist_grow(int capacity)
 {
-	int i;
-	dart_free_teamlist_ptr pre = NULL;
-	dart_free_teamlist_ptr newAllocateEntry;
-	for (i = 0; i < DART_MAX_TEAM_NUMBER; i++) {
-		newAllocateEntry =
-      (dart_free_teamlist_ptr)malloc(sizeof (dart_free_entry));
-		newAllocateEntry -> index = i;
-		if (pre != NULL) {
-			pre -> next = newAllocateEntry;
-		} else {
-			dart_free_teamlist_header = newAllocateEntry;
-		}
-		pre = newAllocateEntry;
+	if (capacity > UINT16_MAX + 1) {
+		capacity = UINT16_MAX + 1;
+	}
+	if (capacity <= dart_team_data_capacity) {
+		DART_LOG_ERROR("Out of bound: exceed the maximum number of teams (%d)",
+		               dart_team_data_capacity);
+		return -1;
 	}
-	newAllocateEntry -> next = NULL;
+	dart_team_data_t * team_data = realloc(
+	  dart_team_data, capacity * sizeof(dart_team_data_t));
+	dart_allocated_entry * allocated = realloc(
+	  dart_allocated_teamlist_array, capacity * sizeof(dart_allocated_entry));
+	uint16_t * free_list = realloc(
+	  dart_free_teamlist, capacity * sizeof(uint16_t));
+	if (team_data == NULL || allocated == NULL || free_list == NULL) {
+		DART_LOG_ERROR("Failed to grow team table to %d teams", capacity);
+		return -1;
+	}
+	dart_team_data                = team_data;
+	dart_allocated_teamlist_array = allocated;
+	dart_free_teamlist            = free_list;
+	/* Push new slots in decreasing order so lower indices are used first */
+	for (int i = capacity - 1; i >= dart_team_data_capacity; i--) {
+		dart_free_teamlist[dart_free_teamlist_size++] = (uint16_t)i;
+	}
+	DART_LOG_DEBUG("dart_adapt_teamlist_grow: %d -> %d team slots",
+	               dart_team_data_capacity, capacity);
+	dart_team_data_capacity = capacity;
+	return 0;
+}
 
+int dart_adapt_teamlist_init ()
+{
+	dart_team_data_capacity = 0;
+	dart_free_teamlist_size = 0;
 	dart_allocated_teamlist_size = 0;
-	return 0;
+	return dart_adapt_teamlist_grow(DART_INIT_TEAM_NUMBER);
 }
 
 int dart_adapt_teamlist_destroy ()
 {
-	dart_free_teamlist_ptr pre, p = dart_free_teamlist_header;
-	while (p) {
-		pre = p;
-		p = p -> next;
-		free (pre);
-	}
-	dart_allocated_teamlist_size = 0;
+	free(dart_free_teamlist);
+	free(dart_allocated_teamlist_array);
+	free(dart_team_data);
+	dart_free_teamlist            = NULL;
+	dart_allocated_teamlist_array = NULL;
+	dart_team_data                = NULL;
+	dart_team_data_capacity       = 0;
+	dart_free_teamlist_size       = 0;
+	dart_allocated_teamlist_size  = 0;
 	return 0;
 }
 
 int dart_adapt_teamlist_alloc (dart_team_t teamid, uint16_t* index)
 {
-	dart_free_teamlist_ptr p;
-	if (dart_free_teamlist_header != NULL) {
-		*index = dart_free_teamlist_header -> index;
-		p = dart_free_teamlist_header;
-
-		dart_free_teamlist_header = dart_free_teamlist_header -> next;
-		free (p);
-#if 0
-		for (j = dart_allocated_teamlist_size - 1; (j>=0)&&(dart_allocated_teamlist_array[j].allocated_teamid > teamid); j--)
-		{
-			dart_allocated_teamlist_array[j + 1].index = dart_allocated_teamlist_array[j].index;
-			dart_allocated_teamlist_array[j + 1].allocated_teamid = dart_allocated_teamlist_array[j].allocated_teamid;
-		}
-		dart_allocated_teamlist_array[j+1].index = *index;
-		dart_allocated_teamlist_array[j+1].allocated_teamid = teamid;
-#endif
-
-		/* The allocated teamlist array should be arranged in an increasing order based on
-		 * the member of allocated_teamid.
-		 *
-		 * Notes: the newly created teamid will always be increased because the teamid
-		 * is not reused after certain team is destroyed.
-		 */
-		dart_allocated_teamlist_array[dart_allocated_teamlist_size].index = *index;
-		dart_allocated_teamlist_array[dart_allocated_teamlist_size].allocated_teamid = teamid;
-		dart_allocated_teamlist_size ++;
-
-		/* If allocated successfully, the position of the new element in the allcoated array
-		 * is returned.
-		 */
-		return (dart_allocated_teamlist_size - 1);
-
-	} else {
-		DART_LOG_ERROR ("Out of bound: exceed the MAX_TEAM_NUMBER limit");
+	if (dart_free_teamlist_size == 0 &&
+	    dart_adapt_teamlist_grow(2 * dart_team_data_capacity) != 0) {
 		return -1;
 	}
+	*index = dart_free_teamlist[--dart_free_teamlist_size];
+
+	/* The allocated teamlist array should be arranged in an increasing order based on
+	 * the member of allocated_teamid.
+	 *
+	 * Notes: the newly created teamid will always be increased because the teamid
+	 * is not reused after certain team is destroyed.
+	 */
+	dart_allocated_teamlist_array[dart_allocated_teamlist_size].index = *index;
+	dart_allocated_teamlist_array[dart_allocated_teamlist_size].allocated_teamid = teamid;
+	dart_allocated_teamlist_size ++;
+
+	/* If allocated successfully, the position of the new element in the allcoated array
+	 * is returned.
+	 */
+	return (dart_allocated_teamlist_size - 1);
 }
 
 int dart_adapt_teamlist_recycle (uint16_t index, int pos)
 {
 	int i;
-	dart_free_teamlist_ptr newAllocateEntry =
-    (dart_free_teamlist_ptr)malloc (sizeof (dart_free_entry));
-	newAllocateEntry -> index = index;
-	newAllocateEntry -> next = dart_free_teamlist_header;
-	dart_free_teamlist_header = newAllocateEntry;
+	dart_free_teamlist[dart_free_teamlist_size++] = index;
 	/* The allocated teamlist array should be keep as an ordered array
 	 * after deleting the given element.
 	 */
@@ -184,6 +172,104 @@ int dart_adapt_teamlist_convert(
 	}
 }
 
+/* Maximum number of destroyed teams kept for reuse */
+#define DART_TEAM_CACHE_SIZE (16)
+
+/* Structure of a cached team entry */
+struct dart_teamcache_entry
+{
+	dart_team_t      teamid;
+	MPI_Group        group;
+	dart_team_data_t data;
+};
+typedef struct dart_teamcache_entry dart_teamcache_entry;
+
+static dart_teamcache_entry dart_teamcache[DART_TEAM_CACHE_SIZE];
+static int                  dart_teamcache_size = 0;
+
+void dart_adapt_teamdata_free(dart_team_data_t * team_data)
+{
+  MPI_Win_unlock_all(team_data->window);
+  MPI_Win_free(&team_data->window);
+#if !defined(DART_MPI_DISABLE_SHARED_WINDOWS)
+  free(team_data->sharedmem_tab);
+  team_data->sharedmem_tab = NULL;
+  if (team_data->sharedmem_comm != MPI_COMM_NULL) {
+    MPI_Comm_free(&team_data->sharedmem_comm);
+  }
+#endif
+  MPI_Comm_free(&team_data->comm);
+}
+
+int dart_adapt_teamcache_insert(
+  dart_team_t              teamid,
+  const dart_team_data_t * team_data)
+{
+  /* Units in the team must agree on caching, the number of cached entries
+   * depends on all teams a unit is member of: */
+  int can_cache = (dart_teamcache_size < DART_TEAM_CACHE_SIZE);
+  int all_can_cache;
+  MPI_Allreduce(&can_cache, &all_can_cache, 1, MPI_INT, MPI_MIN,
+                team_data->comm);
+  if (!all_can_cache) {
+    return 0;
+  }
+  dart_teamcache_entry * entry = &dart_teamcache[dart_teamcache_size++];
+  entry->teamid = teamid;
+  entry->data   = *team_data;
+  MPI_Comm_group(team_data->comm, &entry->group);
+  DART_LOG_DEBUG("dart_adapt_teamcache_insert: team %d cached, entries: %d",
+                 teamid, dart_teamcache_size);
+  return 1;
+}
+
+int dart_adapt_teamcache_take(
+  MPI_Group          group,
+  dart_team_data_t * team_data)
+{
+  /* Entries of teams with identical units are taken in the order of their
+   * team IDs so all units in the group select the same entry: */
+  int pos = -1;
+  for (int i = 0; i < dart_teamcache_size; i++) {
+    int cmp;
+    MPI_Group_compare(group, dart_teamcache[i].group, &cmp);
+    if (cmp == MPI_IDENT &&
+        (pos < 0 || dart_teamcache[i].teamid < dart_teamcache[pos].teamid)) {
+      pos = i;
+    }
+  }
+  if (pos < 0) {
+    return 0;
+  }
+  DART_LOG_DEBUG("dart_adapt_teamcache_take: reusing data of team %d",
+                 dart_teamcache[pos].teamid);
+  *team_data = dart_teamcache[pos].data;
+  MPI_Group_free(&dart_teamcache[pos].group);
+  for (int i = pos; i < dart_teamcache_size - 1; i++) {
+    dart_teamcache[i] = dart_teamcache[i + 1];
+  }
+  dart_teamcache_size--;
+  return 1;
+}
+
+int dart_adapt_teamcache_destroy()
+{
+  /* Free entries in the order of their team IDs to avoid deadlocks in
+   * collective operations on communicators shared by several units: */
+  while (dart_teamcache_size > 0) {
+    int pos = 0;
+    for (int i = 1; i < dart_teamcache_size; i++) {
+      if (dart_teamcache[i].teamid < dart_teamcache[pos].teamid) {
+        pos = i;
+      }
+    }
+    dart_adapt_teamdata_free(&dart_teamcache[pos].data);
+    MPI_Group_free(&dart_teamcache[pos].group);
+    dart_teamcache[pos] = dart_teamcache[--dart_teamcache_size];
+  }
+  return 0;
+}
+
 #if !defined(DART_MPI_DISABLE_SHARED_WINDOWS)
 dart_ret_t dart_allocate_shared_comm(dart_team_data_t *team_data)
 {
@@ -0,0 +1,54 @@
+/**
+ * \file dart_trace.c
+ *
+ * Communication counters and event traces, recorded in
+ * dart_communication.c.
+ */
+#include <dash/dart/base/logging.h>
+#include <dash/dart/base/trace.h>
+
+#include <dash/dart/if/dart_types.h>
+#include <dash/dart/if/dart_trace.h>
+
+
+dart_ret_t dart_trace_set_level(
+  dart_trace_level_t   level)
+{
+  DART_LOG_DEBUG("dart_trace_set_level() level:%d", level);
+  return dart__base__trace__set_level(level);
+}
+
+dart_ret_t dart_trace_level(
+  dart_trace_level_t * level)
+{
+  *level = dart__base__trace__level_;
+  return DART_OK;
+}
+
+dart_ret_t dart_trace_counter(
+  dart_trace_op_t        op,
+  dart_global_unit_t     target,
+  dart_trace_counter_t * counter)
+{
+  return dart__base__trace__counter(op, target.id, counter);
+}
+
+dart_ret_t dart_trace_histogram(
+  dart_trace_op_t        op,
+  uint64_t             * bins)
+{
+  return dart__base__trace__histogram(op, bins);
+}
+
+dart_ret_t dart_trace_reset()
+{
+  DART_LOG_DEBUG("dart_trace_reset()");
+  return dart__base__trace__reset();
+}
+
+dart_ret_t dart_trace_write(
+  const char         * filename)
+{
+  DART_LOG_DEBUG("dart_trace_write() file:%s", filename);
+  return dart__base__trace__write(filename);
+}
@@ -0,0 +1,311 @@
+/**
+ * \file dart_types.c
+ *
+ * User-defined reduce operations and data types.
+ *
+ * MPI does not pass a context to user-defined reduce functions.
+ * Every operation therefore reduces a duplicate of its operand type
+ * which identifies the operation by a cached attribute.
+ */
+#include <dash/dart/base/logging.h>
+
+#include <dash/dart/if/dart_types.h>
+
+#include <dash/dart/mpi/dart_communication_priv.h>
+
+#include <mpi.h>
+#include <stdint.h>
+#include <stdlib.h>
+
+
+dart__mpi__user_op_t * dart__mpi__user_ops       = NULL;
+size_t                 dart__mpi__num_user_ops   = 0;
+
+MPI_Datatype         * dart__mpi__user_types     = NULL;
+size_t                 dart__mpi__num_user_types = 0;
+
+/* Attribute key of operand types referencing the index of their
+ * operation */
+static int dart__mpi__op_keyval = MPI_KEYVAL_INVALID;
+
+static void dart__mpi__op_invoke(
+  void         * invec,
+  void         * inoutvec,
+  int          * len,
+  MPI_Datatype * dtype)
+{
+  void * attr_val;
+  int    flag = 0;
+  MPI_Type_get_attr(*dtype, dart__mpi__op_keyval, &attr_val, &flag);
+  if (!flag) {
+    DART_LOG_ERROR("dart__mpi__op_invoke ! operand type of unknown op");
+    return;
+  }
+  dart__mpi__user_op_t * user_op =
+    &dart__mpi__user_ops[(size_t)(intptr_t)attr_val];
+  user_op->op(invec, inoutvec, (size_t)(*len), user_op->userdata);
+}
+
+dart_ret_t dart_op_create(
+  dart_operator_t    op,
+  void             * userdata,
+  int32_t            commutative,
+  dart_datatype_t    dtype,
+  dart_operation_t * new_op)
+{
+  MPI_Datatype mpi_dtype = dart_mpi_datatype(dtype);
+  if (op == NULL || mpi_dtype == (MPI_Datatype)(-1)) {
+    DART_LOG_ERROR("dart_op_create ! invalid operation or type:%d", dtype);
+    return DART_ERR_INVAL;
+  }
+  if (dart__mpi__op_keyval == MPI_KEYVAL_INVALID &&
+      MPI_Type_create_keyval(MPI_TYPE_NULL_COPY_FN,
+                             MPI_TYPE_NULL_DELETE_FN,
+                             &dart__mpi__op_keyval,
+                             NULL) != MPI_SUCCESS) {
+    DART_LOG_ERROR("dart_op_create ! MPI_Type_create_keyval failed");
+    return DART_ERR_OTHER;
+  }
+
+  /* Reuse the slot of a destroyed operation: */
+  size_t idx;
+  for (idx = 0; idx < dart__mpi__num_user_ops; ++idx) {
+    if (dart__mpi__user_ops[idx].op == NULL) {
+      break;
+    }
+  }
+  if (idx == dart__mpi__num_user_ops) {
+    dart__mpi__user_op_t * ops = realloc(
+      dart__mpi__user_ops,
+      (dart__mpi__num_user_ops + 1) * sizeof(dart__mpi__user_op_t));
+    if (ops == NULL) {
+      return DART_ERR_OTHER;
+    }
+    dart__mpi__user_ops = ops;
+    dart__mpi__num_user_ops++;
+  }
+
+  dart__mpi__user_op_t * user_op = &dart__mpi__user_ops[idx];
+  if (MPI_Type_dup(mpi_dtype, &user_op->mpi_dtype) != MPI_SUCCESS) {
+    user_op->op = NULL;
+    return DART_ERR_OTHER;
+  }
+  MPI_Type_set_attr(user_op->mpi_dtype, dart__mpi__op_keyval,
+                    (void *)(intptr_t)idx);
+  if (MPI_Op_create(&dart__mpi__op_invoke, commutative, &user_op->mpi_op)
+      != MPI_SUCCESS) {
+    MPI_Type_free(&user_op->mpi_dtype);
+    user_op->op = NULL;
+    return DART_ERR_OTHER;
+  }
+  user_op->op       = op;
+  user_op->userdata = userdata;
+  user_op->dtype    = dtype;
+
+  *new_op = (dart_operation_t)(DART_OP_USER_BASE + idx);
+  DART_LOG_DEBUG("dart_op_create > op:%d dtype:%d commutative:%d",
+                 *new_op, dtype, commutative);
+  return DART_OK;
+}
+
+dart_ret_t dart_op_destroy(
+  dart_operation_t * op)
+{
+  dart__mpi__user_op_t * user_op = dart__mpi__user_op(*op);
+  if (user_op == NULL) {
+    DART_LOG_ERROR("dart_op_destroy ! invalid operation:%d", *op);
+    return DART_ERR_INVAL;
+  }
+  DART_LOG_DEBUG("dart_op_destroy() op:%d", *op);
+  MPI_Op_free(&user_op->mpi_op);
+  MPI_Type_free(&user_op->mpi_dtype);
+  user_op->op = NULL;
+  *op         = DART_OP_UNDEFINED;
+  return DART_OK;
+}
+
+static dart_ret_t dart__mpi__type_register(
+  MPI_Datatype      mpi_dtype,
+  dart_datatype_t * new_type)
+{
+  if (MPI_Type_commit(&mpi_dtype) != MPI_SUCCESS) {
+    MPI_Type_free(&mpi_dtype);
+    return DART_ERR_OTHER;
+  }
+  size_t idx;
+  for (idx = 0; idx < dart__mpi__num_user_types; ++idx) {
+    if (dart__mpi__user_types[idx] == MPI_DATATYPE_NULL) {
+      break;
+    }
+  }
+  if (idx == dart__mpi__num_user_types) {
+    MPI_Datatype * types = realloc(
+      dart__mpi__user_types,
+      (dart__mpi__num_user_types + 1) * sizeof(MPI_Datatype));
+    if (types == NULL) {
+      MPI_Type_free(&mpi_dtype);
+      return DART_ERR_OTHER;
+    }
+    dart__mpi__user_types = types;
+    dart__mpi__num_user_types++;
+  }
+  dart__mpi__user_types[idx] = mpi_dtype;
+  *new_type = (dart_datatype_t)(DART_TYPE_USER_BASE + idx);
+  return DART_OK;
+}
+
+dart_ret_t dart_type_create_contiguous(
+  dart_datatype_t    base_type,
+  size_t             nelem,
+  dart_datatype_t  * new_type)
+{
+  MPI_Datatype mpi_base = dart_mpi_datatype(base_type);
+  MPI_Datatype mpi_dtype;
+  if (mpi_base == (MPI_Datatype)(-1) || nelem == 0 || nelem > INT32_MAX) {
+    DART_LOG_ERROR("dart_type_create_contiguous ! invalid type:%d "
+                   "nelem:%zu", base_type, nelem);
+    return DART_ERR_INVAL;
+  }
+  if (MPI_Type_contiguous((int)nelem, mpi_base, &mpi_dtype)
+      != MPI_SUCCESS) {
+    return DART_ERR_OTHER;
+  }
+  dart_ret_t ret = dart__mpi__type_register(mpi_dtype, new_type);
+  DART_LOG_DEBUG("dart_type_create_contiguous > base:%d nelem:%zu "
+                 "type:%d", base_type, nelem, *new_type);
+  return ret;
+}
+
+dart_ret_t dart_type_create_indexed(
+  dart_datatype_t         base_type,
+  size_t                  nblocks,
+  const size_t          * blocklens,
+  const size_t          * displs,
+  dart_datatype_t       * new_type)
+{
+  MPI_Datatype mpi_base = dart_mpi_datatype(base_type);
+  if (mpi_base == (MPI_Datatype)(-1) ||
+      nblocks == 0 || nblocks > INT32_MAX) {
+    DART_LOG_ERROR("dart_type_create_indexed ! invalid type:%d "
+                   "nblocks:%zu", base_type, nblocks);
+    return DART_ERR_INVAL;
+  }
+  int        * mpi_blocklens = malloc(nblocks * sizeof(int));
+  int        * mpi_displs    = malloc(nblocks * sizeof(int));
+  dart_ret_t   ret           = DART_OK;
+  for (size_t b = 0; b < nblocks; ++b) {
+    if (blocklens[b] > INT32_MAX || displs[b] > INT32_MAX) {
+      DART_LOG_ERROR("dart_type_create_indexed ! invalid block %zu", b);
+      ret = DART_ERR_INVAL;
+    }
+    mpi_blocklens[b] = (int)blocklens[b];
+    mpi_displs[b]    = (int)displs[b];
+  }
+  MPI_Datatype mpi_dtype;
+  if (ret == DART_OK &&
+      MPI_Type_indexed((int)nblocks, mpi_blocklens, mpi_displs, mpi_base,
+                       &mpi_dtype) != MPI_SUCCESS) {
+    ret = DART_ERR_OTHER;
+  }
+  free(mpi_blocklens);
+  free(mpi_displs);
+  if (ret == DART_OK) {
+    ret = dart__mpi__type_register(mpi_dtype, new_type);
+    DART_LOG_DEBUG("dart_type_create_indexed > base:%d nblocks:%zu "
+                   "type:%d", base_type, nblocks, *new_type);
+  }
+  return ret;
+}
+
+dart_ret_t dart_type_create_struct(
+  size_t                  nblocks,
+  const size_t          * blocklens,
+  const size_t          * offsets,
+  const dart_datatype_t * types,
+  size_t                  extent,
+  dart_datatype_t       * new_type)
+{
+  if (nblocks == 0 || nblocks > INT32_MAX) {
+    DART_LOG_ERROR("dart_type_create_struct ! invalid nblocks:%zu",
+                   nblocks);
+    return DART_ERR_INVAL;
+  }
+  int          * mpi_blocklens = malloc(nblocks * sizeof(int));
+  MPI_Aint     * mpi_offsets   = malloc(nblocks * sizeof(MPI_Aint));
+  MPI_Datatype * mpi_types     = malloc(nblocks * sizeof(MPI_Datatype));
+  dart_ret_t     ret           = DART_OK;
+  for (size_t b = 0; b < nblocks; ++b) {
+    mpi_blocklens[b] = (int)blocklens[b];
+    mpi_offsets[b]   = (MPI_Aint)offsets[b];
+    mpi_types[b]     = dart_mpi_datatype(types[b]);
+    if (mpi_types[b] == (MPI_Datatype)(-1)) {
+      DART_LOG_ERROR("dart_type_create_struct ! invalid type:%d in "
+                     "block %zu", types[b], b);
+      ret = DART_ERR_INVAL;
+    }
+  }
+  MPI_Datatype mpi_struct;
+  MPI_Datatype mpi_dtype;
+  if (ret == DART_OK) {
+    if (MPI_Type_create_struct((int)nblocks, mpi_blocklens, mpi_offsets,
+                               mpi_types, &mpi_struct) != MPI_SUCCESS) {
+      ret = DART_ERR_OTHER;
+    } else {
+      /* Account for padding of the struct: */
+      if (MPI_Type_create_resized(mpi_struct, 0, (MPI_Aint)extent,
+                                  &mpi_dtype) != MPI_SUCCESS) {
+        ret = DART_ERR_OTHER;
+      }
+      MPI_Type_free(&mpi_struct);
+    }
+  }
+  free(mpi_blocklens);
+  free(mpi_offsets);
+  free(mpi_types);
+  if (ret == DART_OK) {
+    ret = dart__mpi__type_register(mpi_dtype, new_type);
+    DART_LOG_DEBUG("dart_type_create_struct > nblocks:%zu extent:%zu "
+                   "type:%d", nblocks, extent, *new_type);
+  }
+  return ret;
+}
+
+dart_ret_t dart_type_destroy(
+  dart_datatype_t  * dtype)
+{
+  size_t idx = (size_t)(*dtype) - (size_t)DART_TYPE_USER_BASE;
+  if (*dtype < DART_TYPE_USER_BASE || idx >= dart__mpi__num_user_types ||
+      dart__mpi__user_types[idx] == MPI_DATATYPE_NULL) {
+    DART_LOG_ERROR("dart_type_destroy ! invalid type:%d", *dtype);
+    return DART_ERR_INVAL;
+  }
+  DART_LOG_DEBUG("dart_type_destroy() type:%d", *dtype);
+  MPI_Type_free(&dart__mpi__user_types[idx]);
+  dart__mpi__user_types[idx] = MPI_DATATYPE_NULL;
+  *dtype = DART_TYPE_UNDEFINED;
+  return DART_OK;
+}
+
+void dart__mpi__types_finalize()
+{
+  for (size_t idx = 0; idx < dart__mpi__num_user_ops; ++idx) {
+    if (dart__mpi__user_ops[idx].op != NULL) {
+      MPI_Op_free(&dart__mpi__user_ops[idx].mpi_op);
+      MPI_Type_free(&dart__mpi__user_ops[idx].mpi_dtype);
+    }
+  }
+  for (size_t idx = 0; idx < dart__mpi__num_user_types; ++idx) {
+    if (dart__mpi__user_types[idx] != MPI_DATATYPE_NULL) {
+      MPI_Type_free(&dart__mpi__user_types[idx]);
+    }
+  }
+  free(dart__mpi__user_ops);
+  free(dart__mpi__user_types);
+  dart__mpi__user_ops       = NULL;
+  dart__mpi__num_user_ops   = 0;
+  dart__mpi__user_types     = NULL;
+  dart__mpi__num_user_types = 0;
+  if (dart__mpi__op_keyval != MPI_KEYVAL_INVALID) {
+    MPI_Type_free_keyval(&dart__mpi__op_keyval);
+  }
+}
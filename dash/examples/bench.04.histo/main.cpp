@@ -29,12 +29,6 @@ int main(int argc, char **argv)
   dash::Array<int> key_array(NUM_KEYS, dash::BLOCKED);
   dash::Array<int> key_histo(MAX_KEY,  dash::BLOCKED);
   
-  dash::Array<dash::GlobPtr<int>> work_buffers(size, dash::CYCLIC);
-  work_buffers[myid] = dash::memalloc<int>(MAX_KEY);
-  
-  dash::GlobPtr<int> gptr = work_buffers[myid];
-  int* work_buf = (int*) gptr;
-  
   if(myid==0) {
     for(int i=0; i<key_array.size(); i++ ) {
       key_array[i]=rand() % MAX_KEY;
@@ -52,32 +46,10 @@ int main(int argc, char **argv)
   dash::barrier();
   TIMESTAMP(tstart);
 
-  // compute the histogram for the local keys
-  for(int i=0; i<key_array.lsize(); i++) {
-    work_buf[ key_array.local[i] ]++; 
-  }
-
-  // turn it into a cumulative histogram
-  for(int i=0; i<MAX_KEY-1; i++ ) {
-    //work_buf[i+1] += work_buf[i];
-  }
-
-  // compute the offset of this unit's local part in 
-  // the global key_histo array
-  auto& pat = key_histo.pattern();
-  int goffs = pat.global(0);
-
-  for(int i=0; i<key_histo.lsize(); i++ ) { 
-    key_histo.local[i] = work_buf[goffs+i];
-  }
-
-  for(int unit=1; unit<size; unit++ ) {
-    dash::GlobPtr<int> remote = work_buffers[(myid+unit)%size];
-    
-    for(int i=0; i<key_histo.lsize(); i++ ) { 
-      key_histo.local[i] += remote[goffs+i];
-    }
-  }
+  // count local keys in thread-local histograms and combine them in the
+  // local bins of key_histo
+  dash::histogram(dash::execution::par_unseq,
+                  key_array.begin(), key_array.end(), key_histo);
   dash::barrier();
   TIMESTAMP(tstop);
 
@@ -46,6 +46,7 @@ typedef struct benchmark_params_t
     size_t min_repeats;
     size_t rep_base;
     bool   verify;
+    bool   minmax;
   }
   benchmark_params;
 
@@ -249,7 +250,9 @@ measurement perform_test(
     }
 
     auto ts_start  = Timer::Now();
-    auto min_git   = dash::min_element(arr.begin(), arr.end());
+    auto min_git   = params.minmax
+                     ? dash::minmax_element(arr.begin(), arr.end()).first
+                     : dash::min_element(arr.begin(), arr.end());
     auto time_us   = Timer::ElapsedSince(ts_start);
 
     if (REPEAT == 1 || i == 1) {
@@ -411,6 +414,7 @@ benchmark_params parse_args(int argc, char * argv[])
   params.min_repeats    = 10;
   params.size_min       = 8.0e+6; // 800k elements
   params.verify         = false;
+  params.minmax         = false;
 
   for (auto i = 1; i < argc; i += 2) {
     std::string flag = argv[i];
@@ -429,6 +433,9 @@ benchmark_params parse_args(int argc, char * argv[])
     } else if (flag == "-v") {
       params.verify         = true;
       i++;
+    } else if (flag == "-mm") {
+      params.minmax         = true;
+      i++;
     }
   }
   if (params.num_repeats == 0) {
@@ -454,6 +461,7 @@ void print_params(
   bench_cfg.print_param("-rb",     "rep. base",       params.rep_base);
   bench_cfg.print_param("-i",      "iterations",      params.num_iterations);
   bench_cfg.print_param("-v",      "verify",          params.verify);
+  bench_cfg.print_param("-mm",     "minmax_element",  params.minmax);
   bench_cfg.print_section_end();
 }
 
@@ -104,6 +104,7 @@ typedef struct benchmark_params_t {
   extent_t    units_y;
   extent_t    units_inc;
   extent_t    threads;
+  int         layers;
   float       cpu_gflops_peak;
   bool        mkl_dyn;
   bool        verify;
@@ -449,24 +450,27 @@ void init_values(
   auto num_local_blocks = num_blocks / dash::Team::All().size();
   value_t * l_block_elem_a;
   value_t * l_block_elem_b;
+  value_t * l_block_elem_c;
   for (auto l_block_idx = 0;
        l_block_idx < num_local_blocks;
        ++l_block_idx)
   {
     auto l_block_a = matrix_a.local.block(l_block_idx);
     auto l_block_b = matrix_b.local.block(l_block_idx);
+    auto l_block_c = matrix_c.local.block(l_block_idx);
     l_block_elem_a = l_block_a.begin().local();
     l_block_elem_b = l_block_b.begin().local();
+    l_block_elem_c = l_block_c.begin().local();
     for (auto phase = 0; phase < block_cols * block_rows; ++phase) {
       value_t value = (100000 * (unit_id + 1)) +
                       (100 * l_block_idx) +
                       phase;
       l_block_elem_a[phase] = value;
-      if (!params.verify) {
-        l_block_elem_b[phase] = value;
-      }
+      l_block_elem_b[phase] = params.verify ? 0 : value;
+      l_block_elem_c[phase] = 0;
     }
   }
+  dash::barrier();
   if (params.verify && dash::myid() == 0) {
     // Initialize matrix B as identity matrix to verify A x B = A
     // after the test run:
@@ -526,7 +530,13 @@ std::pair<double, double> test_dash(
       dash::util::TraceStore::on();
     }
 
-    dash::summa(matrix_a, matrix_b, matrix_c);
+    if (params.variant == "dash-bcast") {
+      dash::summa_bcast(matrix_a, matrix_b, matrix_c, params.layers, false);
+    } else if (params.variant == "dash-node") {
+      dash::summa_bcast(matrix_a, matrix_b, matrix_c, params.layers, true);
+    } else {
+      dash::summa(matrix_a, matrix_b, matrix_c);
+    }
 
     if (i == 0) {
       dash::util::TraceStore::off();
@@ -1056,6 +1066,7 @@ benchmark_params parse_args(int argc, char * argv[])
   params.units_x            = 0;
   params.units_y            = 0;
   params.threads            = 1;
+  params.layers             = 1;
   params.exp_max            = 4;
   params.cpu_gflops_peak    = 41.4;
   params.mkl_dyn            = false;
@@ -1081,6 +1092,8 @@ benchmark_params parse_args(int argc, char * argv[])
       params.units_y   = static_cast<extent_t>(atoi(argv[i+1]));
     } else if (flag == "-nt") {
       params.threads  = static_cast<extent_t>(atoi(argv[i+1]));
+    } else if (flag == "-c") {
+      params.layers   = atoi(argv[i+1]);
     } else if (flag == "-s") {
       params.variant  = argv[i+1];
     } else if (flag == "-emax") {
@@ -1171,6 +1184,7 @@ void print_params(
   conf.print_param("-rmax",   "rep. max",           params.rep_max);
   conf.print_param("-rbase",  "rep. base",          params.rep_base);
   conf.print_param("-nt",     "threads/proc",       params.threads);
+  conf.print_param("-c",      "summa layers",       params.layers);
   conf.print_param("-mkldyn", "MKL dynamic",        params.mkl_dyn);
   conf.print_param("-verify", "run test iteration", params.verify);
   conf.print_param("-ninc",   "units inc.",         params.units_inc);
@@ -11,19 +11,31 @@
  *
  */
 
+#include <dash/ExecutionPolicy.h>
+
 #include <dash/algorithm/Operation.h>
 #include <dash/algorithm/LocalRange.h>
 #include <dash/algorithm/ForEach.h>
 #include <dash/algorithm/MinMax.h>
 #include <dash/algorithm/Transform.h>
 #include <dash/algorithm/Accumulate.h>
+#include <dash/algorithm/TransformReduce.h>
+#include <dash/algorithm/Scan.h>
+#include <dash/algorithm/Histogram.h>
 #include <dash/algorithm/Copy.h>
 #include <dash/algorithm/Fill.h>
 #include <dash/algorithm/Generate.h>
 #include <dash/algorithm/AllOf.h>
 #include <dash/algorithm/AnyOf.h>
+#include <dash/algorithm/None_of.h>
 #include <dash/algorithm/Find.h>
 #include <dash/algorithm/Equal.h>
+#include <dash/algorithm/LowerBound.h>
+#include <dash/algorithm/Merge.h>
+#include <dash/algorithm/Unique.h>
+#include <dash/algorithm/SetOperations.h>
+
+#include <dash/algorithm/WorkStealing.h>
 
 #include <dash/algorithm/SUMMA.h>
 
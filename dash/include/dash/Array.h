@@ -16,6 +16,7 @@
 
 #include <dash/iterator/GlobIter.h>
 
+#include <functional>
 #include <iterator>
 #include <initializer_list>
 #include <type_traits>
@@ -840,6 +841,36 @@ public:
     allocate(m_pattern);
   }
 
+  /**
+   * Constructor, specifies distribution pattern explicitly and obtains
+   * the local memory of units from a local allocator.
+   *
+   * \see allocate(const PatternType &, LocalAllocatorType &)
+   */
+  template <
+    class LocalAllocatorType,
+    typename = typename std::enable_if<
+                 std::is_same<
+                   typename LocalAllocatorType::local_pointer,
+                   value_type *
+                 >::value
+               >::type >
+  Array(
+    const PatternType  & pattern,
+    LocalAllocatorType & local_alloc)
+  : local(this),
+    async(this),
+    m_team(&pattern.team()),
+    m_myid(m_team->myid()),
+    m_pattern(pattern),
+    m_size(0),
+    m_lsize(0),
+    m_lcapacity(0)
+  {
+    DASH_LOG_TRACE("Array()", "pattern instance constructor, local alloc");
+    allocate(m_pattern, local_alloc);
+  }
+
   /**
    * Copy constructor is deleted to prevent unintentional copies of - usually
    * huge - distributed arrays.
@@ -1228,11 +1259,58 @@ public:
       delete m_globmem;
       m_globmem = nullptr;
     }
+    if (m_local_dealloc) {
+      // Return local memory registered in global memory to its allocator:
+      m_local_dealloc(m_lbegin_attached);
+      m_local_dealloc    = nullptr;
+      m_lbegin_attached  = nullptr;
+    }
     m_size = 0;
     DASH_LOG_TRACE_VAR("Array.deallocate >", this);
   }
 
   bool allocate(const PatternType & pattern)
+  {
+    return _allocate(pattern, nullptr, nullptr);
+  }
+
+  /**
+   * Allocates the array with local memory of units obtained from a local
+   * allocator like \c dash::allocator::MappedFileAllocator, which
+   * provides the methods
+   * <tt>local_pointer allocate_local(size_type)</tt> and
+   * <tt>void deallocate_local(local_pointer)</tt>.
+   * Local memory is registered in global memory and returned to the
+   * allocator in \c deallocate, so the allocator must outlive the array.
+   */
+  template <
+    class LocalAllocatorType,
+    typename = typename std::enable_if<
+                 std::is_same<
+                   typename LocalAllocatorType::local_pointer,
+                   value_type *
+                 >::value
+               >::type >
+  bool allocate(
+    const PatternType  & pattern,
+    LocalAllocatorType & local_alloc)
+  {
+    return _allocate(
+             pattern,
+             [&local_alloc](size_type nlocal) {
+               return local_alloc.allocate_local(nlocal);
+             },
+             [&local_alloc](value_type * lptr) {
+               local_alloc.deallocate_local(lptr);
+             });
+  }
+
+private:
+
+  bool _allocate(
+    const PatternType                          & pattern,
+    std::function<value_type * (size_type)>      local_alloc,
+    std::function<void (value_type *)>           local_dealloc)
   {
 		DASH_LOG_TRACE("Array._allocate()", "pattern",
                    pattern.memory_layout().extents());
@@ -1253,7 +1331,14 @@ public:
     // Allocate local memory of identical size on every unit:
     DASH_LOG_TRACE_VAR("Array._allocate", m_lcapacity);
     DASH_LOG_TRACE_VAR("Array._allocate", m_lsize);
-    m_globmem   = new glob_mem_type(m_lcapacity, *m_team);
+    if (!local_alloc) {
+      m_globmem = new glob_mem_type(m_lcapacity, *m_team);
+    } else {
+      // Register local memory obtained from the local allocator:
+      m_lbegin_attached = local_alloc(m_lcapacity);
+      m_local_dealloc   = local_dealloc;
+      m_globmem = new glob_mem_type(m_lbegin_attached, m_lcapacity, *m_team);
+    }
     // Global iterators:
     m_begin     = iterator(m_globmem, m_pattern);
     m_end       = iterator(m_begin) + m_size;
@@ -1364,6 +1449,10 @@ private:
   ElementType        * m_lbegin    = nullptr;
   /// Native pointer past last local element in the array
   ElementType        * m_lend      = nullptr;
+  /// Local memory obtained from a local allocator, if any
+  ElementType        * m_lbegin_attached = nullptr;
+  /// Returns local memory obtained from a local allocator
+  std::function<void (ElementType *)> m_local_dealloc;
 
 };
 
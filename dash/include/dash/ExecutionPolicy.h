@@ -0,0 +1,140 @@
+#ifndef DASH__EXECUTION_POLICY_H__INCLUDED
+#define DASH__EXECUTION_POLICY_H__INCLUDED
+
+#include <type_traits>
+
+/**
+ * \defgroup  DashExecutionPolicies  Execution policies of DASH algorithms
+ *
+ * Execution policies specify how a unit executes the local portion of a
+ * collective DASH algorithm.
+ *
+ * Example:
+ *
+ * \code
+ *   // Local elements are processed by all threads available to the unit:
+ *   dash::for_each(dash::par_unseq, array.begin(), array.end(), func);
+ *   // Use 4 threads per unit:
+ *   dash::for_each(dash::execution::parallel_unsequenced_policy(4),
+ *                  array.begin(), array.end(), func);
+ * \endcode
+ *
+ * \ingroup   DashAlgorithms
+ */
+
+namespace dash {
+namespace execution {
+
+/**
+ * Execution policy type: the local portion of an algorithm is executed
+ * sequentially by the calling thread.
+ *
+ * \ingroup  DashExecutionPolicies
+ */
+class sequenced_policy
+{
+public:
+  constexpr sequenced_policy() { }
+
+  /**
+   * Number of threads executing the local portion of an algorithm.
+   */
+  constexpr int num_threads() const {
+    return 1;
+  }
+};
+
+/**
+ * Execution policy type: the local portion of an algorithm is split into
+ * contiguous chunks that are processed by multiple threads, loops within
+ * chunks may be vectorized.
+ *
+ * Unless specified explicitly, the number of threads is resolved from the
+ * calling unit's locality, see
+ * \c dash::util::UnitLocality::num_domain_threads.
+ *
+ * Chunks are assigned to threads statically and are aligned to memory
+ * pages, so a range is partitioned identically in every algorithm
+ * executed with this policy. Pages first touched by a thread in an
+ * initializing algorithm like \c dash::fill or \c dash::generate are
+ * thereby placed in the thread's NUMA domain and processed by the same
+ * thread in subsequent algorithms.
+ * Threads should be bound to cores, e.g. using <tt>OMP_PROC_BIND</tt>.
+ *
+ * Function objects passed to algorithms executed with this policy must
+ * be safe to invoke concurrently and must not call DASH or DART
+ * communication routines.
+ *
+ * \ingroup  DashExecutionPolicies
+ */
+class parallel_unsequenced_policy
+{
+public:
+  constexpr parallel_unsequenced_policy()
+  : _num_threads(0)
+  { }
+
+  /**
+   * Policy using a fixed number of threads per unit.
+   */
+  constexpr explicit parallel_unsequenced_policy(
+    /// Number of threads, resolved from unit locality if 0
+    int num_threads)
+  : _num_threads(num_threads)
+  { }
+
+  /**
+   * Number of threads requested for this policy, 0 if resolved from
+   * unit locality.
+   */
+  constexpr int num_threads() const {
+    return _num_threads;
+  }
+
+private:
+  int _num_threads;
+};
+
+/**
+ * Type trait to identify execution policy types.
+ *
+ * \ingroup  DashExecutionPolicies
+ */
+template <class T>
+struct is_execution_policy
+: public std::false_type
+{ };
+
+template <>
+struct is_execution_policy<sequenced_policy>
+: public std::true_type
+{ };
+
+template <>
+struct is_execution_policy<parallel_unsequenced_policy>
+: public std::true_type
+{ };
+
+/**
+ * Sequential execution of local portions of algorithms.
+ *
+ * \ingroup  DashExecutionPolicies
+ */
+constexpr sequenced_policy            seq       { };
+
+/**
+ * Multi-threaded, vectorized execution of local portions of algorithms
+ * using all threads available to a unit.
+ *
+ * \ingroup  DashExecutionPolicies
+ */
+constexpr parallel_unsequenced_policy par_unseq { };
+
+} // namespace execution
+
+using execution::seq;
+using execution::par_unseq;
+
+} // namespace dash
+
+#endif // DASH__EXECUTION_POLICY_H__INCLUDED
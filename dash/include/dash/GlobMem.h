@@ -185,6 +185,36 @@ public:
                    "_lbegin:", _lbegin, "_lend:", _lend);
   }
 
+  /**
+   * Constructor, collectively registers local memory allocated by the
+   * caller, e.g. by \c dash::allocator::MappedFileAllocator, in global
+   * memory space.
+   * The local memory is not freed when the global memory is destroyed.
+   */
+  inline GlobMem(
+    /// Local memory to register in global memory space
+    local_pointer   lbegin,
+    /// Number of local elements in local memory
+    size_type       n_local_elem,
+    /// Team containing all units operating on the global memory region
+    Team          & team = dash::Team::All())
+  : _allocator(team),
+    _team(team),
+    _nlelem(n_local_elem),
+    _nunits(team.size())
+  {
+    DASH_LOG_TRACE("GlobMem(lbegin,nlocal,team)",
+                   "number of local values:", _nlelem,
+                   "team size:",              team.size());
+    _begptr = _allocator.attach(lbegin, _nlelem);
+    DASH_ASSERT_MSG(!DART_GPTR_ISNULL(_begptr), "registration failed");
+
+    // Use id's of team all
+    _lbegin = this->lbegin(dash::Team::GlobalUnitID());
+    _lend   = lend(dash::Team::GlobalUnitID());
+    DASH_LOG_TRACE("GlobMem(lbegin,nlocal,team) >");
+  }
+
   /**
    * Destructor, collectively frees underlying global memory.
    */
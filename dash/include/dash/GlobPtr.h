@@ -116,27 +116,15 @@ public:
   }
 
   /**
-   * Copy constructor.
+   * Copy constructor, global pointers are trivially copyable so they can
+   * be transferred as bytes.
    */
-  GlobPtr(const self_t & other)
-  : _dart_gptr(other._dart_gptr)
-  {
-    DASH_LOG_TRACE("GlobPtr()", "GlobPtr<T> other");
-  }
+  GlobPtr(const self_t & other) = default;
 
   /**
    * Assignment operator.
    */
-  self_t & operator=(const self_t & rhs)
-  {
-    DASH_LOG_TRACE("GlobPtr.=()", "GlobPtr<T> rhs");
-    DASH_LOG_TRACE_VAR("GlobPtr.=", rhs);
-    if (this != &rhs) {
-      _dart_gptr = rhs._dart_gptr;
-    }
-    DASH_LOG_TRACE("GlobPtr.= >");
-    return *this;
-  }
+  self_t & operator=(const self_t & rhs) = default;
 
   /**
    * Converts pointer to its underlying global address.
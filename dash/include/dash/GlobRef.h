@@ -4,6 +4,7 @@
 #include <dash/GlobMem.h>
 #include <dash/Init.h>
 #include <dash/algorithm/Operation.h>
+#include <dash/util/CommMatrix.h>
 
 namespace dash {
 
@@ -145,6 +146,7 @@ public:
     T t;
     dart_storage_t ds = dash::dart_storage<T>(1);
     dart_get_blocking(static_cast<void *>(&t), _gptr, ds.nelem, ds.dtype);
+    dash::util::CommMatrix::record(_gptr, 1);
     return t;
   }
 
@@ -154,6 +156,7 @@ public:
     T t;
     dart_storage_t ds = dash::dart_storage<T>(1);
     dart_get_blocking(static_cast<void *>(&t), _gptr, ds.nelem, ds.dtype);
+    dash::util::CommMatrix::record(_gptr, 1);
     return t;
   }
 
@@ -162,6 +165,7 @@ public:
     DASH_LOG_TRACE_VAR("GlobRef.T()", _gptr);
     dart_storage_t ds = dash::dart_storage<T>(1);
     dart_get_blocking(static_cast<void *>(tptr), _gptr, ds.nelem, ds.dtype);
+    dash::util::CommMatrix::record(_gptr, 1);
   }
 
   void get(T& tref) const {
@@ -169,6 +173,7 @@ public:
     DASH_LOG_TRACE_VAR("GlobRef.T()", _gptr);
     dart_storage_t ds = dash::dart_storage<T>(1);
     dart_get_blocking(static_cast<void *>(&tref), _gptr, ds.nelem, ds.dtype);
+    dash::util::CommMatrix::record(_gptr, 1);
   }
 
   void put(T& tref) const {
@@ -176,6 +181,7 @@ public:
     DASH_LOG_TRACE_VAR("GlobRef.T()", _gptr);
     dart_storage_t ds = dash::dart_storage<T>(1);
     dart_put_blocking(_gptr, static_cast<void *>(&tref), ds.nelem, ds.dtype);
+    dash::util::CommMatrix::record(_gptr, 1);
   }
 
   void put(T* tptr) const {
@@ -183,6 +189,7 @@ public:
     DASH_LOG_TRACE_VAR("GlobRef.T()", _gptr);
     dart_storage_t ds = dash::dart_storage<T>(1);
     dart_put_blocking(_gptr, static_cast<void *>(tptr), ds.nelem, ds.dtype);
+    dash::util::CommMatrix::record(_gptr, 1);
   }
 
   operator GlobPtr<T>() const {
@@ -198,6 +205,7 @@ public:
     //       _gptr->is_local()
     dart_storage_t ds = dash::dart_storage<T>(1);
     dart_put_blocking(_gptr, static_cast<const void *>(&val), ds.nelem, ds.dtype);
+    dash::util::CommMatrix::record(_gptr, 1);
     return *this;
   }
 
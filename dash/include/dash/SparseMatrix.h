@@ -0,0 +1,584 @@
+#ifndef DASH__SPARSE_MATRIX_H_INCLUDED
+#define DASH__SPARSE_MATRIX_H_INCLUDED
+
+#include <dash/dart/if/dart.h>
+
+#include <dash/Types.h>
+#include <dash/Team.h>
+#include <dash/Array.h>
+#include <dash/Exception.h>
+#include <dash/ExecutionPolicy.h>
+
+#include <dash/pattern/CSRPattern.h>
+
+#include <dash/algorithm/internal/ParallelFor.h>
+
+#include <dash/internal/Logging.h>
+
+#include <algorithm>
+#include <cstddef>
+#include <type_traits>
+#include <vector>
+
+
+namespace dash {
+
+/**
+ * Distributed sparse matrix in Compressed Sparse Row (CSR) format.
+ *
+ * Rows are distributed to units in contiguous ranges of irregular size.
+ * Row pointers, column indices and values are stored in arrays
+ * distributed by \c dash::CSRPattern, so the local elements of every unit
+ * are a CSR matrix of its rows. Row pointers are offsets in the unit's
+ * local column indices and values.
+ *
+ * Vectors multiplied with the matrix are arrays distributed by
+ * \c col_pattern(), results are distributed by \c row_pattern(). For
+ * square matrices, both patterns are identical.
+ *
+ * Construction computes the communication plan of the sparse
+ * matrix-vector product once: the columns referenced by local rows but
+ * owned by other units (*ghost* columns) are gathered and merged into
+ * transfers of contiguous elements from the owning units. Within every
+ * row, entries in columns owned by the calling unit (the diagonal block)
+ * are stored before entries in ghost columns, so \c multiply computes the
+ * product of the diagonal block while ghost elements are transferred.
+ *
+ * Example:
+ *
+ * \code
+ *   // Local rows of the calling unit in CSR format, column indices are
+ *   // global:
+ *   std::vector<long>   row_ptr    { 0, 2, 3 };
+ *   std::vector<long>   col_idx    { 0, 5, 1 };
+ *   std::vector<double> values     { 4.0, -1.0, 4.0 };
+ *   dash::SparseMatrix<double, long> A(ncols, row_ptr, col_idx, values);
+ *
+ *   dash::SparseMatrix<double, long>::vector_type x(A.col_pattern());
+ *   dash::SparseMatrix<double, long>::vector_type y(A.row_pattern());
+ *   // ... initialize local elements of x ...
+ *   A.multiply(dash::execution::par_unseq, x, y);
+ * \endcode
+ *
+ * \ingroup  DashContainerConcept
+ */
+template<
+  typename ElementType,
+  typename IndexType = dash::default_index_t >
+class SparseMatrix
+{
+  static_assert(std::is_signed<IndexType>::value,
+                "dash::SparseMatrix expects a signed index type");
+
+private:
+  typedef SparseMatrix<ElementType, IndexType>              self_t;
+
+public:
+  typedef ElementType                                       value_type;
+  typedef IndexType                                         index_type;
+  typedef typename std::make_unsigned<IndexType>::type      size_type;
+  typedef dash::CSRPattern<1, dash::ROW_MAJOR, IndexType>   pattern_type;
+  typedef dash::Array<IndexType, IndexType, pattern_type>   index_array_type;
+  typedef dash::Array<ElementType, IndexType, pattern_type> value_array_type;
+  /// Type of vectors multiplied with the matrix
+  typedef value_array_type                                  vector_type;
+
+private:
+  /**
+   * Transfer of contiguous ghost elements from the local memory of the
+   * owning unit.
+   */
+  struct GhostTransfer
+  {
+    /// Unit owning the elements
+    team_unit_t unit;
+    /// Offset of the first element in the owning unit's local memory
+    index_type  lindex;
+    /// Offset of the first element in the ghost buffer
+    index_type  ghost;
+    /// Number of elements
+    size_type   nelem;
+  };
+
+public:
+  /**
+   * Creates a matrix with \c ncols columns from the local rows of every
+   * unit, with columns distributed like rows if the matrix is square and
+   * in blocks of balanced size otherwise.
+   *
+   * Collective operation.
+   *
+   * \throws  dash::exception::InvalidArgument  if the local rows are not
+   *          in valid CSR format or reference columns out of range
+   */
+  SparseMatrix(
+    /// Number of columns of the matrix
+    size_type                       ncols,
+    /// Offsets of the local rows' first entries in \c l_col_indices and
+    /// \c l_values, followed by the number of local entries
+    const std::vector<index_type> & l_row_ptr,
+    /// Global column indices of the local entries
+    const std::vector<index_type> & l_col_indices,
+    /// Values of the local entries
+    const std::vector<value_type> & l_values,
+    /// Team containing all units the matrix is distributed to
+    dash::Team                    & team = dash::Team::All())
+  : SparseMatrix(
+      default_col_sizes(ncols, l_row_ptr, team),
+      l_row_ptr, l_col_indices, l_values, team)
+  { }
+
+  /**
+   * Creates a matrix from the local rows of every unit, with columns
+   * distributed in contiguous ranges of the specified sizes.
+   *
+   * Collective operation.
+   *
+   * \throws  dash::exception::InvalidArgument  if the local rows are not
+   *          in valid CSR format or reference columns out of range
+   */
+  SparseMatrix(
+    /// Number of columns assigned to every unit in the team
+    const std::vector<size_type>  & col_local_sizes,
+    /// Offsets of the local rows' first entries in \c l_col_indices and
+    /// \c l_values, followed by the number of local entries
+    const std::vector<index_type> & l_row_ptr,
+    /// Global column indices of the local entries
+    const std::vector<index_type> & l_col_indices,
+    /// Values of the local entries
+    const std::vector<value_type> & l_values,
+    /// Team containing all units the matrix is distributed to
+    dash::Team                    & team = dash::Team::All())
+  : _team(&team),
+    _row_pattern(gather_local_sizes(num_local_rows(l_row_ptr), team),
+                 team),
+    _col_pattern(col_local_sizes, team),
+    _col_offsets(col_local_sizes.size() + 1, 0),
+    _row_ptr(pattern_type(
+               gather_local_sizes(num_local_rows(l_row_ptr) + 1, team),
+               team)),
+    _col_indices(pattern_type(
+                   gather_local_sizes(l_col_indices.size(), team),
+                   team)),
+    _values(pattern_type(
+              gather_local_sizes(l_values.size(), team),
+              team))
+  {
+    DASH_LOG_DEBUG("SparseMatrix()",
+                   "local rows:", _row_pattern.local_size(),
+                   "local entries:", l_values.size());
+    for (size_type u = 0; u < col_local_sizes.size(); ++u) {
+      _col_offsets[u + 1] = _col_offsets[u] + col_local_sizes[u];
+    }
+    init_local(l_row_ptr, l_col_indices, l_values);
+    init_transfers();
+    _team->barrier();
+    DASH_LOG_DEBUG("SparseMatrix >",
+                   "ghosts:",    _ghost_cols.size(),
+                   "transfers:", _transfers.size());
+  }
+
+  SparseMatrix(const self_t & other)       = delete;
+  self_t & operator=(const self_t & other) = delete;
+
+  /**
+   * Computes the matrix-vector product <tt>y = A x</tt>.
+   *
+   * Collective operation. Ghost elements of \c x are fetched from the
+   * owning units in bulk transfers while the product of the diagonal block
+   * is computed, local rows are processed by the threads specified in the
+   * execution policy.
+   * Units are synchronized before ghost elements are fetched, so values
+   * written to local elements of \c x before the call are visible, and
+   * before returning, so local elements of \c x may be modified and
+   * elements of \c y may be read by any unit after the call.
+   *
+   * \see  DashExecutionPolicies
+   */
+  template<class ExecutionPolicy>
+  dash::internal::enable_if_execution_policy<ExecutionPolicy>
+  multiply(
+    ExecutionPolicy  && policy,
+    /// Vector distributed by \c col_pattern()
+    const vector_type   & x,
+    /// Result vector distributed by \c row_pattern(), not aliasing \c x
+    vector_type         & y)
+  {
+    DASH_ASSERT_MSG(x.pattern() == _col_pattern,
+                    "SparseMatrix.multiply: "
+                    "distribution of x differs from column pattern");
+    DASH_ASSERT_MSG(y.pattern() == _row_pattern,
+                    "SparseMatrix.multiply: "
+                    "distribution of y differs from row pattern");
+    DASH_ASSERT_MSG(static_cast<const void *>(&x) !=
+                    static_cast<const void *>(&y),
+                    "SparseMatrix.multiply: x and y must not alias");
+
+    const index_type * row_ptr = _row_ptr.lbegin();
+    const value_type * values  = _values.lbegin();
+    const value_type * x_l     = x.lbegin();
+    const value_type * ghosts  = _ghosts.data();
+    value_type       * y_l     = y.lbegin();
+    index_type         nrows_l = _row_pattern.local_size();
+
+    _team->barrier();
+    start_exchange(x);
+    // Diagonal block while ghost elements are in flight:
+    dash::internal::parallel_for(
+      policy, nrows_l, sizeof(value_type),
+      [&](int, index_type r_begin, index_type r_end) {
+        for (index_type r = r_begin; r < r_end; ++r) {
+          value_type acc = value_type();
+          for (index_type j = row_ptr[r]; j < _diag_end[r]; ++j) {
+            acc += values[j] * x_l[_lcols[j]];
+          }
+          y_l[r] = acc;
+        }
+      });
+    wait_exchange();
+    if (!_ghost_cols.empty()) {
+      dash::internal::parallel_for(
+        policy, nrows_l, sizeof(value_type),
+        [&](int, index_type r_begin, index_type r_end) {
+          for (index_type r = r_begin; r < r_end; ++r) {
+            value_type acc = y_l[r];
+            for (index_type j = _diag_end[r]; j < row_ptr[r + 1]; ++j) {
+              acc += values[j] * ghosts[_lcols[j]];
+            }
+            y_l[r] = acc;
+          }
+        });
+    }
+    // Other units may still read ghost elements from local elements of x:
+    _team->barrier();
+  }
+
+  /**
+   * Computes the matrix-vector product <tt>y = A x</tt>.
+   *
+   * Collective operation.
+   */
+  void multiply(
+    /// Vector distributed by \c col_pattern()
+    const vector_type & x,
+    /// Result vector distributed by \c row_pattern(), not aliasing \c x
+    vector_type       & y)
+  {
+    multiply(dash::execution::seq, x, y);
+  }
+
+  /**
+   * Number of rows of the matrix.
+   */
+  inline size_type nrows() const
+  {
+    return _row_pattern.size();
+  }
+
+  /**
+   * Number of columns of the matrix.
+   */
+  inline size_type ncols() const
+  {
+    return _col_pattern.size();
+  }
+
+  /**
+   * Number of stored entries of the matrix.
+   */
+  inline size_type nnz() const
+  {
+    return _values.size();
+  }
+
+  /**
+   * Distribution of rows, and of vectors resulting from \c multiply.
+   */
+  inline const pattern_type & row_pattern() const
+  {
+    return _row_pattern;
+  }
+
+  /**
+   * Distribution of columns, and of vectors passed to \c multiply.
+   */
+  inline const pattern_type & col_pattern() const
+  {
+    return _col_pattern;
+  }
+
+  /**
+   * Row pointers, with \c row_pattern().local_size() + 1 local elements
+   * at every unit.
+   */
+  inline const index_array_type & row_ptr() const
+  {
+    return _row_ptr;
+  }
+
+  /**
+   * Global column indices of stored entries.
+   */
+  inline const index_array_type & col_indices() const
+  {
+    return _col_indices;
+  }
+
+  /**
+   * Values of stored entries.
+   */
+  inline value_array_type & values()
+  {
+    return _values;
+  }
+
+  /**
+   * Values of stored entries.
+   */
+  inline const value_array_type & values() const
+  {
+    return _values;
+  }
+
+  /**
+   * Global indices of the columns referenced by local rows and owned by
+   * other units, in ascending order.
+   */
+  inline const std::vector<index_type> & ghost_cols() const
+  {
+    return _ghost_cols;
+  }
+
+  /**
+   * Number of transfers issued by the calling unit in \c multiply.
+   */
+  inline size_type num_transfers() const
+  {
+    return _transfers.size();
+  }
+
+  /**
+   * The team containing all units the matrix is distributed to.
+   */
+  inline dash::Team & team() const
+  {
+    return *_team;
+  }
+
+  /**
+   * Synchronizes all units the matrix is distributed to.
+   */
+  inline void barrier() const
+  {
+    _team->barrier();
+  }
+
+private:
+  static size_type num_local_rows(const std::vector<index_type> & l_row_ptr)
+  {
+    if (l_row_ptr.empty()) {
+      DASH_THROW(
+        dash::exception::InvalidArgument,
+        "SparseMatrix: row pointers must contain at least one element");
+    }
+    return l_row_ptr.size() - 1;
+  }
+
+  /**
+   * Local sizes of all units in the team.
+   */
+  static std::vector<size_type> gather_local_sizes(
+    std::size_t   l_size,
+    dash::Team  & team)
+  {
+    std::vector<std::size_t> sizes(team.size());
+    DASH_ASSERT_RETURNS(
+      dart_allgather(&l_size, sizes.data(), 1, DART_TYPE_SIZET,
+                     team.dart_id()),
+      DART_OK);
+    return std::vector<size_type>(sizes.begin(), sizes.end());
+  }
+
+  /**
+   * Local column sizes of square matrices are the local row sizes,
+   * otherwise columns are distributed in balanced blocks.
+   */
+  static std::vector<size_type> default_col_sizes(
+    size_type                       ncols,
+    const std::vector<index_type> & l_row_ptr,
+    dash::Team                    & team)
+  {
+    auto      row_sizes = gather_local_sizes(num_local_rows(l_row_ptr), team);
+    size_type nrows     = 0;
+    for (auto s : row_sizes) {
+      nrows += s;
+    }
+    if (nrows == ncols) {
+      return row_sizes;
+    }
+    size_type              nunits = team.size();
+    std::vector<size_type> col_sizes(nunits, ncols / nunits);
+    for (size_type u = 0; u < ncols % nunits; ++u) {
+      ++col_sizes[u];
+    }
+    return col_sizes;
+  }
+
+  /**
+   * Stores the local rows with entries of the diagonal block first and
+   * resolves the local offsets of all entries in \c x or the ghost buffer.
+   */
+  void init_local(
+    const std::vector<index_type> & l_row_ptr,
+    const std::vector<index_type> & l_col_indices,
+    const std::vector<value_type> & l_values)
+  {
+    index_type nrows_l = _row_pattern.local_size();
+    index_type nnz_l   = l_values.size();
+    if (l_row_ptr.front() != 0 || l_row_ptr.back() != nnz_l ||
+        static_cast<index_type>(l_col_indices.size()) != nnz_l ||
+        !std::is_sorted(l_row_ptr.begin(), l_row_ptr.end())) {
+      DASH_THROW(
+        dash::exception::InvalidArgument,
+        "SparseMatrix: invalid local rows in CSR format");
+    }
+    // Range of columns owned by the calling unit:
+    index_type col_begin = _col_offsets[_team->myid().id];
+    index_type col_end   = _col_offsets[_team->myid().id + 1];
+    index_type ncols   = _col_pattern.size();
+
+    for (index_type j = 0; j < nnz_l; ++j) {
+      index_type col = l_col_indices[j];
+      if (col < 0 || col >= ncols) {
+        DASH_THROW(
+          dash::exception::InvalidArgument,
+          "SparseMatrix: column index " << col << " out of range " <<
+          "[0, " << ncols << ")");
+      }
+      if (col < col_begin || col >= col_end) {
+        _ghost_cols.push_back(col);
+      }
+    }
+    std::sort(_ghost_cols.begin(), _ghost_cols.end());
+    _ghost_cols.erase(std::unique(_ghost_cols.begin(), _ghost_cols.end()),
+                      _ghost_cols.end());
+    _ghosts.resize(_ghost_cols.size());
+
+    index_type * row_ptr     = _row_ptr.lbegin();
+    index_type * col_indices = _col_indices.lbegin();
+    value_type * values      = _values.lbegin();
+    _diag_end.resize(nrows_l);
+    _lcols.resize(nnz_l);
+    for (index_type r = 0; r < nrows_l; ++r) {
+      index_type j_out = l_row_ptr[r];
+      row_ptr[r]       = j_out;
+      // Two passes over the row, diagonal block first:
+      for (int pass = 0; pass < 2; ++pass) {
+        for (index_type j = l_row_ptr[r]; j < l_row_ptr[r + 1]; ++j) {
+          index_type col  = l_col_indices[j];
+          bool       diag = col >= col_begin && col < col_end;
+          if (diag != (pass == 0)) {
+            continue;
+          }
+          col_indices[j_out] = col;
+          values[j_out]      = l_values[j];
+          _lcols[j_out]      = diag
+                               ? col - col_begin
+                               : std::lower_bound(_ghost_cols.begin(),
+                                                  _ghost_cols.end(), col)
+                                 - _ghost_cols.begin();
+          ++j_out;
+        }
+        if (pass == 0) {
+          _diag_end[r] = j_out;
+        }
+      }
+    }
+    row_ptr[nrows_l] = nnz_l;
+  }
+
+  /**
+   * Merges ghost columns that are contiguous in the local memory of the
+   * owning unit into single transfers.
+   */
+  void init_transfers()
+  {
+    for (size_type g = 0; g < _ghost_cols.size(); ++g) {
+      size_type   col = _ghost_cols[g];
+      team_unit_t unit(
+        std::upper_bound(_col_offsets.begin(), _col_offsets.end(), col)
+        - _col_offsets.begin() - 1);
+      if (g > 0 && _transfers.back().unit == unit &&
+          _ghost_cols[g - 1] + 1 == _ghost_cols[g]) {
+        ++_transfers.back().nelem;
+        continue;
+      }
+      _transfers.push_back(
+        GhostTransfer {
+          unit,
+          static_cast<index_type>(col - _col_offsets[unit.id]),
+          static_cast<index_type>(g),
+          1 });
+    }
+    _handles.resize(_transfers.size());
+  }
+
+  /**
+   * Issues the transfers of all ghost elements of \c x, non-blocking.
+   */
+  void start_exchange(const vector_type & x)
+  {
+    const auto & globmem = x.begin().globmem();
+    for (size_type t = 0; t < _transfers.size(); ++t) {
+      const auto & transfer = _transfers[t];
+      dart_storage_t ds = dash::dart_storage<value_type>(transfer.nelem);
+      DASH_ASSERT_RETURNS(
+        dart_get_handle(
+          _ghosts.data() + transfer.ghost,
+          globmem.at(transfer.unit, transfer.lindex).dart_gptr(),
+          ds.nelem,
+          ds.dtype,
+          &_handles[t]),
+        DART_OK);
+    }
+  }
+
+  /**
+   * Waits for completion of the transfers issued in \c start_exchange.
+   */
+  void wait_exchange()
+  {
+    if (_handles.empty()) {
+      return;
+    }
+    DASH_ASSERT_RETURNS(
+      dart_waitall(_handles.data(), _handles.size()),
+      DART_OK);
+  }
+
+private:
+  dash::Team                 * _team;
+  pattern_type                 _row_pattern;
+  pattern_type                 _col_pattern;
+  /// Global index of the first column owned by every unit, followed by
+  /// the number of columns
+  std::vector<size_type>       _col_offsets;
+  index_array_type             _row_ptr;
+  index_array_type             _col_indices;
+  value_array_type             _values;
+  /// Offset past the last entry of the diagonal block in every local row
+  std::vector<index_type>      _diag_end;
+  /// Offset of every local entry's column in the local elements of x for
+  /// the diagonal block, or in the ghost buffer
+  std::vector<index_type>      _lcols;
+  /// Global indices of ghost columns, ascending
+  std::vector<index_type>      _ghost_cols;
+  /// Ghost elements of x in the order of \c _ghost_cols
+  std::vector<value_type>      _ghosts;
+  std::vector<GhostTransfer>   _transfers;
+  std::vector<dart_handle_t>   _handles;
+};
+
+} // namespace dash
+
+#endif // DASH__SPARSE_MATRIX_H_INCLUDED
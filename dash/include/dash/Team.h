@@ -11,6 +11,7 @@
 
 #include <dash/internal/Logging.h>
 
+#include <algorithm>
 #include <list>
 #include <unordered_map>
 #include <iostream>
@@ -171,7 +172,12 @@ public:
   }
 
   /**
-   * Destructor. Recursively frees this Team instance's child teams.
+   * Destructor. Recursively frees this Team instance's child teams and
+   * releases the team's DART resources.
+   *
+   * Collective operation on all units in the team, like its creation in
+   * \c split: teams must be destroyed in the same order at all member
+   * units.
    */
   ~Team()
   {
@@ -197,6 +203,14 @@ public:
     }
 
     free();
+
+    if (DART_TEAM_NULL != _dartid &&
+        DART_TEAM_ALL  != _dartid &&
+        dash::is_initialized()) {
+      // Release the team's communication resources, collective operation
+      // on all units in the team:
+      dart_team_destroy(&_dartid);
+    }
   }
 
   /**
@@ -253,7 +267,15 @@ public:
      * times)
      */
     while (Team::_teams.size() > 0) {
-      Team *t = Team::_teams.begin()->second;
+      // Teams are destroyed in collective operations, delete them in the
+      // same order at all units:
+      auto t_it = std::max_element(
+                    Team::_teams.begin(), Team::_teams.end(),
+                    [](const std::pair<const dart_team_t, Team *> & a,
+                       const std::pair<const dart_team_t, Team *> & b) {
+                      return a.first < b.first;
+                    });
+      Team *t = t_it->second;
       delete t;
     }
 
@@ -2,18 +2,224 @@
 #define DASH__ALGORITHM__ACCUMULATE_H__
 
 #include <dash/Array.h>
+#include <dash/ExecutionPolicy.h>
 #include <dash/iterator/GlobIter.h>
 
 #include <dash/algorithm/LocalRange.h>
 #include <dash/algorithm/Operation.h>
+#include <dash/algorithm/internal/ParallelFor.h>
+
+#include <dash/dart/if/dart_communication.h>
+
+#include <numeric>
+#include <type_traits>
+#include <vector>
 
 
 namespace dash {
 
+namespace internal {
+
+/**
+ * Operand of units without elements in a reduction with the predefined
+ * DART operation \c op, which leaves the result \c op(init, result)
+ * unchanged.
+ */
+template <class ValueType>
+ValueType accumulate_neutral_value(
+  dart_operation_t   op,
+  const ValueType  & init)
+{
+  switch (op) {
+    case DART_OP_SUM:
+    case DART_OP_BOR:
+    case DART_OP_LOR:
+    case DART_OP_BXOR:
+    case DART_OP_LXOR:
+      return ValueType(0);
+    case DART_OP_PROD:
+      return ValueType(1);
+    default:
+      // Idempotent operations like DART_OP_MIN:
+      return init;
+  }
+}
+
+/**
+ * Combines the partial results of all units if the operation maps to a
+ * predefined DART operation on a DART basic type, avoiding user-defined
+ * DART types and operations.
+ */
+template <
+  class ValueType,
+  class BinaryOperation,
+  class TeamType >
+ValueType accumulate_units(
+  const ReducePartial<ValueType> & l_result,
+  ValueType                        init,
+  BinaryOperation                  binary_op,
+  TeamType                       & team,
+  std::true_type                   /* predefined operation */)
+{
+  const dart_operation_t dart_op = binary_op.dart_operation();
+  ValueType l_value = l_result.valid
+                      ? l_result.value
+                      : accumulate_neutral_value(dart_op, init);
+  ValueType g_value = init;
+  DASH_ASSERT_RETURNS(
+    dart_allreduce(
+      &l_value,
+      &g_value,
+      1,
+      dash::dart_datatype<ValueType>::value,
+      dart_op,
+      team.dart_id()),
+    DART_OK);
+  // The result of units without elements is the neutral value:
+  return binary_op(init, g_value);
+}
+
+/**
+ * Combines the partial results of all units in a user-defined DART
+ * operation on partial results.
+ */
+template <
+  class ValueType,
+  class BinaryOperation,
+  class TeamType >
+ValueType accumulate_units(
+  const ReducePartial<ValueType> & l_result,
+  ValueType                        init,
+  BinaryOperation                  binary_op,
+  TeamType                       & team,
+  std::false_type                  /* user-defined operation */)
+{
+  typedef ReducePartial<ValueType>                        partial_t;
+  typedef ReducePartialOperation<ValueType, BinaryOperation>
+                                                          partial_op_t;
+
+  partial_t g_result { init, false };
+  dash::DartReduceOperation<partial_t, partial_op_t> dart_op(
+    partial_op_t { binary_op });
+  DASH_ASSERT_RETURNS(
+    dart_allreduce(
+      &l_result,
+      &g_result,
+      1,
+      dart_op.dart_type(),
+      dart_op.dart_operation(),
+      team.dart_id()),
+    DART_OK);
+
+  return g_result.valid ? binary_op(init, g_result.value) : init;
+}
+
+} // namespace internal
+
+/**
+ * Accumulate values in range \c [first, last) using the given binary
+ * reduce function \c op.
+ *
+ * Collective operation, local elements are reduced by the threads
+ * specified in the execution policy.
+ * The reduce function must be associative, the result is returned at
+ * all units.
+ *
+ * Semantics:
+ *
+ *     acc = init (+) in[0] (+) in[1] (+) ... (+) in[n]
+ *
+ * \see      DashExecutionPolicies
+ *
+ * \ingroup  DashAlgorithms
+ */
+template <
+  class ExecutionPolicy,
+  class GlobInputIt,
+  class ValueType,
+  class BinaryOperation >
+dash::internal::enable_if_execution_policy<ExecutionPolicy, ValueType>
+accumulate(
+  ExecutionPolicy && policy,
+  GlobInputIt        in_first,
+  GlobInputIt        in_last,
+  ValueType          init,
+  BinaryOperation    binary_op)
+{
+  typedef typename GlobInputIt::index_type                index_t;
+  typedef dash::internal::ReducePartial<ValueType>        partial_t;
+  typedef dash::internal::ReducePartialOperation<
+            ValueType, BinaryOperation>                   partial_op_t;
+
+  auto & team        = in_first.team();
+  auto   index_range = dash::local_range(in_first, in_last);
+  auto   l_first     = index_range.begin;
+  index_t l_size     = index_range.end - index_range.begin;
+
+  std::vector<partial_t> chunk_results(
+    dash::internal::num_parallel_chunks(policy, l_size, sizeof(ValueType)),
+    partial_t { init, false });
+  dash::internal::parallel_for(
+    policy, l_size, sizeof(ValueType),
+    [&](int c, index_t c_begin, index_t c_end) {
+      if (c_begin < c_end) {
+        chunk_results[c].value = std::accumulate(
+                                   l_first + c_begin + 1,
+                                   l_first + c_end,
+                                   static_cast<ValueType>(l_first[c_begin]),
+                                   binary_op);
+        chunk_results[c].valid = true;
+      }
+    });
+  partial_op_t partial_op { binary_op };
+  partial_t    l_result   { init, false };
+  for (const auto & cr : chunk_results) {
+    l_result = partial_op(l_result, cr);
+  }
+
+  // Combine partial results of all units in a single reduction:
+  return dash::internal::accumulate_units(
+           l_result, init, binary_op, team,
+           std::integral_constant<
+             bool,
+             dash::internal::has_dart_operation<
+               BinaryOperation>::type::value &&
+             dash::dart_datatype<ValueType>::value != DART_TYPE_UNDEFINED
+           >());
+}
+
 /**
  * Accumulate values in range \c [first, last) as the sum of all values
  * in the range.
  *
+ * Collective operation, local elements are reduced by the threads
+ * specified in the execution policy.
+ *
+ * \see      DashExecutionPolicies
+ *
+ * \ingroup  DashAlgorithms
+ */
+template <
+  class ExecutionPolicy,
+  class GlobInputIt,
+  class ValueType >
+dash::internal::enable_if_execution_policy<ExecutionPolicy, ValueType>
+accumulate(
+  ExecutionPolicy && policy,
+  GlobInputIt        in_first,
+  GlobInputIt        in_last,
+  ValueType          init)
+{
+  return dash::accumulate(policy, in_first, in_last, init,
+                          dash::plus<ValueType>());
+}
+
+/**
+ * Accumulate values in range \c [first, last) as the sum of all values
+ * in the range.
+ *
+ * Collective operation, the result is returned at all units.
+ *
  * Note: For equivalent of semantics of \c MPI_Accumulate, see
  * \c dash::transform.
  *
@@ -33,34 +239,18 @@ ValueType accumulate(
   GlobInputIt     in_last,
   ValueType       init)
 {
-  typedef typename GlobInputIt::index_type index_t;
-
-  auto & team      = in_first.team();
-  auto myid        = team.myid();
-  auto index_range = dash::local_range(in_first, in_last);
-  auto l_first     = index_range.begin;
-  auto l_last      = index_range.end;
-  auto l_result    = std::accumulate(l_first, l_last, init);
-  auto result      = 0;
-
-  dash::Array<index_t> l_results(team.size(), team);
-  l_results.local[0] = l_result;
-
-  team.barrier();
-
-  if (myid == 0) {
-    for (int i = 0; i < team.size(); i++) {
-      result += l_results[i];
-    }
-  }
-  return result;
+  return dash::accumulate(dash::execution::seq, in_first, in_last, init,
+                          dash::plus<ValueType>());
 }
 
 /**
  * Accumulate values in range \c [first, last) using the given binary
  * reduce function \c op.
  *
- * Collective operation.
+ * Collective operation, the result is returned at all units.
+ * The reduce function must be associative, values of arbitrary
+ * trivially copyable types are reduced in a single collective
+ * operation.
  *
  * Note: For equivalent of semantics of \c MPI_Accumulate, see
  * \c dash::transform.
@@ -83,27 +273,8 @@ ValueType accumulate(
   ValueType       init,
   BinaryOperation binary_op = dash::plus<ValueType>())
 {
-  typedef typename GlobInputIt::index_type index_t;
-
-  auto & team      = in_first.team();
-  auto myid        = team.myid();
-  auto index_range = dash::local_range(in_first, in_last);
-  auto l_first     = index_range.begin;
-  auto l_last      = index_range.end;
-  auto l_result    = std::accumulate(l_first, l_last, init, binary_op);
-  auto result      = 0;
-
-  dash::Array<index_t> l_results(team.size(), team);
-  l_results.local[0] = l_result;
-
-  team.barrier();
-
-  if (myid == 0) {
-    for (int i = 0; i < team.size(); i++) {
-      result = binary_op(result, l_results[i]);
-    }
-  }
-  return result;
+  return dash::accumulate(dash::execution::seq, in_first, in_last, init,
+                          binary_op);
 }
 
 } // namespace dash
@@ -1,28 +1,66 @@
 #ifndef DASH__ALGORITHM__ALL_OF_H__
 #define DASH__ALGORITHM__ALL_OF_H__
 
+#include <dash/ExecutionPolicy.h>
 #include <dash/iterator/GlobIter.h>
 #include <dash/algorithm/Find.h>
+#include <dash/algorithm/internal/ParallelFor.h>
 
 
 namespace dash {
 
 /**
+ * Returns true if \c p returns true for all elements in the range
+ * \c [first,last) or if the range is empty.
+ *
+ * Collective operation, local elements are searched by the threads
+ * specified in the execution policy. Like \c dash::find_if, units stop
+ * searching as soon as the result is known.
+ *
+ * \see         DashExecutionPolicies
+ *
  * \ingroup     DashAlgorithms
  */
 template<
+  class    ExecutionPolicy,
   typename ElementType,
   class    PatternType,
-	typename UnaryPredicate>
-GlobIter<ElementType, PatternType> all_of(
+  typename UnaryPredicate >
+dash::internal::enable_if_execution_policy<ExecutionPolicy, bool>
+all_of(
+  /// Execution policy of the local search
+  ExecutionPolicy                   && policy,
   /// Iterator to the initial position in the sequence
   GlobIter<ElementType, PatternType>   first,
   /// Iterator to the final position in the sequence
   GlobIter<ElementType, PatternType>   last,
   /// Predicate applied to the elements in range [first, last)
-  UnaryPredicate p)
+  UnaryPredicate                       p)
 {
-  return find_if_not(first, last, p) == last;
+  return dash::find_if_not(policy, first, last, p) == last;
+}
+
+/**
+ * Returns true if \c p returns true for all elements in the range
+ * \c [first,last) or if the range is empty.
+ *
+ * Collective operation.
+ *
+ * \ingroup     DashAlgorithms
+ */
+template<
+  typename ElementType,
+  class    PatternType,
+  typename UnaryPredicate >
+bool all_of(
+  /// Iterator to the initial position in the sequence
+  GlobIter<ElementType, PatternType>   first,
+  /// Iterator to the final position in the sequence
+  GlobIter<ElementType, PatternType>   last,
+  /// Predicate applied to the elements in range [first, last)
+  UnaryPredicate                       p)
+{
+  return dash::all_of(dash::seq, first, last, p);
 }
 
 } // namespace dash
@@ -1,20 +1,35 @@
 #ifndef DASH__ALGORITHM__ANY_OF_H__
 #define DASH__ALGORITHM__ANY_OF_H__
 
+#include <dash/ExecutionPolicy.h>
 #include <dash/iterator/GlobIter.h>
 #include <dash/algorithm/Find.h>
+#include <dash/algorithm/internal/ParallelFor.h>
 
 
 namespace dash {
 
 /**
+ * Returns true if \c p returns true for at least one element in the
+ * range \c [first,last), false if the range is empty.
+ *
+ * Collective operation, local elements are searched by the threads
+ * specified in the execution policy. Like \c dash::find_if, units stop
+ * searching as soon as the result is known.
+ *
+ * \see         DashExecutionPolicies
+ *
  * \ingroup     DashAlgorithms
  */
 template<
+  class    ExecutionPolicy,
   typename ElementType,
   class    PatternType,
   typename UnaryPredicate >
-GlobIter<ElementType, PatternType> any_of(
+dash::internal::enable_if_execution_policy<ExecutionPolicy, bool>
+any_of(
+  /// Execution policy of the local search
+  ExecutionPolicy                   && policy,
   /// Iterator to the initial position in the sequence
   GlobIter<ElementType, PatternType>   first,
   /// Iterator to the final position in the sequence
@@ -22,7 +37,30 @@ GlobIter<ElementType, PatternType> any_of(
   /// Predicate applied to the elements in range [first, last)
   UnaryPredicate                       p)
 {
-  return find_if(first, last, p) != last;
+  return dash::find_if(policy, first, last, p) != last;
+}
+
+/**
+ * Returns true if \c p returns true for at least one element in the
+ * range \c [first,last), false if the range is empty.
+ *
+ * Collective operation.
+ *
+ * \ingroup     DashAlgorithms
+ */
+template<
+  typename ElementType,
+  class    PatternType,
+  typename UnaryPredicate >
+bool any_of(
+  /// Iterator to the initial position in the sequence
+  GlobIter<ElementType, PatternType>   first,
+  /// Iterator to the final position in the sequence
+  GlobIter<ElementType, PatternType>   last,
+  /// Predicate applied to the elements in range [first, last)
+  UnaryPredicate                       p)
+{
+  return dash::any_of(dash::seq, first, last, p);
 }
 
 } // namespace dash
@@ -3,8 +3,11 @@
 
 #include <dash/Future.h>
 #include <dash/Iterator.h>
+#include <dash/ExecutionPolicy.h>
 
 #include <dash/algorithm/LocalRange.h>
+#include <dash/algorithm/internal/ParallelFor.h>
+#include <dash/util/CommMatrix.h>
 
 #include <dash/dart/if/dart_communication.h>
 
@@ -174,6 +177,7 @@ ValueType * copy_impl(
                      "left:",           total_elem_left);
       auto cur_in_first  = g_in_first + num_elem_copied;
       auto cur_out_first = out_first  + num_elem_copied;
+      dash::util::CommMatrix::record(cur_in_first.dart_gptr(), num_copy_elem);
       dart_storage_t ds = dash::dart_storage<ValueType>(num_copy_elem);
       DASH_ASSERT_RETURNS(
         dart_get_blocking(
@@ -228,6 +232,7 @@ ValueType * copy_impl(
                      "left:",           total_elem_left);
       auto dest_ptr = out_first + num_elem_copied;
       auto src_gptr = cur_in_first.dart_gptr();
+      dash::util::CommMatrix::record(src_gptr, num_copy_elem);
       dart_storage_t ds = dash::dart_storage<ValueType>(num_copy_elem);
       if (dart_get_blocking(
             dest_ptr,
@@ -326,6 +331,7 @@ dash::Future<ValueType *> copy_async_impl(
                      "left:",           total_elem_left);
       auto cur_in_first  = g_in_first + num_elem_copied;
       auto cur_out_first = out_first  + num_elem_copied;
+      dash::util::CommMatrix::record(cur_in_first.dart_gptr(), num_copy_elem);
 #ifdef DASH__ALGORITHM__COPY__USE_FLUSH
       dart_storage_t ds = dash::dart_storage<ValueType>(num_copy_elem);
       DASH_ASSERT_RETURNS(
@@ -397,6 +403,7 @@ dash::Future<ValueType *> copy_async_impl(
                      "left:",           total_elem_left);
       auto src_gptr = cur_in_first.dart_gptr();
       auto dest_ptr = out_first + num_elem_copied;
+      dash::util::CommMatrix::record(src_gptr, num_copy_elem);
 #ifdef DASH__ALGORITHM__COPY__USE_FLUSH
       dart_storage_t ds = dash::dart_storage<ValueType>(num_copy_elem);
       if (dart_get(
@@ -494,6 +501,7 @@ GlobOutputIt copy_impl(
                  "g_out_first:", out_first.pos());
 
   auto num_elements = std::distance(in_first, in_last);
+  dash::util::CommMatrix::record(out_first.dart_gptr(), num_elements);
   dart_storage_t ds = dash::dart_storage<ValueType>(num_elements);
   DASH_ASSERT_RETURNS(
     dart_put_blocking(
@@ -537,6 +545,7 @@ dash::Future<GlobOutputIt> copy_async_impl(
   auto num_copy_elem = std::distance(in_first, in_last);
   auto src_ptr       = in_first;
   auto dest_gptr     = out_first.dart_gptr();
+  dash::util::CommMatrix::record(dest_gptr, num_copy_elem);
 #ifdef DASH__ALGORITHM__COPY__USE_FLUSH
   dart_storage_t ds = dash::dart_storage<ValueType>(num_copy_elem);
   if (dart_put(
@@ -662,6 +671,7 @@ dash::Future<ValueType *> copy_async(
   // local-only range only requires one call to in_first.local() which increases
   // throughput by ~10% for local ranges.
   if (num_local_elem == total_copy_elem) {
+    dash::util::CommMatrix::record_local(num_local_elem);
     // Entire input range is local:
     DASH_LOG_TRACE("dash::copy_async", "entire input range is local");
     ValueType * l_out_last = out_first + total_copy_elem;
@@ -694,6 +704,7 @@ dash::Future<ValueType *> copy_async(
   auto futures = std::vector< dash::Future<ValueType *> >();
   // Check if global input range is partially local:
   if (num_local_elem > 0) {
+    dash::util::CommMatrix::record_local(num_local_elem);
     // Part of the input range is local, copy local input subrange to local
     // output range directly.
     auto pattern          = in_first.pattern();
@@ -870,6 +881,7 @@ ValueType * copy(
   // local-only range only requires one call to in_first.local() which increases
   // throughput by ~10% for local ranges.
   if (num_local_elem == total_copy_elem) {
+    dash::util::CommMatrix::record_local(num_local_elem);
     // Entire input range is local:
     DASH_LOG_TRACE("dash::copy", "entire input range is local");
     ValueType * out_last = out_first + total_copy_elem;
@@ -897,6 +909,7 @@ ValueType * copy(
                  "in_first.is_local:", in_first.is_local());
   // Check if global input range is partially local:
   if (num_local_elem > 0) {
+    dash::util::CommMatrix::record_local(num_local_elem);
     // Part of the input range is local, copy local input subrange to local
     // output range directly.
     auto pattern          = in_first.pattern();
@@ -1015,6 +1028,54 @@ ValueType * copy(
   return out_last;
 }
 
+/*
+ * Specialization of \c dash::copy as global-to-local blocking copy
+ * operation, a local input range is copied by the threads specified in
+ * the execution policy.
+ * Input ranges that are not entirely local are copied as in
+ * \c dash::copy.
+ *
+ * \see      DashExecutionPolicies
+ *
+ * \ingroup  DashAlgorithms
+ */
+template <
+  class    ExecutionPolicy,
+  typename ValueType,
+  class    GlobInputIt >
+dash::internal::enable_if_execution_policy<ExecutionPolicy, ValueType *>
+copy(
+  ExecutionPolicy && policy,
+  GlobInputIt        in_first,
+  GlobInputIt        in_last,
+  ValueType        * out_first)
+{
+  typedef typename GlobInputIt::index_type index_t;
+
+  DASH_LOG_TRACE("dash::copy()", "blocking, global to local, policy");
+  auto    li_range_in     = local_index_range(in_first, in_last);
+  // Number of elements in the local subrange:
+  index_t num_local_elem  = li_range_in.end - li_range_in.begin;
+  // Total number of elements to be copied:
+  index_t total_copy_elem = in_last - in_first;
+  if (num_local_elem != total_copy_elem) {
+    return dash::copy(in_first, in_last, out_first);
+  }
+  // Entire input range is local:
+  dash::util::CommMatrix::record_local(num_local_elem);
+  ValueType * l_in_first = in_first.local();
+  dash::internal::parallel_for(
+    policy, num_local_elem, sizeof(ValueType),
+    [&](int, index_t c_begin, index_t c_end) {
+      std::copy(l_in_first + c_begin,
+                l_in_first + c_end,
+                out_first  + c_begin);
+    });
+  DASH_LOG_TRACE("dash::copy >", "finished local copy of",
+                 num_local_elem, "elements");
+  return out_first + num_local_elem;
+}
+
 
 // =========================================================================
 // Local to Global, Distributed Range
@@ -1071,6 +1132,7 @@ GlobOutputIt copy(
   auto num_local_elem     = li_range_out.end - li_range_out.begin;
   // Check if part of the output range is local:
   if (num_local_elem > 0) {
+    dash::util::CommMatrix::record_local(num_local_elem);
     // Part of the output range is local
     // Copy local input subrange to local output range directly:
     auto pattern            = out_first.pattern();
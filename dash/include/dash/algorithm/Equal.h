@@ -2,11 +2,16 @@
 #define DASH__ALGORITHM__EQUAL_H__
 
 #include <dash/Array.h>
+#include <dash/ExecutionPolicy.h>
 #include <dash/iterator/GlobIter.h>
 #include <dash/algorithm/LocalRange.h>
 #include <dash/algorithm/Operation.h>
+#include <dash/algorithm/internal/ParallelFor.h>
 #include <dash/dart/if/dart_communication.h>
 
+#include <algorithm>
+#include <vector>
+
 namespace dash {
 
 /**
@@ -94,6 +99,107 @@ bool equal(
   return return_result;
 }
 
+/**
+ * Returns true if the range \c [first1, last1) is equal to the range
+ * \c [first2, first2 + (last1 - first1)) with respect to a specified
+ * predicate, and false otherwise.
+ *
+ * Both ranges must have identical distribution and start offset.
+ * Collective operation, local elements are compared by the threads
+ * specified in the execution policy and the result is returned at all
+ * units.
+ *
+ * \see         DashExecutionPolicies
+ *
+ * \ingroup     DashAlgorithms
+ */
+template <
+  class    ExecutionPolicy,
+  typename ElementType,
+  class    PatternType,
+  class    BinaryPredicate >
+dash::internal::enable_if_execution_policy<ExecutionPolicy, bool>
+equal(
+  /// Execution policy of the local comparison
+  ExecutionPolicy                   && policy,
+  /// Iterator to the initial position in the sequence
+  GlobIter<ElementType, PatternType>   first_1,
+  /// Iterator to the final position in the sequence
+  GlobIter<ElementType, PatternType>   last_1,
+  GlobIter<ElementType, PatternType>   first_2,
+  BinaryPredicate                      pred)
+{
+  typedef typename PatternType::index_type index_t;
+
+  DASH_ASSERT_MSG(first_1.pattern() == first_2.pattern(),
+                  "dash::equal: distributions of ranges differ");
+  auto & team        = first_1.team();
+  auto   last_2      = first_2 + dash::distance(first_1, last_1);
+  // Global iterators to local ranges:
+  auto   l_range_1   = dash::local_range(first_1, last_1);
+  auto   l_range_2   = dash::local_range(first_2, last_2);
+  index_t l_size     = l_range_1.end - l_range_1.begin;
+  DASH_ASSERT_EQ(l_size, l_range_2.end - l_range_2.begin,
+                 "dash::equal: local ranges differ in size");
+
+  // Result of every chunk, as char to prevent std::vector<bool>:
+  std::vector<char> chunk_results(
+    dash::internal::num_parallel_chunks(
+      policy, l_size, sizeof(ElementType)),
+    1);
+  dash::internal::parallel_for(
+    policy, l_size, sizeof(ElementType),
+    [&](int c, index_t c_begin, index_t c_end) {
+      chunk_results[c] = std::equal(l_range_1.begin + c_begin,
+                                    l_range_1.begin + c_end,
+                                    l_range_2.begin + c_begin,
+                                    pred);
+    });
+  int l_result = std::all_of(chunk_results.begin(), chunk_results.end(),
+                             [](char r) { return r != 0; });
+  int g_result;
+  DASH_ASSERT_RETURNS(
+    dart_allreduce(
+      &l_result,
+      &g_result,
+      1,
+      DART_TYPE_INT,
+      DART_OP_LAND,
+      team.dart_id()),
+    DART_OK);
+  return g_result != 0;
+}
+
+/**
+ * Returns true if the range \c [first1, last1) is equal to the range
+ * \c [first2, first2 + (last1 - first1)), and false otherwise.
+ *
+ * Both ranges must have identical distribution and start offset.
+ * Collective operation, local elements are compared by the threads
+ * specified in the execution policy.
+ *
+ * \see         DashExecutionPolicies
+ *
+ * \ingroup     DashAlgorithms
+ */
+template <
+  class    ExecutionPolicy,
+  typename ElementType,
+  class    PatternType >
+dash::internal::enable_if_execution_policy<ExecutionPolicy, bool>
+equal(
+  /// Execution policy of the local comparison
+  ExecutionPolicy                   && policy,
+  /// Iterator to the initial position in the sequence
+  GlobIter<ElementType, PatternType>   first_1,
+  /// Iterator to the final position in the sequence
+  GlobIter<ElementType, PatternType>   last_1,
+  GlobIter<ElementType, PatternType>   first_2)
+{
+  return dash::equal(policy, first_1, last_1, first_2,
+                     std::equal_to<ElementType>());
+}
+
 } // namespace dash
 
 #endif // DASH__ALGORITHM__EQUAL_H__
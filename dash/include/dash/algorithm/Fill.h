@@ -1,18 +1,21 @@
 #ifndef DASH__ALGORITHM__FILL_H__
 #define DASH__ALGORITHM__FILL_H__
 
+#include <dash/internal/Config.h>
+
 #include <dash/iterator/GlobIter.h>
 
+#include <dash/ExecutionPolicy.h>
+
 #include <dash/algorithm/LocalRange.h>
 #include <dash/algorithm/Operation.h>
+#include <dash/algorithm/internal/ParallelFor.h>
 
-#include <dash/util/UnitLocality.h>
+#include <dash/internal/Logging.h>
 
 #include <dash/dart/if/dart_communication.h>
 
-#ifdef DASH_ENABLE_OPENMP
-#include <omp.h>
-#endif
+#include <algorithm>
 
 
 namespace dash {
@@ -22,15 +25,27 @@ namespace dash {
  *
  * Being a collaborative operation, each unit will assign the value to
  * its local elements only.
+ * Local elements are assigned by the threads specified in the execution
+ * policy, which also places their memory pages in the threads' NUMA
+ * domains on first touch.
  *
- * \tparam      ElementType  Type of the elements in the sequence
- * \complexity  O(d) + O(nl), with \c d dimensions in the global iterators'
- *              pattern and \c nl local elements within the global range
+ * \tparam      ExecutionPolicy  Execution policy type, e.g.
+ *                               \c dash::execution::parallel_unsequenced_policy
+ * \complexity  O(d) + O(nl/t), with \c d dimensions in the global
+ *              iterators' pattern, \c nl local elements within the global
+ *              range and \c t threads
+ *
+ * \see         DashExecutionPolicies
  *
  * \ingroup     DashAlgorithms
  */
-template <typename GlobIterType>
-void fill(
+template <
+  class ExecutionPolicy,
+  typename GlobIterType >
+dash::internal::enable_if_execution_policy<ExecutionPolicy>
+fill(
+  /// Execution policy of the local assignment
+  ExecutionPolicy  && policy,
   /// Iterator to the initial position in the sequence
   GlobIterType        first,
   /// Iterator to the final position in the sequence
@@ -45,33 +60,46 @@ void fill(
   auto      index_range = dash::local_range(first, last);
   value_t * lfirst      = index_range.begin;
   value_t * llast       = index_range.end;
-  auto      nlocal      = llast - lfirst;
+  index_t   nlocal      = llast - lfirst;
 
-#if 0
-  for (index_t lt = 0; lt < nlocal; lt++) {
-    lfirst[lt] = value;
-  }
-#else
+  auto n_chunks = dash::internal::parallel_for(
+                    policy, nlocal, sizeof(value_t),
+                    [&](int, index_t c_begin, index_t c_end) {
+                      std::fill(lfirst + c_begin, lfirst + c_end, value);
+                    });
+  DASH_LOG_DEBUG("dash::fill >", "local elements:", nlocal,
+                 "chunks:", n_chunks);
+}
+
+/**
+ * Assigns the given value to the elements in the range [first, last)
+ *
+ * Being a collaborative operation, each unit will assign the value to
+ * its local elements only.
+ * If OpenMP is enabled, local elements are assigned by the threads of the
+ * calling unit's domain as in \c dash::execution::par_unseq, otherwise
+ * sequentially.
+ *
+ * \tparam      ElementType  Type of the elements in the sequence
+ * \complexity  O(d) + O(nl/t), with \c d dimensions in the global
+ *              iterators' pattern, \c nl local elements within the global
+ *              range and \c t threads
+ *
+ * \ingroup     DashAlgorithms
+ */
+template <typename GlobIterType>
+void fill(
+  /// Iterator to the initial position in the sequence
+  GlobIterType        first,
+  /// Iterator to the final position in the sequence
+  GlobIterType        last,
+  /// Value which will be assigned to the elements in range [first, last)
+  const typename GlobIterType::value_type & value)
+{
 #ifdef DASH_ENABLE_OPENMP
-  dash::util::UnitLocality uloc;
-  auto n_threads = uloc.num_domain_threads();
-  DASH_LOG_DEBUG("dash::fill", "thread capacity:",  n_threads);
-  #pragma omp parallel num_threads(n_threads)
-  for (index_t lt = 0; lt < nlocal; lt += 2) {
-    lfirst[lt] = value;
-  }
-  #pragma omp parallel num_threads(n_threads)
-  for (index_t lt = 1; lt < nlocal; lt += 2) {
-    lfirst[lt] = value;
-  }
+  dash::fill(dash::execution::par_unseq, first, last, value);
 #else
-  for (index_t lt = 0; lt < nlocal; lt += 2) {
-    lfirst[lt] = value;
-  }
-  for (index_t lt = 1; lt < nlocal; lt += 2) {
-    lfirst[lt] = value;
-  }
-#endif
+  dash::fill(dash::execution::seq, first, last, value);
 #endif
 }
 
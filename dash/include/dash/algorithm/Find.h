@@ -1,73 +1,154 @@
 #ifndef DASH__ALGORITHM__FIND_H__
 #define DASH__ALGORITHM__FIND_H__
 
-#include <dash/Array.h>
+#include <dash/ExecutionPolicy.h>
 #include <dash/iterator/GlobIter.h>
 #include <dash/algorithm/LocalRange.h>
 #include <dash/algorithm/Operation.h>
+#include <dash/algorithm/internal/FindBound.h>
+#include <dash/algorithm/internal/ParallelFor.h>
 #include <dash/dart/if/dart_communication.h>
 
+#include <algorithm>
+#include <limits>
+#include <memory>
+#include <vector>
+
 namespace dash {
 
+namespace internal {
+
 /**
- * Returns an iterator to the first element in the range \c [first,last) that
- * compares equal to \c val.
+ * Offset of the first element in the local range \c [first, first + nelem)
+ * for which \c predicate returns true, or \c nelem if no such element
+ * is found. Chunks of the range are searched by the threads specified in
+ * the execution policy.
+ */
+template<
+  class    ExecutionPolicy,
+  typename ElementType,
+  typename IndexType,
+  class    UnaryPredicate >
+IndexType find_if_local(
+  ExecutionPolicy    && policy,
+  const ElementType   * first,
+  IndexType             nelem,
+  UnaryPredicate      & predicate)
+{
+  // Local offset of first hit in every chunk, or nelem if not found:
+  std::vector<IndexType> chunk_hits(
+    dash::internal::num_parallel_chunks(
+      policy, nelem, sizeof(ElementType)),
+    nelem);
+  dash::internal::parallel_for(
+    policy, nelem, sizeof(ElementType),
+    [&](int c, IndexType c_begin, IndexType c_end) {
+      chunk_hits[c] = std::find_if(first + c_begin,
+                                   first + c_end,
+                                   predicate)
+                      - first;
+      if (chunk_hits[c] == c_end) {
+        chunk_hits[c] = nelem;
+      }
+    });
+  // Chunks are ordered, the first hit is the smallest offset:
+  return *std::min_element(chunk_hits.begin(), chunk_hits.end());
+}
+
+} // namespace internal
+
+/**
+ * Returns an iterator to the first element in the range \c [first,last)
+ * for which \c predicate returns true.
  * If no such element is found, the function returns \c last.
  *
+ * Collective operation, local elements are searched by the threads
+ * specified in the execution policy.
+ *
+ * In ranges of one-dimensional patterns exceeding
+ * \c dash::internal::find_round_bytes per unit, units search their local
+ * elements cooperatively: every unit publishes its first hit in a word
+ * shared by the team and stops searching once a hit before its remaining
+ * elements is known, so searches for rare values terminate shortly after
+ * the first hit has been found instead of scanning all elements.
+ *
+ * \see         DashExecutionPolicies
+ *
  * \ingroup     DashAlgorithms
  */
 template<
+  class    ExecutionPolicy,
   typename ElementType,
-  class    PatternType>
-GlobIter<ElementType, PatternType> find(
+  class    PatternType,
+  class    UnaryPredicate >
+dash::internal::enable_if_execution_policy<
+  ExecutionPolicy, GlobIter<ElementType, PatternType> >
+find_if(
+  /// Execution policy of the local search
+  ExecutionPolicy                   && policy,
   /// Iterator to the initial position in the sequence
   GlobIter<ElementType, PatternType>   first,
   /// Iterator to the final position in the sequence
   GlobIter<ElementType, PatternType>   last,
-  /// Value which will be assigned to the elements in range [first, last)
-  const ElementType                  & value)
+  /// Predicate which will be applied to the elements in range [first, last)
+  UnaryPredicate                       predicate)
 {
   using p_index_t = typename PatternType::index_type;
+  using bound_t   = dash::internal::FindBound<p_index_t>;
 
   if(first >= last) {
     return last;
   }
 
-  p_index_t g_index;
   auto & pattern     = first.pattern();
   auto & team        = pattern.team();
   auto index_range   = dash::local_index_range(first, last);
-  auto l_begin_index = index_range.begin;
-  auto l_end_index   = index_range.end;
-  auto first_offset  = first.pos();
-  if(l_begin_index == l_end_index){
-    g_index = std::numeric_limits<p_index_t>::max();
+  p_index_t l_size   = index_range.end - index_range.begin;
+  p_index_t g_index  = bound_t::not_found();
+  p_index_t round_size = static_cast<p_index_t>(
+                           dash::internal::find_round_bytes /
+                           sizeof(ElementType)) + 1;
+  // Search cooperatively in rounds if the range is large enough, local
+  // elements are only ordered by their global index in one-dimensional
+  // patterns:
+  std::unique_ptr<bound_t> bound;
+  if (PatternType::ndim() == 1 &&
+      (last - first) / static_cast<p_index_t>(team.size()) > round_size) {
+    bound.reset(new bound_t(team));
+    round_size *= dash::internal::num_threads(policy);
   } else {
-   auto g_begin_index = pattern.global(l_begin_index);
-
+    round_size  = l_size;
+  }
+  if (l_size > 0) {
     // Pointer to first element in local memory:
     const ElementType * lbegin        = first.globmem().lbegin(
                                           dash::Team::GlobalUnitID());
-    // Pointers to first / final element in local range:
-    const ElementType * l_range_begin = lbegin + l_begin_index;
-    const ElementType * l_range_end   = lbegin + l_end_index;
-
-    DASH_LOG_DEBUG("local index range", l_begin_index, l_end_index);
-
-    auto l_result = std::find(l_range_begin, l_range_end, value);
-    if(l_result == l_range_end){
-      DASH_LOG_DEBUG("Not found in local range");
-      g_index = std::numeric_limits<p_index_t>::max();
-    } else {
-      auto l_hit_index = l_result - lbegin;
-      g_index = pattern.global(l_hit_index);
+    const ElementType * l_range_begin = lbegin + index_range.begin;
+    for (p_index_t r_begin = 0; r_begin < l_size; r_begin += round_size) {
+      p_index_t r_size = std::min(round_size, l_size - r_begin);
+      if (r_begin > 0 &&
+          bound->load() < pattern.global(index_range.begin + r_begin)) {
+        DASH_LOG_DEBUG("dash::find_if", "earlier hit known, stopped at",
+                       r_begin, "of", l_size, "local elements");
+        break;
+      }
+      p_index_t l_hit = dash::internal::find_if_local(
+                          policy, l_range_begin + r_begin, r_size,
+                          predicate);
+      if (l_hit < r_size) {
+        g_index = pattern.global(index_range.begin + r_begin + l_hit);
+        if (bound) {
+          bound->publish(g_index);
+        }
+        break;
+      }
     }
+    DASH_LOG_DEBUG("dash::find_if", "local index range",
+                   index_range.begin, index_range.end, "hit:", g_index);
   }
-  team.barrier();
 
-  // receive buffer for global maximal index
+  // receive buffer for global minimal index
   p_index_t g_hit_idx;
-
   DASH_ASSERT_RETURNS(
       dart_allreduce(
         &g_index,
@@ -77,85 +158,152 @@ GlobIter<ElementType, PatternType> find(
         DART_OP_MIN,
         team.dart_id()),
       DART_OK);
+  // All units stopped searching, the shared bound can be released:
+  bound.reset();
 
-  if (g_hit_idx == std::numeric_limits<p_index_t>::max()) {
-    DASH_LOG_DEBUG("element not found");
-  } else {
-    return first + g_hit_idx;
+  if (g_hit_idx == bound_t::not_found()) {
+    DASH_LOG_DEBUG("dash::find_if >", "element not found");
+    return last;
   }
-  return last;
+  return first + (g_hit_idx - first.pos());
 }
 
 /**
+ * Returns an iterator to the first element in the range \c [first,last)
+ * for which \c predicate returns true.
+ * If no such element is found, the function returns \c last.
+ *
+ * Collective operation.
+ *
  * \ingroup     DashAlgorithms
  */
 template<
   typename ElementType,
   class    PatternType,
-	class    UnaryPredicate >
+  class    UnaryPredicate >
 GlobIter<ElementType, PatternType> find_if(
   /// Iterator to the initial position in the sequence
   GlobIter<ElementType, PatternType>   first,
   /// Iterator to the final position in the sequence
   GlobIter<ElementType, PatternType>   last,
   /// Predicate which will be applied to the elements in range [first, last)
-	UnaryPredicate                       predicate)
+  UnaryPredicate                       predicate)
 {
-  typedef typename PatternType::index_type index_t;
-
-  auto & team        = first.pattern().team();
-  auto myid          = team.myid();
-  /// Global iterators to local range:
-  auto index_range   = dash::local_range(first, last);
-  auto l_first       = index_range.begin;
-  auto l_last        = index_range.end;
-
-  auto l_result      = std::find_if(l_first, l_last, predicate);
-  auto l_offset      = std::distance(l_first, l_result);
-  if (l_result == l_last) {
-    l_offset = -1;
-  }
-
-  dash::Array<index_t> l_results(team.size(), team);
-
-  l_results.local[0] = l_offset;
-
-  team.barrier();
-
-  // All local offsets stored in l_results
-  auto result = last;
-
-  for (auto u = 0; u < team.size(); u++) {
-    if (l_results[u] >= 0) {
-      auto g_offset = first.pattern()
-                           .global_index(
-                              u,
-                              { l_results[u] });
-      result = first + g_offset - first.pos();
-      break;
-    }
-  }
+  return dash::find_if(dash::seq, first, last, predicate);
+}
 
-  team.barrier();
-  return result;
+/**
+ * Returns an iterator to the first element in the range \c [first,last)
+ * for which \c predicate returns false.
+ * If no such element is found, the function returns \c last.
+ *
+ * Collective operation, local elements are searched by the threads
+ * specified in the execution policy.
+ *
+ * \see         DashExecutionPolicies
+ *
+ * \ingroup     DashAlgorithms
+ */
+template<
+  class    ExecutionPolicy,
+  typename ElementType,
+  class    PatternType,
+  class    UnaryPredicate >
+dash::internal::enable_if_execution_policy<
+  ExecutionPolicy, GlobIter<ElementType, PatternType> >
+find_if_not(
+  /// Execution policy of the local search
+  ExecutionPolicy                   && policy,
+  /// Iterator to the initial position in the sequence
+  GlobIter<ElementType, PatternType>   first,
+  /// Iterator to the final position in the sequence
+  GlobIter<ElementType, PatternType>   last,
+  /// Predicate which will be applied to the elements in range [first, last)
+  UnaryPredicate                       predicate)
+{
+  return dash::find_if(
+           policy, first, last,
+           [&](const ElementType & elem) { return !predicate(elem); });
 }
 
 /**
+ * Returns an iterator to the first element in the range \c [first,last)
+ * for which \c predicate returns false.
+ * If no such element is found, the function returns \c last.
+ *
+ * Collective operation.
+ *
  * \ingroup     DashAlgorithms
  */
 template<
   typename ElementType,
   class    PatternType,
-	class    UnaryPredicate>
+  class    UnaryPredicate>
 GlobIter<ElementType, PatternType> find_if_not(
   /// Iterator to the initial position in the sequence
   GlobIter<ElementType, PatternType>   first,
   /// Iterator to the final position in the sequence
   GlobIter<ElementType, PatternType>   last,
   /// Predicate which will be applied to the elements in range [first, last)
-	UnaryPredicate                       predicate)
+  UnaryPredicate                       predicate)
+{
+  return dash::find_if_not(dash::seq, first, last, predicate);
+}
+
+/**
+ * Returns an iterator to the first element in the range \c [first,last)
+ * that compares equal to \c val.
+ * If no such element is found, the function returns \c last.
+ *
+ * Collective operation, local elements are searched by the threads
+ * specified in the execution policy.
+ *
+ * \see         DashExecutionPolicies
+ *
+ * \ingroup     DashAlgorithms
+ */
+template<
+  class    ExecutionPolicy,
+  typename ElementType,
+  class    PatternType>
+dash::internal::enable_if_execution_policy<
+  ExecutionPolicy, GlobIter<ElementType, PatternType> >
+find(
+  /// Execution policy of the local search
+  ExecutionPolicy                   && policy,
+  /// Iterator to the initial position in the sequence
+  GlobIter<ElementType, PatternType>   first,
+  /// Iterator to the final position in the sequence
+  GlobIter<ElementType, PatternType>   last,
+  /// Value to search for in range [first, last)
+  const ElementType                  & value)
+{
+  return dash::find_if(
+           policy, first, last,
+           [&](const ElementType & elem) { return elem == value; });
+}
+
+/**
+ * Returns an iterator to the first element in the range \c [first,last) that
+ * compares equal to \c val.
+ * If no such element is found, the function returns \c last.
+ *
+ * Collective operation.
+ *
+ * \ingroup     DashAlgorithms
+ */
+template<
+  typename ElementType,
+  class    PatternType>
+GlobIter<ElementType, PatternType> find(
+  /// Iterator to the initial position in the sequence
+  GlobIter<ElementType, PatternType>   first,
+  /// Iterator to the final position in the sequence
+  GlobIter<ElementType, PatternType>   last,
+  /// Value to search for in range [first, last)
+  const ElementType                  & value)
 {
-  return find_if(first, last, std::not1(predicate));
+  return dash::find(dash::seq, first, last, value);
 }
 
 } // namespace dash
@@ -1,10 +1,18 @@
 #ifndef DASH__ALGORITHM__FOR_EACH_H__
 #define DASH__ALGORITHM__FOR_EACH_H__
 
+#include <dash/ExecutionPolicy.h>
 #include <dash/iterator/GlobIter.h>
 #include <dash/algorithm/LocalRange.h>
+#include <dash/algorithm/WorkStealing.h>
+#include <dash/algorithm/internal/ParallelFor.h>
 #include <dash/internal/Logging.h>
 
+#include <dash/dart/if/dart_communication.h>
+
+#include <algorithm>
+#include <vector>
+
 namespace dash {
 
 /**
@@ -90,6 +98,53 @@ void for_each(
   team.barrier();
 }
 
+/**
+ * Invoke a function on every element in a range distributed by a pattern.
+ * Being a collaborative operation, each unit will invoke the given
+ * function on its local elements only.
+ * Local elements are processed by the threads specified in the execution
+ * policy, the function may be invoked concurrently and in any order.
+ *
+ * \tparam      ExecutionPolicy  Execution policy type, e.g.
+ *                               \c dash::execution::parallel_unsequenced_policy
+ * \complexity  O(d) + O(nl/t), with \c d dimensions in the global
+ *              iterators' pattern, \c nl local elements within the global
+ *              range and \c t threads
+ *
+ * \see         DashExecutionPolicies
+ *
+ * \ingroup     DashAlgorithms
+ */
+template <
+  class    ExecutionPolicy,
+  typename ElementType,
+  class    PatternType,
+  class    UnaryFunction >
+dash::internal::enable_if_execution_policy<ExecutionPolicy>
+for_each(
+  /// Execution policy of the local phase
+  ExecutionPolicy                         && policy,
+  /// Iterator to the initial position in the sequence
+  GlobIter<ElementType, PatternType>         first,
+  /// Iterator to the final position in the sequence
+  GlobIter<ElementType, PatternType>         last,
+  /// Function to invoke on every element in the range
+  UnaryFunction                              func)
+{
+  typedef typename PatternType::index_type index_t;
+  auto &  team   = first.pattern().team();
+  // Global iterators to local range:
+  auto    lrange = dash::local_range(first, last);
+  auto    lfirst = lrange.begin;
+  index_t nlocal = lrange.end - lrange.begin;
+  dash::internal::parallel_for(
+    policy, nlocal, sizeof(ElementType),
+    [&](int, index_t c_begin, index_t c_end) {
+      std::for_each(lfirst + c_begin, lfirst + c_end, func);
+    });
+  team.barrier();
+}
+
 /**
  * Invoke a function on every element in a range distributed by a pattern.
  * Being a collaborative operation, each unit will invoke the given
@@ -137,6 +192,113 @@ void for_each_with_index(
   team.barrier();
 }
 
+namespace internal {
+
+/**
+ * Invoke a function on every element in a range distributed by a pattern
+ * with dynamic load balancing.
+ * Chunks claimed from remote units are fetched into a local buffer and,
+ * if \c WriteBack is set, written back to their owner after the
+ * function has been applied.
+ */
+template <
+  bool     WriteBack,
+  typename ElementType,
+  class    PatternType,
+  class    UnaryFunction >
+void for_each_work_stealing(
+  dash::WorkStealing                       & policy,
+  const GlobIter<ElementType, PatternType> & first,
+  const GlobIter<ElementType, PatternType> & last,
+  UnaryFunction                            & func)
+{
+  typedef typename dash::WorkStealing::index_type index_t;
+
+  auto   myid    = policy.team().myid();
+  auto & pattern = first.pattern();
+  std::vector<ElementType> chunk_buf;
+  policy.run(first, last,
+    [&](team_unit_t unit, index_t lbegin, index_t lend) {
+      auto nelem = lend - lbegin;
+      if (unit == myid) {
+        // Local range to native pointers:
+        ElementType * l_first = (first + (pattern.global(lbegin) -
+                                          first.pos())).local();
+        std::for_each(l_first, l_first + nelem, func);
+        return;
+      }
+      // Stolen chunk, elements are contiguous in the owner's local
+      // memory:
+      dart_gptr_t    gptr = first.globmem().at(unit, lbegin).dart_gptr();
+      dart_storage_t ds   = dash::dart_storage<ElementType>(nelem);
+      chunk_buf.resize(nelem);
+      DASH_ASSERT_RETURNS(
+        dart_get_blocking(chunk_buf.data(), gptr, ds.nelem, ds.dtype),
+        DART_OK);
+      std::for_each(chunk_buf.begin(), chunk_buf.end(), func);
+      if (WriteBack) {
+        DASH_ASSERT_RETURNS(
+          dart_put_blocking(gptr, chunk_buf.data(), ds.nelem, ds.dtype),
+          DART_OK);
+      }
+    });
+}
+
+} // namespace internal
+
+/**
+ * Invoke a function on every element in a range distributed by a pattern.
+ * Variant of \c dash::for_each with dynamic load balancing: units that
+ * finished their local elements steal chunks of elements from other
+ * units.
+ *
+ * \see  dash::WorkStealing
+ *
+ * \ingroup     DashAlgorithms
+ */
+template <
+  typename ElementType,
+  class    PatternType >
+void for_each(
+  /// Execution policy, created collectively by the units in the team
+  dash::WorkStealing                       & policy,
+  /// Iterator to the initial position in the sequence
+  const GlobIter<ElementType, PatternType> & first,
+  /// Iterator to the final position in the sequence
+  const GlobIter<ElementType, PatternType> & last,
+  /// Function to invoke on every index in the range
+  ::std::function<void(const ElementType &)> & func)
+{
+  dash::internal::for_each_work_stealing<false>(policy, first, last, func);
+}
+
+/**
+ * Invoke a function on every element in a range distributed by a pattern.
+ * Variant of \c dash::for_each with dynamic load balancing for functions
+ * modifying elements.
+ * Stolen chunks are written back to their owner unit, so elements must
+ * not be accessed concurrently by other units.
+ *
+ * \see  dash::WorkStealing
+ *
+ * \ingroup     DashAlgorithms
+ */
+template <
+  typename ElementType,
+  class    PatternType >
+void for_each(
+  /// Execution policy, created collectively by the units in the team
+  dash::WorkStealing                       & policy,
+  /// Iterator to the initial position in the sequence
+  const GlobIter<ElementType, PatternType> & first,
+  /// Iterator to the final position in the sequence
+  const GlobIter<ElementType, PatternType> & last,
+  /// Function to invoke on every index in the range
+  ::std::function<void(ElementType &)>     & func)
+{
+  dash::internal::for_each_work_stealing<true>(policy, first, last, func);
+}
+
 } // namespace dash
 
 #endif // DASH__ALGORITHM__FOR_EACH_H__
@@ -1,11 +1,15 @@
 #ifndef DASH__ALGORITHM__GENERATE_H__
 #define DASH__ALGORITHM__GENERATE_H__
 
+#include <dash/ExecutionPolicy.h>
 #include <dash/iterator/GlobIter.h>
 #include <dash/algorithm/LocalRange.h>
 #include <dash/algorithm/Operation.h>
+#include <dash/algorithm/internal/ParallelFor.h>
 #include <dash/dart/if/dart_communication.h>
 
+#include <algorithm>
+
 namespace dash {
 
 /**
@@ -39,6 +43,54 @@ void generate (
     std::generate(lfirst, llast, g);
 }
 
+/**
+ *  Assigns each element in range [first, last) a value generated by the
+ *  given function object g.
+ *
+ *  Being a collaborative operation, each unit will invoke the given
+ *  function on its local elements only.
+ *  Local elements are assigned by the threads specified in the execution
+ *  policy, the generator function may be invoked concurrently and in any
+ *  order.
+ *
+ * \tparam      ElementType  Type of the elements in the sequence
+ *                           invoke, deduced from parameter \c func
+ * \complexity  O(d) + O(nl/t), with \c d dimensions in the global
+ *              iterators' pattern, \c nl local elements within the global
+ *              range and \c t threads
+ *
+ * \see         DashExecutionPolicies
+ *
+ * \ingroup     DashAlgorithms
+ */
+template<
+    class    ExecutionPolicy,
+    typename ElementType,
+    class    PatternType,
+    class    Generator >
+dash::internal::enable_if_execution_policy<ExecutionPolicy>
+generate (
+    /// Execution policy of the local assignment
+    ExecutionPolicy                 && policy,
+    /// Iterator to the initial position in the sequence
+    GlobIter<ElementType, PatternType> first,
+    /// Iterator to the final position in the sequence
+    GlobIter<ElementType, PatternType> last,
+    /// Generator function
+    Generator                          g) {
+    typedef typename PatternType::index_type index_t;
+    /// Global iterators to local range:
+    auto    lrange = dash::local_range(first, last);
+    auto    lfirst = lrange.begin;
+    index_t nlocal = lrange.end - lrange.begin;
+
+    dash::internal::parallel_for(
+      policy, nlocal, sizeof(ElementType),
+      [&](int, index_t c_begin, index_t c_end) {
+        std::generate(lfirst + c_begin, lfirst + c_end, g);
+      });
+}
+
 } // namespace dash
 
 #endif // DASH__ALGORITHM__GENERATE_H__
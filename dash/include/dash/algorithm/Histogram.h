@@ -0,0 +1,274 @@
+#ifndef DASH__ALGORITHM__HISTOGRAM_H__
+#define DASH__ALGORITHM__HISTOGRAM_H__
+
+#include <dash/Types.h>
+#include <dash/Exception.h>
+#include <dash/ExecutionPolicy.h>
+#include <dash/iterator/GlobIter.h>
+#include <dash/internal/Logging.h>
+
+#include <dash/algorithm/LocalRange.h>
+#include <dash/algorithm/Scan.h>
+#include <dash/algorithm/internal/ParallelFor.h>
+
+#include <dash/dart/if/dart_communication.h>
+
+#include <algorithm>
+#include <array>
+#include <cstddef>
+#include <type_traits>
+#include <vector>
+
+
+namespace dash {
+
+namespace internal {
+
+/**
+ * Maximum number of bins of histograms combined in a single allreduce.
+ * Histograms with more bins are reduced and scattered to the units
+ * owning the bins, so every unit only receives its local bins.
+ */
+constexpr std::size_t histogram_allreduce_max_bins = 4096;
+
+/**
+ * Histogram of the \c l_size local values at \c l_first with \c nbins
+ * bins, counted in separate histograms by the threads specified in the
+ * execution policy which are then summed up bin-wise.
+ */
+template <
+  typename CountType,
+  class    ExecutionPolicy,
+  typename ValueType,
+  typename IndexType,
+  class    KeyFunction >
+std::vector<CountType> histogram_local(
+  ExecutionPolicy  && policy,
+  const ValueType   * l_first,
+  IndexType           l_size,
+  std::size_t         nbins,
+  KeyFunction         key_fn)
+{
+  int n_chunks = dash::internal::num_parallel_chunks(
+                   policy, l_size, sizeof(ValueType));
+  std::vector<std::vector<CountType>> chunk_hists(n_chunks);
+  dash::internal::parallel_for(
+    policy, l_size, sizeof(ValueType),
+    [&](int c, IndexType c_begin, IndexType c_end) {
+      // Allocated by the thread counting the chunk:
+      std::vector<CountType> & hist = chunk_hists[c];
+      hist.assign(nbins, CountType(0));
+      for (IndexType i = c_begin; i < c_end; ++i) {
+        // Negative keys are out of range after conversion:
+        std::size_t key = static_cast<std::size_t>(key_fn(l_first[i]));
+        if (key < nbins) {
+          ++hist[key];
+        }
+      }
+    });
+  std::vector<CountType> l_hist(std::move(chunk_hists[0]));
+  if (n_chunks > 1) {
+    dash::internal::parallel_for(
+      policy, nbins, sizeof(CountType),
+      [&](int, std::size_t b_begin, std::size_t b_end) {
+        for (int c = 1; c < n_chunks; ++c) {
+          const CountType * c_hist = chunk_hists[c].data();
+          for (std::size_t b = b_begin; b < b_end; ++b) {
+            l_hist[b] += c_hist[b];
+          }
+        }
+      });
+  }
+  return l_hist;
+}
+
+/**
+ * Key function of \c dash::histogram using values as bin indices.
+ */
+struct histogram_identity_key {
+  template <typename ValueType>
+  const ValueType & operator()(const ValueType & value) const
+  {
+    return value;
+  }
+};
+
+} // namespace internal
+
+/**
+ * Counts the values in range \c [first, last) in bins of the
+ * one-dimensional array \c bins: bin \c b is set to the number of values
+ * \c v with <tt>key_fn(v) == b</tt>. Values with keys outside of
+ * <tt>[0, bins.size())</tt> are not counted.
+ *
+ * Collective operation. Every unit counts its local values in separate
+ * histograms for all threads specified in the execution policy and sums
+ * them up, so values are never counted in global memory. Local
+ * histograms of all units are then combined in a single collective
+ * operation:
+ *
+ * - Histograms with at most \c 4096 bins, or with bins not distributed
+ *   in blocks ordered by unit, are combined in an allreduce.
+ * - Larger histograms with blocked distribution are reduced and
+ *   scattered, so every unit only receives the sums of its local bins.
+ *
+ * Units are synchronized before returning.
+ *
+ * Example:
+ *
+ * \code
+ *   dash::Array<double> values(n);
+ *   dash::Array<long>   bins(100);
+ *   // Histogram of values in [0, 1):
+ *   dash::histogram(dash::execution::par_unseq,
+ *                   values.begin(), values.end(), bins,
+ *                   [](double v) { return static_cast<long>(v * 100); });
+ * \endcode
+ *
+ * \see      DashExecutionPolicies
+ *
+ * \ingroup  DashAlgorithms
+ */
+template <
+  class ExecutionPolicy,
+  class GlobInputIt,
+  class BinArrayType,
+  class KeyFunction >
+dash::internal::enable_if_execution_policy<ExecutionPolicy>
+histogram(
+  ExecutionPolicy  && policy,
+  GlobInputIt         first,
+  GlobInputIt         last,
+  BinArrayType      & bins,
+  KeyFunction         key_fn)
+{
+  typedef typename BinArrayType::value_type   count_t;
+  typedef typename BinArrayType::index_type   index_t;
+  typedef typename BinArrayType::pattern_type pattern_t;
+  typedef typename GlobInputIt::index_type    in_index_t;
+
+  static_assert(pattern_t::ndim() == 1,
+                "dash::histogram expects bins with one-dimensional "
+                "distribution");
+  static_assert(dash::dart_datatype<count_t>::value != DART_TYPE_UNDEFINED,
+                "dash::histogram expects bins of a basic numeric type");
+
+  auto & team = bins.team();
+  DASH_ASSERT_MSG(team == first.team(),
+                  "dash::histogram: "
+                  "Different teams in input range and bins");
+  std::size_t  nbins   = bins.size();
+  const auto & pattern = bins.pattern();
+  if (nbins == 0) {
+    team.barrier();
+    return;
+  }
+
+  auto       index_range = dash::local_range(first, last);
+  in_index_t l_size      = index_range.end - index_range.begin;
+  auto       l_hist      = dash::internal::histogram_local<count_t>(
+                             policy, index_range.begin, l_size, nbins,
+                             key_fn);
+
+  bool units_ordered = dash::internal::scan_units_ordered(
+                         pattern, std::true_type());
+  dart_datatype_t dtype = dash::dart_datatype<count_t>::value;
+  DASH_LOG_TRACE("dash::histogram", "local values:", l_size,
+                 "bins:", nbins, "blocked:", units_ordered);
+
+  if (units_ordered &&
+      nbins > dash::internal::histogram_allreduce_max_bins) {
+    std::vector<std::size_t> nrecv(team.size());
+    for (dash::team_unit_t u{0}; u < team.size(); u++) {
+      nrecv[u] = pattern.local_size(u);
+    }
+    DASH_ASSERT_RETURNS(
+      dart_reduce_scatter(l_hist.data(), bins.lbegin(), nrecv.data(),
+                          dtype, DART_OP_SUM, team.dart_id()),
+      DART_OK);
+  } else {
+    std::vector<count_t> g_hist(nbins);
+    DASH_ASSERT_RETURNS(
+      dart_allreduce(l_hist.data(), g_hist.data(), nbins,
+                     dtype, DART_OP_SUM, team.dart_id()),
+      DART_OK);
+    index_t   l_bins = bins.lsize();
+    count_t * l_bin  = bins.lbegin();
+    for (index_t l = 0; l < l_bins; ++l) {
+      l_bin[l] = g_hist[pattern.global_index(
+                          team.myid(), std::array<index_t, 1> {{ l }})];
+    }
+  }
+  team.barrier();
+}
+
+/**
+ * Counts the values in range \c [first, last) in bins of the
+ * one-dimensional array \c bins, using values as bin indices.
+ *
+ * Collective operation.
+ *
+ * \see      DashExecutionPolicies
+ *
+ * \ingroup  DashAlgorithms
+ */
+template <
+  class ExecutionPolicy,
+  class GlobInputIt,
+  class BinArrayType >
+dash::internal::enable_if_execution_policy<ExecutionPolicy>
+histogram(
+  ExecutionPolicy  && policy,
+  GlobInputIt         first,
+  GlobInputIt         last,
+  BinArrayType      & bins)
+{
+  dash::histogram(policy, first, last, bins,
+                  dash::internal::histogram_identity_key());
+}
+
+/**
+ * Counts the values in range \c [first, last) in bins of the
+ * one-dimensional array \c bins: bin \c b is set to the number of values
+ * \c v with <tt>key_fn(v) == b</tt>.
+ *
+ * Collective operation.
+ *
+ * \ingroup  DashAlgorithms
+ */
+template <
+  class GlobInputIt,
+  class BinArrayType,
+  class KeyFunction >
+void histogram(
+  GlobInputIt         first,
+  GlobInputIt         last,
+  BinArrayType      & bins,
+  KeyFunction         key_fn)
+{
+  dash::histogram(dash::execution::seq, first, last, bins, key_fn);
+}
+
+/**
+ * Counts the values in range \c [first, last) in bins of the
+ * one-dimensional array \c bins, using values as bin indices.
+ *
+ * Collective operation.
+ *
+ * \ingroup  DashAlgorithms
+ */
+template <
+  class GlobInputIt,
+  class BinArrayType >
+void histogram(
+  GlobInputIt         first,
+  GlobInputIt         last,
+  BinArrayType      & bins)
+{
+  dash::histogram(dash::execution::seq, first, last, bins,
+                  dash::internal::histogram_identity_key());
+}
+
+} // namespace dash
+
+#endif // DASH__ALGORITHM__HISTOGRAM_H__
@@ -39,6 +39,35 @@ struct LocalIndexRange {
   IndexType end;
 };
 
+namespace internal {
+
+/**
+ * Local index of the first element at the calling unit with global index
+ * not less than \c g_index in a one-dimensional pattern, or the local
+ * size if there is no such element.
+ */
+template <class PatternType>
+typename PatternType::index_type local_index_lower_bound(
+  const PatternType                & pattern,
+  typename PatternType::index_type   g_index)
+{
+  typedef typename PatternType::index_type idx_t;
+  idx_t l_first = 0;
+  idx_t l_count = static_cast<idx_t>(pattern.local_size());
+  while (l_count > 0) {
+    idx_t l_step = l_count / 2;
+    if (pattern.global(l_first + l_step) < g_index) {
+      l_first += l_step + 1;
+      l_count -= l_step + 1;
+    } else {
+      l_count  = l_step;
+    }
+  }
+  return l_first;
+}
+
+} // namespace internal
+
 #if 0
 template<class GlobInputIter>
 typename std::enable_if<
@@ -89,7 +118,9 @@ local_index_range(
  * \tparam      PatternType  Type of the global iterators' pattern
  *                           implementation
  * \complexity  O(d), with \c d dimensions in the global iterators'
- *              pattern
+ *              pattern, O(log(l)) with \c l local elements if local
+ *              elements of a one-dimensional pattern are interleaved
+ *              with elements of other units
  *
  * \ingroup     DashAlgorithms
  */
@@ -114,7 +145,7 @@ local_index_range(
   DASH_LOG_TRACE("local_index_range(GlobIt,GlobIt)",
                  begin_gindex, end_gindex);
   // Get pattern from global iterators, O(1):
-  auto pattern        = first.pattern();
+  const auto & pattern = first.pattern();
   DASH_LOG_TRACE_VAR("local_index_range", pattern.local_size());
   if (pattern.local_size() == 0) {
     // Local index range is empty
@@ -133,6 +164,20 @@ local_index_range(
     DASH_LOG_TRACE("local_index_range (intersect:0) >", 0, 0);
     return LocalIndexRange<idx_t> { 0, 0 };
   }
+  if (pattern_t::ndim() == 1 &&
+      lend_gindex - lbegin_gindex != static_cast<idx_t>(
+                                       pattern.local_size())) {
+    // Local elements are interleaved with elements of other units, like
+    // in cyclic distributions. As local elements are ordered by their
+    // global index, resolve range bounds by binary search, O(log n):
+    idx_t lbegin_index = dash::internal::local_index_lower_bound(
+                           pattern, begin_gindex);
+    idx_t lend_index   = dash::internal::local_index_lower_bound(
+                           pattern, end_gindex);
+    DASH_LOG_TRACE("local_index_range (interleaved) >",
+                   lbegin_index, lend_index);
+    return LocalIndexRange<idx_t> { lbegin_index, lend_index };
+  }
   // Intersect local range and global range, in global index domain:
   auto goffset_lbegin = std::max<idx_t>(lbegin_gindex, begin_gindex);
   auto goffset_lend   = std::min<idx_t>(lend_gindex, end_gindex);
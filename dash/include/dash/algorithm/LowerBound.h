@@ -0,0 +1,171 @@
+#ifndef DASH__ALGORITHM__LOWER_BOUND_H__
+#define DASH__ALGORITHM__LOWER_BOUND_H__
+
+#include <dash/iterator/GlobIter.h>
+
+#include <dash/algorithm/LocalRange.h>
+#include <dash/algorithm/internal/SortedRanges.h>
+
+#include <dash/dart/if/dart_communication.h>
+
+#include <algorithm>
+#include <functional>
+
+
+namespace dash {
+
+namespace internal {
+
+/**
+ * Position of the first element in the sorted range \c [first, last)
+ * found by \c local_bound in the local elements of the calling unit,
+ * reduced to the earliest position at all units.
+ */
+template <
+  class GlobIterType,
+  class LocalBoundFunc >
+GlobIterType sorted_bound(
+  GlobIterType   first,
+  GlobIterType   last,
+  LocalBoundFunc local_bound)
+{
+  typedef typename GlobIterType::index_type index_t;
+
+  auto & team      = first.team();
+  auto & pattern   = first.pattern();
+  auto   l_range   = dash::internal::sorted_local_range(first, last);
+  auto   l_idx     = dash::local_index_range(first, last);
+  auto   l_pos     = local_bound(l_range.begin, l_range.end);
+  // Global index of the local bound, the end of the range if no local
+  // element satisfies the bound:
+  index_t l_bound  = last.pos();
+  if (l_pos != l_range.end) {
+    l_bound = pattern.global(
+                static_cast<index_t>(l_idx.begin + (l_pos - l_range.begin)));
+  }
+  index_t g_bound  = l_bound;
+  DASH_ASSERT_RETURNS(
+    dart_allreduce(
+      &l_bound,
+      &g_bound,
+      1,
+      dash::dart_datatype<index_t>::value,
+      DART_OP_MIN,
+      team.dart_id()),
+    DART_OK);
+  DASH_LOG_TRACE("dash::internal::sorted_bound",
+                 "local bound:", l_bound, "global bound:", g_bound);
+  return first + (g_bound - first.pos());
+}
+
+} // namespace internal
+
+/**
+ * Returns an iterator to the first element in the range \c [first, last)
+ * that is not less than \c value w.r.t. \c comp, or \c last if no such
+ * element is found.
+ *
+ * The range must be sorted w.r.t. \c comp and have a one-dimensional
+ * distribution. Every unit searches its local elements by binary search,
+ * positions are combined in a single reduction.
+ *
+ * Collective operation, the result is returned at all units.
+ *
+ * \complexity  O(log(l)), with l local elements per unit, and a single
+ *              reduction.
+ *
+ * \ingroup  DashAlgorithms
+ */
+template <
+  class GlobIterType,
+  class ValueType,
+  class Compare >
+GlobIterType lower_bound(
+  GlobIterType       first,
+  GlobIterType       last,
+  const ValueType  & value,
+  Compare            comp)
+{
+  typedef typename GlobIterType::value_type element_t;
+  return dash::internal::sorted_bound(
+           first, last,
+           [&](const element_t * l_first, const element_t * l_last) {
+             return std::lower_bound(l_first, l_last, value, comp);
+           });
+}
+
+/**
+ * Returns an iterator to the first element in the sorted range
+ * \c [first, last) that is not less than \c value.
+ *
+ * Collective operation.
+ *
+ * \ingroup  DashAlgorithms
+ */
+template <
+  class GlobIterType,
+  class ValueType >
+GlobIterType lower_bound(
+  GlobIterType       first,
+  GlobIterType       last,
+  const ValueType  & value)
+{
+  return dash::lower_bound(
+           first, last, value,
+           std::less<typename GlobIterType::value_type>());
+}
+
+/**
+ * Returns an iterator to the first element in the range \c [first, last)
+ * that is greater than \c value w.r.t. \c comp, or \c last if no such
+ * element is found.
+ *
+ * The range must be sorted w.r.t. \c comp and have a one-dimensional
+ * distribution.
+ *
+ * Collective operation, the result is returned at all units.
+ *
+ * \ingroup  DashAlgorithms
+ */
+template <
+  class GlobIterType,
+  class ValueType,
+  class Compare >
+GlobIterType upper_bound(
+  GlobIterType       first,
+  GlobIterType       last,
+  const ValueType  & value,
+  Compare            comp)
+{
+  typedef typename GlobIterType::value_type element_t;
+  return dash::internal::sorted_bound(
+           first, last,
+           [&](const element_t * l_first, const element_t * l_last) {
+             return std::upper_bound(l_first, l_last, value, comp);
+           });
+}
+
+/**
+ * Returns an iterator to the first element in the sorted range
+ * \c [first, last) that is greater than \c value.
+ *
+ * Collective operation.
+ *
+ * \ingroup  DashAlgorithms
+ */
+template <
+  class GlobIterType,
+  class ValueType >
+GlobIterType upper_bound(
+  GlobIterType       first,
+  GlobIterType       last,
+  const ValueType  & value)
+{
+  return dash::upper_bound(
+           first, last, value,
+           std::less<typename GlobIterType::value_type>());
+}
+
+} // namespace dash
+
+#endif // DASH__ALGORITHM__LOWER_BOUND_H__
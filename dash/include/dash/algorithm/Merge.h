@@ -0,0 +1,93 @@
+#ifndef DASH__ALGORITHM__MERGE_H__
+#define DASH__ALGORITHM__MERGE_H__
+
+#include <dash/iterator/GlobIter.h>
+
+#include <dash/algorithm/internal/SortedRanges.h>
+
+#include <algorithm>
+#include <functional>
+
+
+namespace dash {
+
+/**
+ * Merges the sorted ranges \c [first1, last1) and \c [first2, last2)
+ * into one sorted range beginning at \c d_first.
+ *
+ * Values are partitioned into key ranges by splitters sampled from both
+ * ranges and exchanged in bulk, so every unit merges only the values in
+ * its assigned key range. Results are written to the output range in
+ * contiguous segments.
+ *
+ * Like \c std::merge, equivalent elements of the first range precede
+ * those of the second range. Equivalent elements of the same range keep
+ * their relative order if local elements of a unit precede those of
+ * units with higher ids, like in \c dash::BLOCKED distribution.
+ *
+ * Precondition: Input ranges are sorted w.r.t. \c comp and have
+ * one-dimensional distribution, the output range does not overlap the
+ * input ranges.
+ *
+ * Collective operation.
+ *
+ * \returns  Iterator past the last element written.
+ *
+ * \complexity  O(n/p log(p)) with n elements in both ranges, a sample
+ *              allgather and two all-to-all exchanges.
+ *
+ * \ingroup  DashAlgorithms
+ */
+template <
+  class GlobInputIt1,
+  class GlobInputIt2,
+  class GlobOutputIt,
+  class Compare >
+GlobOutputIt merge(
+  GlobInputIt1   first1,
+  GlobInputIt1   last1,
+  GlobInputIt2   first2,
+  GlobInputIt2   last2,
+  GlobOutputIt   d_first,
+  Compare        comp)
+{
+  typedef typename GlobInputIt1::value_type value_t;
+  typedef typename std::vector<value_t>::iterator l_iter_t;
+  typedef std::back_insert_iterator<std::vector<value_t>> l_out_t;
+
+  DASH_LOG_DEBUG("dash::merge()");
+  return dash::internal::sorted_combine(
+           first1, last1, first2, last2, d_first, comp,
+           [&](l_iter_t a_first, l_iter_t a_last,
+               l_iter_t b_first, l_iter_t b_last,
+               l_out_t  out) {
+             std::merge(a_first, a_last, b_first, b_last, out, comp);
+           });
+}
+
+/**
+ * Merges the sorted ranges \c [first1, last1) and \c [first2, last2)
+ * into one sorted range beginning at \c d_first.
+ *
+ * Collective operation.
+ *
+ * \ingroup  DashAlgorithms
+ */
+template <
+  class GlobInputIt1,
+  class GlobInputIt2,
+  class GlobOutputIt >
+GlobOutputIt merge(
+  GlobInputIt1   first1,
+  GlobInputIt1   last1,
+  GlobInputIt2   first2,
+  GlobInputIt2   last2,
+  GlobOutputIt   d_first)
+{
+  return dash::merge(first1, last1, first2, last2, d_first,
+                     std::less<typename GlobInputIt1::value_type>());
+}
+
+} // namespace dash
+
+#endif // DASH__ALGORITHM__MERGE_H__
@@ -4,8 +4,12 @@
 #include <dash/internal/Config.h>
 
 #include <dash/Allocator.h>
+#include <dash/ExecutionPolicy.h>
 
 #include <dash/algorithm/LocalRange.h>
+#include <dash/algorithm/Operation.h>
+#include <dash/algorithm/internal/MinMaxKernel.h>
+#include <dash/algorithm/internal/ParallelFor.h>
 
 #include <dash/util/Config.h>
 #include <dash/util/Trace.h>
@@ -14,12 +18,14 @@
 #include <dash/iterator/GlobIter.h>
 #include <dash/internal/Logging.h>
 
+#include <dash/dart/if/dart_communication.h>
+
 #include <algorithm>
+#include <functional>
 #include <memory>
-
-#ifdef DASH_ENABLE_OPENMP
-#include <omp.h>
-#endif
+#include <type_traits>
+#include <utility>
+#include <vector>
 
 
 namespace dash {
@@ -27,138 +33,148 @@ namespace dash {
 /**
  * Finds an iterator pointing to the element with the smallest value in
  * the range [first,last).
- * Specialization for local range, delegates to std::min_element.
+ * Specialization for local range, chunks of the range are searched by
+ * the threads specified in the execution policy.
  *
  * \return      An iterator to the first occurrence of the smallest value
  *              in the range, or \c last if the range is empty.
  *
  * \tparam      ElementType  Type of the elements in the sequence
- * \complexity  O(d) + O(nl), with \c d dimensions in the global iterators'
- *              pattern and \c nl local elements within the global range
+ * \tparam      Compare      Binary predicate type, arithmetic elements
+ *                           compared by \c std::less or \c std::greater
+ *                           are searched by vectorized kernels
+ * \complexity  O(nl/t), with \c nl elements in the local range and \c t
+ *              threads
+ *
+ * \see         DashExecutionPolicies
  *
  * \ingroup     DashAlgorithms
  */
-template<typename ElementType>
-const ElementType * min_element(
+template<
+  class    ExecutionPolicy,
+  typename ElementType,
+  class    Compare = std::less<const ElementType &> >
+dash::internal::enable_if_execution_policy<
+  ExecutionPolicy, const ElementType *>
+min_element(
+  /// Execution policy of the local search
+  ExecutionPolicy    && policy,
   /// Iterator to the initial position in the sequence
-  const ElementType * l_range_begin,
+  const ElementType   * l_range_begin,
   /// Iterator to the final position in the sequence
-  const ElementType * l_range_end,
+  const ElementType   * l_range_end,
   /// Element comparison function, defaults to std::less
-  const std::function<
-          bool(const ElementType &, const ElementType)
-        > & compare
-        = std::less<const ElementType &>())
+  Compare               compare = Compare())
 {
-#ifdef DASH_ENABLE_OPENMP
-  dash::util::UnitLocality uloc;
-  auto n_threads = uloc.num_domain_threads();
-  DASH_LOG_DEBUG("dash::min_element", "thread capacity:",  n_threads);
-
-  // TODO: Should also restrict on elements/units > ~10240.
-  //       Find a model for the minimum work laod.
-  if (n_threads > 1) {
-    auto          l_size     = l_range_end - l_range_begin;
-    int           min_idx_l  = 0;
-    ElementType   min_val_l  = *l_range_begin;
-
-    typedef struct min_pos_t { ElementType val; size_t idx; } min_pos;
-
-    DASH_LOG_DEBUG("dash::min_element", "local range size:", l_size);
-    int       align_bytes      = uloc.cache_line_size(0);
-    size_t    min_vals_t_size  = n_threads + 1 +
-                                 (align_bytes / sizeof(min_pos));
-    size_t    min_vals_t_bytes = min_vals_t_size * sizeof(min_pos);
-    min_pos * min_vals_t_raw   = new min_pos[min_vals_t_size];
-    void    * min_vals_t_alg   = min_vals_t_raw;
-    min_pos * min_vals_t       = static_cast<min_pos *>(
-                                   dash::align(
-                                     align_bytes,
-                                     sizeof(min_pos),
-                                     min_vals_t_alg,
-                                     min_vals_t_bytes));
-    DASH_LOG_TRACE("dash::min_element", "min * alloc:",   min_vals_t_raw);
-    DASH_LOG_TRACE("dash::min_element", "min * aligned:", min_vals_t);
-    DASH_LOG_TRACE("dash::min_element", "min * size:",    min_vals_t_bytes);
-    DASH_ASSERT_GE(min_vals_t_bytes, n_threads * sizeof(min_pos),
-                   "Aligned buffer of min_pos has insufficient size");
-    DASH_ASSERT_MSG(nullptr != min_vals_t,
-                    "Aligned allocation of min_pos returned nullptr");
-
-    // Cannot use user-defined reduction (OpenMP 4.0) as the compare
-    // predicate cannot be used in `omp declare reduction`.
-    // Avoid omp for + omp critical section by using array of
-    // thread-local minimum values, aligned to prevent false sharing:
-    int t_id;
-    #pragma omp parallel num_threads(n_threads) private(t_id)
-    {
-      // Documentation of Intel MIC intrinsics, see:
-      // https://software.intel.com/de-de/node/523533
-      // https://software.intel.com/de-de/node/523387
-      t_id = omp_get_thread_num();
-      DASH_LOG_TRACE("dash::min_element", "starting thread", t_id);
-      min_vals_t[t_id].idx = min_idx_l;
-      min_vals_t[t_id].val = min_val_l;
-      // Cannot use explicit private(min_val_t) as ElementType might
-      // not be default-constructible:
-      #pragma omp for schedule(static)
-//    #pragma ivdep
-//    #pragma vector aligned nontemporal
-      for (int i = 0; i < l_size; i++) {
-        const ElementType & val_t = *(l_range_begin + i);
-        if (compare(val_t, min_vals_t[t_id].val)) {
-          min_vals_t[t_id].val = val_t;
-          min_vals_t[t_id].idx = i;
-        }
-      }
-      DASH_LOG_TRACE("dash::min_element", "local minimum at thread", t_id,
-                     "idx:", min_vals_t[t_id].idx,
-                     "val:", min_vals_t[t_id].val);
-    }
-    min_pos min_pos_l = min_vals_t[0];
-    for (int t = 1; t < n_threads; t++) {
-      const min_pos & mpt = min_vals_t[t];
-      if (compare(mpt.val, min_pos_l.val)) {
-        min_pos_l = mpt;
+  typedef std::ptrdiff_t index_t;
+
+  index_t l_size   = l_range_end - l_range_begin;
+  int     n_chunks = dash::internal::num_parallel_chunks(
+                       policy, l_size, sizeof(ElementType));
+  DASH_LOG_DEBUG("dash::min_element", "local range size:", l_size,
+                 "chunks:", n_chunks);
+  if (n_chunks < 2) {
+    return dash::internal::min_element_local(
+             l_range_begin, l_range_end, compare);
+  }
+  // Minimum of every chunk, written once per chunk to prevent false
+  // sharing:
+  std::vector<const ElementType *> chunk_min(n_chunks, l_range_end);
+  dash::internal::parallel_for(
+    policy, l_size, sizeof(ElementType),
+    [&](int c, index_t c_begin, index_t c_end) {
+      if (c_begin < c_end) {
+        chunk_min[c] = dash::internal::min_element_local(
+                         l_range_begin + c_begin,
+                         l_range_begin + c_end,
+                         compare);
       }
+    });
+  // Chunks are ordered, keep the first occurrence of the minimum:
+  const ElementType * lmin = l_range_end;
+  for (auto cmin : chunk_min) {
+    if (cmin != l_range_end &&
+        (lmin == l_range_end || compare(*cmin, *lmin))) {
+      lmin = cmin;
     }
-    delete[] min_vals_t_raw;
-    return (l_range_begin + min_pos_l.idx);
   }
-#endif // DASH_ENABLE_OPENMP
-  return ::std::min_element(l_range_begin, l_range_end, compare);
+  return lmin;
+}
+
+/**
+ * Finds an iterator pointing to the element with the smallest value in
+ * the range [first,last).
+ * Specialization for local range.
+ *
+ * \return      An iterator to the first occurrence of the smallest value
+ *              in the range, or \c last if the range is empty.
+ *
+ * \tparam      ElementType  Type of the elements in the sequence
+ * \tparam      Compare      Binary predicate type, arithmetic elements
+ *                           compared by \c std::less or \c std::greater
+ *                           are searched by vectorized kernels
+ * \complexity  O(nl), with \c nl elements in the local range
+ *
+ * \ingroup     DashAlgorithms
+ */
+template<
+  typename ElementType,
+  class    Compare = std::less<const ElementType &> >
+const ElementType * min_element(
+  /// Iterator to the initial position in the sequence
+  const ElementType * l_range_begin,
+  /// Iterator to the final position in the sequence
+  const ElementType * l_range_end,
+  /// Element comparison function, defaults to std::less
+  Compare             compare = Compare())
+{
+  return dash::internal::min_element_local(
+           l_range_begin, l_range_end, compare);
 }
 
 /**
  * Finds an iterator pointing to the element with the smallest value in
  * the range [first,last).
  *
+ * Collective operation, local minima are combined in a single
+ * reduction.
+ *
  * \return      An iterator to the first occurrence of the smallest value
  *              in the range, or \c last if the range is empty.
  *
  * \tparam      ElementType  Type of the elements in the sequence
+ * \tparam      Compare      Binary predicate type, arithmetic elements
+ *                           compared by \c std::less or \c std::greater
+ *                           are searched by vectorized kernels
  * \complexity  O(d) + O(nl), with \c d dimensions in the global iterators'
  *              pattern and \c nl local elements within the global range
  *
  * \ingroup     DashAlgorithms
  */
 template<
+  class    ExecutionPolicy,
   typename ElementType,
-  class    PatternType>
-GlobIter<ElementType, PatternType> min_element(
+  class    PatternType,
+  class    Compare = std::less<const ElementType &> >
+dash::internal::enable_if_execution_policy<
+  ExecutionPolicy, GlobIter<ElementType, PatternType> >
+min_element(
+  /// Execution policy of the local search
+  ExecutionPolicy                         && policy,
   /// Iterator to the initial position in the sequence
   const GlobIter<ElementType, PatternType> & first,
   /// Iterator to the final position in the sequence
   const GlobIter<ElementType, PatternType> & last,
   /// Element comparison function, defaults to std::less
-  const std::function<
-          bool(const ElementType &, const ElementType)
-        > & compare
-        = std::less<const ElementType &>())
+  Compare                                    compare = Compare())
 {
   typedef dash::GlobIter<ElementType, PatternType> globiter_t;
   typedef PatternType                               pattern_t;
   typedef typename pattern_t::index_type              index_t;
+  typedef typename std::remove_const<ElementType>::type value_t;
+  typedef dash::internal::ValueIndex<value_t, index_t>  value_index_t;
+  typedef dash::internal::ValueIndexMinOperation<
+            value_t, index_t, Compare>                  min_op_t;
 
   // return last for empty array
   if (first == last) {
@@ -171,17 +187,15 @@ GlobIter<ElementType, PatternType> min_element(
 
   auto & pattern = first.pattern();
   auto & team    = pattern.team();
-  DASH_LOG_DEBUG("dash::min_element()",
-                 "allocate minarr, size", team.size());
   // Global position of end element in range:
   auto    gi_last            = last.gpos();
   // Find the local min. element in parallel
   // Get local address range between global iterators:
   auto    local_idx_range    = dash::local_index_range(first, last);
-  // Pointer to local minimum element:
-  const   ElementType * lmin = nullptr;
-  // Local offset of local minimum element, or -1 if no element found:
-  index_t l_idx_lmin         = -1;
+  // Local minimum, global index -1 if no element found:
+  value_index_t local_min;
+  local_min.value   = value_t();
+  local_min.g_index = -1;
   if (local_idx_range.begin == local_idx_range.end) {
     // local range is empty
     DASH_LOG_DEBUG("dash::min_element", "local range empty");
@@ -195,93 +209,43 @@ GlobIter<ElementType, PatternType> min_element(
     const ElementType * l_range_begin = lbegin + local_idx_range.begin;
     const ElementType * l_range_end   = lbegin + local_idx_range.end;
 
-    lmin = dash::min_element(l_range_begin, l_range_end, compare);
-
+    const ElementType * lmin = dash::min_element(
+                                 policy, l_range_begin, l_range_end,
+                                 compare);
     if (lmin != l_range_end) {
       DASH_LOG_TRACE_VAR("dash::min_element", *lmin);
-      // Offset of local minimum in local memory:
-      l_idx_lmin = lmin - lbegin;
+      local_min.value   = *lmin;
+      local_min.g_index = pattern.global(
+                            static_cast<index_t>(lmin - lbegin));
     }
 
     trace.exit_state("local");
   }
-  DASH_LOG_TRACE("dash::min_element",
-                 "local index of local minimum:", l_idx_lmin);
-  DASH_LOG_TRACE("dash::min_element",
-                 "waiting for local min of other units");
-
-  trace.enter_state("barrier");
-  team.barrier();
-  trace.exit_state("barrier");
-
-  typedef struct {
-    ElementType value;
-    index_t     g_index;
-  } local_min_t;
-
-  std::vector<local_min_t> local_min_values(team.size());
-
-  // Set global index of local minimum to -1 if no local minimum has been
-  // found:
-  local_min_t local_min;
-  local_min.value   = l_idx_lmin < 0
-                      ? ElementType()
-                      : *lmin;
-  local_min.g_index = l_idx_lmin < 0
-                      ? -1
-                      : pattern.global(l_idx_lmin);
-
-  DASH_LOG_TRACE("dash::min_element", "sending local minimum: {",
+  DASH_LOG_TRACE("dash::min_element", "local minimum: {",
                  "value:",   local_min.value,
                  "g.index:", local_min.g_index, "}");
 
-  DASH_LOG_TRACE("dash::min_element", "dart_allgather()");
-  trace.enter_state("allgather");
+  // Combine local minima in a single reduction equivalent to MINLOC:
+  trace.enter_state("allreduce");
+  value_index_t global_min;
+  dash::DartReduceOperation<value_index_t, min_op_t> dart_op(
+    min_op_t { compare }, true);
   DASH_ASSERT_RETURNS(
-    dart_allgather(
+    dart_allreduce(
       &local_min,
-      local_min_values.data(),
-      sizeof(local_min_t),
-      DART_TYPE_BYTE,
+      &global_min,
+      1,
+      dart_op.dart_type(),
+      dart_op.dart_operation(),
       team.dart_id()),
     DART_OK);
-  trace.exit_state("allgather");
-
-#ifdef DASH_ENABLE_LOGGING
-  for (int lmin_u = 0; lmin_u < local_min_values.size(); lmin_u++) {
-    auto lmin_entry = local_min_values[lmin_u];
-    DASH_LOG_TRACE("dash::min_element", "dart_allgather >",
-                   "unit:",    lmin_u,
-                   "value:",   lmin_entry.value,
-                   "g_index:", lmin_entry.g_index);
-  }
-#endif
-
-  auto gmin_elem_it  = ::std::min_element(
-                           local_min_values.begin(),
-                           local_min_values.end(),
-                           [&](const local_min_t & a,
-                               const local_min_t & b) {
-                             // Ignore elements with global index -1 (no
-                             // element found):
-                             return (b.g_index < 0 ||
-                                     (a.g_index > 0 &&
-                                      compare(a.value, b.value)));
-                           });
-
-  if (gmin_elem_it == local_min_values.end()) {
-    DASH_LOG_DEBUG_VAR("dash::min_element >", last);
-    return last;
-  }
-
-  auto gi_minimum    = gmin_elem_it->g_index;
+  trace.exit_state("allreduce");
 
+  auto gi_minimum = global_min.g_index;
   DASH_LOG_TRACE("dash::min_element",
-                 "min. value:", gmin_elem_it->value,
-                 "at unit:",    (gmin_elem_it - local_min_values.begin()),
+                 "min. value:", global_min.value,
                  "global idx:", gi_minimum);
 
-  DASH_LOG_TRACE_VAR("dash::min_element", gi_minimum);
   if (gi_minimum < 0 || gi_minimum == gi_last) {
     DASH_LOG_DEBUG_VAR("dash::min_element >", last);
     return last;
@@ -291,11 +255,42 @@ GlobIter<ElementType, PatternType> min_element(
   // offset of minimum element:
   globiter_t minimum = (first - first.gpos()) + gi_minimum;
   DASH_LOG_DEBUG("dash::min_element >", minimum,
-                 "=", static_cast<ElementType>(*minimum));
+                 "=", global_min.value);
 
   return minimum;
 }
 
+/**
+ * Finds an iterator pointing to the element with the smallest value in
+ * the range [first,last).
+ *
+ * Collective operation, local minima are combined in a single
+ * reduction.
+ *
+ * \return      An iterator to the first occurrence of the smallest value
+ *              in the range, or \c last if the range is empty.
+ *
+ * \tparam      ElementType  Type of the elements in the sequence
+ * \complexity  O(d) + O(nl), with \c d dimensions in the global iterators'
+ *              pattern and \c nl local elements within the global range
+ *
+ * \ingroup     DashAlgorithms
+ */
+template<
+  typename ElementType,
+  class    PatternType,
+  class    Compare = std::less<const ElementType &> >
+GlobIter<ElementType, PatternType> min_element(
+  /// Iterator to the initial position in the sequence
+  const GlobIter<ElementType, PatternType> & first,
+  /// Iterator to the final position in the sequence
+  const GlobIter<ElementType, PatternType> & last,
+  /// Element comparison function, defaults to std::less
+  Compare                                    compare = Compare())
+{
+  return dash::min_element(dash::seq, first, last, compare);
+}
+
 /**
  * Finds an iterator pointing to the element with the greatest value in
  * the range [first,last).
@@ -311,52 +306,333 @@ GlobIter<ElementType, PatternType> min_element(
  */
 template<
   typename ElementType,
-  class    PatternType>
+  class    PatternType,
+  class    Compare = std::greater<const ElementType &> >
 GlobIter<ElementType, PatternType> max_element(
   /// Iterator to the initial position in the sequence
   const GlobIter<ElementType, PatternType> & first,
   /// Iterator to the final position in the sequence
   const GlobIter<ElementType, PatternType> & last,
-  /// Element comparison function, defaults to std::less
-  const std::function<
-          bool(const ElementType &, const ElementType)
-        > & compare
-        = std::greater<const ElementType &>())
+  /// Element comparison function, defaults to std::greater
+  Compare                                    compare = Compare())
 {
   // Same as min_element with different compare function
   return dash::min_element(first, last, compare);
 }
 
+/**
+ * Finds an iterator pointing to the element with the greatest value in
+ * the range [first,last), local elements are searched by the threads
+ * specified in the execution policy.
+ *
+ * \return      An iterator to the first occurrence of the greatest value
+ *              in the range, or \c last if the range is empty.
+ *
+ * \see         DashExecutionPolicies
+ *
+ * \ingroup     DashAlgorithms
+ */
+template<
+  class    ExecutionPolicy,
+  typename ElementType,
+  class    PatternType,
+  class    Compare = std::greater<const ElementType &> >
+dash::internal::enable_if_execution_policy<
+  ExecutionPolicy, GlobIter<ElementType, PatternType> >
+max_element(
+  /// Execution policy of the local search
+  ExecutionPolicy                         && policy,
+  /// Iterator to the initial position in the sequence
+  const GlobIter<ElementType, PatternType> & first,
+  /// Iterator to the final position in the sequence
+  const GlobIter<ElementType, PatternType> & last,
+  /// Element comparison function, defaults to std::greater
+  Compare                                    compare = Compare())
+{
+  // Same as min_element with different compare function
+  return dash::min_element(policy, first, last, compare);
+}
+
 /**
  * Finds an iterator pointing to the element with the greatest value in
  * the range [first,last).
- * Specialization for local range, delegates to std::min_element.
+ * Specialization for local range.
  *
  * \return      An iterator to the first occurrence of the greatest value
  *              in the range, or \c last if the range is empty.
  *
  * \tparam      ElementType  Type of the elements in the sequence
- * \complexity  O(d) + O(nl), with \c d dimensions in the global iterators'
- *              pattern and \c nl local elements within the global range
+ * \complexity  O(nl), with \c nl elements in the local range
  *
  * \ingroup     DashAlgorithms
  */
-template< typename ElementType >
+template<
+  typename ElementType,
+  class    Compare = std::greater<const ElementType &> >
 const ElementType * max_element(
   /// Iterator to the initial position in the sequence
   const ElementType * first,
   /// Iterator to the final position in the sequence
   const ElementType * last,
-  /// Element comparison function, defaults to std::less
-  const std::function<
-          bool(const ElementType &, const ElementType)
-        > & compare
-        = std::greater<const ElementType &>())
+  /// Element comparison function, defaults to std::greater
+  Compare             compare = Compare())
 {
   // Same as min_element with different compare function
   return dash::min_element(first, last, compare);
 }
 
+/**
+ * Finds iterators pointing to the elements with the smallest and the
+ * greatest value in the range [first,last).
+ * Specialization for local range, chunks of the range are searched by
+ * the threads specified in the execution policy.
+ *
+ * \return      A pair of iterators to the first occurrence of the
+ *              smallest and the last occurrence of the greatest value in
+ *              the range like \c std::minmax_element, or a pair of
+ *              \c last if the range is empty.
+ *
+ * \see         DashExecutionPolicies
+ *
+ * \ingroup     DashAlgorithms
+ */
+template<
+  class    ExecutionPolicy,
+  typename ElementType,
+  class    Compare = std::less<const ElementType &> >
+dash::internal::enable_if_execution_policy<
+  ExecutionPolicy, std::pair<const ElementType *, const ElementType *> >
+minmax_element(
+  /// Execution policy of the local search
+  ExecutionPolicy    && policy,
+  /// Iterator to the initial position in the sequence
+  const ElementType   * l_range_begin,
+  /// Iterator to the final position in the sequence
+  const ElementType   * l_range_end,
+  /// Element comparison function, defaults to std::less
+  Compare               compare = Compare())
+{
+  typedef std::ptrdiff_t                                     index_t;
+  typedef std::pair<const ElementType *, const ElementType *> minmax_t;
+
+  index_t l_size   = l_range_end - l_range_begin;
+  int     n_chunks = dash::internal::num_parallel_chunks(
+                       policy, l_size, sizeof(ElementType));
+  if (n_chunks < 2) {
+    return dash::internal::minmax_element_local(
+             l_range_begin, l_range_end, compare);
+  }
+  std::vector<minmax_t> chunk_minmax(
+    n_chunks, minmax_t(l_range_end, l_range_end));
+  dash::internal::parallel_for(
+    policy, l_size, sizeof(ElementType),
+    [&](int c, index_t c_begin, index_t c_end) {
+      if (c_begin < c_end) {
+        chunk_minmax[c] = dash::internal::minmax_element_local(
+                            l_range_begin + c_begin,
+                            l_range_begin + c_end,
+                            compare);
+      }
+    });
+  // Chunks are ordered, keep the first occurrence of the minimum and the
+  // last occurrence of the maximum:
+  minmax_t lminmax(l_range_end, l_range_end);
+  for (const auto & cmm : chunk_minmax) {
+    if (cmm.first == l_range_end) {
+      continue;
+    }
+    if (lminmax.first == l_range_end ||
+        compare(*cmm.first, *lminmax.first)) {
+      lminmax.first  = cmm.first;
+    }
+    if (lminmax.second == l_range_end ||
+        !compare(*cmm.second, *lminmax.second)) {
+      lminmax.second = cmm.second;
+    }
+  }
+  return lminmax;
+}
+
+/**
+ * Finds iterators pointing to the elements with the smallest and the
+ * greatest value in the range [first,last).
+ * Specialization for local range.
+ *
+ * \return      A pair of iterators to the first occurrence of the
+ *              smallest and the last occurrence of the greatest value in
+ *              the range like \c std::minmax_element, or a pair of
+ *              \c last if the range is empty.
+ *
+ * \ingroup     DashAlgorithms
+ */
+template<
+  typename ElementType,
+  class    Compare = std::less<const ElementType &> >
+std::pair<const ElementType *, const ElementType *> minmax_element(
+  /// Iterator to the initial position in the sequence
+  const ElementType * l_range_begin,
+  /// Iterator to the final position in the sequence
+  const ElementType * l_range_end,
+  /// Element comparison function, defaults to std::less
+  Compare             compare = Compare())
+{
+  return dash::internal::minmax_element_local(
+           l_range_begin, l_range_end, compare);
+}
+
+/**
+ * Finds iterators pointing to the elements with the smallest and the
+ * greatest value in the range [first,last) in a single pass over local
+ * elements.
+ *
+ * Collective operation, local minima and maxima are combined in a single
+ * reduction.
+ *
+ * \return      A pair of iterators to the first occurrence of the
+ *              smallest and the last occurrence of the greatest value in
+ *              the range like \c std::minmax_element, or a pair of
+ *              \c last if the range is empty.
+ *
+ * \tparam      ElementType  Type of the elements in the sequence
+ * \tparam      Compare      Binary predicate type, arithmetic elements
+ *                           compared by \c std::less or \c std::greater
+ *                           are searched by vectorized kernels
+ * \complexity  O(d) + O(nl), with \c d dimensions in the global iterators'
+ *              pattern and \c nl local elements within the global range
+ *
+ * \ingroup     DashAlgorithms
+ */
+template<
+  class    ExecutionPolicy,
+  typename ElementType,
+  class    PatternType,
+  class    Compare = std::less<const ElementType &> >
+dash::internal::enable_if_execution_policy<
+  ExecutionPolicy,
+  std::pair<GlobIter<ElementType, PatternType>,
+            GlobIter<ElementType, PatternType> > >
+minmax_element(
+  /// Execution policy of the local search
+  ExecutionPolicy                         && policy,
+  /// Iterator to the initial position in the sequence
+  const GlobIter<ElementType, PatternType> & first,
+  /// Iterator to the final position in the sequence
+  const GlobIter<ElementType, PatternType> & last,
+  /// Element comparison function, defaults to std::less
+  Compare                                    compare = Compare())
+{
+  typedef dash::GlobIter<ElementType, PatternType> globiter_t;
+  typedef PatternType                               pattern_t;
+  typedef typename pattern_t::index_type              index_t;
+  typedef typename std::remove_const<ElementType>::type value_t;
+  typedef dash::internal::MinMaxIndex<value_t, index_t> minmax_index_t;
+  typedef dash::internal::MinMaxIndexOperation<
+            value_t, index_t, Compare>                  minmax_op_t;
+
+  if (first == last) {
+    DASH_LOG_DEBUG("dash::minmax_element >",
+                   "empty range, returning last", last);
+    return std::make_pair(last, last);
+  }
+
+  dash::util::Trace trace("minmax_element");
+
+  auto & pattern         = first.pattern();
+  auto & team            = pattern.team();
+  auto   gi_last         = last.gpos();
+  auto   local_idx_range = dash::local_index_range(first, last);
+  // Local bounds, global indices -1 if no element found:
+  minmax_index_t local_minmax;
+  local_minmax.min.value   = value_t();
+  local_minmax.min.g_index = -1;
+  local_minmax.max         = local_minmax.min;
+  if (local_idx_range.begin != local_idx_range.end) {
+    trace.enter_state("local");
+
+    const ElementType * lbegin        = first.globmem().lbegin(
+                                          dash::Team::GlobalUnitID());
+    const ElementType * l_range_begin = lbegin + local_idx_range.begin;
+    const ElementType * l_range_end   = lbegin + local_idx_range.end;
+
+    auto lminmax = dash::minmax_element(
+                     policy, l_range_begin, l_range_end, compare);
+    if (lminmax.first != l_range_end) {
+      local_minmax.min.value   = *lminmax.first;
+      local_minmax.min.g_index = pattern.global(
+                                   static_cast<index_t>(
+                                     lminmax.first - lbegin));
+      local_minmax.max.value   = *lminmax.second;
+      local_minmax.max.g_index = pattern.global(
+                                   static_cast<index_t>(
+                                     lminmax.second - lbegin));
+    }
+
+    trace.exit_state("local");
+  }
+
+  trace.enter_state("allreduce");
+  minmax_index_t global_minmax;
+  dash::DartReduceOperation<minmax_index_t, minmax_op_t> dart_op(
+    minmax_op_t { compare }, true);
+  DASH_ASSERT_RETURNS(
+    dart_allreduce(
+      &local_minmax,
+      &global_minmax,
+      1,
+      dart_op.dart_type(),
+      dart_op.dart_operation(),
+      team.dart_id()),
+    DART_OK);
+  trace.exit_state("allreduce");
+
+  DASH_LOG_TRACE("dash::minmax_element",
+                 "min. value:", global_minmax.min.value,
+                 "global idx:", global_minmax.min.g_index,
+                 "max. value:", global_minmax.max.value,
+                 "global idx:", global_minmax.max.g_index);
+
+  if (global_minmax.min.g_index < 0 ||
+      global_minmax.min.g_index == gi_last) {
+    DASH_LOG_DEBUG_VAR("dash::minmax_element >", last);
+    return std::make_pair(last, last);
+  }
+  globiter_t g_begin = first - first.gpos();
+  return std::make_pair(g_begin + global_minmax.min.g_index,
+                        g_begin + global_minmax.max.g_index);
+}
+
+/**
+ * Finds iterators pointing to the elements with the smallest and the
+ * greatest value in the range [first,last) in a single pass over local
+ * elements.
+ *
+ * Collective operation, local minima and maxima are combined in a single
+ * reduction.
+ *
+ * \return      A pair of iterators to the first occurrence of the
+ *              smallest and the last occurrence of the greatest value in
+ *              the range like \c std::minmax_element, or a pair of
+ *              \c last if the range is empty.
+ *
+ * \ingroup     DashAlgorithms
+ */
+template<
+  typename ElementType,
+  class    PatternType,
+  class    Compare = std::less<const ElementType &> >
+std::pair<GlobIter<ElementType, PatternType>,
+          GlobIter<ElementType, PatternType> >
+minmax_element(
+  /// Iterator to the initial position in the sequence
+  const GlobIter<ElementType, PatternType> & first,
+  /// Iterator to the final position in the sequence
+  const GlobIter<ElementType, PatternType> & last,
+  /// Element comparison function, defaults to std::less
+  Compare                                    compare = Compare())
+{
+  return dash::minmax_element(dash::seq, first, last, compare);
+}
+
 } // namespace dash
 
 #endif // DASH__ALGORITHM__MIN_MAX_H__
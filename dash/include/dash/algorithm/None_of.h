@@ -1,30 +1,67 @@
 #ifndef DASH__ALGORITHM__NONE_OF_H__
 #define DASH__ALGORITHM__NONE_OF_H__
 
+#include <dash/ExecutionPolicy.h>
 #include <dash/iterator/GlobIter.h>
-#include <dash/algorithm/LocalRange.h>
-#include <dash/algorithm/Operation.h>
-#include <dash/dart/if/dart_communication.h>
-#include <dash/algorithm/Find_if.h>
+#include <dash/algorithm/Find.h>
+#include <dash/algorithm/internal/ParallelFor.h>
+
 
 namespace dash {
 
 /**
+ * Returns true if \c p returns true for no element in the range
+ * \c [first,last) or if the range is empty.
+ *
+ * Collective operation, local elements are searched by the threads
+ * specified in the execution policy. Like \c dash::find_if, units stop
+ * searching as soon as the result is known.
+ *
+ * \see         DashExecutionPolicies
+ *
+ * \ingroup     DashAlgorithms
+ */
+template<
+  class    ExecutionPolicy,
+  typename ElementType,
+  class    PatternType,
+  typename UnaryPredicate >
+dash::internal::enable_if_execution_policy<ExecutionPolicy, bool>
+none_of(
+  /// Execution policy of the local search
+  ExecutionPolicy                   && policy,
+  /// Iterator to the initial position in the sequence
+  GlobIter<ElementType, PatternType>   first,
+  /// Iterator to the final position in the sequence
+  GlobIter<ElementType, PatternType>   last,
+  /// Predicate applied to the elements in range [first, last)
+  UnaryPredicate                       p)
+{
+  return dash::find_if(policy, first, last, p) == last;
+}
+
+/**
+ * Returns true if \c p returns true for no element in the range
+ * \c [first,last) or if the range is empty.
+ *
+ * Collective operation.
+ *
  * \ingroup     DashAlgorithms
  */
 template<
-    typename ElementType,
-    class PatternType>
-GlobIter<ElementType, PatternType> any_of(
-    /// Iterator to the initial position in the sequence
-    GlobIter<ElementType, PatternType>   first,
-    /// Iterator to the final position in the sequence
-    GlobIter<ElementType, PatternType>   last,
-    /// Predicate applied to the elements in range [first, last)
-    UnaryPredicate p)
+  typename ElementType,
+  class    PatternType,
+  typename UnaryPredicate >
+bool none_of(
+  /// Iterator to the initial position in the sequence
+  GlobIter<ElementType, PatternType>   first,
+  /// Iterator to the final position in the sequence
+  GlobIter<ElementType, PatternType>   last,
+  /// Predicate applied to the elements in range [first, last)
+  UnaryPredicate                       p)
 {
-    
-    return find_if(first, last, p) == last;
+  return dash::none_of(dash::seq, first, last, p);
+}
 
 } // namespace dash
 
@@ -1,8 +1,15 @@
 #ifndef DASH__ALGORITHM__OPERATION_H__
 #define DASH__ALGORITHM__OPERATION_H__
 
+#include <dash/Types.h>
+#include <dash/Team.h>
+#include <dash/Exception.h>
+
 #include <dash/dart/if/dart_types.h>
+
 #include <functional>
+#include <type_traits>
+#include <utility>
 
 /**
  * \defgroup DashReduceOperations DASH Reduce Operations
@@ -112,6 +119,241 @@ public:
   }
 };
 
+namespace internal {
+
+/**
+ * Whether \c BinaryOperation provides a predefined DART operation, i.e.
+ * is derived from \c dash::ReduceOperation.
+ */
+template< typename BinaryOperation >
+struct has_dart_operation {
+private:
+  template< typename Op >
+  static auto test(int)
+    -> decltype(std::declval<const Op &>().dart_operation(),
+                std::true_type());
+
+  template< typename Op >
+  static std::false_type test(...);
+
+public:
+  typedef decltype(test<BinaryOperation>(0)) type;
+};
+
+/**
+ * Partial result of a distributed reduction. \c valid is \c false for
+ * results of empty ranges as arbitrary operations have no neutral
+ * element.
+ */
+template< typename ValueType >
+struct ReducePartial {
+  ValueType value;
+  bool      valid;
+};
+
+/**
+ * Combines partial results of a distributed reduction, ignoring invalid
+ * operands.
+ */
+template< typename ValueType, typename BinaryOperation >
+struct ReducePartialOperation {
+  typedef ReducePartial<ValueType> partial_type;
+
+  BinaryOperation op;
+
+  partial_type operator()(
+    const partial_type & lhs,
+    const partial_type & rhs) const {
+    if (!lhs.valid) {
+      return rhs;
+    }
+    if (!rhs.valid) {
+      return lhs;
+    }
+    return partial_type { op(lhs.value, rhs.value), true };
+  }
+};
+
+/**
+ * DART data type and user-defined DART operations of binary operations
+ * of type \c BinaryOperation on values of type \c ValueType.
+ *
+ * Created on first use and reused by all instances of
+ * \c dash::DartReduceOperation with the same types until the DASH
+ * runtime is finalized. The operations invoke the instance referenced by
+ * \c current.
+ */
+template< typename ValueType, typename BinaryOperation >
+struct dart_user_reduce_op {
+  dart_datatype_t         dart_type  = DART_TYPE_UNDEFINED;
+  /// Non-commutative and commutative operation
+  dart_operation_t        dart_op[2] = { DART_OP_UNDEFINED,
+                                         DART_OP_UNDEFINED };
+  const BinaryOperation * current    = nullptr;
+
+  static dart_user_reduce_op & get() {
+    static dart_user_reduce_op instance;
+    return instance;
+  }
+
+  /**
+   * Destroys the DART type and operations, called when the DASH runtime
+   * is finalized.
+   */
+  void release() {
+    for (auto & op : dart_op) {
+      if (op != DART_OP_UNDEFINED) {
+        dart_op_destroy(&op);
+      }
+    }
+    dart_type_destroy(&dart_type);
+    dart_type = DART_TYPE_UNDEFINED;
+    current   = nullptr;
+  }
+};
+
+} // namespace internal
+
+/**
+ * Reduce operation on values of type \c ValueType for DART collectives
+ * like \c dart_allreduce, obtained from an arbitrary binary operation.
+ *
+ * Operations derived from \c dash::ReduceOperation on value types with a
+ * DART data type map to the predefined DART operation.
+ * Any other binary function object is registered as user-defined DART
+ * operation on the trivially copyable value type, see \c dart_op_create.
+ * The DART type and operation are created once for every combination of
+ * value type and operation type and reused by all instances, the
+ * operation applies the instance whose \c dart_operation() was obtained
+ * last. Instances of the same types must therefore not be used in
+ * concurrent collectives.
+ *
+ * Example:
+ *
+ * \code
+ *   dash::DartReduceOperation<point_t, point_max_t> op(point_max_t());
+ *   dart_allreduce(&l_point, &g_point, 1,
+ *                  op.dart_type(), op.dart_operation(),
+ *                  team.dart_id());
+ * \endcode
+ *
+ * \ingroup  DashReduceOperations
+ */
+template< typename ValueType, typename BinaryOperation >
+class DartReduceOperation {
+
+private:
+  typedef DartReduceOperation<ValueType, BinaryOperation> self_t;
+  typedef internal::dart_user_reduce_op<ValueType, BinaryOperation>
+    user_op_t;
+
+  static_assert(std::is_trivially_copyable<ValueType>::value,
+                "dash::DartReduceOperation: values are transferred as "
+                "bytes and must be trivially copyable");
+
+public:
+  typedef ValueType value_type;
+
+public:
+  /**
+   * Creates a reduce operation from the binary operation \c op.
+   * Values are combined in order of unit ids unless \c commutative is
+   * set.
+   */
+  explicit DartReduceOperation(
+    const BinaryOperation & op,
+    bool                    commutative = false)
+  : _op(op),
+    _dart_type(dash::dart_datatype<ValueType>::value)
+  {
+    init(commutative,
+         std::integral_constant<
+           bool,
+           internal::has_dart_operation<BinaryOperation>::type::value &&
+           dash::dart_datatype<ValueType>::value != DART_TYPE_UNDEFINED
+         >());
+  }
+
+  ~DartReduceOperation()
+  {
+    user_op_t & user_op = user_op_t::get();
+    if (user_op.current == &_op) {
+      user_op.current = nullptr;
+    }
+  }
+
+  DartReduceOperation(const self_t & other)    = delete;
+  self_t & operator=(const self_t & other)     = delete;
+
+  /**
+   * The DART operation to be used with values of type \c dart_type().
+   */
+  dart_operation_t dart_operation() const {
+    if (_user_op) {
+      user_op_t::get().current = &_op;
+    }
+    return _dart_op;
+  }
+
+  /**
+   * The DART data type of a single value of type \c ValueType.
+   */
+  dart_datatype_t dart_type() const {
+    return _dart_type;
+  }
+
+private:
+  void init(bool, std::true_type) {
+    _dart_op = _op.dart_operation();
+  }
+
+  void init(bool commutative, std::false_type) {
+    user_op_t & user_op = user_op_t::get();
+    if (user_op.dart_type == DART_TYPE_UNDEFINED) {
+      DASH_ASSERT_RETURNS(
+        dart_type_create_contiguous(
+          DART_TYPE_BYTE, sizeof(ValueType), &user_op.dart_type),
+        DART_OK);
+      // Reduce operations are created in collective operations, so all
+      // units register the deallocator in the same order:
+      dash::Team::All().register_deallocator(
+        &user_op, std::bind(&user_op_t::release, &user_op));
+    }
+    dart_operation_t & dart_op = user_op.dart_op[commutative ? 1 : 0];
+    if (dart_op == DART_OP_UNDEFINED) {
+      DASH_ASSERT_RETURNS(
+        dart_op_create(
+          &self_t::apply, &user_op.current, commutative,
+          user_op.dart_type, &dart_op),
+        DART_OK);
+    }
+    _dart_type = user_op.dart_type;
+    _dart_op   = dart_op;
+    _user_op   = true;
+  }
+
+  static void apply(
+    const void * invec,
+    void       * inoutvec,
+    size_t       len,
+    void       * userdata) {
+    const BinaryOperation & op    = **static_cast<
+                                       const BinaryOperation * const *>(
+                                         userdata);
+    const ValueType       * in    = static_cast<const ValueType *>(invec);
+    ValueType             * inout = static_cast<ValueType *>(inoutvec);
+    for (size_t i = 0; i < len; ++i) {
+      inout[i] = op(in[i], inout[i]);
+    }
+  }
+
+private:
+  BinaryOperation  _op;
+  dart_datatype_t  _dart_type;
+  dart_operation_t _dart_op = DART_OP_UNDEFINED;
+  bool             _user_op = false;
+};
+
 }  // namespace dash
 
 #endif // DASH__ALGORITHM__OPERATION_H__
@@ -6,9 +6,14 @@
 #include <dash/Pattern.h>
 #include <dash/Future.h>
 #include <dash/algorithm/Copy.h>
+#include <dash/algorithm/internal/Gemm.h>
+#include <dash/algorithm/internal/PanelBcast.h>
 #include <dash/util/Trace.h>
 
+#include <array>
+#include <cstdlib>
 #include <utility>
+#include <vector>
 
 // Prefer MKL if available:
 #ifdef DASH_ENABLE_MKL
@@ -49,42 +54,29 @@ void mmult_local(
   MemArrange        storage);
 #else
 /**
- * Naive matrix multiplication for local multiplication of matrix blocks,
- * used only for tests and where MKL is not available.
+ * Matrix multiplication for local multiplication of matrix blocks via
+ * the built-in cache-blocked kernel, used where neither MKL nor BLAS is
+ * available.
  */
 template<typename ValueType>
 void mmult_local(
-  /// Matrix to multiply, extents n x m
+  /// Matrix to multiply, m rows by k columns.
   const ValueType * A,
-  /// Matrix to multiply, extents m x p
+  /// Matrix to multiply, k rows by n columns.
   const ValueType * B,
-  /// Matrix to contain the multiplication result, extents n x p
+  /// Matrix to contain the multiplication result, m rows by n columns.
   ValueType       * C,
   long long         m,
   long long         n,
-  long long         p,
+  long long         k,
   MemArrange        storage)
 {
-#ifndef DEBUG
-  DASH_THROW(
-    dash::exception::RuntimeError,
-    "Called fallback implementation of DGEMM (only enabled in Debug)");
-#endif
-  ValueType c_sum = 0;
-  for (auto i = 0; i < n; ++i) {
-    // row i = 0...n
-    for (auto j = 0; j < p; ++j) {
-      // column j = 0...p
-      c_sum = C[i * p + j]; // = C[j][i]
-      for (auto k = 0; k < m; ++k) {
-        // k = 0...m
-        auto ik     = i * m + k;
-        auto kj     = k * m + j;
-        auto value  = A[ik] * B[kj];
-        c_sum      += value;
-      }
-      C[i * p + j] = c_sum; // C[j][i] = c_sum
-    }
+  if (storage == dash::COL_MAJOR) {
+    dash::internal::gemm_local<ValueType, dash::COL_MAJOR>(
+      dash::execution::par_unseq, A, B, C, m, n, k);
+  } else {
+    dash::internal::gemm_local<ValueType, dash::ROW_MAJOR>(
+      dash::execution::par_unseq, A, B, C, m, n, k);
   }
 }
 #endif // defined(DASH_ENABLE_MKL) || defined(DASH_ENABLE_BLAS)
@@ -603,6 +595,372 @@ void summa(
   DASH_LOG_TRACE("dash::summa >", "finished");
 }
 
+namespace internal {
+
+/**
+ * Whether the pattern maps complete blocks to the units in the specified
+ * teamspec cyclically in every dimension, like \c dash::TilePattern.
+ */
+template <class PatternType, class TeamSpecType>
+bool summa_cyclic_blocks(
+  const PatternType  & pattern,
+  const TeamSpecType & teamspec)
+{
+  typedef typename PatternType::index_type index_t;
+  typedef std::array<index_t, 2>           coords_t;
+
+  index_t t0  = teamspec.extent(0);
+  index_t t1  = teamspec.extent(1);
+  index_t bs0 = pattern.blocksize(0);
+  index_t bs1 = pattern.blocksize(1);
+  if (pattern.teamspec().extent(0) != teamspec.extent(0) ||
+      pattern.teamspec().extent(1) != teamspec.extent(1) ||
+      pattern.extent(0) % bs0 != 0 ||
+      pattern.extent(1) % bs1 != 0) {
+    return false;
+  }
+  for (index_t b0 = 0; b0 < static_cast<index_t>(pattern.extent(0)) / bs0;
+       ++b0) {
+    for (index_t b1 = 0; b1 < static_cast<index_t>(pattern.extent(1)) / bs1;
+         ++b1) {
+      auto unit = pattern.unit_at(coords_t {{ b0 * bs0, b1 * bs1 }});
+      if (unit.id != static_cast<dart_unit_t>(
+                       teamspec.at(coords_t {{ b0 % t0, b1 % t1 }}))) {
+        return false;
+      }
+    }
+  }
+  return true;
+}
+
+/**
+ * Splits \c layers into extents \c s0 x \c s1 of the sub-grids of units
+ * in matrix teamspecs of extents \c t0 x \c t1 that compute a set of
+ * blocks in the result matrix together in \c dash::summa_bcast.
+ * Prefers square sub-grids.
+ */
+inline std::array<int, 2> summa_layer_extents(
+  int    layers,
+  size_t t0,
+  size_t t1)
+{
+  std::array<int, 2> extents {{ 0, 0 }};
+  for (int s0 = 1; s0 <= layers; ++s0) {
+    int s1 = layers / s0;
+    if (s0 * s1 != layers || t0 % s0 != 0 || t1 % s1 != 0) {
+      continue;
+    }
+    if (extents[0] == 0 ||
+        std::abs(s0 - s1) < std::abs(extents[0] - extents[1])) {
+      extents = {{ s0, s1 }};
+    }
+  }
+  if (extents[0] == 0) {
+    DASH_THROW(
+      dash::exception::InvalidArgument,
+      "dash::summa_bcast(): "
+      "number of layers " << layers << " does not divide teamspec " <<
+      t0 << "x" << t1);
+  }
+  return extents;
+}
+
+} // namespace internal
+
+/**
+ * Multiplies two matrices using a variant of the SUMMA algorithm that
+ * broadcasts panels of \c A and \c B in sub-teams instead of fetching
+ * single blocks at every unit.
+ *
+ * Computes \c C(i,j) += A(i,k) * B(k,j), where \c i is the coordinate of
+ * the first dimension.
+ *
+ * Units are arranged in the grid of the matrix teamspec. In every step
+ * \c k, the panel of \c A containing blocks \c A(i,k) is broadcast to the
+ * units sharing the grid coordinate in the first dimension, the panel of
+ * \c B containing blocks \c B(k,j) to the units sharing the coordinate in
+ * the second dimension. Broadcasts use the tree algorithm of the
+ * communication backend and, if \c node_aware is set, first transfer
+ * panels to a single unit per node which then shares them with the other
+ * units on its node.
+ *
+ * For \c layers \c c > 1, sub-grids of \c c units compute the union of
+ * their blocks in \c C together (2.5D algorithm): every unit computes the
+ * partial products of all blocks in its sub-grid for every \c c-th step
+ * \c k, and partial results are accumulated at the owners of the blocks
+ * in the end. This reduces the volume of panels received per unit by
+ * \c sqrt(c) at the cost of \c c temporary copies of local blocks in
+ * \c C. The number of layers must be a product of divisors of the
+ * teamspec extents.
+ *
+ * Collective operation. Requires patterns that map blocks to units in
+ * the teamspec cyclically, like \c dash::TilePattern, with extents
+ * divisible by the block extents. Blocks of \c A and \c B must have
+ * identical extents in the dimension of \c k.
+ *
+ * \see  dash::summa
+ */
+template<
+  typename MatrixTypeA,
+  typename MatrixTypeB,
+  typename MatrixTypeC
+>
+void summa_bcast(
+  /// Matrix to multiply, extents n x m
+  MatrixTypeA & A,
+  /// Matrix to multiply, extents m x p
+  MatrixTypeB & B,
+  /// Matrix to contain the multiplication result, extents n x p
+  MatrixTypeC & C,
+  /// Number of layers sharing the computation of blocks in \c C
+  int           layers     = 1,
+  /// Whether panels are broadcast in two stages, across and within nodes
+  bool          node_aware = true)
+{
+  typedef typename MatrixTypeA::value_type   value_type;
+  typedef typename MatrixTypeA::index_type   index_t;
+  typedef std::array<index_t, 2>             coords_t;
+
+  static_assert(
+      std::is_same<value_type, double>::value ||
+      std::is_same<value_type, float>::value,
+      "dash::summa_bcast expects matrix element type double or float");
+
+  DASH_LOG_DEBUG("dash::summa_bcast()", "layers:", layers,
+                 "node aware:", node_aware);
+
+  dash::Team & team     = C.team();
+  const auto & pattern_a = A.pattern();
+  const auto & pattern_b = B.pattern();
+  const auto & pattern_c = C.pattern();
+  const dash::MemArrange memory_order = pattern_a.memory_order();
+
+  DASH_ASSERT_EQ(
+    pattern_a.extent(1),
+    pattern_b.extent(0),
+    "dash::summa_bcast(): "
+    "Extents of first operand in dimension 1 do not match extents of "
+    "second operand in dimension 0");
+  DASH_ASSERT_EQ(
+    pattern_c.extent(0),
+    pattern_a.extent(0),
+    "dash::summa_bcast(): "
+    "Extents of result matrix in dimension 0 do not match extents of "
+    "first operand in dimension 0");
+  DASH_ASSERT_EQ(
+    pattern_c.extent(1),
+    pattern_b.extent(1),
+    "dash::summa_bcast(): "
+    "Extents of result matrix in dimension 1 do not match extents of "
+    "second operand in dimension 1");
+  if (pattern_a.blocksize(1) != pattern_b.blocksize(0) ||
+      pattern_c.blocksize(0) != pattern_a.blocksize(0) ||
+      pattern_c.blocksize(1) != pattern_b.blocksize(1)) {
+    DASH_THROW(
+      dash::exception::InvalidArgument,
+      "dash::summa_bcast(): "
+      "block extents of matrices do not match");
+  }
+  const auto & teamspec  = pattern_c.teamspec();
+  if (!dash::internal::summa_cyclic_blocks(pattern_a, teamspec) ||
+      !dash::internal::summa_cyclic_blocks(pattern_b, teamspec) ||
+      !dash::internal::summa_cyclic_blocks(pattern_c, teamspec)) {
+    DASH_THROW(
+      dash::exception::InvalidArgument,
+      "dash::summa_bcast(): "
+      "matrix patterns do not map complete blocks to units cyclically");
+  }
+  size_t t0 = teamspec.extent(0);
+  size_t t1 = teamspec.extent(1);
+
+  auto     layer_ext = dash::internal::summa_layer_extents(layers, t0, t1);
+  size_t   s0        = layer_ext[0];
+  size_t   s1        = layer_ext[1];
+  auto     my_coords = teamspec.coords(team.myid());
+  size_t   x0        = my_coords[0];
+  size_t   x1        = my_coords[1];
+  // Layer of this unit, i.e. its position in its sub-grid:
+  size_t   layer     = (x0 % s0) + s0 * (x1 % s1);
+
+  index_t  bs_m      = pattern_a.blocksize(0);
+  index_t  bs_k      = pattern_a.blocksize(1);
+  index_t  bs_n      = pattern_b.blocksize(1);
+  index_t  nblocks_k = pattern_a.blockspec().extent(1);
+  size_t   block_a_size = bs_m * bs_k;
+  size_t   block_b_size = bs_k * bs_n;
+  size_t   block_c_size = bs_m * bs_n;
+
+  // Block coordinates of the blocks in C computed by the sub-grid of this
+  // unit:
+  std::vector<index_t> blocks_0;
+  std::vector<index_t> blocks_1;
+  for (index_t b0 = 0;
+       b0 < static_cast<index_t>(pattern_c.blockspec().extent(0)); ++b0) {
+    if ((b0 % t0) / s0 == x0 / s0) {
+      blocks_0.push_back(b0);
+    }
+  }
+  for (index_t b1 = 0;
+       b1 < static_cast<index_t>(pattern_c.blockspec().extent(1)); ++b1) {
+    if ((b1 % t1) / s1 == x1 / s1) {
+      blocks_1.push_back(b1);
+    }
+  }
+  DASH_LOG_TRACE("dash::summa_bcast", "sub-grid:", s0, "x", s1,
+                 "layer:", layer,
+                 "blocks:", blocks_0.size(), "x", blocks_1.size());
+
+  dash::util::Trace trace("SUMMA");
+
+  // -------------------------------------------------------------------------
+  // Create teams receiving panels of A and B:
+  // -------------------------------------------------------------------------
+  trace.enter_state("teams");
+  auto unit_at = [&](size_t u0, size_t u1) {
+    return team.global_id(
+             dash::team_unit_t(
+               teamspec.at(coords_t {{ static_cast<index_t>(u0),
+                                       static_cast<index_t>(u1) }})));
+  };
+  // Panels of A are received by units with identical grid coordinate in
+  // dimension 0 and layer, panels of B by units with identical grid
+  // coordinate in dimension 1 and layer:
+  std::vector<std::vector<dash::global_unit_t>> groups_a(t0 * s1);
+  std::vector<std::vector<dash::global_unit_t>> groups_b(t1 * s0);
+  for (size_t u0 = 0; u0 < t0; ++u0) {
+    for (size_t u1 = 0; u1 < t1; ++u1) {
+      groups_a[u0 * s1 + u1 % s1].push_back(unit_at(u0, u1));
+      groups_b[u1 * s0 + u0 % s0].push_back(unit_at(u0, u1));
+    }
+  }
+  std::vector<int32_t> node_ids;
+  if (node_aware) {
+    node_ids = dash::internal::unit_node_ids(team);
+  }
+  dash::internal::PanelBcastTeam team_a(team, groups_a, node_ids);
+  dash::internal::PanelBcastTeam team_b(team, groups_b, node_ids);
+  trace.exit_state("teams");
+
+  // -------------------------------------------------------------------------
+  // Result blocks, local blocks of C for a single layer:
+  // -------------------------------------------------------------------------
+  std::vector<value_type>   acc;
+  std::vector<value_type *> blocks_c;
+  if (s0 * s1 > 1) {
+    acc.resize(blocks_0.size() * blocks_1.size() * block_c_size);
+    for (size_t b = 0; b < blocks_0.size() * blocks_1.size(); ++b) {
+      blocks_c.push_back(acc.data() + b * block_c_size);
+    }
+  } else {
+    for (auto b0 : blocks_0) {
+      for (auto b1 : blocks_1) {
+        blocks_c.push_back(
+          C.block(coords_t {{ b0, b1 }}).begin().local());
+      }
+    }
+  }
+  std::vector<value_type> panel_a(blocks_0.size() * block_a_size);
+  std::vector<value_type> panel_b(blocks_1.size() * block_b_size);
+
+  // Copies the blocks of a panel to the buffer at the root of a broadcast:
+  auto fetch_panel = [&](
+                       value_type                          * panel,
+                       size_t                                block_size,
+                       const std::vector<coords_t>         & coords,
+                       bool                                  from_a) {
+    std::vector<dash::Future<value_type *>> gets;
+    for (size_t b = 0; b < coords.size(); ++b) {
+      auto block = from_a ? A.block(coords[b]) : B.block(coords[b]);
+      auto lptr  = block.begin().local();
+      if (lptr != nullptr) {
+        std::copy(lptr, lptr + block_size, panel + b * block_size);
+      } else {
+        gets.push_back(
+          dash::copy_async(block.begin(), block.end(),
+                           panel + b * block_size));
+      }
+    }
+    for (auto & get : gets) {
+      get.wait();
+    }
+  };
+
+  // -------------------------------------------------------------------------
+  // Iterate steps assigned to the layer of this unit:
+  // -------------------------------------------------------------------------
+  for (index_t k = layer; k < nblocks_k; k += s0 * s1) {
+    // Root of panel of A in team of this unit, grid coordinate in
+    // dimension 1 nearest to owners of blocks A(i,k):
+    size_t k1     = k % t1;
+    size_t root_a = k1 - (k1 % s1) + (layer / s0);
+    size_t k0     = k % t0;
+    size_t root_b = k0 - (k0 % s0) + (layer % s0);
+
+    trace.enter_state("bcast");
+    if (x1 == root_a) {
+      std::vector<coords_t> coords;
+      for (auto b0 : blocks_0) {
+        coords.push_back(coords_t {{ b0, k }});
+      }
+      fetch_panel(panel_a.data(), block_a_size, coords, true);
+    }
+    team_a.bcast(panel_a.data(), panel_a.size(), unit_at(x0, root_a));
+    if (x0 == root_b) {
+      std::vector<coords_t> coords;
+      for (auto b1 : blocks_1) {
+        coords.push_back(coords_t {{ k, b1 }});
+      }
+      fetch_panel(panel_b.data(), block_b_size, coords, false);
+    }
+    team_b.bcast(panel_b.data(), panel_b.size(), unit_at(root_b, x1));
+    trace.exit_state("bcast");
+
+    trace.enter_state("multiply");
+    for (size_t i = 0; i < blocks_0.size(); ++i) {
+      for (size_t j = 0; j < blocks_1.size(); ++j) {
+        dash::internal::mmult_local<value_type>(
+            panel_a.data() + i * block_a_size,
+            panel_b.data() + j * block_b_size,
+            blocks_c[i * blocks_1.size() + j],
+            bs_m,
+            bs_n,
+            bs_k,
+            memory_order);
+      }
+    }
+    trace.exit_state("multiply");
+  }
+
+  // -------------------------------------------------------------------------
+  // Accumulate partial results of layers at owners of blocks in C:
+  // -------------------------------------------------------------------------
+  if (s0 * s1 > 1) {
+    trace.enter_state("accumulate");
+    dart_gptr_t gptr_c = DART_GPTR_NULL;
+    for (size_t i = 0; i < blocks_0.size(); ++i) {
+      for (size_t j = 0; j < blocks_1.size(); ++j) {
+        gptr_c = C.block(coords_t {{ blocks_0[i], blocks_1[j] }})
+                  .begin().dart_gptr();
+        dart_storage_t ds = dash::dart_storage<value_type>(block_c_size);
+        DASH_ASSERT_RETURNS(
+          dart_accumulate(gptr_c, blocks_c[i * blocks_1.size() + j],
+                          ds.nelem, ds.dtype, DART_OP_SUM, team.dart_id()),
+          DART_OK);
+      }
+    }
+    if (!DART_GPTR_ISNULL(gptr_c)) {
+      DASH_ASSERT_RETURNS(dart_flush_all(gptr_c), DART_OK);
+    }
+    trace.exit_state("accumulate");
+  }
+
+  trace.enter_state("barrier");
+  C.barrier();
+  trace.exit_state("barrier");
+
+  DASH_LOG_TRACE("dash::summa_bcast >", "finished");
+}
+
 #ifdef DOXYGEN
 /**
  * Function adapter to an implementation of matrix-matrix multiplication
@@ -0,0 +1,715 @@
+#ifndef DASH__ALGORITHM__SCAN_H__
+#define DASH__ALGORITHM__SCAN_H__
+
+#include <dash/ExecutionPolicy.h>
+#include <dash/iterator/GlobIter.h>
+
+#include <dash/algorithm/LocalRange.h>
+#include <dash/algorithm/Operation.h>
+#include <dash/algorithm/internal/ParallelFor.h>
+
+#include <dash/dart/if/dart_communication.h>
+
+#include <algorithm>
+#include <array>
+#include <numeric>
+#include <type_traits>
+#include <vector>
+
+
+namespace dash {
+
+namespace internal {
+
+/**
+ * Local elements with consecutive global indices, scanned as a contiguous
+ * sequence.
+ */
+template <typename IndexType>
+struct ScanRun {
+  /// Local offset of the first element in the run
+  IndexType l_begin;
+  /// Local offset past the last element in the run
+  IndexType l_end;
+  /// Global index of the first element in the run
+  IndexType g_begin;
+};
+
+/**
+ * Splits the local index range \c [l_begin, l_end) into runs of elements
+ * with consecutive global indices.
+ * Local elements of one-dimensional patterns are ordered by their global
+ * indices, so the end of a run can be found by galloping search. Runs in
+ * multi-dimensional patterns, like the rows of local blocks, are not
+ * ordered by global index and are resolved element by element.
+ */
+template <class PatternType, typename IndexType>
+std::vector<ScanRun<IndexType>> scan_runs(
+  const PatternType & pattern,
+  IndexType           l_begin,
+  IndexType           l_end)
+{
+  std::vector<ScanRun<IndexType>> runs;
+  while (l_begin < l_end) {
+    IndexType g_begin = pattern.global(l_begin);
+    IndexType l_max   = l_end - l_begin;
+    // Elements [l_begin, l_begin + n) are consecutive:
+    auto consecutive  = [&](IndexType n) {
+                          return pattern.global(l_begin + n - 1)
+                                 == g_begin + n - 1;
+                        };
+    IndexType n_run   = 1;
+    if (PatternType::ndim() == 1) {
+      IndexType n_bad = l_max + 1;
+      for (IndexType step = 1; n_run < l_max; step *= 2) {
+        IndexType n = std::min(n_run + step, l_max);
+        if (!consecutive(n)) {
+          n_bad = n;
+          break;
+        }
+        n_run = n;
+      }
+      while (n_bad <= l_max && n_bad - n_run > 1) {
+        IndexType n = n_run + (n_bad - n_run) / 2;
+        if (consecutive(n)) {
+          n_run = n;
+        } else {
+          n_bad = n;
+        }
+      }
+    } else {
+      while (n_run < l_max && consecutive(n_run + 1)) {
+        ++n_run;
+      }
+    }
+    runs.push_back(ScanRun<IndexType> { l_begin, l_begin + n_run, g_begin });
+    l_begin += n_run;
+  }
+  return runs;
+}
+
+/**
+ * Whether every unit's local elements of a one-dimensional pattern have
+ * consecutive global indices that precede those of units with higher
+ * ids, so that a range is scanned in the order of units.
+ */
+template <class PatternType>
+bool scan_units_ordered(
+  const PatternType & pattern,
+  std::true_type      /* one-dimensional */)
+{
+  typedef typename PatternType::index_type index_t;
+  index_t g_next = 0;
+  for (dash::team_unit_t u{0}; u < pattern.team().size(); u++) {
+    index_t l_size = pattern.local_size(u);
+    if (l_size == 0) {
+      continue;
+    }
+    index_t g_first = pattern.global_index(
+                        u, std::array<index_t, 1> {{ 0 }});
+    index_t g_last  = pattern.global_index(
+                        u, std::array<index_t, 1> {{ l_size - 1 }});
+    if (g_first != g_next || g_last != g_first + l_size - 1) {
+      return false;
+    }
+    g_next = g_last + 1;
+  }
+  return true;
+}
+
+template <class PatternType>
+bool scan_units_ordered(
+  const PatternType &,
+  std::false_type     /* multi-dimensional */)
+{
+  return false;
+}
+
+/**
+ * Number of elements in a phase of a one-dimensional pattern that assigns
+ * blocks to units round-robin, like cyclic and block-cyclic patterns, or
+ * \c 0 for other patterns.
+ * Every phase consists of one block of every unit, ordered by unit id.
+ * Collective operation, the units agree on whether all their local runs
+ * are in blocks of this order.
+ */
+template <class PatternType, typename IndexType, class TeamType>
+IndexType scan_phase_size(
+  const PatternType                     & pattern,
+  const std::vector<ScanRun<IndexType>> & runs,
+  TeamType                              & team,
+  std::true_type                          /* one-dimensional */)
+{
+  IndexType block_size = pattern.blocksize(0);
+  IndexType nunits     = team.size();
+  int       l_phased   = (block_size > 0) ? 1 : 0;
+  for (size_t r = 0; l_phased && r < runs.size(); ++r) {
+    IndexType block_offs = runs[r].g_begin % block_size;
+    if ((runs[r].g_begin / block_size) % nunits != team.myid().id ||
+        runs[r].l_end - runs[r].l_begin > block_size - block_offs) {
+      l_phased = 0;
+    }
+  }
+  int phased = 0;
+  DASH_ASSERT_RETURNS(
+    dart_allreduce(&l_phased, &phased, 1, DART_TYPE_INT, DART_OP_MIN,
+                   team.dart_id()),
+    DART_OK);
+  return phased ? block_size * nunits : 0;
+}
+
+template <class PatternType, typename IndexType, class TeamType>
+IndexType scan_phase_size(
+  const PatternType                     &,
+  const std::vector<ScanRun<IndexType>> &,
+  TeamType                              &,
+  std::false_type                         /* multi-dimensional */)
+{
+  return 0;
+}
+
+/**
+ * Exclusive prefix of every local run in the global range
+ * \c [g_begin, g_end), combined from the totals of the runs at all units.
+ *
+ * If units are ordered, local totals are combined in an exclusive scan.
+ * If blocks are assigned to units round-robin in phases of
+ * \c phase_size elements, every unit contributes one total per phase to
+ * an exclusive scan and a reduction over all units. Otherwise, the totals
+ * of all runs are gathered at all units.
+ */
+template <
+  typename IndexType,
+  class    PartialType,
+  class    PartialOperation,
+  class    TeamType >
+std::vector<PartialType> scan_run_prefixes(
+  const std::vector<ScanRun<IndexType>> & runs,
+  const std::vector<PartialType>        & run_totals,
+  PartialType                             init,
+  PartialOperation                        partial_op,
+  bool                                    units_ordered,
+  IndexType                               phase_size,
+  IndexType                               g_begin,
+  IndexType                               g_end,
+  TeamType                              & team)
+{
+  std::vector<PartialType> prefixes(runs.size(), init);
+  if (units_ordered) {
+    // At most one run per unit, ordered by unit id:
+    PartialType l_total { init.value, false };
+    for (const auto & rt : run_totals) {
+      l_total = partial_op(l_total, rt);
+    }
+    PartialType l_prefix { init.value, false };
+    dash::DartReduceOperation<PartialType, PartialOperation> dart_op(
+      partial_op);
+    DASH_ASSERT_RETURNS(
+      dart_exscan(
+        &l_total,
+        &l_prefix,
+        1,
+        dart_op.dart_type(),
+        dart_op.dart_operation(),
+        team.dart_id()),
+      DART_OK);
+    if (team.myid() == 0) {
+      // Result of exscan is undefined at first unit:
+      l_prefix.valid = false;
+    }
+    for (auto & prefix : prefixes) {
+      prefix = partial_op(init, l_prefix);
+    }
+    return prefixes;
+  }
+
+  if (phase_size > 0) {
+    // At most one run per unit and phase, runs of a phase are ordered by
+    // unit id:
+    IndexType   phase_first = g_begin / phase_size;
+    size_t      nphases     = (g_end - 1) / phase_size - phase_first + 1;
+    PartialType none { init.value, false };
+    std::vector<PartialType> l_totals(nphases, none);
+    for (size_t r = 0; r < runs.size(); ++r) {
+      auto & total = l_totals[runs[r].g_begin / phase_size - phase_first];
+      total = partial_op(total, run_totals[r]);
+    }
+    // Totals of every phase and of the runs of preceding units in every
+    // phase:
+    std::vector<PartialType> phase_totals(nphases, none);
+    std::vector<PartialType> unit_prefixes(nphases, none);
+    dash::DartReduceOperation<PartialType, PartialOperation> dart_op(
+      partial_op);
+    DASH_ASSERT_RETURNS(
+      dart_allreduce(
+        l_totals.data(),
+        phase_totals.data(),
+        nphases,
+        dart_op.dart_type(),
+        dart_op.dart_operation(),
+        team.dart_id()),
+      DART_OK);
+    DASH_ASSERT_RETURNS(
+      dart_exscan(
+        l_totals.data(),
+        unit_prefixes.data(),
+        nphases,
+        dart_op.dart_type(),
+        dart_op.dart_operation(),
+        team.dart_id()),
+      DART_OK);
+    PartialType g_prefix = init;
+    for (size_t k = 0; k < nphases; ++k) {
+      // Result of exscan is undefined at first unit:
+      if (team.myid() == 0) {
+        unit_prefixes[k] = none;
+      }
+      unit_prefixes[k] = partial_op(g_prefix, unit_prefixes[k]);
+      g_prefix         = partial_op(g_prefix, phase_totals[k]);
+    }
+    for (size_t r = 0; r < runs.size(); ++r) {
+      prefixes[r] = unit_prefixes[runs[r].g_begin / phase_size
+                                  - phase_first];
+    }
+    return prefixes;
+  }
+
+  // Runs of units are interleaved, gather the totals of all runs:
+  struct run_total_t {
+    IndexType   g_begin;
+    PartialType total;
+  };
+  std::vector<run_total_t> l_run_totals;
+  l_run_totals.reserve(runs.size());
+  for (size_t r = 0; r < runs.size(); ++r) {
+    l_run_totals.push_back(run_total_t { runs[r].g_begin, run_totals[r] });
+  }
+  size_t              nunits = team.size();
+  size_t              l_num  = l_run_totals.size() * sizeof(run_total_t);
+  std::vector<size_t> num_bytes(nunits);
+  DASH_ASSERT_RETURNS(
+    dart_allgather(&l_num, num_bytes.data(), 1, DART_TYPE_SIZET,
+                   team.dart_id()),
+    DART_OK);
+  std::vector<size_t> displs(nunits, 0);
+  for (size_t u = 1; u < nunits; ++u) {
+    displs[u] = displs[u-1] + num_bytes[u-1];
+  }
+  std::vector<run_total_t> g_run_totals(
+    (displs[nunits-1] + num_bytes[nunits-1]) / sizeof(run_total_t));
+  DASH_ASSERT_RETURNS(
+    dart_allgatherv(l_run_totals.data(), l_num, DART_TYPE_BYTE,
+                    g_run_totals.data(), num_bytes.data(), displs.data(),
+                    team.dart_id()),
+    DART_OK);
+  std::sort(g_run_totals.begin(), g_run_totals.end(),
+            [](const run_total_t & a, const run_total_t & b) {
+              return a.g_begin < b.g_begin;
+            });
+  // Local runs are not ordered by global index in multi-dimensional
+  // patterns, merge with all runs in order of their global index:
+  std::vector<size_t> run_order(runs.size());
+  std::iota(run_order.begin(), run_order.end(), 0);
+  std::sort(run_order.begin(), run_order.end(),
+            [&](size_t a, size_t b) {
+              return runs[a].g_begin < runs[b].g_begin;
+            });
+  PartialType g_prefix = init;
+  size_t      r        = 0;
+  for (const auto & rt : g_run_totals) {
+    if (r == run_order.size()) {
+      break;
+    }
+    if (rt.g_begin == runs[run_order[r]].g_begin) {
+      prefixes[run_order[r++]] = g_prefix;
+    }
+    g_prefix = partial_op(g_prefix, rt.total);
+  }
+  return prefixes;
+}
+
+/**
+ * Scan of the values in range \c [first, last), written to the range
+ * starting at \c d_first.
+ *
+ * Every unit splits its local elements into runs of consecutive global
+ * indices. Totals of runs are reduced in a multithreaded local pass,
+ * their exclusive prefixes are combined across units and the scan
+ * is completed in a second local pass, starting every run at its prefix.
+ */
+template <
+  class ExecutionPolicy,
+  class GlobInputIt,
+  class GlobOutputIt,
+  class ValueType,
+  class BinaryOperation >
+GlobOutputIt scan(
+  ExecutionPolicy && policy,
+  GlobInputIt        first,
+  GlobInputIt        last,
+  GlobOutputIt       d_first,
+  BinaryOperation    binary_op,
+  ValueType          init,
+  bool               has_init,
+  bool               inclusive)
+{
+  typedef typename GlobInputIt::index_type                index_t;
+  typedef typename GlobInputIt::pattern_type              pattern_t;
+  typedef dash::internal::ReducePartial<ValueType>        partial_t;
+  typedef dash::internal::ReducePartialOperation<
+            ValueType, BinaryOperation>                   partial_op_t;
+  typedef dash::internal::ScanRun<index_t>                run_t;
+
+  if (first >= last) {
+    return d_first;
+  }
+  auto &  pattern     = first.pattern();
+  auto &  team        = pattern.team();
+  index_t g_size      = last - first;
+  DASH_ASSERT_MSG(pattern == d_first.pattern(),
+                  "dash::scan: "
+                  "distributions of input and output ranges differ");
+  auto    index_range = dash::local_index_range(first, last);
+  auto    l_in        = dash::local_range(first, last).begin;
+  GlobOutputIt d_last = d_first + g_size;
+  auto    out_range   = dash::local_range(d_first, d_last);
+  auto    l_out       = out_range.begin;
+  index_t l_size      = index_range.end - index_range.begin;
+  DASH_ASSERT_MSG(l_size == out_range.end - out_range.begin,
+                  "dash::scan: "
+                  "start offsets of input and output ranges differ");
+
+  // Runs with local offsets relative to l_in:
+  std::vector<run_t> runs = dash::internal::scan_runs(
+                              pattern, index_range.begin, index_range.end);
+  for (auto & run : runs) {
+    run.l_begin -= index_range.begin;
+    run.l_end   -= index_range.begin;
+  }
+  DASH_LOG_TRACE("dash::scan", "local elements:", l_size,
+                 "runs:", runs.size());
+
+  // Partial totals of the segments of runs in every chunk:
+  int n_chunks = dash::internal::num_parallel_chunks(
+                   policy, l_size, sizeof(ValueType));
+  std::vector<size_t>                 chunk_first_run(n_chunks, 0);
+  std::vector<std::vector<partial_t>> chunk_totals(n_chunks);
+  auto first_run_in = [&](index_t l_offset) {
+                        return std::upper_bound(
+                                 runs.begin(), runs.end(), l_offset,
+                                 [](index_t l, const run_t & run) {
+                                   return l < run.l_end;
+                                 }) - runs.begin();
+                      };
+  dash::internal::parallel_for(
+    policy, l_size, sizeof(ValueType),
+    [&](int c, index_t c_begin, index_t c_end) {
+      size_t r           = first_run_in(c_begin);
+      chunk_first_run[c] = r;
+      for (; r < runs.size() && runs[r].l_begin < c_end; ++r) {
+        index_t s_begin = std::max(c_begin, runs[r].l_begin);
+        index_t s_end   = std::min(c_end,   runs[r].l_end);
+        ValueType acc   = l_in[s_begin];
+        for (index_t i = s_begin + 1; i < s_end; ++i) {
+          acc = binary_op(acc, l_in[i]);
+        }
+        chunk_totals[c].push_back(partial_t { acc, true });
+      }
+    });
+
+  partial_op_t partial_op { binary_op };
+  std::vector<partial_t> run_totals(runs.size(), partial_t { init, false });
+  for (int c = 0; c < n_chunks; ++c) {
+    for (size_t s = 0; s < chunk_totals[c].size(); ++s) {
+      auto & rt = run_totals[chunk_first_run[c] + s];
+      rt = partial_op(rt, chunk_totals[c][s]);
+    }
+  }
+
+  std::integral_constant<bool, pattern_t::ndim() == 1> one_dim;
+  bool    units_ordered = dash::internal::scan_units_ordered(
+                            pattern, one_dim);
+  index_t phase_size    = units_ordered
+                          ? 0
+                          : dash::internal::scan_phase_size(
+                              pattern, runs, team, one_dim);
+  index_t g_begin       = first.gpos();
+  std::vector<partial_t> run_prefixes =
+    dash::internal::scan_run_prefixes(
+      runs, run_totals, partial_t { init, has_init }, partial_op,
+      units_ordered, phase_size, g_begin, g_begin + g_size, team);
+
+  // Initial values of the segments of runs in every chunk:
+  for (int c = 0; c < n_chunks; ++c) {
+    for (size_t s = 0; s < chunk_totals[c].size(); ++s) {
+      auto & prefix = run_prefixes[chunk_first_run[c] + s];
+      auto   total  = chunk_totals[c][s];
+      chunk_totals[c][s] = prefix;
+      prefix = partial_op(prefix, total);
+    }
+  }
+
+  dash::internal::parallel_for(
+    policy, l_size, sizeof(ValueType),
+    [&](int c, index_t c_begin, index_t c_end) {
+      size_t r = chunk_first_run[c];
+      for (size_t s = 0; s < chunk_totals[c].size(); ++s, ++r) {
+        index_t   s_begin = std::max(c_begin, runs[r].l_begin);
+        index_t   s_end   = std::min(c_end,   runs[r].l_end);
+        partial_t acc     = chunk_totals[c][s];
+        for (index_t i = s_begin; i < s_end; ++i) {
+          // Input and output range may be identical:
+          ValueType value = l_in[i];
+          if (inclusive) {
+            acc.value = acc.valid ? binary_op(acc.value, value) : value;
+            acc.valid = true;
+            l_out[i]  = acc.value;
+          } else {
+            l_out[i]  = acc.value;
+            acc.value = binary_op(acc.value, value);
+          }
+        }
+      }
+    });
+
+  return d_last;
+}
+
+} // namespace internal
+
+/**
+ * Computes the inclusive prefix reduction of the values in range
+ * \c [first, last) using \c binary_op, starting with \c init, and writes
+ * the results to the range beginning at \c d_first.
+ *
+ * Collective operation, local elements are scanned by the threads
+ * specified in the execution policy.
+ * If every unit's local elements are contiguous in the range and ordered
+ * by unit like in blocked one-dimensional patterns, local totals are
+ * combined in a single exclusive scan. In cyclic and block-cyclic
+ * one-dimensional patterns, every unit contributes one total per phase of
+ * blocks. For other patterns, totals of the local runs of consecutive
+ * elements are gathered at all units.
+ * The operation must be associative, but not necessarily commutative.
+ *
+ * Precondition: Input and output range have identical distribution and
+ * start offset, they may be identical.
+ *
+ * Semantics:
+ *
+ *     out[i] = init (+) in[0] (+) in[1] (+) ... (+) in[i]
+ *
+ * \returns  Output iterator to the element past the last element written.
+ *
+ * \see      DashExecutionPolicies
+ *
+ * \ingroup  DashAlgorithms
+ */
+template <
+  class ExecutionPolicy,
+  class GlobInputIt,
+  class GlobOutputIt,
+  class BinaryOperation,
+  class ValueType >
+dash::internal::enable_if_execution_policy<ExecutionPolicy, GlobOutputIt>
+inclusive_scan(
+  ExecutionPolicy && policy,
+  GlobInputIt        first,
+  GlobInputIt        last,
+  GlobOutputIt       d_first,
+  BinaryOperation    binary_op,
+  ValueType          init)
+{
+  return dash::internal::scan(policy, first, last, d_first, binary_op,
+                              init, true, true);
+}
+
+/**
+ * Computes the inclusive prefix reduction of the values in range
+ * \c [first, last) using \c binary_op and writes the results to the
+ * range beginning at \c d_first.
+ *
+ * Collective operation, local elements are scanned by the threads
+ * specified in the execution policy.
+ *
+ * Semantics:
+ *
+ *     out[i] = in[0] (+) in[1] (+) ... (+) in[i]
+ *
+ * \returns  Output iterator to the element past the last element written.
+ *
+ * \see      DashExecutionPolicies
+ *
+ * \ingroup  DashAlgorithms
+ */
+template <
+  class ExecutionPolicy,
+  class GlobInputIt,
+  class GlobOutputIt,
+  class BinaryOperation >
+dash::internal::enable_if_execution_policy<ExecutionPolicy, GlobOutputIt>
+inclusive_scan(
+  ExecutionPolicy && policy,
+  GlobInputIt        first,
+  GlobInputIt        last,
+  GlobOutputIt       d_first,
+  BinaryOperation    binary_op)
+{
+  typedef typename GlobOutputIt::value_type value_t;
+  return dash::internal::scan(policy, first, last, d_first, binary_op,
+                              value_t(), false, true);
+}
+
+/**
+ * Computes the inclusive prefix sum of the values in range
+ * \c [first, last) and writes the results to the range beginning at
+ * \c d_first.
+ *
+ * Collective operation, local elements are scanned by the threads
+ * specified in the execution policy.
+ *
+ * \returns  Output iterator to the element past the last element written.
+ *
+ * \see      DashExecutionPolicies
+ *
+ * \ingroup  DashAlgorithms
+ */
+template <
+  class ExecutionPolicy,
+  class GlobInputIt,
+  class GlobOutputIt >
+dash::internal::enable_if_execution_policy<ExecutionPolicy, GlobOutputIt>
+inclusive_scan(
+  ExecutionPolicy && policy,
+  GlobInputIt        first,
+  GlobInputIt        last,
+  GlobOutputIt       d_first)
+{
+  typedef typename GlobOutputIt::value_type value_t;
+  return dash::inclusive_scan(policy, first, last, d_first,
+                              dash::plus<value_t>());
+}
+
+/**
+ * Computes the inclusive prefix reduction of the values in range
+ * \c [first, last) and writes the results to the range beginning at
+ * \c d_first.
+ *
+ * Collective operation.
+ *
+ * \returns  Output iterator to the element past the last element written.
+ *
+ * \ingroup  DashAlgorithms
+ */
+template <
+  class GlobInputIt,
+  class GlobOutputIt,
+  class BinaryOperation = dash::plus<typename GlobOutputIt::value_type> >
+GlobOutputIt inclusive_scan(
+  GlobInputIt        first,
+  GlobInputIt        last,
+  GlobOutputIt       d_first,
+  BinaryOperation    binary_op = BinaryOperation())
+{
+  return dash::inclusive_scan(dash::execution::seq, first, last, d_first,
+                              binary_op);
+}
+
+/**
+ * Computes the exclusive prefix reduction of the values in range
+ * \c [first, last) using \c binary_op, starting with \c init, and writes
+ * the results to the range beginning at \c d_first.
+ *
+ * Collective operation, local elements are scanned by the threads
+ * specified in the execution policy.
+ * The operation must be associative, but not necessarily commutative.
+ *
+ * Precondition: Input and output range have identical distribution and
+ * start offset, they may be identical.
+ *
+ * Semantics:
+ *
+ *     out[0] = init
+ *     out[i] = init (+) in[0] (+) in[1] (+) ... (+) in[i-1]
+ *
+ * \returns  Output iterator to the element past the last element written.
+ *
+ * \see      dash::inclusive_scan
+ * \see      DashExecutionPolicies
+ *
+ * \ingroup  DashAlgorithms
+ */
+template <
+  class ExecutionPolicy,
+  class GlobInputIt,
+  class GlobOutputIt,
+  class ValueType,
+  class BinaryOperation = dash::plus<ValueType> >
+dash::internal::enable_if_execution_policy<ExecutionPolicy, GlobOutputIt>
+exclusive_scan(
+  ExecutionPolicy && policy,
+  GlobInputIt        first,
+  GlobInputIt        last,
+  GlobOutputIt       d_first,
+  ValueType          init,
+  BinaryOperation    binary_op = BinaryOperation())
+{
+  return dash::internal::scan(policy, first, last, d_first, binary_op,
+                              init, true, false);
+}
+
+/**
+ * Computes the exclusive prefix reduction of the values in range
+ * \c [first, last) using \c binary_op, starting with \c init, and writes
+ * the results to the range beginning at \c d_first.
+ *
+ * Collective operation.
+ *
+ * \returns  Output iterator to the element past the last element written.
+ *
+ * \ingroup  DashAlgorithms
+ */
+template <
+  class GlobInputIt,
+  class GlobOutputIt,
+  class ValueType,
+  class BinaryOperation = dash::plus<ValueType> >
+GlobOutputIt exclusive_scan(
+  GlobInputIt        first,
+  GlobInputIt        last,
+  GlobOutputIt       d_first,
+  ValueType          init,
+  BinaryOperation    binary_op = BinaryOperation())
+{
+  return dash::exclusive_scan(dash::execution::seq, first, last, d_first,
+                              init, binary_op);
+}
+
+/**
+ * Computes the partial sums of the values in range \c [first, last)
+ * using \c binary_op and writes them to the range beginning at
+ * \c d_first, equivalent to \c dash::inclusive_scan.
+ *
+ * Collective operation.
+ *
+ * \returns  Output iterator to the element past the last element written.
+ *
+ * \ingroup  DashAlgorithms
+ */
+template <
+  class GlobInputIt,
+  class GlobOutputIt,
+  class BinaryOperation = dash::plus<typename GlobOutputIt::value_type> >
+GlobOutputIt partial_sum(
+  GlobInputIt        first,
+  GlobInputIt        last,
+  GlobOutputIt       d_first,
+  BinaryOperation    binary_op = BinaryOperation())
+{
+  return dash::inclusive_scan(dash::execution::seq, first, last, d_first,
+                              binary_op);
+}
+
+} // namespace dash
+
+#endif // DASH__ALGORITHM__SCAN_H__
@@ -0,0 +1,160 @@
+#ifndef DASH__ALGORITHM__SET_OPERATIONS_H__
+#define DASH__ALGORITHM__SET_OPERATIONS_H__
+
+#include <dash/iterator/GlobIter.h>
+
+#include <dash/algorithm/internal/SortedRanges.h>
+
+#include <algorithm>
+#include <functional>
+
+
+namespace dash {
+
+/**
+ * Copies the elements found in either of the sorted ranges
+ * \c [first1, last1) and \c [first2, last2) to the range beginning at
+ * \c d_first, like \c std::set_union.
+ *
+ * Values are partitioned into key ranges by splitters sampled from both
+ * ranges and exchanged in bulk, so every unit combines only the values in
+ * its assigned key range.
+ *
+ * Precondition: Input ranges are sorted w.r.t. \c comp and have
+ * one-dimensional distribution.
+ *
+ * Collective operation.
+ *
+ * \note
+ * Operates on values. The \c dash::set_union overloads for views combine
+ * index sets instead.
+ *
+ * \returns  Iterator past the last element written.
+ *
+ * \ingroup  DashAlgorithms
+ */
+template <
+  class GlobInputIt1,
+  class GlobInputIt2,
+  class GlobOutputIt,
+  class Compare >
+GlobOutputIt set_union(
+  GlobInputIt1   first1,
+  GlobInputIt1   last1,
+  GlobInputIt2   first2,
+  GlobInputIt2   last2,
+  GlobOutputIt   d_first,
+  Compare        comp)
+{
+  typedef typename GlobInputIt1::value_type value_t;
+  typedef typename std::vector<value_t>::iterator l_iter_t;
+  typedef std::back_insert_iterator<std::vector<value_t>> l_out_t;
+
+  DASH_LOG_DEBUG("dash::set_union()");
+  return dash::internal::sorted_combine(
+           first1, last1, first2, last2, d_first, comp,
+           [&](l_iter_t a_first, l_iter_t a_last,
+               l_iter_t b_first, l_iter_t b_last,
+               l_out_t  out) {
+             std::set_union(a_first, a_last, b_first, b_last, out, comp);
+           });
+}
+
+/**
+ * Copies the elements found in either of the sorted ranges
+ * \c [first1, last1) and \c [first2, last2) to the range beginning at
+ * \c d_first.
+ *
+ * Collective operation.
+ *
+ * \ingroup  DashAlgorithms
+ */
+template <
+  class GlobInputIt1,
+  class GlobInputIt2,
+  class GlobOutputIt >
+GlobOutputIt set_union(
+  GlobInputIt1   first1,
+  GlobInputIt1   last1,
+  GlobInputIt2   first2,
+  GlobInputIt2   last2,
+  GlobOutputIt   d_first)
+{
+  return dash::set_union(first1, last1, first2, last2, d_first,
+                         std::less<typename GlobInputIt1::value_type>());
+}
+
+/**
+ * Copies the elements found in both of the sorted ranges
+ * \c [first1, last1) and \c [first2, last2) to the range beginning at
+ * \c d_first, like \c std::set_intersection.
+ *
+ * Values are partitioned into key ranges by splitters sampled from both
+ * ranges and exchanged in bulk, so every unit intersects only the values
+ * in its assigned key range.
+ *
+ * Precondition: Input ranges are sorted w.r.t. \c comp and have
+ * one-dimensional distribution.
+ *
+ * Collective operation.
+ *
+ * \returns  Iterator past the last element written.
+ *
+ * \ingroup  DashAlgorithms
+ */
+template <
+  class GlobInputIt1,
+  class GlobInputIt2,
+  class GlobOutputIt,
+  class Compare >
+GlobOutputIt set_intersection(
+  GlobInputIt1   first1,
+  GlobInputIt1   last1,
+  GlobInputIt2   first2,
+  GlobInputIt2   last2,
+  GlobOutputIt   d_first,
+  Compare        comp)
+{
+  typedef typename GlobInputIt1::value_type value_t;
+  typedef typename std::vector<value_t>::iterator l_iter_t;
+  typedef std::back_insert_iterator<std::vector<value_t>> l_out_t;
+
+  DASH_LOG_DEBUG("dash::set_intersection()");
+  return dash::internal::sorted_combine(
+           first1, last1, first2, last2, d_first, comp,
+           [&](l_iter_t a_first, l_iter_t a_last,
+               l_iter_t b_first, l_iter_t b_last,
+               l_out_t  out) {
+             std::set_intersection(a_first, a_last, b_first, b_last, out,
+                                   comp);
+           });
+}
+
+/**
+ * Copies the elements found in both of the sorted ranges
+ * \c [first1, last1) and \c [first2, last2) to the range beginning at
+ * \c d_first.
+ *
+ * Collective operation.
+ *
+ * \ingroup  DashAlgorithms
+ */
+template <
+  class GlobInputIt1,
+  class GlobInputIt2,
+  class GlobOutputIt >
+GlobOutputIt set_intersection(
+  GlobInputIt1   first1,
+  GlobInputIt1   last1,
+  GlobInputIt2   first2,
+  GlobInputIt2   last2,
+  GlobOutputIt   d_first)
+{
+  return dash::set_intersection(
+           first1, last1, first2, last2, d_first,
+           std::less<typename GlobInputIt1::value_type>());
+}
+
+} // namespace dash
+
+#endif // DASH__ALGORITHM__SET_OPERATIONS_H__
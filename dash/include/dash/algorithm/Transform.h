@@ -3,10 +3,15 @@
 
 #include <dash/GlobRef.h>
 #include <dash/GlobAsyncRef.h>
+#include <dash/ExecutionPolicy.h>
 
 #include <dash/algorithm/LocalRange.h>
 #include <dash/algorithm/Operation.h>
 #include <dash/algorithm/Accumulate.h>
+#include <dash/algorithm/Scan.h>
+#include <dash/algorithm/WorkStealing.h>
+#include <dash/algorithm/internal/GlobSegments.h>
+#include <dash/algorithm/internal/ParallelFor.h>
 
 #include <dash/iterator/GlobIter.h>
 
@@ -14,39 +19,143 @@
 
 #include <dash/dart/if/dart_communication.h>
 
+#include <algorithm>
+#include <cstdint>
 #include <iterator>
-
-#ifdef DASH_ENABLE_OPENMP
-#include <omp.h>
-#endif
+#include <map>
+#include <vector>
 
 namespace dash {
 
 namespace internal {
 
 /**
- * Wrapper of the blocking DART accumulate operation.
+ * Collects values to be accumulated to global output ranges and sends
+ * them in a single accumulate operation per target unit.
+ * Output ranges are split into segments that are contiguous in the local
+ * memory of a single unit, values of all segments at a unit are packed
+ * in a buffer and accumulated to the segments as indexed blocks.
+ * Completion of the operations is deferred, they are completed by a
+ * subsequent flush of the output range's global memory which must
+ * precede destruction of the accumulator.
  */
 template< typename ValueType >
-inline dart_ret_t transform_blocking_impl(
-  dart_gptr_t        dest,
-  ValueType        * values,
-  size_t             nvalues,
-  dart_operation_t   op,
-  dart_team_t        team)
-{
+class transform_accumulator {
   static_assert(dash::dart_datatype<ValueType>::value != DART_TYPE_UNDEFINED,
       "Cannot accumulate unknown type!");
 
-  dart_ret_t result = dart_accumulate(
-                        dest,
-                        reinterpret_cast<void *>(values),
-                        nvalues,
-                        dash::dart_datatype<ValueType>::value,
-                        op,
-                        team);
-  dart_flush(dest);
-  return result;
+  struct target_t {
+    /// Global pointer to the first segment at the unit
+    dart_gptr_t            gptr;
+    /// Offsets of the segments in the unit's memory, in bytes
+    std::vector<uint64_t>  offsets;
+    std::vector<size_t>    blocklens;
+    std::vector<ValueType> values;
+  };
+
+public:
+  /**
+   * Adds the values in local range \c [values, values + nvalues) to be
+   * accumulated to the global range beginning at \c out_first.
+   */
+  template<
+    typename IndexType,
+    class GlobOutputIt >
+  void add(
+    const ValueType  * values,
+    IndexType          nvalues,
+    GlobOutputIt       out_first)
+  {
+    dash::internal::for_each_glob_segment(
+      out_first, nvalues,
+      [&](dart_gptr_t seg_gptr, IndexType offset, IndexType n_seg) {
+        target_t & target = _targets[seg_gptr.unitid];
+        if (target.offsets.empty()) {
+          target.gptr = seg_gptr;
+        }
+        target.offsets.push_back(seg_gptr.addr_or_offs.offset);
+        target.blocklens.push_back(n_seg);
+        target.values.insert(target.values.end(),
+                             values + offset, values + offset + n_seg);
+      });
+  }
+
+  /**
+   * Starts the accumulate operations of all values added.
+   */
+  void accumulate(
+    dart_operation_t   op,
+    dart_team_t        team)
+  {
+    for (auto & unit_target : _targets) {
+      target_t & target = unit_target.second;
+      DASH_LOG_TRACE("dash::internal::transform_accumulator",
+                     "unit:", unit_target.first,
+                     "segments:", target.offsets.size(),
+                     "values:", target.values.size());
+      if (target.offsets.size() == 1) {
+        DASH_ASSERT_RETURNS(
+          dart_accumulate(
+            target.gptr,
+            target.values.data(),
+            target.values.size(),
+            dash::dart_datatype<ValueType>::value,
+            op,
+            team),
+          DART_OK);
+        continue;
+      }
+      // Block displacements are relative to the segment with the lowest
+      // offset:
+      uint64_t base = *std::min_element(target.offsets.begin(),
+                                        target.offsets.end());
+      std::vector<size_t> displs;
+      displs.reserve(target.offsets.size());
+      for (uint64_t offset : target.offsets) {
+        displs.push_back((offset - base) / sizeof(ValueType));
+      }
+      dart_gptr_t gptr = target.gptr;
+      gptr.addr_or_offs.offset = base;
+      DASH_ASSERT_RETURNS(
+        dart_accumulate_indexed(
+          gptr,
+          target.values.data(),
+          target.blocklens.size(),
+          target.blocklens.data(),
+          displs.data(),
+          dash::dart_datatype<ValueType>::value,
+          op,
+          team),
+        DART_OK);
+    }
+  }
+
+private:
+  std::map<dart_unit_t, target_t> _targets;
+};
+
+/**
+ * Whether two ranges with identical start offset are distributed by the
+ * same pattern, so that corresponding elements are local to the same unit
+ * at identical local offsets.
+ */
+template<
+  class PatternA,
+  class PatternB >
+bool transform_patterns_equal(
+  const PatternA &,
+  const PatternB &)
+{
+  return false;
+}
+
+template<
+  class PatternType >
+bool transform_patterns_equal(
+  const PatternType & pattern_a,
+  const PatternType & pattern_b)
+{
+  return pattern_a == pattern_b;
 }
 
 /**
@@ -116,11 +225,16 @@ OutputIt transform(
  *
  * Corresponding to \c MPI_Accumulate, the binary operation is executed
  * atomically on single elements.
+ * Values are sent in one accumulate operation for every segment of the
+ * output range that is contiguous in the local memory of a unit, all
+ * operations are completed by a single flush.
  *
- * Precondition: All elements in the input range are contained in a single
- * block so that
- *
- *   g_out_last == g_out_first + (l_in_last - l_in_first)
+ * If input and output ranges are global ranges with identical
+ * distribution and start offset, all elements are transformed in local
+ * memory of their owning unit without communication. As every unit then
+ * only writes its local elements, accesses are not atomic w.r.t. other
+ * concurrent operations on the output range, like in
+ * \c dash::transform_local.
  *
  * Semantics:
  *
@@ -187,20 +301,30 @@ GlobOutputIt transform(
  *              =    =    =    ...
  *   output:  [ u0 | u1 | u2 | ... ]
  * </pre>
+ *
+ * Local elements are transformed by the threads specified in the
+ * execution policy.
+ *
+ * \see  DashExecutionPolicies
  */
 template<
   typename ValueType,
+  class ExecutionPolicy,
   class InputAIt,
   class InputBIt,
   class OutputIt,
   class BinaryOperation >
-OutputIt transform_local(
-  InputAIt        in_a_first,
-  InputAIt        in_a_last,
-  InputBIt        in_b_first,
-  OutputIt        out_first,
-  BinaryOperation binary_op)
+dash::internal::enable_if_execution_policy<ExecutionPolicy, OutputIt>
+transform_local(
+  ExecutionPolicy && policy,
+  InputAIt           in_a_first,
+  InputAIt           in_a_last,
+  InputBIt           in_b_first,
+  OutputIt           out_first,
+  BinaryOperation    binary_op)
 {
+  typedef typename InputAIt::index_type index_t;
+
   DASH_LOG_DEBUG("dash::transform_local()");
   DASH_ASSERT_MSG(in_a_first.pattern() == in_b_first.pattern(),
                   "dash::transform_local: "
@@ -224,37 +348,53 @@ OutputIt transform_local(
   auto num_gvalues       = dash::distance(in_a_first, in_b_first);
   DASH_LOG_TRACE_VAR("dash::transform_local", num_gvalues);
   // Number of local elements:
-  DASH_LOG_TRACE("dash::transform_local", "local elements:", lend_a-lbegin_a);
+  index_t l_size         = lend_a - lbegin_a;
+  DASH_LOG_TRACE("dash::transform_local", "local elements:", l_size);
   // Local subrange of input range b:
   ValueType * lbegin_b   = (in_b_first + g_offset_first).local();
   // Local pointer of initial output element:
   ValueType * lbegin_out = (out_first  + g_offset_first).local();
   // Generate output values:
-#ifdef DASH_ENABLE_OPENMP
-  dash::util::UnitLocality uloc;
-  auto n_threads = uloc.num_domain_threads();
-  DASH_LOG_DEBUG("dash::transform_local", "thread capacity:",  n_threads);
-  if (n_threads > 1) {
-    auto l_size = lend_a - lbegin_a;
-    // TODO: Vectorize.
-    // Documentation of Intel MIC intrinsics, see:
-    // https://software.intel.com/de-de/node/523533
-    // https://software.intel.com/de-de/node/523387
-    #pragma omp parallel for num_threads(n_threads) schedule(static)
-    for (int i = 0; i < l_size; i++) {
-      lbegin_out[i] = binary_op(lbegin_a[i], lbegin_b[i]);
-    }
-    return out_first + num_gvalues;
-  }
-#endif
-  // No OpenMP or insufficient number of threads for parallelization:
-  for (; lbegin_a != lend_a; ++lbegin_a, ++lbegin_b, ++lbegin_out) {
-    *lbegin_out = binary_op(*lbegin_a, *lbegin_b);
-  }
+  dash::internal::parallel_for(
+    policy, l_size, sizeof(ValueType),
+    [&](int, index_t c_begin, index_t c_end) {
+      std::transform(lbegin_a + c_begin, lbegin_a + c_end,
+                     lbegin_b + c_begin,
+                     lbegin_out + c_begin,
+                     binary_op);
+    });
   // Return out_end iterator past final transformed element;
   return out_first + num_gvalues;
 }
 
+/**
+ * Transform operation on ranges with identical distribution and start
+ * offset, executed sequentially by the calling unit.
+ *
+ * \see  dash::transform_local
+ */
+template<
+  typename ValueType,
+  class InputAIt,
+  class InputBIt,
+  class OutputIt,
+  class BinaryOperation >
+OutputIt transform_local(
+  InputAIt        in_a_first,
+  InputAIt        in_a_last,
+  InputBIt        in_b_first,
+  OutputIt        out_first,
+  BinaryOperation binary_op)
+{
+  return dash::transform_local<ValueType>(
+           dash::seq,
+           in_a_first,
+           in_a_last,
+           in_b_first,
+           out_first,
+           binary_op);
+}
+
 /**
  * Local lhs input ranges on global output range.
  *
@@ -299,32 +439,18 @@ GlobOutputIt transform(
   // Resolve local range from global range:
   // Number of elements in local range:
   size_t num_local_elements     = std::distance(in_first, in_last);
-  // Global iterator to dart_gptr_t:
-  dart_gptr_t dest_gptr         = out_first.dart_gptr();
-  // Send accumulate message:
+  // Send accumulate messages to all units owning elements in the output
+  // range and complete them in a single flush:
   trace.enter_state("transform_blocking");
-  dash::internal::transform_blocking_impl(
-      dest_gptr,
-      in_first,
-      num_local_elements,
-      binary_op.dart_operation(),
-      team.dart_id());
+  dash::internal::transform_accumulator<ValueType> accumulator;
+  accumulator.add(in_first, num_local_elements, out_first);
+  accumulator.accumulate(binary_op.dart_operation(), team.dart_id());
+  DASH_ASSERT_RETURNS(
+    dart_flush_all(out_first.dart_gptr()),
+    DART_OK);
   trace.exit_state("transform_blocking");
-  // The position past the last element transformed in global element space
-  // cannot be resolved from the size of the local range if the local range
-  // spans over more than one block. Otherwise, the difference of two global
-  // iterators is not well-defined. The corresponding invariant is:
-  //   g_out_last == g_out_first + (l_in_last - l_in_first)
-  // Example:
-  //   unit:            0       1       0
-  //   local offset:  | 0 1 2 | 0 1 2 | 3 4 5 | ...
-  //   global offset: | 0 1 2   3 4 5   6 7 8   ...
-  //   range:          [- - -           - -]
-  // When iterating in local memory range [0,5[ of unit 0, the position of the
-  // global iterator to return is 8 != 5
-  // For ranges over block borders, we would have to resolve the global
-  // position past the last element transformed from the iterator's pattern
-  // (see dash::PatternIterator).
+  // The local input range is accumulated to consecutive elements in
+  // global element space, possibly spanning over several blocks:
   return out_first + num_local_elements;
 }
 
@@ -345,52 +471,15 @@ GlobOutputIt transform(
   BinaryOperation                  binary_op = dash::plus<ValueType>())
 {
   DASH_LOG_DEBUG("dash::transform(gaf, gal, gbf, goutf, binop)");
-  auto in_first = in_a_first;
-  auto in_last  = in_a_last;
-
-  if (in_b_first == out_first) {
-    // Output range is rhs input range: C += A
-    // Input is (in_a_first, in_a_last).
-  } else {
-    DASH_THROW(
-      dash::exception::NotImplemented,
-      "dash::transform is only implemented for out = op(in,out)");
-    // Output range different from rhs input range: C = A+B
-    // Input is (in_a_first, in_a_last) + (in_b_first, in_b_last):
-
-    // TODO:
-    // in_range.allocate(...);
-    // in_first = in_range.begin();
-    // in_last  = in_range.end();
-  }
+  typedef typename PatternType::index_type index_t;
 
   dash::util::Trace trace("transform");
 
   // Pattern of input ranges a and b, and output range:
-  auto pattern_in_a = in_a_first.pattern();
-  auto pattern_in_b = in_b_first.pattern();
-  auto pattern_out  = out_first.pattern();
-
-#if __NON_ATOMIC__
-  // Fast path: check if transform operation is local-only:
-  if (pattern_in_a == pattern_in_b &&
-      pattern_in_a == pattern_out) {
-    // Identical pattern in all ranges
-    if (in_a_first.pos() == in_b_first.pos() &&
-        in_a_first.pos() == out_first.pos()) {
-      trace.enter_state("local");
-      // All units operate on local ranges that have identical distribution:
-      auto out_last = dash::transform_local<ValueType>(
-                        in_a_first,
-                        in_a_last,
-                        in_b_first,
-                        out_first,
-                        binary_op);
-      trace.exit_state("local");
-      return out_last;
-    }
-  }
-#endif
+  const auto & pattern_in_a = in_a_first.pattern();
+  const auto & pattern_in_b = in_b_first.pattern();
+  const auto & pattern_out  = out_first.pattern();
+
   // Resolve teams from global iterators:
   dash::Team & team_in_a        = pattern_in_a.team();
   DASH_ASSERT_MSG(
@@ -399,33 +488,212 @@ GlobOutputIt transform(
   DASH_ASSERT_MSG(
     team_in_a == pattern_out.team(),
     "dash::transform: Different teams in input- and output ranges");
+
+  // Fast path: all units transform elements in their local memory if
+  // ranges have identical distribution and start offset:
+  bool local_a_out = in_a_first.pos() == out_first.pos() &&
+                     dash::internal::transform_patterns_equal(
+                       pattern_in_a, pattern_out);
+  bool local_b_out = in_b_first == out_first ||
+                     (in_b_first.pos() == out_first.pos() &&
+                      dash::internal::transform_patterns_equal(
+                        pattern_in_b, pattern_out));
+  if (local_a_out && local_b_out) {
+    trace.enter_state("local");
+    auto out_last = out_first + dash::distance(in_a_first, in_a_last);
+    auto in_b_last = in_b_first + dash::distance(in_a_first, in_a_last);
+    auto l_range_a   = dash::local_range(in_a_first, in_a_last);
+    auto l_range_b   = dash::local_range(in_b_first, in_b_last);
+    auto l_range_out = dash::local_range(out_first,  out_last);
+    const ValueType * l_a   = l_range_a.begin;
+    const ValueType * l_b   = l_range_b.begin;
+    ValueType       * l_out = l_range_out.begin;
+    index_t           l_size = l_range_a.end - l_range_a.begin;
+    DASH_LOG_TRACE("dash::transform", "local elements:", l_size);
+    // Reduce operations are commutative, so the output value is the
+    // accumulate operation's target operand:
+    for (index_t i = 0; i < l_size; ++i) {
+      l_out[i] = binary_op(l_b[i], l_a[i]);
+    }
+    trace.exit_state("local");
+    return out_last;
+  }
+
+  if (!(in_b_first == out_first)) {
+    DASH_THROW(
+      dash::exception::NotImplemented,
+      "dash::transform is only implemented for out = op(in,out) "
+      "or ranges with identical distribution");
+  }
+
   // Resolve local range from global range:
   auto l_index_range_in_a       = local_index_range(in_a_first, in_a_last);
   DASH_LOG_TRACE_VAR("dash::transform", l_index_range_in_a.begin);
   DASH_LOG_TRACE_VAR("dash::transform", l_index_range_in_a.end);
-  // Local range to global offset:
-  auto global_offset            = pattern_in_a.global(
-                                    l_index_range_in_a.begin);
-  DASH_LOG_TRACE_VAR("dash::transform", global_offset);
-  // Number of elements in local range:
-  size_t num_local_elements     = l_index_range_in_a.end -
-                                  l_index_range_in_a.begin;
-  DASH_LOG_TRACE_VAR("dash::transform", num_local_elements);
-  // Global iterator to dart_gptr_t:
-  dart_gptr_t dest_gptr         = (out_first + global_offset).dart_gptr();
-  // Native pointer to local sub-range:
-  ValueType * l_values          = (in_a_first + global_offset).local();
-  // Send accumulate message:
+  // Native pointer to first element in local memory:
+  const ValueType * l_values    = in_a_first.globmem().lbegin();
+  // Local elements with consecutive global indices are accumulated to
+  // consecutive elements in the output range:
+  auto runs = dash::internal::scan_runs(
+                pattern_in_a,
+                static_cast<index_t>(l_index_range_in_a.begin),
+                static_cast<index_t>(l_index_range_in_a.end));
+  DASH_LOG_TRACE("dash::transform", "local runs:", runs.size());
+  // Send a single accumulate message to every unit owning elements in the
+  // output range and complete them in a single flush:
   trace.enter_state("transform_blocking");
-  dash::internal::transform_blocking_impl(
-      dest_gptr,
-      l_values,
-      num_local_elements,
-      binary_op.dart_operation(),
-      team_in_a.dart_id());
+  dash::internal::transform_accumulator<ValueType> accumulator;
+  for (const auto & run : runs) {
+    accumulator.add(
+      l_values + run.l_begin,
+      run.l_end - run.l_begin,
+      out_first + (run.g_begin - in_a_first.pos()));
+  }
+  accumulator.accumulate(binary_op.dart_operation(), team_in_a.dart_id());
+  DASH_ASSERT_RETURNS(
+    dart_flush_all(out_first.dart_gptr()),
+    DART_OK);
   trace.exit_state("transform_blocking");
 
-  return out_first + global_offset + num_local_elements;
+  return out_first + dash::distance(in_a_first, in_a_last);
+}
+
+/**
+ * Transform operation on ranges with identical distribution and start
+ * offset, local elements are transformed by the threads specified in the
+ * execution policy.
+ * Collective operation.
+ *
+ * \note
+ * As \c dash::transform_local, this function does not execute the
+ * transformation as atomic operation on elements.
+ *
+ * \see  DashExecutionPolicies
+ *
+ * \ingroup  DashAlgorithms
+ */
+template<
+  typename ValueType,
+  class ExecutionPolicy,
+  class PatternType,
+  class BinaryOperation >
+dash::internal::enable_if_execution_policy<
+  ExecutionPolicy, GlobIter<ValueType, PatternType> >
+transform(
+  /// Execution policy of the local phase
+  ExecutionPolicy                 && policy,
+  GlobIter<ValueType, PatternType>   in_a_first,
+  GlobIter<ValueType, PatternType>   in_a_last,
+  GlobIter<ValueType, PatternType>   in_b_first,
+  GlobIter<ValueType, PatternType>   out_first,
+  BinaryOperation                    binary_op)
+{
+  DASH_LOG_DEBUG("dash::transform(policy, gaf, gal, gbf, goutf, binop)");
+  DASH_ASSERT_MSG(in_a_first.pos() == in_b_first.pos() &&
+                  in_a_first.pos() == out_first.pos(),
+                  "dash::transform: "
+                  "offsets of input- and output ranges differ");
+  dash::util::Trace trace("transform");
+  trace.enter_state("local");
+  dash::transform_local<ValueType>(
+    policy,
+    in_a_first,
+    in_a_last,
+    in_b_first,
+    out_first,
+    binary_op);
+  trace.exit_state("local");
+  trace.enter_state("barrier");
+  in_a_first.pattern().team().barrier();
+  trace.exit_state("barrier");
+  return out_first + dash::distance(in_a_first, in_a_last);
+}
+
+/**
+ * Transform operation on ranges with identical distribution and start
+ * offset with dynamic load balancing.
+ * Units that finished transforming their local elements steal chunks of
+ * elements from other units. Input values of stolen chunks are fetched
+ * from their owner unit and the results are written back to the owner's
+ * output range.
+ *
+ * \note
+ * As \c dash::transform_local, this function does not execute the
+ * transformation as atomic operation on elements.
+ *
+ * \see  dash::WorkStealing
+ *
+ * \ingroup  DashAlgorithms
+ */
+template<
+  typename ValueType,
+  class PatternType,
+  class BinaryOperation >
+GlobIter<ValueType, PatternType> transform(
+  /// Execution policy, created collectively by the units in the team
+  dash::WorkStealing               & policy,
+  GlobIter<ValueType, PatternType>   in_a_first,
+  GlobIter<ValueType, PatternType>   in_a_last,
+  GlobIter<ValueType, PatternType>   in_b_first,
+  GlobIter<ValueType, PatternType>   out_first,
+  BinaryOperation                    binary_op)
+{
+  typedef typename dash::WorkStealing::index_type index_t;
+
+  DASH_LOG_DEBUG("dash::transform(policy, gaf, gal, gbf, goutf, binop)");
+  DASH_ASSERT_MSG(in_a_first.pattern() == in_b_first.pattern(),
+                  "dash::transform: "
+                  "distributions of input ranges differ");
+  DASH_ASSERT_MSG(in_a_first.pattern() == out_first.pattern(),
+                  "dash::transform: "
+                  "distributions of input- and output ranges differ");
+  DASH_ASSERT_MSG(in_a_first.pos() == in_b_first.pos() &&
+                  in_a_first.pos() == out_first.pos(),
+                  "dash::transform: "
+                  "offsets of input- and output ranges differ");
+  auto   myid    = policy.team().myid();
+  auto & pattern = in_a_first.pattern();
+  std::vector<ValueType> chunk_a;
+  std::vector<ValueType> chunk_b;
+  policy.run(in_a_first, in_a_last,
+    [&](team_unit_t unit, index_t lbegin, index_t lend) {
+      auto nelem   = lend - lbegin;
+      auto g_delta = pattern.global(lbegin) - in_a_first.pos();
+      if (unit == myid) {
+        // Local range to native pointers:
+        ValueType * l_a   = (in_a_first + g_delta).local();
+        ValueType * l_b   = (in_b_first + g_delta).local();
+        ValueType * l_out = (out_first  + g_delta).local();
+        for (index_t i = 0; i < nelem; ++i) {
+          l_out[i] = binary_op(l_a[i], l_b[i]);
+        }
+        return;
+      }
+      // Stolen chunk, elements are contiguous in the owner's local
+      // memory:
+      dart_storage_t ds     = dash::dart_storage<ValueType>(nelem);
+      dart_gptr_t    gptr_a = in_a_first.globmem().at(unit, lbegin)
+                                                  .dart_gptr();
+      dart_gptr_t    gptr_b = in_b_first.globmem().at(unit, lbegin)
+                                                  .dart_gptr();
+      dart_gptr_t    gptr_o = out_first.globmem().at(unit, lbegin)
+                                                 .dart_gptr();
+      chunk_a.resize(nelem);
+      chunk_b.resize(nelem);
+      DASH_ASSERT_RETURNS(
+        dart_get_blocking(chunk_a.data(), gptr_a, ds.nelem, ds.dtype),
+        DART_OK);
+      DASH_ASSERT_RETURNS(
+        dart_get_blocking(chunk_b.data(), gptr_b, ds.nelem, ds.dtype),
+        DART_OK);
+      for (index_t i = 0; i < nelem; ++i) {
+        chunk_a[i] = binary_op(chunk_a[i], chunk_b[i]);
+      }
+      DASH_ASSERT_RETURNS(
+        dart_put_blocking(gptr_o, chunk_a.data(), ds.nelem, ds.dtype),
+        DART_OK);
+    });
+  return out_first + dash::distance(in_a_first, in_a_last);
 }
 
 /**
@@ -0,0 +1,268 @@
+#ifndef DASH__ALGORITHM__TRANSFORM_REDUCE_H__
+#define DASH__ALGORITHM__TRANSFORM_REDUCE_H__
+
+#include <dash/ExecutionPolicy.h>
+#include <dash/iterator/GlobIter.h>
+
+#include <dash/algorithm/LocalRange.h>
+#include <dash/algorithm/Operation.h>
+#include <dash/algorithm/internal/ParallelFor.h>
+
+#include <dash/dart/if/dart_communication.h>
+
+#include <vector>
+
+
+namespace dash {
+
+namespace internal {
+
+/**
+ * Combines the partial results of the local transform-reduce phase of
+ * all units in a single reduction.
+ */
+template <
+  class ValueType,
+  class BinaryReduceOp,
+  class IndexType,
+  class TeamType,
+  class TransformChunkFunc >
+ValueType transform_reduce_combine(
+  int                  n_chunks,
+  IndexType            l_size,
+  TeamType           & team,
+  ValueType            init,
+  BinaryReduceOp       reduce_op,
+  TransformChunkFunc   chunk_func)
+{
+  typedef dash::internal::ReducePartial<ValueType>        partial_t;
+  typedef dash::internal::ReducePartialOperation<
+            ValueType, BinaryReduceOp>                    partial_op_t;
+
+  std::vector<partial_t> chunk_results(n_chunks, partial_t { init, false });
+  chunk_func(chunk_results);
+
+  partial_op_t partial_op { reduce_op };
+  partial_t    l_result   { init, false };
+  for (const auto & cr : chunk_results) {
+    l_result = partial_op(l_result, cr);
+  }
+  DASH_LOG_TRACE("dash::transform_reduce", "local elements:", l_size,
+                 "local result valid:", l_result.valid);
+
+  partial_t g_result { init, false };
+  dash::DartReduceOperation<partial_t, partial_op_t> dart_op(partial_op);
+  DASH_ASSERT_RETURNS(
+    dart_allreduce(
+      &l_result,
+      &g_result,
+      1,
+      dart_op.dart_type(),
+      dart_op.dart_operation(),
+      team.dart_id()),
+    DART_OK);
+
+  return g_result.valid ? reduce_op(init, g_result.value) : init;
+}
+
+} // namespace internal
+
+/**
+ * Transforms the values in range \c [first, last) using \c transform_op
+ * and reduces the results using \c reduce_op in a single pass over the
+ * local elements, without storing transformed values.
+ *
+ * Collective operation, local elements are transformed and reduced by
+ * the threads specified in the execution policy. Partial results of all
+ * units are combined in a single reduction.
+ * The reduce function must be associative, the result is returned at
+ * all units.
+ *
+ * Semantics:
+ *
+ *     acc = init (+) t(in[0]) (+) t(in[1]) (+) ... (+) t(in[n])
+ *
+ * \see      dash::accumulate
+ * \see      DashExecutionPolicies
+ *
+ * \ingroup  DashAlgorithms
+ */
+template <
+  class ExecutionPolicy,
+  class GlobInputIt,
+  class ValueType,
+  class BinaryReduceOp,
+  class UnaryTransformOp >
+dash::internal::enable_if_execution_policy<ExecutionPolicy, ValueType>
+transform_reduce(
+  ExecutionPolicy  && policy,
+  GlobInputIt         first,
+  GlobInputIt         last,
+  ValueType           init,
+  BinaryReduceOp      reduce_op,
+  UnaryTransformOp    transform_op)
+{
+  typedef typename GlobInputIt::index_type          index_t;
+  typedef dash::internal::ReducePartial<ValueType>  partial_t;
+
+  auto    index_range = dash::local_range(first, last);
+  auto    l_first     = index_range.begin;
+  index_t l_size      = index_range.end - index_range.begin;
+  int     n_chunks    = dash::internal::num_parallel_chunks(
+                          policy, l_size, sizeof(*l_first));
+
+  return dash::internal::transform_reduce_combine(
+           n_chunks, l_size, first.team(), init, reduce_op,
+           [&](std::vector<partial_t> & chunk_results) {
+             dash::internal::parallel_for(
+               policy, l_size, sizeof(*l_first),
+               [&](int c, index_t c_begin, index_t c_end) {
+                 if (c_begin < c_end) {
+                   ValueType acc = transform_op(l_first[c_begin]);
+                   for (index_t i = c_begin + 1; i < c_end; ++i) {
+                     acc = reduce_op(acc, transform_op(l_first[i]));
+                   }
+                   chunk_results[c].value = acc;
+                   chunk_results[c].valid = true;
+                 }
+               });
+           });
+}
+
+/**
+ * Transforms pairs of values in ranges \c [first1, last1) and
+ * \c [first2, first2 + (last1 - first1)) using \c transform_op and
+ * reduces the results using \c reduce_op in a single pass over the
+ * local elements, like an inner product.
+ *
+ * Collective operation, local elements are transformed and reduced by
+ * the threads specified in the execution policy. Partial results of all
+ * units are combined in a single reduction.
+ *
+ * Precondition: Both ranges have identical distribution and start
+ * offset, so corresponding elements are local to the same unit.
+ *
+ * Semantics:
+ *
+ *     acc = init (+) t(a[0], b[0]) (+) ... (+) t(a[n], b[n])
+ *
+ * \see      DashExecutionPolicies
+ *
+ * \ingroup  DashAlgorithms
+ */
+template <
+  class ExecutionPolicy,
+  class GlobInputIt1,
+  class GlobInputIt2,
+  class ValueType,
+  class BinaryReduceOp,
+  class BinaryTransformOp >
+dash::internal::enable_if_execution_policy<ExecutionPolicy, ValueType>
+transform_reduce(
+  ExecutionPolicy  && policy,
+  GlobInputIt1        first1,
+  GlobInputIt1        last1,
+  GlobInputIt2        first2,
+  ValueType           init,
+  BinaryReduceOp      reduce_op,
+  BinaryTransformOp   transform_op)
+{
+  typedef typename GlobInputIt1::index_type         index_t;
+  typedef dash::internal::ReducePartial<ValueType>  partial_t;
+
+  DASH_ASSERT_MSG(first1.pattern() == first2.pattern(),
+                  "dash::transform_reduce: "
+                  "distributions of input ranges differ");
+  auto    index_range_a = dash::local_range(first1, last1);
+  auto    index_range_b = dash::local_range(first2,
+                                            first2 + (last1 - first1));
+  auto    l_first_a     = index_range_a.begin;
+  auto    l_first_b     = index_range_b.begin;
+  index_t l_size        = index_range_a.end - index_range_a.begin;
+  DASH_ASSERT_MSG(l_size == index_range_b.end - index_range_b.begin,
+                  "dash::transform_reduce: "
+                  "start offsets of input ranges differ");
+  int     n_chunks      = dash::internal::num_parallel_chunks(
+                            policy, l_size, sizeof(*l_first_a));
+
+  return dash::internal::transform_reduce_combine(
+           n_chunks, l_size, first1.team(), init, reduce_op,
+           [&](std::vector<partial_t> & chunk_results) {
+             dash::internal::parallel_for(
+               policy, l_size, sizeof(*l_first_a),
+               [&](int c, index_t c_begin, index_t c_end) {
+                 if (c_begin < c_end) {
+                   ValueType acc = transform_op(l_first_a[c_begin],
+                                                l_first_b[c_begin]);
+                   for (index_t i = c_begin + 1; i < c_end; ++i) {
+                     acc = reduce_op(acc, transform_op(l_first_a[i],
+                                                       l_first_b[i]));
+                   }
+                   chunk_results[c].value = acc;
+                   chunk_results[c].valid = true;
+                 }
+               });
+           });
+}
+
+/**
+ * Transforms the values in range \c [first, last) using \c transform_op
+ * and reduces the results using \c reduce_op in a single pass over the
+ * local elements.
+ *
+ * Collective operation, the result is returned at all units.
+ *
+ * \see      dash::accumulate
+ *
+ * \ingroup  DashAlgorithms
+ */
+template <
+  class GlobInputIt,
+  class ValueType,
+  class BinaryReduceOp,
+  class UnaryTransformOp >
+ValueType transform_reduce(
+  GlobInputIt         first,
+  GlobInputIt         last,
+  ValueType           init,
+  BinaryReduceOp      reduce_op,
+  UnaryTransformOp    transform_op)
+{
+  return dash::transform_reduce(dash::execution::seq, first, last, init,
+                                reduce_op, transform_op);
+}
+
+/**
+ * Transforms pairs of values in ranges \c [first1, last1) and
+ * \c [first2, first2 + (last1 - first1)) using \c transform_op and
+ * reduces the results using \c reduce_op in a single pass over the
+ * local elements.
+ *
+ * Collective operation, the result is returned at all units.
+ *
+ * Precondition: Both ranges have identical distribution and start
+ * offset.
+ *
+ * \ingroup  DashAlgorithms
+ */
+template <
+  class GlobInputIt1,
+  class GlobInputIt2,
+  class ValueType,
+  class BinaryReduceOp,
+  class BinaryTransformOp >
+ValueType transform_reduce(
+  GlobInputIt1        first1,
+  GlobInputIt1        last1,
+  GlobInputIt2        first2,
+  ValueType           init,
+  BinaryReduceOp      reduce_op,
+  BinaryTransformOp   transform_op)
+{
+  return dash::transform_reduce(dash::execution::seq, first1, last1, first2,
+                                init, reduce_op, transform_op);
+}
+
+} // namespace dash
+
+#endif // DASH__ALGORITHM__TRANSFORM_REDUCE_H__
@@ -0,0 +1,94 @@
+#ifndef DASH__ALGORITHM__UNIQUE_H__
+#define DASH__ALGORITHM__UNIQUE_H__
+
+#include <dash/iterator/GlobIter.h>
+
+#include <dash/algorithm/internal/SortedRanges.h>
+
+#include <algorithm>
+#include <functional>
+#include <vector>
+
+
+namespace dash {
+
+/**
+ * Removes all but the first element of every group of equivalent
+ * elements w.r.t. \c comp from the sorted range \c [first, last).
+ *
+ * Every unit removes duplicates in its local elements first. Remaining
+ * values are partitioned into key ranges by splitters and exchanged in
+ * bulk, so all equivalent elements are assigned to the same unit which
+ * removes duplicates in its key range. Remaining elements are written
+ * back to the beginning of the range in contiguous segments.
+ *
+ * Unlike \c std::unique, the range must be sorted w.r.t. \c comp and
+ * elements \c a and \c b are considered equal if neither \c comp(a, b)
+ * nor \c comp(b, a).
+ *
+ * Precondition: The range has one-dimensional distribution.
+ *
+ * Collective operation.
+ *
+ * \returns  Iterator past the last remaining element, elements in the
+ *           range after this position have unspecified values.
+ *
+ * \ingroup  DashAlgorithms
+ */
+template <
+  class GlobIterType,
+  class Compare >
+GlobIterType unique(
+  GlobIterType   first,
+  GlobIterType   last,
+  Compare        comp)
+{
+  typedef typename GlobIterType::value_type value_t;
+
+  DASH_LOG_DEBUG("dash::unique()");
+  auto & team      = first.team();
+  auto   l_range   = dash::internal::sorted_local_range(first, last);
+  auto   splitters = dash::internal::sorted_splitters<value_t>(
+                       team, { l_range }, dash::distance(first, last), comp);
+  // Adjacent values in a sorted sequence are equivalent if the first is
+  // not less than the second:
+  auto   equiv     = [&](const value_t & a, const value_t & b) {
+                       return !comp(a, b);
+                     };
+  // Remove local duplicates before the exchange, so every unit sends at
+  // most one value of every group:
+  std::vector<value_t> l_unique(l_range.begin, l_range.end);
+  l_unique.erase(
+    std::unique(l_unique.begin(), l_unique.end(), equiv),
+    l_unique.end());
+  dash::LocalRange<const value_t> l_unique_range {
+    l_unique.data(), l_unique.data() + l_unique.size() };
+  auto   values    = dash::internal::sorted_exchange(
+                       team, l_unique_range, splitters, comp);
+  values.erase(
+    std::unique(values.begin(), values.end(), equiv),
+    values.end());
+  return dash::internal::sorted_write(team, values, first);
+}
+
+/**
+ * Removes all but the first element of every group of equal elements
+ * from the sorted range \c [first, last).
+ *
+ * Collective operation.
+ *
+ * \ingroup  DashAlgorithms
+ */
+template <
+  class GlobIterType >
+GlobIterType unique(
+  GlobIterType   first,
+  GlobIterType   last)
+{
+  return dash::unique(first, last,
+                      std::less<typename GlobIterType::value_type>());
+}
+
+} // namespace dash
+
+#endif // DASH__ALGORITHM__UNIQUE_H__
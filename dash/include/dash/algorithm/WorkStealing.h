@@ -0,0 +1,249 @@
+#ifndef DASH__ALGORITHM__WORK_STEALING_H__
+#define DASH__ALGORITHM__WORK_STEALING_H__
+
+#include <dash/Array.h>
+#include <dash/Atomic.h>
+#include <dash/Team.h>
+#include <dash/Types.h>
+
+#include <dash/algorithm/LocalRange.h>
+#include <dash/algorithm/Operation.h>
+
+#include <dash/util/Timer.h>
+#include <dash/internal/Logging.h>
+
+#include <dash/dart/if/dart_communication.h>
+
+#include <algorithm>
+#include <vector>
+
+
+namespace dash {
+
+/**
+ * Execution policy for DASH algorithms with dynamic load balancing.
+ *
+ * The local index range of every unit in an algorithm's input range is
+ * split into chunks. Units first process chunks of their own local range
+ * and then steal chunks from the local ranges of other units until all
+ * chunks have been processed.
+ * Chunks are claimed by atomic fetch-and-add on per-unit chunk counters
+ * in global memory, so every chunk is processed by exactly one unit.
+ *
+ * Instances must be created collectively by all units in the team.
+ *
+ * Example:
+ *
+ * \code
+ *   dash::WorkStealing ws(dash::Team::All(), 1024);
+ *   dash::for_each(ws, array.begin(), array.end(), refine);
+ *   // Time in microseconds unit 0 spent in chunks in the last run:
+ *   double busy_0 = ws.busy_time(dash::team_unit_t(0));
+ * \endcode
+ *
+ * \see  dash::for_each
+ * \see  dash::transform
+ *
+ * \ingroup  DashAlgorithms
+ */
+class WorkStealing
+{
+private:
+  typedef WorkStealing                                     self_t;
+  typedef dash::util::Timer<dash::util::TimeMeasure::Clock> timer_t;
+
+public:
+  typedef dash::default_index_t                         index_type;
+  typedef dash::default_size_t                           size_type;
+
+public:
+  /**
+   * Constructor, collective operation on the units in \c team.
+   */
+  WorkStealing(
+    /// Team of units executing algorithms with this policy
+    dash::Team & team       = dash::Team::All(),
+    /// Number of elements in a chunk, determined from the size of the
+    /// input range if 0
+    size_type    chunk_size = 0)
+  : _team(&team),
+    _chunk_size(chunk_size),
+    _claims(team.size(), team),
+    _busy_times(team.size(), team),
+    _local_ranges(2 * team.size(), 0)
+  {
+    DASH_LOG_DEBUG("WorkStealing(team,chunk_size)", chunk_size);
+    timer_t::Calibrate(0);
+    _claims.local[0]     = 0;
+    _busy_times.local[0] = 0;
+    _claims.barrier();
+    DASH_LOG_DEBUG("WorkStealing >");
+  }
+
+  WorkStealing(const self_t & other)           = delete;
+  self_t & operator=(const self_t & other)     = delete;
+
+  /**
+   * Team of units executing algorithms with this policy.
+   */
+  inline dash::Team & team() const
+  {
+    return *_team;
+  }
+
+  /**
+   * Number of elements in a chunk as specified in the constructor,
+   * 0 if chunk sizes are determined from the input range.
+   */
+  inline size_type chunk_size() const
+  {
+    return _chunk_size;
+  }
+
+  /**
+   * Microseconds the calling unit spent processing chunks in the most
+   * recent algorithm executed with this policy.
+   */
+  inline double busy_time() const
+  {
+    return _busy_time;
+  }
+
+  /**
+   * Microseconds the given unit spent processing chunks in the most
+   * recent algorithm executed with this policy.
+   */
+  inline double busy_time(team_unit_t unit) const
+  {
+    return (unit == _team->myid()
+            ? _busy_time
+            : static_cast<double>(_busy_times[unit.id]));
+  }
+
+  /**
+   * Number of chunks the calling unit stole from other units in the
+   * most recent algorithm executed with this policy.
+   */
+  inline size_type num_stolen() const
+  {
+    return _num_stolen;
+  }
+
+  /**
+   * Process all chunks of the local index ranges of the units in the
+   * team. Collective operation.
+   *
+   * The given function is invoked for every chunk claimed by the calling
+   * unit with the chunk's owner unit and its local index range
+   * \c [lbegin, lend) in the owner's local memory.
+   */
+  template <
+    class GlobIterType,
+    class ChunkFunction >
+  void run(
+    /// Iterator to the initial position in the sequence
+    const GlobIterType & first,
+    /// Iterator to the final position in the sequence
+    const GlobIterType & last,
+    /// Function to invoke on every claimed chunk as
+    /// \c chunk_func(owner_unit, lbegin, lend)
+    ChunkFunction        chunk_func)
+  {
+    DASH_LOG_DEBUG("WorkStealing.run()");
+    DASH_ASSERT_MSG(first.pattern().team() == *_team,
+                    "WorkStealing: team of policy and range differ");
+    auto   nunits      = _team->size();
+    auto   myid        = _team->myid();
+    auto   index_range = dash::local_index_range(first, last);
+    index_type l_range[2] = { static_cast<index_type>(index_range.begin),
+                              static_cast<index_type>(index_range.end) };
+    _busy_time  = 0;
+    _num_stolen = 0;
+    // Chunk counters must be reset before any unit starts claiming:
+    _claims.local[0] = 0;
+    _claims.barrier();
+    DASH_ASSERT_RETURNS(
+      dart_allgather(
+        l_range,
+        _local_ranges.data(),
+        2,
+        dash::dart_datatype<index_type>::value,
+        _team->dart_id()),
+      DART_OK);
+    index_type chunk_size = chunk_size_for_ranges();
+    DASH_LOG_TRACE_VAR("WorkStealing.run", chunk_size);
+
+    // Start at the calling unit's local range and visit the other units
+    // round-robin once it has been exhausted:
+    for (size_type u_offset = 0; u_offset < nunits; ++u_offset) {
+      team_unit_t victim((myid.id + u_offset) % nunits);
+      index_type  lbegin  = _local_ranges[2 * victim.id];
+      index_type  lend    = _local_ranges[2 * victim.id + 1];
+      index_type  nchunks = dash::math::div_ceil(lend - lbegin, chunk_size);
+      if (nchunks <= 0) {
+        continue;
+      }
+      dash::Atomic<index_type> claim(_claims.begin() + victim.id, *_team);
+      while (true) {
+        index_type chunk_idx = claim.fetch_and_add(1);
+        if (chunk_idx >= nchunks) {
+          break;
+        }
+        index_type c_begin = lbegin  + chunk_idx * chunk_size;
+        index_type c_end   = std::min(c_begin + chunk_size, lend);
+        DASH_LOG_TRACE("WorkStealing.run", "unit:", victim,
+                       "chunk:", chunk_idx, "range:", c_begin, c_end);
+        timer_t timer;
+        chunk_func(victim, c_begin, c_end);
+        _busy_time += timer.Elapsed();
+        if (victim != myid) {
+          ++_num_stolen;
+        }
+      }
+    }
+    _busy_times.local[0] = _busy_time;
+    DASH_LOG_DEBUG("WorkStealing.run >",
+                   "busy:", _busy_time, "stolen:", _num_stolen);
+    _team->barrier();
+  }
+
+private:
+  /**
+   * Chunk size for the current local ranges, identical at all units.
+   * Unless specified explicitly, ranges are split into chunks such that
+   * every unit could claim 16 chunks under perfect balance.
+   */
+  index_type chunk_size_for_ranges() const
+  {
+    if (_chunk_size > 0) {
+      return _chunk_size;
+    }
+    index_type nelem_total = 0;
+    for (size_type u = 0; u < _team->size(); ++u) {
+      nelem_total += _local_ranges[2 * u + 1] - _local_ranges[2 * u];
+    }
+    return std::max<index_type>(
+             1, nelem_total / (_team->size() * 16));
+  }
+
+private:
+  /// Team of units executing algorithms with this policy
+  dash::Team              * _team;
+  /// Elements per chunk, 0 to determine from input range
+  size_type                 _chunk_size;
+  /// Number of claimed chunks in the local range of every unit
+  dash::Array<index_type>   _claims;
+  /// Busy time of every unit in the most recent run
+  dash::Array<double>       _busy_times;
+  /// Local index ranges { begin, end } of all units in the current run
+  std::vector<index_type>   _local_ranges;
+  /// Busy time of the calling unit in the most recent run
+  double                    _busy_time  = 0;
+  /// Number of chunks stolen by the calling unit in the most recent run
+  size_type                 _num_stolen = 0;
+
+}; // class WorkStealing
+
+} // namespace dash
+
+#endif // DASH__ALGORITHM__WORK_STEALING_H__
@@ -0,0 +1,117 @@
+#ifndef DASH__ALGORITHM__INTERNAL__FIND_BOUND_H__INCLUDED
+#define DASH__ALGORITHM__INTERNAL__FIND_BOUND_H__INCLUDED
+
+#include <dash/Team.h>
+#include <dash/Types.h>
+#include <dash/Exception.h>
+#include <dash/internal/Logging.h>
+
+#include <dash/dart/if/dart_communication.h>
+#include <dash/dart/if/dart_globmem.h>
+
+#include <cstddef>
+#include <limits>
+
+
+namespace dash {
+namespace internal {
+
+/**
+ * Number of bytes in the local range of a unit searched between two
+ * checks of the shared \c FindBound in cooperative searches.
+ */
+constexpr std::size_t find_round_bytes = 256 * 1024;
+
+/**
+ * Global index of the earliest hit known to any unit in a cooperative
+ * search, shared by the units of a team.
+ *
+ * The bound is stored in a single word at the first unit of the team.
+ * Units lower it by remote atomic minimum when they find a hit and check
+ * it between rounds of their local search, so they can stop as soon as a
+ * hit before their remaining elements is known.
+ *
+ * Construction is collective. As the word is released when the instance
+ * at the first unit is destroyed, all units must have stopped accessing
+ * the bound before, e.g. by completing a reduction of their results.
+ */
+template <typename IndexType>
+class FindBound
+{
+public:
+  explicit FindBound(dash::Team & team)
+  : _team(team),
+    _gptr(DART_GPTR_NULL)
+  {
+    if (_team.myid() == 0) {
+      DASH_ASSERT_RETURNS(
+        dart_memalloc(1, dash::dart_datatype<IndexType>::value, &_gptr),
+        DART_OK);
+      IndexType * lptr = nullptr;
+      DASH_ASSERT_RETURNS(
+        dart_gptr_getaddr(_gptr, reinterpret_cast<void **>(&lptr)),
+        DART_OK);
+      *lptr = not_found();
+    }
+    DASH_ASSERT_RETURNS(
+      dart_bcast(&_gptr, sizeof(dart_gptr_t), DART_TYPE_BYTE,
+                 dash::team_unit_t(0), _team.dart_id()),
+      DART_OK);
+    DASH_LOG_TRACE("FindBound()", "gptr:", _gptr);
+  }
+
+  ~FindBound()
+  {
+    if (_team.myid() == 0) {
+      dart_memfree(_gptr);
+    }
+  }
+
+  FindBound(const FindBound &)             = delete;
+  FindBound & operator=(const FindBound &) = delete;
+
+  /**
+   * Value of the bound if no hit is known.
+   */
+  static constexpr IndexType not_found() {
+    return std::numeric_limits<IndexType>::max();
+  }
+
+  /**
+   * Global index of the earliest hit known to any unit.
+   */
+  IndexType load() const
+  {
+    IndexType value = not_found();
+    IndexType bound;
+    DASH_ASSERT_RETURNS(
+      dart_fetch_and_op(_gptr, &value, &bound,
+                        dash::dart_datatype<IndexType>::value,
+                        DART_OP_MIN, _team.dart_id()),
+      DART_OK);
+    DASH_ASSERT_RETURNS(dart_flush(_gptr), DART_OK);
+    return bound;
+  }
+
+  /**
+   * Lowers the bound to the specified global index of a hit.
+   */
+  void publish(IndexType g_index)
+  {
+    DASH_ASSERT_RETURNS(
+      dart_accumulate(_gptr, &g_index, 1,
+                      dash::dart_datatype<IndexType>::value,
+                      DART_OP_MIN, _team.dart_id()),
+      DART_OK);
+    DASH_ASSERT_RETURNS(dart_flush(_gptr), DART_OK);
+  }
+
+private:
+  dash::Team & _team;
+  dart_gptr_t  _gptr;
+};
+
+} // namespace internal
+} // namespace dash
+
+#endif // DASH__ALGORITHM__INTERNAL__FIND_BOUND_H__INCLUDED
@@ -0,0 +1,260 @@
+#ifndef DASH__ALGORITHM__INTERNAL__GEMM_H__INCLUDED
+#define DASH__ALGORITHM__INTERNAL__GEMM_H__INCLUDED
+
+#include <dash/Types.h>
+#include <dash/ExecutionPolicy.h>
+#include <dash/internal/Logging.h>
+
+#include <dash/algorithm/internal/ParallelFor.h>
+
+#include <algorithm>
+#include <type_traits>
+#include <vector>
+
+
+namespace dash {
+namespace internal {
+
+/**
+ * Blocking parameters of the built-in GEMM kernel.
+ *
+ * The register tile of \c mr x \c nr values of the result is held in
+ * registers by the micro-kernel, its inner loop over \c nr values is
+ * vectorized. Packed panels of A (\c mc x \c kc) and B (\c kc x \c nc)
+ * are sized for the L2 and L3 cache.
+ */
+template <typename ValueType>
+struct gemm_blocking {
+  enum : int {
+    mr = 4,
+    nr = 64 / sizeof(ValueType),
+    kc = 256,
+    mc = 128,
+    nc = 2048
+  };
+};
+
+/**
+ * Micro-kernel of the built-in GEMM, adds the product of a packed
+ * \c mr x \c kc panel of A and a packed \c kc x \c nr panel of B to the
+ * \c m_valid x \c n_valid tile of row-major C.
+ */
+template <typename ValueType>
+inline void gemm_micro_kernel(
+  long long          kc,
+  const ValueType  * a_pack,
+  const ValueType  * b_pack,
+  ValueType        * c,
+  long long          ldc,
+  int                m_valid,
+  int                n_valid)
+{
+  typedef gemm_blocking<ValueType> blk;
+
+  ValueType acc[blk::mr][blk::nr] = { };
+  for (long long p = 0; p < kc; ++p) {
+    const ValueType * a = a_pack + p * blk::mr;
+    const ValueType * b = b_pack + p * blk::nr;
+    for (int i = 0; i < blk::mr; ++i) {
+      for (int j = 0; j < blk::nr; ++j) {
+        acc[i][j] += a[i] * b[j];
+      }
+    }
+  }
+  if (m_valid == blk::mr && n_valid == blk::nr) {
+    for (int i = 0; i < blk::mr; ++i) {
+      for (int j = 0; j < blk::nr; ++j) {
+        c[i * ldc + j] += acc[i][j];
+      }
+    }
+  } else {
+    for (int i = 0; i < m_valid; ++i) {
+      for (int j = 0; j < n_valid; ++j) {
+        c[i * ldc + j] += acc[i][j];
+      }
+    }
+  }
+}
+
+/**
+ * Packs the \c mc x \c kc block of row-major A at \c a into panels of
+ * \c mr rows, stored column by column and padded with zeros.
+ */
+template <typename ValueType>
+void gemm_pack_a(
+  const ValueType  * a,
+  long long          lda,
+  long long          mc,
+  long long          kc,
+  ValueType        * a_pack)
+{
+  typedef gemm_blocking<ValueType> blk;
+
+  for (long long ir = 0; ir < mc; ir += blk::mr) {
+    int m_valid = static_cast<int>(std::min<long long>(blk::mr, mc - ir));
+    for (long long p = 0; p < kc; ++p) {
+      for (int i = 0; i < blk::mr; ++i) {
+        *a_pack++ = (i < m_valid) ? a[(ir + i) * lda + p] : ValueType(0);
+      }
+    }
+  }
+}
+
+/**
+ * Packs the \c kc x \c nc block of row-major B at \c b into panels of
+ * \c nr columns, stored row by row and padded with zeros.
+ */
+template <typename ValueType>
+void gemm_pack_b(
+  const ValueType  * b,
+  long long          ldb,
+  long long          kc,
+  long long          nc,
+  ValueType        * b_pack)
+{
+  typedef gemm_blocking<ValueType> blk;
+
+  for (long long jr = 0; jr < nc; jr += blk::nr) {
+    int n_valid = static_cast<int>(std::min<long long>(blk::nr, nc - jr));
+    for (long long p = 0; p < kc; ++p) {
+      const ValueType * b_row = b + p * ldb + jr;
+      for (int j = 0; j < blk::nr; ++j) {
+        *b_pack++ = (j < n_valid) ? b_row[j] : ValueType(0);
+      }
+    }
+  }
+}
+
+/**
+ * Cache-blocked multiplication C += A x B of row-major matrices with
+ * leading dimensions \c lda, \c ldb and \c ldc.
+ *
+ * Micro-tiles of every block of C are distributed to the threads
+ * specified in the execution policy.
+ */
+template <
+  typename ValueType,
+  class    ExecutionPolicy >
+void gemm_row_major(
+  ExecutionPolicy  && policy,
+  const ValueType  * A,
+  const ValueType  * B,
+  ValueType        * C,
+  long long          m,
+  long long          n,
+  long long          k,
+  long long          lda,
+  long long          ldb,
+  long long          ldc)
+{
+  typedef gemm_blocking<ValueType> blk;
+
+  std::vector<ValueType> a_pack(
+    static_cast<std::size_t>(blk::mc) * blk::kc);
+  std::vector<ValueType> b_pack(
+    static_cast<std::size_t>(blk::kc) *
+    ((std::min<long long>(blk::nc, n) + blk::nr - 1) / blk::nr) * blk::nr);
+
+  for (long long jc = 0; jc < n; jc += blk::nc) {
+    long long nc = std::min<long long>(blk::nc, n - jc);
+    for (long long pc = 0; pc < k; pc += blk::kc) {
+      long long kc = std::min<long long>(blk::kc, k - pc);
+      gemm_pack_b(B + pc * ldb + jc, ldb, kc, nc, b_pack.data());
+      for (long long ic = 0; ic < m; ic += blk::mc) {
+        long long mc = std::min<long long>(blk::mc, m - ic);
+        gemm_pack_a(A + ic * lda + pc, lda, mc, kc, a_pack.data());
+        // Micro-tiles in the block, consecutive tiles share a panel of B:
+        long long n_tiles_m = (mc + blk::mr - 1) / blk::mr;
+        long long n_tiles_n = (nc + blk::nr - 1) / blk::nr;
+        dash::internal::parallel_for(
+          policy, n_tiles_m * n_tiles_n,
+          // Every tile is an aligned unit of work:
+          dash::internal::parallel_chunk_min_bytes,
+          [&](int, long long t_begin, long long t_end) {
+            for (long long t = t_begin; t < t_end; ++t) {
+              long long ir = (t % n_tiles_m) * blk::mr;
+              long long jr = (t / n_tiles_m) * blk::nr;
+              gemm_micro_kernel(
+                kc,
+                a_pack.data() + ir * kc,
+                b_pack.data() + jr * kc,
+                C + (ic + ir) * ldc + jc + jr,
+                ldc,
+                static_cast<int>(std::min<long long>(blk::mr, mc - ir)),
+                static_cast<int>(std::min<long long>(blk::nr, nc - jr)));
+            }
+          });
+      }
+    }
+  }
+}
+
+template <
+  typename ValueType,
+  class    ExecutionPolicy >
+void gemm_local(
+  ExecutionPolicy  && policy,
+  const ValueType  * A,
+  const ValueType  * B,
+  ValueType        * C,
+  long long          m,
+  long long          n,
+  long long          k,
+  std::integral_constant<dash::MemArrange, dash::ROW_MAJOR>)
+{
+  gemm_row_major(policy, A, B, C, m, n, k, k, n, n);
+}
+
+template <
+  typename ValueType,
+  class    ExecutionPolicy >
+void gemm_local(
+  ExecutionPolicy  && policy,
+  const ValueType  * A,
+  const ValueType  * B,
+  ValueType        * C,
+  long long          m,
+  long long          n,
+  long long          k,
+  std::integral_constant<dash::MemArrange, dash::COL_MAJOR>)
+{
+  // Column-major C = A x B is row-major C^T = B^T x A^T:
+  gemm_row_major(policy, B, A, C, n, m, k, k, m, m);
+}
+
+/**
+ * Built-in multiplication C += A x B of local matrices for \c float and
+ * \c double, used if neither MKL nor BLAS is available.
+ *
+ * Matrices are stored in order \c Storage without padding, A has \c m
+ * rows and \c k columns, B has \c k rows and \c n columns and C has \c m
+ * rows and \c n columns, like in \c cblas_dgemm.
+ *
+ * \tparam  Storage  Memory order of A, B and C
+ */
+template <
+  typename         ValueType,
+  dash::MemArrange Storage,
+  class            ExecutionPolicy >
+void gemm_local(
+  ExecutionPolicy  && policy,
+  const ValueType  * A,
+  const ValueType  * B,
+  ValueType        * C,
+  long long          m,
+  long long          n,
+  long long          k)
+{
+  static_assert(
+      std::is_same<ValueType, double>::value ||
+      std::is_same<ValueType, float>::value,
+      "dash::internal::gemm_local expects element type double or float");
+  DASH_LOG_TRACE("dash::internal::gemm_local", "m:", m, "n:", n, "k:", k);
+  gemm_local(policy, A, B, C, m, n, k,
+             std::integral_constant<dash::MemArrange, Storage>());
+}
+
+} // namespace internal
+} // namespace dash
+
+#endif // DASH__ALGORITHM__INTERNAL__GEMM_H__INCLUDED
@@ -0,0 +1,86 @@
+#ifndef DASH__ALGORITHM__INTERNAL__GLOB_SEGMENTS_H__INCLUDED
+#define DASH__ALGORITHM__INTERNAL__GLOB_SEGMENTS_H__INCLUDED
+
+#include <dash/internal/Logging.h>
+
+#include <dash/dart/if/dart_globmem.h>
+
+#include <algorithm>
+
+
+namespace dash {
+namespace internal {
+
+/**
+ * Splits the global range \c [first, first + nelem) into segments that
+ * are contiguous in the local memory of a single unit and calls
+ * \c segment_func(gptr, offset, nseg) for every segment, where \c gptr
+ * references the first element of the segment at offset \c offset in the
+ * range.
+ *
+ * For one-dimensional patterns, local offsets at a unit are ordered by
+ * global index, so the end of a segment is found by galloping search.
+ */
+template <
+  typename IndexType,
+  class    GlobIterType,
+  class    SegmentFunc >
+void for_each_glob_segment(
+  GlobIterType first,
+  IndexType    nelem,
+  SegmentFunc  segment_func)
+{
+  typedef typename GlobIterType::pattern_type pattern_t;
+  typedef typename GlobIterType::value_type   value_t;
+
+  IndexType n_done = 0;
+  while (n_done < nelem) {
+    dart_gptr_t seg_gptr = (first + n_done).dart_gptr();
+    IndexType   n_max    = nelem - n_done;
+    // Elements [n_done, n_done + n) are contiguous in the local memory of
+    // the unit owning the first element of the segment:
+    auto contiguous = [&](IndexType n) {
+                        dart_gptr_t gptr = (first + (n_done + n - 1))
+                                           .dart_gptr();
+                        return gptr.unitid == seg_gptr.unitid &&
+                               gptr.segid  == seg_gptr.segid  &&
+                               gptr.addr_or_offs.offset ==
+                                 seg_gptr.addr_or_offs.offset +
+                                 (n - 1) * sizeof(value_t);
+                      };
+    IndexType n_seg = 1;
+    if (pattern_t::ndim() == 1) {
+      IndexType n_bad = n_max + 1;
+      for (IndexType step = 1; n_seg < n_max; step *= 2) {
+        IndexType n = std::min(n_seg + step, n_max);
+        if (!contiguous(n)) {
+          n_bad = n;
+          break;
+        }
+        n_seg = n;
+      }
+      while (n_bad <= n_max && n_bad - n_seg > 1) {
+        IndexType n = n_seg + (n_bad - n_seg) / 2;
+        if (contiguous(n)) {
+          n_seg = n;
+        } else {
+          n_bad = n;
+        }
+      }
+    } else {
+      while (n_seg < n_max && contiguous(n_seg + 1)) {
+        ++n_seg;
+      }
+    }
+    DASH_LOG_TRACE("dash::internal::for_each_glob_segment",
+                   "unit:", seg_gptr.unitid, "offset:", n_done,
+                   "nelem:", n_seg);
+    segment_func(seg_gptr, n_done, n_seg);
+    n_done += n_seg;
+  }
+}
+
+} // namespace internal
+} // namespace dash
+
+#endif // DASH__ALGORITHM__INTERNAL__GLOB_SEGMENTS_H__INCLUDED
@@ -0,0 +1,322 @@
+#ifndef DASH__ALGORITHM__INTERNAL__MIN_MAX_KERNEL_H__INCLUDED
+#define DASH__ALGORITHM__INTERNAL__MIN_MAX_KERNEL_H__INCLUDED
+
+#include <algorithm>
+#include <cstddef>
+#include <functional>
+#include <type_traits>
+#include <utility>
+
+
+namespace dash {
+namespace internal {
+
+/**
+ * Order of the comparator \c Compare on arithmetic values of type
+ * \c ElementType for which the vectorized search kernels are used:
+ * \c 1 for \c std::less, \c -1 for \c std::greater, \c 0 if the kernels
+ * are not applicable.
+ */
+template <typename ElementType, class Compare>
+struct minmax_kernel_order
+: std::integral_constant<int, 0>
+{ };
+
+template <typename ElementType>
+struct minmax_kernel_order<ElementType, std::less<ElementType>>
+: std::integral_constant<
+    int, std::is_arithmetic<ElementType>::value ? 1 : 0>
+{ };
+
+template <typename ElementType>
+struct minmax_kernel_order<ElementType, std::less<const ElementType &>>
+: std::integral_constant<
+    int, std::is_arithmetic<ElementType>::value ? 1 : 0>
+{ };
+
+template <typename ElementType>
+struct minmax_kernel_order<ElementType, std::greater<ElementType>>
+: std::integral_constant<
+    int, std::is_arithmetic<ElementType>::value ? -1 : 0>
+{ };
+
+template <typename ElementType>
+struct minmax_kernel_order<ElementType, std::greater<const ElementType &>>
+: std::integral_constant<
+    int, std::is_arithmetic<ElementType>::value ? -1 : 0>
+{ };
+
+/**
+ * Smallest and greatest value in the non-empty range \c [first, last)
+ * w.r.t. \c operator<.
+ *
+ * Values are reduced in independent lanes without data-dependent
+ * branches so the compiler can vectorize the loop.
+ * Like \c std::min_element, NaN values are skipped unless the first
+ * value is NaN.
+ */
+template <typename ElementType>
+std::pair<ElementType, ElementType> minmax_value(
+  const ElementType * first,
+  const ElementType * last)
+{
+  enum { nlanes = 8 };
+  ElementType lane_min[nlanes];
+  ElementType lane_max[nlanes];
+  for (int l = 0; l < nlanes; ++l) {
+    lane_min[l] = *first;
+    lane_max[l] = *first;
+  }
+  std::size_t n = last - first;
+  std::size_t i = 0;
+  for (; i + nlanes <= n; i += nlanes) {
+    for (int l = 0; l < nlanes; ++l) {
+      ElementType v = first[i + l];
+      lane_min[l]   = (v < lane_min[l]) ? v : lane_min[l];
+      lane_max[l]   = (lane_max[l] < v) ? v : lane_max[l];
+    }
+  }
+  for (; i < n; ++i) {
+    ElementType v = first[i];
+    lane_min[0]   = (v < lane_min[0]) ? v : lane_min[0];
+    lane_max[0]   = (lane_max[0] < v) ? v : lane_max[0];
+  }
+  ElementType vmin = lane_min[0];
+  ElementType vmax = lane_max[0];
+  for (int l = 1; l < nlanes; ++l) {
+    vmin = (lane_min[l] < vmin) ? lane_min[l] : vmin;
+    vmax = (vmax < lane_max[l]) ? lane_max[l] : vmax;
+  }
+  return std::make_pair(vmin, vmax);
+}
+
+/**
+ * Smallest value in the non-empty range \c [first, last) w.r.t.
+ * \c operator<, or greatest value if \c Greatest is set.
+ * Vectorizable variant of \c minmax_value for a single bound.
+ */
+template <bool Greatest, typename ElementType>
+ElementType bound_value(
+  const ElementType * first,
+  const ElementType * last)
+{
+  enum { nlanes = 8 };
+  ElementType lanes[nlanes];
+  for (int l = 0; l < nlanes; ++l) {
+    lanes[l] = *first;
+  }
+  std::size_t n = last - first;
+  std::size_t i = 0;
+  for (; i + nlanes <= n; i += nlanes) {
+    for (int l = 0; l < nlanes; ++l) {
+      ElementType v = first[i + l];
+      lanes[l]      = Greatest
+                      ? ((lanes[l] < v) ? v : lanes[l])
+                      : ((v < lanes[l]) ? v : lanes[l]);
+    }
+  }
+  for (; i < n; ++i) {
+    ElementType v = first[i];
+    lanes[0]      = Greatest
+                    ? ((lanes[0] < v) ? v : lanes[0])
+                    : ((v < lanes[0]) ? v : lanes[0]);
+  }
+  ElementType bound = lanes[0];
+  for (int l = 1; l < nlanes; ++l) {
+    bound = Greatest
+            ? ((bound < lanes[l]) ? lanes[l] : bound)
+            : ((lanes[l] < bound) ? lanes[l] : bound);
+  }
+  return bound;
+}
+
+template <typename ElementType, class Compare>
+const ElementType * min_element_local(
+  const ElementType * first,
+  const ElementType * last,
+  Compare             compare,
+  std::false_type)
+{
+  return std::min_element(first, last, compare);
+}
+
+template <typename ElementType, class Compare>
+const ElementType * min_element_local(
+  const ElementType * first,
+  const ElementType * last,
+  Compare             compare,
+  std::true_type)
+{
+  typedef minmax_kernel_order<ElementType, Compare> order;
+  if (first == last) {
+    return last;
+  }
+  ElementType bound = (order::value > 0)
+                      ? bound_value<false>(first, last)
+                      : bound_value<true>(first, last);
+  const ElementType * pos = std::find(first, last, bound);
+  // Bound is not found if the first value is NaN:
+  return (pos != last) ? pos : std::min_element(first, last, compare);
+}
+
+/**
+ * Position of the first smallest element in a local range w.r.t.
+ * \c compare, uses vectorized kernels for arithmetic types compared by
+ * \c std::less or \c std::greater.
+ */
+template <typename ElementType, class Compare>
+const ElementType * min_element_local(
+  const ElementType * first,
+  const ElementType * last,
+  Compare             compare)
+{
+  return min_element_local(
+           first, last, compare,
+           std::integral_constant<
+             bool, minmax_kernel_order<ElementType, Compare>::value != 0
+           >());
+}
+
+template <typename ElementType, class Compare>
+std::pair<const ElementType *, const ElementType *> minmax_element_local(
+  const ElementType * first,
+  const ElementType * last,
+  Compare             compare,
+  std::false_type)
+{
+  return std::minmax_element(first, last, compare);
+}
+
+template <typename ElementType, class Compare>
+std::pair<const ElementType *, const ElementType *> minmax_element_local(
+  const ElementType * first,
+  const ElementType * last,
+  Compare             compare,
+  std::true_type)
+{
+  typedef minmax_kernel_order<ElementType, Compare> order;
+  if (first == last) {
+    return std::make_pair(last, last);
+  }
+  auto bounds = minmax_value(first, last);
+  if (order::value < 0) {
+    std::swap(bounds.first, bounds.second);
+  }
+  const ElementType * min_pos = std::find(first, last, bounds.first);
+  const ElementType * max_pos = last;
+  for (const ElementType * it = last; it != first; --it) {
+    if (*(it - 1) == bounds.second) {
+      max_pos = it - 1;
+      break;
+    }
+  }
+  if (min_pos == last || max_pos == last) {
+    // Bounds are not found if the first value is NaN:
+    return std::minmax_element(first, last, compare);
+  }
+  return std::make_pair(min_pos, max_pos);
+}
+
+/**
+ * Positions of the first smallest and the last greatest element in a
+ * local range w.r.t. \c compare, like \c std::minmax_element.
+ * Uses vectorized kernels for arithmetic types compared by \c std::less
+ * or \c std::greater.
+ */
+template <typename ElementType, class Compare>
+std::pair<const ElementType *, const ElementType *> minmax_element_local(
+  const ElementType * first,
+  const ElementType * last,
+  Compare             compare)
+{
+  return minmax_element_local(
+           first, last, compare,
+           std::integral_constant<
+             bool, minmax_kernel_order<ElementType, Compare>::value != 0
+           >());
+}
+
+/**
+ * Value and global index of an element, \c g_index is \c -1 for the
+ * result of an empty range.
+ */
+template <typename ElementType, typename IndexType>
+struct ValueIndex {
+  ElementType value;
+  IndexType   g_index;
+};
+
+/**
+ * Reduces elements to the element with smallest value w.r.t. \c compare
+ * and, of elements with equal value, smallest global index if
+ * \c Last is \c false or greatest global index otherwise.
+ * Commutative equivalent of \c MPI_MINLOC for arbitrary comparators.
+ */
+template <typename ElementType, typename IndexType, class Compare,
+          bool Last = false>
+struct ValueIndexMinOperation {
+  typedef ValueIndex<ElementType, IndexType> value_index_t;
+
+  Compare compare;
+
+  value_index_t operator()(
+    const value_index_t & lhs,
+    const value_index_t & rhs) const {
+    if (lhs.g_index < 0) {
+      return rhs;
+    }
+    if (rhs.g_index < 0) {
+      return lhs;
+    }
+    if (compare(lhs.value, rhs.value)) {
+      return lhs;
+    }
+    if (compare(rhs.value, lhs.value)) {
+      return rhs;
+    }
+    return ((lhs.g_index < rhs.g_index) != Last) ? lhs : rhs;
+  }
+};
+
+/**
+ * Pair of elements with smallest and greatest value, reduced by
+ * \c MinMaxIndexOperation.
+ */
+template <typename ElementType, typename IndexType>
+struct MinMaxIndex {
+  ValueIndex<ElementType, IndexType> min;
+  ValueIndex<ElementType, IndexType> max;
+};
+
+/**
+ * Reduces pairs of elements to the first element with smallest and the
+ * last element with greatest value w.r.t. \c compare.
+ */
+template <typename ElementType, typename IndexType, class Compare>
+struct MinMaxIndexOperation {
+  typedef MinMaxIndex<ElementType, IndexType> min_max_t;
+
+  Compare compare;
+
+  min_max_t operator()(
+    const min_max_t & lhs,
+    const min_max_t & rhs) const {
+    // Greatest element is the smallest w.r.t. the swapped comparison:
+    struct swapped_compare {
+      Compare compare;
+      bool operator()(const ElementType & a, const ElementType & b) const {
+        return compare(b, a);
+      }
+    };
+    ValueIndexMinOperation<ElementType, IndexType, Compare, false>
+      min_op { compare };
+    ValueIndexMinOperation<ElementType, IndexType, swapped_compare, true>
+      max_op { swapped_compare { compare } };
+    return min_max_t { min_op(lhs.min, rhs.min), max_op(lhs.max, rhs.max) };
+  }
+};
+
+} // namespace internal
+} // namespace dash
+
+#endif // DASH__ALGORITHM__INTERNAL__MIN_MAX_KERNEL_H__INCLUDED
@@ -0,0 +1,239 @@
+#ifndef DASH__ALGORITHM__INTERNAL__PANEL_BCAST_H__INCLUDED
+#define DASH__ALGORITHM__INTERNAL__PANEL_BCAST_H__INCLUDED
+
+#include <dash/Team.h>
+#include <dash/Types.h>
+#include <dash/Exception.h>
+#include <dash/internal/Logging.h>
+
+#include <dash/dart/if/dart_communication.h>
+#include <dash/dart/if/dart_globmem.h>
+#include <dash/dart/if/dart_team_group.h>
+
+#include <algorithm>
+#include <cstdint>
+#include <map>
+#include <vector>
+
+
+namespace dash {
+namespace internal {
+
+/**
+ * Node of every unit in the specified team, identified by the smallest
+ * global id of the units sharing memory with it.
+ *
+ * Collective operation, returns a vector indexed by global unit id, with
+ * value \c -1 for units not in the team.
+ */
+inline std::vector<int32_t> unit_node_ids(dash::Team & team)
+{
+  size_t nunits_all;
+  DASH_ASSERT_RETURNS(dart_size(&nunits_all), DART_OK);
+  int32_t my_node = static_cast<int32_t>(dash::myid().id);
+  for (int32_t u = 0; u < my_node; ++u) {
+    int32_t is_local = 0;
+    DASH_ASSERT_RETURNS(
+      dart_unit_shmem_local(dash::global_unit_t(u), &is_local),
+      DART_OK);
+    if (is_local) {
+      my_node = u;
+      break;
+    }
+  }
+  std::vector<int32_t> team_nodes(team.size());
+  DASH_ASSERT_RETURNS(
+    dart_allgather(&my_node, team_nodes.data(), 1, DART_TYPE_INT,
+                   team.dart_id()),
+    DART_OK);
+  std::vector<int32_t> node_ids(nunits_all, -1);
+  for (size_t u = 0; u < team.size(); ++u) {
+    node_ids[team.global_id(dash::team_unit_t(u)).id] = team_nodes[u];
+  }
+  return node_ids;
+}
+
+/**
+ * Team of units receiving the same panels of a distributed matrix in
+ * broadcasts.
+ *
+ * The teams of all groups are created from the parent team in a single
+ * collective operation. If node ids are specified and a team spans
+ * multiple nodes, panels are broadcast hierarchically: first within the
+ * node of the root, then to a single leader unit per node and finally
+ * from the leaders to the other units on their node, so every panel is
+ * transferred between nodes only once per node.
+ *
+ * Construction and destruction are collective operations on the parent
+ * team.
+ */
+class PanelBcastTeam
+{
+public:
+  /**
+   * Creates the team of the group containing the calling unit.
+   */
+  PanelBcastTeam(
+    /// Parent team containing all units in the groups
+    dash::Team                                    & parent,
+    /// Disjoint groups of global unit ids, every unit of the parent team
+    /// must be contained in exactly one group
+    const std::vector<std::vector<global_unit_t>> & groups,
+    /// Node of every unit indexed by global unit id, as returned from
+    /// \c dash::internal::unit_node_ids, or empty for flat broadcasts
+    const std::vector<int32_t>                    & node_ids)
+  : _team(DART_TEAM_NULL),
+    _node_team(DART_TEAM_NULL),
+    _leader_team(DART_TEAM_NULL),
+    _node_ids(node_ids),
+    _hierarchical(false)
+  {
+    size_t group_idx;
+    _team = split(parent, groups, group_idx);
+    DASH_ASSERT_MSG(_team != DART_TEAM_NULL,
+                    "PanelBcastTeam: calling unit is not in any group");
+    if (_node_ids.empty()) {
+      return;
+    }
+    // Partition every group by nodes, groups spanning a single node or
+    // consisting of single units per node are not split:
+    std::vector<std::vector<global_unit_t>> node_groups;
+    std::vector<std::vector<global_unit_t>> leader_groups;
+    for (size_t g = 0; g < groups.size(); ++g) {
+      std::map<int32_t, std::vector<global_unit_t>> by_node;
+      for (auto unit : groups[g]) {
+        by_node[_node_ids[unit.id]].push_back(unit);
+      }
+      bool hierarchical = by_node.size() > 1 &&
+                          by_node.size() < groups[g].size();
+      if (g == group_idx) {
+        _hierarchical = hierarchical;
+      }
+      if (!hierarchical) {
+        continue;
+      }
+      std::vector<global_unit_t> leaders;
+      for (const auto & node_units : by_node) {
+        node_groups.push_back(node_units.second);
+        leaders.push_back(node_units.second.front());
+        if (g == group_idx) {
+          _leaders[node_units.first] = node_units.second.front();
+        }
+      }
+      leader_groups.push_back(leaders);
+    }
+    // Sub-teams are created collectively on the parent team, also by units
+    // in groups that are not split:
+    if (!node_groups.empty()) {
+      size_t sub_idx;
+      _node_team   = split(parent, node_groups, sub_idx);
+      _leader_team = split(parent, leader_groups, sub_idx);
+    }
+    DASH_LOG_TRACE("PanelBcastTeam()", "group:", group_idx,
+                   "hierarchical:", _hierarchical);
+  }
+
+  ~PanelBcastTeam()
+  {
+    if (_leader_team != DART_TEAM_NULL) {
+      dart_team_destroy(&_leader_team);
+    }
+    if (_node_team != DART_TEAM_NULL) {
+      dart_team_destroy(&_node_team);
+    }
+    if (_team != DART_TEAM_NULL) {
+      dart_team_destroy(&_team);
+    }
+  }
+
+  PanelBcastTeam(const PanelBcastTeam &)             = delete;
+  PanelBcastTeam & operator=(const PanelBcastTeam &) = delete;
+
+  /**
+   * Broadcasts \c nelem values in \c buf from the unit \c root to all
+   * units in the team.
+   *
+   * Collective operation on the team.
+   */
+  template <typename ValueType>
+  void bcast(
+    ValueType     * buf,
+    size_t          nelem,
+    global_unit_t   root)
+  {
+    dart_storage_t ds = dash::dart_storage<ValueType>(nelem);
+    if (!_hierarchical) {
+      bcast(buf, ds, root, _team);
+      return;
+    }
+    int32_t root_node = _node_ids[root.id];
+    int32_t my_node   = _node_ids[dash::myid().id];
+    if (my_node == root_node) {
+      bcast(buf, ds, root, _node_team);
+    }
+    if (_leader_team != DART_TEAM_NULL) {
+      bcast(buf, ds, _leaders[root_node], _leader_team);
+    }
+    if (my_node != root_node) {
+      bcast(buf, ds, _leaders[my_node], _node_team);
+    }
+  }
+
+private:
+  static void bcast(
+    void           * buf,
+    dart_storage_t   ds,
+    global_unit_t    root,
+    dart_team_t      team)
+  {
+    size_t team_size;
+    DASH_ASSERT_RETURNS(dart_team_size(team, &team_size), DART_OK);
+    if (team_size < 2) {
+      return;
+    }
+    dart_team_unit_t root_luid;
+    DASH_ASSERT_RETURNS(dart_team_unit_g2l(team, root, &root_luid), DART_OK);
+    DASH_ASSERT_RETURNS(
+      dart_bcast(buf, ds.nelem, ds.dtype, root_luid, team),
+      DART_OK);
+  }
+
+  static dart_team_t split(
+    dash::Team                                    & parent,
+    const std::vector<std::vector<global_unit_t>> & groups,
+    size_t                                        & group_idx)
+  {
+    std::vector<dart_group_t> dart_groups(groups.size());
+    for (size_t g = 0; g < groups.size(); ++g) {
+      DASH_ASSERT_RETURNS(dart_group_create(&dart_groups[g]), DART_OK);
+      for (auto unit : groups[g]) {
+        DASH_ASSERT_RETURNS(
+          dart_group_addmember(dart_groups[g], unit),
+          DART_OK);
+      }
+    }
+    dart_team_t team = DART_TEAM_NULL;
+    group_idx        = groups.size();
+    DASH_ASSERT_RETURNS(
+      dart_team_split(parent.dart_id(), dart_groups.size(),
+                      dart_groups.data(), &team, &group_idx),
+      DART_OK);
+    for (auto & group : dart_groups) {
+      dart_group_destroy(&group);
+    }
+    return team;
+  }
+
+private:
+  dart_team_t                      _team;
+  dart_team_t                      _node_team;
+  dart_team_t                      _leader_team;
+  std::vector<int32_t>             _node_ids;
+  std::map<int32_t, global_unit_t> _leaders;
+  bool                             _hierarchical;
+};
+
+} // namespace internal
+} // namespace dash
+
+#endif // DASH__ALGORITHM__INTERNAL__PANEL_BCAST_H__INCLUDED
@@ -0,0 +1,142 @@
+#ifndef DASH__ALGORITHM__INTERNAL__PARALLEL_FOR_H__INCLUDED
+#define DASH__ALGORITHM__INTERNAL__PARALLEL_FOR_H__INCLUDED
+
+#include <dash/internal/Config.h>
+
+#include <dash/ExecutionPolicy.h>
+
+#include <dash/util/UnitLocality.h>
+#include <dash/internal/Logging.h>
+
+#include <algorithm>
+#include <cstddef>
+#include <type_traits>
+
+#ifdef DASH_ENABLE_OPENMP
+#include <omp.h>
+#endif
+
+
+namespace dash {
+namespace internal {
+
+/**
+ * Resolves to type \c T if \c ExecutionPolicy is an execution policy type,
+ * used to select policy overloads of algorithms.
+ */
+template <
+  class ExecutionPolicy,
+  class T = void >
+using enable_if_execution_policy =
+  typename std::enable_if<
+             dash::execution::is_execution_policy<
+               typename std::decay<ExecutionPolicy>::type
+             >::value,
+             T
+           >::type;
+
+/**
+ * Minimum number of bytes processed by a single thread, also the
+ * alignment of chunk boundaries.
+ */
+constexpr std::size_t parallel_chunk_min_bytes = 4096;
+
+/**
+ * Number of threads executing the local portion of an algorithm.
+ */
+inline int num_threads(
+  const dash::execution::sequenced_policy &)
+{
+  return 1;
+}
+
+/**
+ * Number of threads executing the local portion of an algorithm,
+ * resolved from the calling unit's locality unless specified in the
+ * policy.
+ */
+inline int num_threads(
+  const dash::execution::parallel_unsequenced_policy & policy)
+{
+#ifdef DASH_ENABLE_OPENMP
+  if (policy.num_threads() > 0) {
+    return policy.num_threads();
+  }
+  dash::util::UnitLocality uloc;
+  return std::max(uloc.num_domain_threads(), 1);
+#else
+  return 1;
+#endif
+}
+
+/**
+ * Number of chunks a local range of \c nelem elements is split into by
+ * \c dash::internal::parallel_for, at most the number of threads in the
+ * given policy.
+ */
+template <
+  class ExecutionPolicy,
+  typename IndexType >
+int num_parallel_chunks(
+  const ExecutionPolicy & policy,
+  IndexType               nelem,
+  std::size_t             elem_size)
+{
+  std::size_t nbytes    = static_cast<std::size_t>(nelem) * elem_size;
+  std::size_t max_parts = (nbytes + parallel_chunk_min_bytes - 1) /
+                          parallel_chunk_min_bytes;
+  return static_cast<int>(
+           std::max<std::size_t>(
+             1, std::min<std::size_t>(
+                  dash::internal::num_threads(policy), max_parts)));
+}
+
+/**
+ * Split the local index range \c [0, nelem) into contiguous chunks and
+ * invoke \c chunk_func(chunk_idx, begin, end) on every chunk, in
+ * parallel if permitted by the execution policy.
+ *
+ * Chunk boundaries are aligned to \c parallel_chunk_min_bytes so that
+ * chunks processed by different threads do not share cache lines or
+ * memory pages, and chunk \c i is always processed by thread \c i.
+ *
+ * \returns  The number of chunks, as \c num_parallel_chunks.
+ */
+template <
+  class ExecutionPolicy,
+  typename IndexType,
+  class ChunkFunction >
+int parallel_for(
+  const ExecutionPolicy & policy,
+  IndexType               nelem,
+  std::size_t             elem_size,
+  ChunkFunction           chunk_func)
+{
+  int n_chunks = num_parallel_chunks(policy, nelem, elem_size);
+  if (n_chunks < 2) {
+    chunk_func(0, static_cast<IndexType>(0), nelem);
+    return 1;
+  }
+  // Number of elements in a chunk, rounded up to alignment:
+  IndexType align_elem  = std::max<IndexType>(
+                            1, parallel_chunk_min_bytes / elem_size);
+  IndexType chunk_nelem = (nelem + n_chunks - 1) / n_chunks;
+  chunk_nelem = ((chunk_nelem + align_elem - 1) / align_elem) * align_elem;
+  DASH_LOG_TRACE("dash::internal::parallel_for",
+                 "elements:", nelem, "chunks:", n_chunks,
+                 "chunk size:", chunk_nelem);
+#ifdef DASH_ENABLE_OPENMP
+  #pragma omp parallel for num_threads(n_chunks) schedule(static, 1)
+#endif
+  for (int c = 0; c < n_chunks; ++c) {
+    IndexType c_begin = std::min<IndexType>(nelem, c * chunk_nelem);
+    IndexType c_end   = std::min<IndexType>(nelem, c_begin + chunk_nelem);
+    chunk_func(c, c_begin, c_end);
+  }
+  return n_chunks;
+}
+
+} // namespace internal
+} // namespace dash
+
+#endif // DASH__ALGORITHM__INTERNAL__PARALLEL_FOR_H__INCLUDED
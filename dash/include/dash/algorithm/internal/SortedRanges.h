@@ -0,0 +1,304 @@
+#ifndef DASH__ALGORITHM__INTERNAL__SORTED_RANGES_H__INCLUDED
+#define DASH__ALGORITHM__INTERNAL__SORTED_RANGES_H__INCLUDED
+
+#include <dash/Types.h>
+#include <dash/Iterator.h>
+#include <dash/Exception.h>
+#include <dash/internal/Logging.h>
+
+#include <dash/algorithm/LocalRange.h>
+#include <dash/algorithm/internal/GlobSegments.h>
+
+#include <dash/dart/if/dart_communication.h>
+
+#include <algorithm>
+#include <cstddef>
+#include <iterator>
+#include <type_traits>
+#include <vector>
+
+
+namespace dash {
+namespace internal {
+
+/**
+ * Number of samples per unit drawn from local elements of sorted ranges
+ * to select splitters, at least the number of units in the team.
+ */
+constexpr std::size_t sorted_samples_per_unit = 32;
+
+/**
+ * Local elements of the sorted global range \c [first, last).
+ *
+ * As local elements of one-dimensional patterns are stored in the order
+ * of their global indices, they are a sorted sequence in local memory.
+ */
+template <class GlobIterType>
+dash::LocalRange<const typename GlobIterType::value_type>
+sorted_local_range(
+  const GlobIterType & first,
+  const GlobIterType & last)
+{
+  static_assert(GlobIterType::pattern_type::ndim() == 1,
+                "Sorted ranges must have one-dimensional distribution");
+  return dash::local_range(first, last);
+}
+
+/**
+ * Selects splitters partitioning the values in the sorted ranges of all
+ * units into key ranges of similar size, one for every unit in the team.
+ *
+ * Every unit contributes samples at regular intervals of its local
+ * elements, weighted by its share of the \c g_size elements in all
+ * ranges. Unit \c u is assigned the values \c v with
+ * \c !comp(v, splitters[u-1]) and \c comp(v, splitters[u]).
+ *
+ * Collective operation, returns the same \c team.size() - 1 splitters at
+ * all units, or no splitters if the ranges are empty. Samples are
+ * exchanged as bytes, so \c ValueType must be trivially copyable.
+ */
+template <
+  typename ValueType,
+  class    Compare,
+  class    TeamType >
+std::vector<ValueType> sorted_splitters(
+  TeamType                                             & team,
+  const std::vector<dash::LocalRange<const ValueType>> & l_ranges,
+  std::size_t                                            g_size,
+  Compare                                                comp)
+{
+  static_assert(std::is_trivially_copyable<ValueType>::value,
+                "dash::internal::sorted_splitters: samples are transferred "
+                "as bytes and must be trivially copyable");
+  std::size_t            nunits = team.size();
+  std::vector<ValueType> splitters;
+  if (nunits == 1 || g_size == 0) {
+    return splitters;
+  }
+  std::size_t n_target = nunits * std::max(nunits, sorted_samples_per_unit);
+  std::vector<ValueType> l_samples;
+  for (const auto & l_range : l_ranges) {
+    std::size_t l_size    = l_range.end - l_range.begin;
+    std::size_t n_samples = std::min(
+                              l_size,
+                              (l_size * n_target + g_size - 1) / g_size);
+    for (std::size_t s = 0; s < n_samples; ++s) {
+      l_samples.push_back(
+        l_range.begin[((2 * s + 1) * l_size) / (2 * n_samples)]);
+    }
+  }
+  std::size_t              l_num = l_samples.size() * sizeof(ValueType);
+  std::vector<std::size_t> num_bytes(nunits);
+  DASH_ASSERT_RETURNS(
+    dart_allgather(&l_num, num_bytes.data(), 1, DART_TYPE_SIZET,
+                   team.dart_id()),
+    DART_OK);
+  std::vector<std::size_t> displs(nunits, 0);
+  for (std::size_t u = 1; u < nunits; ++u) {
+    displs[u] = displs[u-1] + num_bytes[u-1];
+  }
+  std::vector<ValueType> g_samples(
+    (displs[nunits-1] + num_bytes[nunits-1]) / sizeof(ValueType));
+  DASH_ASSERT_RETURNS(
+    dart_allgatherv(l_samples.data(), l_num, DART_TYPE_BYTE,
+                    g_samples.data(), num_bytes.data(), displs.data(),
+                    team.dart_id()),
+    DART_OK);
+  std::sort(g_samples.begin(), g_samples.end(), comp);
+  DASH_LOG_TRACE("dash::internal::sorted_splitters",
+                 "samples:", g_samples.size());
+  splitters.reserve(nunits - 1);
+  for (std::size_t u = 1; u < nunits; ++u) {
+    splitters.push_back(g_samples[(u * g_samples.size()) / nunits]);
+  }
+  return splitters;
+}
+
+/**
+ * Sends the local elements of a sorted range to the units assigned to
+ * their key range by \c splitters in a single all-to-all exchange.
+ *
+ * Returns the sorted sequence of values received from all units.
+ * Equivalent values received from different units are ordered by unit id.
+ * Values are exchanged as bytes, so \c ValueType must be trivially
+ * copyable.
+ *
+ * Collective operation.
+ */
+template <
+  typename ValueType,
+  class    Compare,
+  class    TeamType >
+std::vector<ValueType> sorted_exchange(
+  TeamType                                & team,
+  const dash::LocalRange<const ValueType> & l_range,
+  const std::vector<ValueType>            & splitters,
+  Compare                                   comp)
+{
+  static_assert(std::is_trivially_copyable<ValueType>::value,
+                "dash::internal::sorted_exchange: values are transferred "
+                "as bytes and must be trivially copyable");
+  std::size_t nunits = team.size();
+  std::vector<std::size_t> send_bytes(nunits);
+  std::vector<std::size_t> send_displs(nunits);
+  const ValueType * l_bound = l_range.begin;
+  for (std::size_t u = 0; u < nunits; ++u) {
+    const ValueType * l_next = (u < splitters.size())
+                               ? std::lower_bound(l_bound, l_range.end,
+                                                  splitters[u], comp)
+                               : l_range.end;
+    send_displs[u] = (l_bound - l_range.begin) * sizeof(ValueType);
+    send_bytes[u]  = (l_next  - l_bound)       * sizeof(ValueType);
+    l_bound        = l_next;
+  }
+  std::vector<std::size_t> recv_bytes(nunits);
+  DASH_ASSERT_RETURNS(
+    dart_alltoall(send_bytes.data(), recv_bytes.data(), 1, DART_TYPE_SIZET,
+                  team.dart_id()),
+    DART_OK);
+  // Offsets of the values received from every unit, in elements:
+  std::vector<std::size_t> recv_offsets(nunits + 1, 0);
+  std::vector<std::size_t> recv_displs(nunits, 0);
+  for (std::size_t u = 0; u < nunits; ++u) {
+    recv_displs[u]      = recv_offsets[u] * sizeof(ValueType);
+    recv_offsets[u + 1] = recv_offsets[u] +
+                          recv_bytes[u] / sizeof(ValueType);
+  }
+  std::vector<ValueType> values(recv_offsets[nunits]);
+  DASH_ASSERT_RETURNS(
+    dart_alltoallv(l_range.begin, send_bytes.data(), send_displs.data(),
+                   DART_TYPE_BYTE,
+                   values.data(), recv_bytes.data(), recv_displs.data(),
+                   team.dart_id()),
+    DART_OK);
+  DASH_LOG_TRACE("dash::internal::sorted_exchange",
+                 "sent:", l_range.end - l_range.begin,
+                 "received:", values.size());
+  // Merge sorted sequences of adjacent units pairwise, std::inplace_merge
+  // is stable so equivalent values remain ordered by unit id:
+  for (std::size_t width = 1; width < nunits; width *= 2) {
+    for (std::size_t u = 0; u + width < nunits; u += 2 * width) {
+      std::inplace_merge(
+        values.begin() + recv_offsets[u],
+        values.begin() + recv_offsets[u + width],
+        values.begin() + recv_offsets[std::min(u + 2 * width, nunits)],
+        comp);
+    }
+  }
+  return values;
+}
+
+/**
+ * Writes the local results of all units to consecutive elements of the
+ * range starting at \c d_first, ordered by unit id.
+ *
+ * Collective operation, values are written in a single bulk transfer per
+ * contiguous segment of the output range after all units completed their
+ * exchange, so the output range may overlap input ranges.
+ *
+ * \returns  Iterator past the last element written.
+ */
+template <
+  typename ValueType,
+  class    GlobOutputIt,
+  class    TeamType >
+GlobOutputIt sorted_write(
+  TeamType               & team,
+  std::vector<ValueType> & l_result,
+  GlobOutputIt             d_first)
+{
+  typedef typename GlobOutputIt::index_type index_t;
+
+  std::size_t              nunits = team.size();
+  std::size_t              l_num  = l_result.size();
+  std::vector<std::size_t> nums(nunits);
+  DASH_ASSERT_RETURNS(
+    dart_allgather(&l_num, nums.data(), 1, DART_TYPE_SIZET,
+                   team.dart_id()),
+    DART_OK);
+  std::size_t l_offset = 0;
+  std::size_t g_num    = 0;
+  for (std::size_t u = 0; u < nunits; ++u) {
+    if (u < static_cast<std::size_t>(team.myid().id)) {
+      l_offset += nums[u];
+    }
+    g_num += nums[u];
+  }
+  DASH_LOG_TRACE("dash::internal::sorted_write",
+                 "local results:", l_num, "offset:", l_offset,
+                 "total:", g_num);
+  team.barrier();
+  if (l_num > 0) {
+    GlobOutputIt l_first = d_first + static_cast<index_t>(l_offset);
+    dash::internal::for_each_glob_segment(
+      l_first, static_cast<index_t>(l_num),
+      [&](dart_gptr_t seg_gptr, index_t offset, index_t n_seg) {
+        dart_storage_t ds = dash::dart_storage<ValueType>(n_seg);
+        DASH_ASSERT_RETURNS(
+          dart_put(seg_gptr, l_result.data() + offset, ds.nelem, ds.dtype),
+          DART_OK);
+      });
+    DASH_ASSERT_RETURNS(dart_flush_all(l_first.dart_gptr()), DART_OK);
+  }
+  team.barrier();
+  return d_first + static_cast<index_t>(g_num);
+}
+
+/**
+ * Combines the values in the sorted ranges \c [first1, last1) and
+ * \c [first2, last2) to a sorted result written to the range starting at
+ * \c d_first.
+ *
+ * Values are partitioned into key ranges by splitters and exchanged in
+ * bulk, so every unit combines all values in its key range by calling
+ * \c combine(a_first, a_last, b_first, b_last, result_inserter) on
+ * sorted local sequences. Equivalent values are assigned to the same
+ * unit.
+ *
+ * Collective operation.
+ *
+ * \returns  Iterator past the last element written.
+ */
+template <
+  class GlobInputIt1,
+  class GlobInputIt2,
+  class GlobOutputIt,
+  class Compare,
+  class CombineFunc >
+GlobOutputIt sorted_combine(
+  GlobInputIt1   first1,
+  GlobInputIt1   last1,
+  GlobInputIt2   first2,
+  GlobInputIt2   last2,
+  GlobOutputIt   d_first,
+  Compare        comp,
+  CombineFunc    combine)
+{
+  typedef typename GlobInputIt1::value_type value_t;
+
+  auto & team = d_first.team();
+  DASH_ASSERT_MSG(team == first1.team() && team == first2.team(),
+                  "dash::internal::sorted_combine: "
+                  "Different teams in input- and output ranges");
+  auto l_range_1 = dash::internal::sorted_local_range(first1, last1);
+  auto l_range_2 = dash::internal::sorted_local_range(first2, last2);
+  std::size_t g_size = dash::distance(first1, last1) +
+                       dash::distance(first2, last2);
+  auto splitters = dash::internal::sorted_splitters<value_t>(
+                     team, { l_range_1, l_range_2 }, g_size, comp);
+  auto values_1  = dash::internal::sorted_exchange(
+                     team, l_range_1, splitters, comp);
+  auto values_2  = dash::internal::sorted_exchange(
+                     team, l_range_2, splitters, comp);
+  std::vector<value_t> l_result;
+  l_result.reserve(values_1.size() + values_2.size());
+  combine(values_1.begin(), values_1.end(),
+          values_2.begin(), values_2.end(),
+          std::back_inserter(l_result));
+  return dash::internal::sorted_write(team, l_result, d_first);
+}
+
+} // namespace internal
+} // namespace dash
+
+#endif // DASH__ALGORITHM__INTERNAL__SORTED_RANGES_H__INCLUDED
@@ -79,10 +79,12 @@ public:
    */
   CollectiveAllocator(self_t && other) noexcept
   : _team_id(other._team_id),
-    _allocated(std::move(other._allocated))
+    _allocated(std::move(other._allocated)),
+    _attached(std::move(other._attached))
   {
     // clear origin without deallocating gptrs
     other._allocated.clear();
+    other._attached.clear();
   }
 
   /**
@@ -132,9 +134,11 @@ public:
     if (this != &other) {
       clear();
       _allocated = std::move(other._allocated);
+      _attached  = std::move(other._attached);
       _team_id = other._team_id;
       // clear origin without deallocating gptrs
       other._allocated.clear();
+      other._attached.clear();
     }
     return *this;
   }
@@ -200,6 +204,34 @@ public:
     return gptr;
   }
 
+  /**
+   * Registers \c num_local_elem elements in local memory allocated by the
+   * caller at every unit in global memory space, for example memory
+   * mapped by \c dash::allocator::MappedFileAllocator.
+   * Registered memory is not freed when deallocated.
+   *
+   * \note collective operation
+   *
+   * \return  Global pointer to registered memory range, or
+   *          \c DART_GPTR_NULL if registration failed.
+   */
+  pointer attach(value_type * lptr, size_type num_local_elem)
+  {
+    DASH_LOG_DEBUG("CollectiveAllocator.attach(lptr,nlocal)",
+                   "number of local values:", num_local_elem);
+    pointer gptr = DART_GPTR_NULL;
+    dart_storage_t ds = dart_storage<ElementType>(num_local_elem);
+    if (dart_team_memregister(_team_id, ds.nelem, ds.dtype, lptr, &gptr)
+        == DART_OK) {
+      _allocated.push_back(gptr);
+      _attached.push_back(gptr);
+    } else {
+      gptr = DART_GPTR_NULL;
+    }
+    DASH_LOG_DEBUG_VAR("CollectiveAllocator.attach >", gptr);
+    return gptr;
+  }
+
   /**
    * Deallocates memory in global memory space previously allocated across
    * local memory of all units in the team.
@@ -247,10 +279,20 @@ private:
     DASH_ASSERT_RETURNS(
       dart_barrier(_team_id),
       DART_OK);
-    DASH_LOG_DEBUG("CollectiveAllocator.deallocate", "dart_team_memfree");
-    DASH_ASSERT_RETURNS(
-      dart_team_memfree(_team_id, gptr),
-      DART_OK);
+    auto attached = std::find(_attached.begin(), _attached.end(), gptr);
+    if (attached != _attached.end()) {
+      DASH_LOG_DEBUG("CollectiveAllocator.deallocate",
+                     "dart_team_memderegister");
+      DASH_ASSERT_RETURNS(
+        dart_team_memderegister(_team_id, gptr),
+        DART_OK);
+      _attached.erase(attached);
+    } else {
+      DASH_LOG_DEBUG("CollectiveAllocator.deallocate", "dart_team_memfree");
+      DASH_ASSERT_RETURNS(
+        dart_team_memfree(_team_id, gptr),
+        DART_OK);
+    }
     DASH_LOG_DEBUG("CollectiveAllocator.deallocate", "_allocated.erase");
     if(!keep_reference){
       _allocated.erase(
@@ -263,6 +305,8 @@ private:
 private:
   dart_team_t          _team_id;
   std::vector<pointer> _allocated;
+  /// Registered memory allocated by the caller, subset of _allocated
+  std::vector<pointer> _attached;
 
 }; // class CollectiveAllocator
 
@@ -0,0 +1,278 @@
+#ifndef DASH__ALLOCATOR__MAPPED_FILE_ALLOCATOR_H__INCLUDED
+#define DASH__ALLOCATOR__MAPPED_FILE_ALLOCATOR_H__INCLUDED
+
+#include <dash/dart/if/dart.h>
+
+#include <dash/Types.h>
+#include <dash/Team.h>
+#include <dash/Exception.h>
+
+#include <dash/internal/Logging.h>
+
+#include <string>
+#include <vector>
+#include <utility>
+#include <algorithm>
+#include <cstring>
+#include <cerrno>
+
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <fcntl.h>
+#include <unistd.h>
+
+
+namespace dash {
+namespace allocator {
+
+/**
+ * Layout of files backing the local memory of units.
+ */
+enum class MappedFileMode : uint8_t {
+  /**
+   * Units map consecutive regions of a single file. The region of every
+   * unit is aligned to the page size.
+   */
+  SHARED_FILE,
+  /**
+   * Every unit maps a separate file, named by the file path and the
+   * unit id: <tt>path.<unit></tt>
+   */
+  FILE_PER_UNIT
+};
+
+/**
+ * Provides local memory of units mapped from files.
+ *
+ * Memory returned by \c allocate_local is mapped with \c mmap and
+ * registered in global memory by \c dash::GlobMem, so containers can hold
+ * datasets exceeding the physical memory and paging is performed by the
+ * operating system. Data existing in the files is accessible immediately
+ * without parsing, modifications are written back to the files.
+ *
+ * The allocator owns the mappings and must outlive all containers using
+ * its memory.
+ *
+ * Example:
+ * \code
+ *  dash::allocator::MappedFileAllocator<double> mapped("data.bin");
+ *  dash::Array<double> array(dash::BlockPattern<1>(nelem), mapped);
+ * \endcode
+ *
+ * \concept{DashAllocatorConcept}
+ */
+template<typename ElementType>
+class MappedFileAllocator
+{
+private:
+  typedef MappedFileAllocator<ElementType> self_t;
+
+/// Type definitions required for std::allocator concept:
+public:
+  using value_type                             = ElementType;
+  using size_type                              = dash::default_size_t;
+  using propagate_on_container_move_assignment = std::true_type;
+
+/// Type definitions required for dash::allocator concept:
+public:
+  typedef ElementType *                    local_pointer;
+  typedef const ElementType *        const_local_pointer;
+
+public:
+  /**
+   * Constructor.
+   * Creates a new instance of \c dash::MappedFileAllocator mapping
+   * memory of units in a given team from files at the given path.
+   */
+  explicit MappedFileAllocator(
+    /// Path of the shared file, or path prefix of per-unit files
+    const std::string & path,
+    /// Team of all units mapping memory
+    Team              & team = dash::Team::All(),
+    /// Layout of files backing the local memory
+    MappedFileMode      mode = MappedFileMode::SHARED_FILE)
+  : _team(&team),
+    _path(path),
+    _mode(mode)
+  { }
+
+  MappedFileAllocator(const self_t & other)     = delete;
+  self_t & operator=(const self_t & other)      = delete;
+
+  /**
+   * Move-constructor.
+   * Takes ownership of the moved instance's mappings.
+   */
+  MappedFileAllocator(self_t && other) noexcept
+  : _team(other._team),
+    _path(std::move(other._path)),
+    _mode(other._mode),
+    _file_offset(other._file_offset),
+    _mapped(std::move(other._mapped))
+  {
+    other._mapped.clear();
+  }
+
+  /**
+   * Destructor.
+   * Unmaps all memory mapped by this allocator instance.
+   */
+  ~MappedFileAllocator() noexcept
+  {
+    clear();
+  }
+
+  /**
+   * Path of the shared file, or path prefix of per-unit files.
+   */
+  const std::string & path() const noexcept
+  {
+    return _path;
+  }
+
+  /**
+   * Layout of files backing the local memory.
+   */
+  MappedFileMode mode() const noexcept
+  {
+    return _mode;
+  }
+
+  /**
+   * Maps \c num_local_elem local elements of every unit from the file.
+   * Successive allocations are mapped from successive regions of the file.
+   * Files are created and extended as required.
+   *
+   * \note Collective operation, as allocation is symmetric each unit has
+   *       to allocate an equal number of local elements.
+   *
+   * \return  Pointer to mapped local memory, or \c nullptr if
+   *          \c num_local_elem is 0.
+   */
+  local_pointer allocate_local(size_type num_local_elem)
+  {
+    DASH_LOG_DEBUG("MappedFileAllocator.allocate_local(nlocal)",
+                   "number of local values:", num_local_elem);
+    size_t page_size   = sysconf(_SC_PAGESIZE);
+    size_t local_bytes = num_local_elem * sizeof(value_type);
+    // Regions of units in a shared file are aligned to the page size:
+    size_t block_bytes = ((local_bytes + page_size - 1) / page_size)
+                         * page_size;
+    size_t offset;
+    std::string filename;
+    if (_mode == MappedFileMode::SHARED_FILE) {
+      offset   = _file_offset + _team->myid().id * block_bytes;
+      filename = _path;
+      _file_offset += _team->size() * block_bytes;
+      if (_team->myid().id == 0) {
+        // Extend file to total size of all regions before mapping it
+        _extend_file(filename, _file_offset);
+      }
+      _team->barrier();
+    } else {
+      offset   = _file_offset;
+      filename = _path + "." + std::to_string(_team->myid().id);
+      _file_offset += block_bytes;
+      _extend_file(filename, _file_offset);
+    }
+    if (local_bytes == 0) {
+      return nullptr;
+    }
+
+    int fd = open(filename.c_str(), O_RDWR);
+    if (fd < 0) {
+      DASH_THROW(
+        dash::exception::RuntimeError,
+        "MappedFileAllocator: could not open " << filename << ": "
+        << strerror(errno));
+    }
+    void * addr = mmap(nullptr, local_bytes, PROT_READ | PROT_WRITE,
+                       MAP_SHARED, fd, offset);
+    // The mapping remains valid after closing the file descriptor:
+    close(fd);
+    if (addr == MAP_FAILED) {
+      DASH_THROW(
+        dash::exception::RuntimeError,
+        "MappedFileAllocator: could not map " << local_bytes << " bytes "
+        << "at offset " << offset << " of " << filename << ": "
+        << strerror(errno));
+    }
+    _mapped.push_back(std::make_pair(addr, local_bytes));
+    DASH_LOG_DEBUG("MappedFileAllocator.allocate_local >", addr,
+                   "file:", filename, "offset:", offset);
+    return static_cast<local_pointer>(addr);
+  }
+
+  /**
+   * Unmaps local memory previously mapped by this allocator. Modified
+   * pages are written back to the file.
+   *
+   * Local operation.
+   */
+  void deallocate_local(local_pointer lptr)
+  {
+    auto it = std::find_if(
+                _mapped.begin(), _mapped.end(),
+                [&](const std::pair<void *, size_t> & m) {
+                  return m.first == lptr;
+                });
+    if (it == _mapped.end()) {
+      return;
+    }
+    munmap(it->first, it->second);
+    _mapped.erase(it);
+  }
+
+private:
+  /**
+   * Unmaps all memory mapped by this allocator instance.
+   */
+  void clear() noexcept
+  {
+    for (auto & m : _mapped) {
+      munmap(m.first, m.second);
+    }
+    _mapped.clear();
+  }
+
+  /**
+   * Creates the file if it does not exist and extends it to at least the
+   * given size. Existing content is preserved.
+   */
+  static void _extend_file(const std::string & filename, size_t nbytes)
+  {
+    int fd = open(filename.c_str(), O_RDWR | O_CREAT, 0644);
+    if (fd < 0) {
+      DASH_THROW(
+        dash::exception::RuntimeError,
+        "MappedFileAllocator: could not create " << filename << ": "
+        << strerror(errno));
+    }
+    struct stat st;
+    int ret = fstat(fd, &st);
+    if (ret == 0 && static_cast<size_t>(st.st_size) < nbytes) {
+      ret = ftruncate(fd, nbytes);
+    }
+    close(fd);
+    if (ret != 0) {
+      DASH_THROW(
+        dash::exception::RuntimeError,
+        "MappedFileAllocator: could not extend " << filename << " to "
+        << nbytes << " bytes: " << strerror(errno));
+    }
+  }
+
+private:
+  Team                                 * _team;
+  std::string                            _path;
+  MappedFileMode                         _mode;
+  /// Offset of the next allocation in the file(s)
+  size_t                                 _file_offset = 0;
+  std::vector<std::pair<void *, size_t>> _mapped;
+
+}; // class MappedFileAllocator
+
+} // namespace allocator
+} // namespace dash
+
+#endif // DASH__ALLOCATOR__MAPPED_FILE_ALLOCATOR_H__INCLUDED
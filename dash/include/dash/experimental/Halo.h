@@ -230,6 +230,194 @@ std::ostream & operator<<(
   return operator<<(os, ss.str());
 }
 
+/**
+ * Content of halo regions exceeding the global extents of a matrix.
+ */
+enum class HaloBoundary : std::uint8_t {
+  /// Halo regions at the global boundary are not exchanged
+  NONE,
+  /// Halo regions at the global boundary contain the elements at the
+  /// opposite boundary of the global domain
+  PERIODIC,
+  /// Halo regions at the global boundary contain a fixed value
+  FIXED,
+  /// Halo regions at the global boundary are filled by a user-defined
+  /// function of the elements' global coordinates
+  CUSTOM
+};
+
+/**
+ * Specifies the content of halo regions exceeding the global extents of
+ * a matrix, for both boundaries in every dimension.
+ *
+ * Example:
+ *
+ * \code
+ *   // Periodic domain in dimension 0, inflow at the minus boundary and
+ *   // zero-gradient outflow at the plus boundary in dimension 1:
+ *   HaloBoundarySpec<double, 2> boundary;
+ *   boundary.set_periodic(0)
+ *           .set_fixed(1, HaloRegion::MINUS, 1.0)
+ *           .set_custom(1, HaloRegion::PLUS,
+ *                       [&](const std::array<index_t, 2> & gcoords) {
+ *                         return outflow(gcoords[0]);
+ *                       });
+ * \endcode
+ */
+template<
+  typename ElementT,
+  dim_t    NumDimensions,
+  typename IndexT = dash::default_index_t >
+class HaloBoundarySpec
+{
+private:
+  using self_t = HaloBoundarySpec<ElementT, NumDimensions, IndexT>;
+
+public:
+  using coords_t            = std::array<IndexT, NumDimensions>;
+  /// Function returning the value of the halo element at the given global
+  /// coordinates, which exceed the global extents
+  using boundary_function_t = std::function<ElementT(const coords_t &)>;
+
+  struct boundary_t
+  {
+    HaloBoundary        mode;
+    /// Value of halo elements at a boundary of mode \c FIXED
+    ElementT            value;
+    /// Function filling halo elements at a boundary of mode \c CUSTOM
+    boundary_function_t function;
+  };
+
+public:
+  /**
+   * Creates a boundary specification with mode \c HaloBoundary::NONE at
+   * all boundaries.
+   */
+  HaloBoundarySpec()
+  {
+    for (auto & dim_boundaries : _boundaries) {
+      for (auto & boundary : dim_boundaries) {
+        boundary.mode  = HaloBoundary::NONE;
+        boundary.value = ElementT();
+      }
+    }
+  }
+
+  /**
+   * The boundary's number of dimensions.
+   */
+  static constexpr dim_t ndim()
+  {
+    return NumDimensions;
+  }
+
+  /**
+   * Wraps halo regions around both boundaries in the given dimension.
+   */
+  self_t & set_periodic(dim_t dimension)
+  {
+    for (auto & boundary : _boundaries[dimension]) {
+      boundary.mode     = HaloBoundary::PERIODIC;
+      boundary.function = nullptr;
+    }
+    return *this;
+  }
+
+  /**
+   * Fills halo regions at the given boundary with a fixed value.
+   */
+  self_t & set_fixed(
+    dim_t            dimension,
+    HaloRegion       side,
+    const ElementT & value)
+  {
+    auto & boundary   = _boundaries[dimension][static_cast<int>(side)];
+    unset_periodic(dimension);
+    boundary.mode     = HaloBoundary::FIXED;
+    boundary.value    = value;
+    boundary.function = nullptr;
+    return *this;
+  }
+
+  /**
+   * Fills halo regions at both boundaries in the given dimension with a
+   * fixed value.
+   */
+  self_t & set_fixed(
+    dim_t            dimension,
+    const ElementT & value)
+  {
+    set_fixed(dimension, HaloRegion::MINUS, value);
+    return set_fixed(dimension, HaloRegion::PLUS, value);
+  }
+
+  /**
+   * Fills halo regions at the given boundary using a user-defined
+   * function, evaluated for every halo element in every halo exchange.
+   */
+  self_t & set_custom(
+    dim_t               dimension,
+    HaloRegion          side,
+    boundary_function_t function)
+  {
+    auto & boundary   = _boundaries[dimension][static_cast<int>(side)];
+    unset_periodic(dimension);
+    boundary.mode     = HaloBoundary::CUSTOM;
+    boundary.function = function;
+    return *this;
+  }
+
+  /**
+   * Fills halo regions at both boundaries in the given dimension using a
+   * user-defined function.
+   */
+  self_t & set_custom(
+    dim_t               dimension,
+    boundary_function_t function)
+  {
+    set_custom(dimension, HaloRegion::MINUS, function);
+    return set_custom(dimension, HaloRegion::PLUS, function);
+  }
+
+  /**
+   * The boundary specification at the given boundary.
+   */
+  const boundary_t & boundary(dim_t dimension, HaloRegion side) const
+  {
+    return _boundaries[dimension][static_cast<int>(side)];
+  }
+
+  /**
+   * The boundary mode at the given boundary.
+   */
+  HaloBoundary mode(dim_t dimension, HaloRegion side) const
+  {
+    return boundary(dimension, side).mode;
+  }
+
+private:
+  /**
+   * Periodic boundaries are always set for both sides, setting a
+   * different mode at one side resets the other side.
+   */
+  void unset_periodic(dim_t dimension)
+  {
+    for (auto & boundary : _boundaries[dimension]) {
+      if (boundary.mode == HaloBoundary::PERIODIC) {
+        boundary.mode = HaloBoundary::NONE;
+      }
+    }
+  }
+
+private:
+  /// Boundary specification at the minus and plus boundary in every
+  /// dimension
+  std::array<
+    std::array<boundary_t, static_cast<int>(HaloRegion::COUNT)>,
+    NumDimensions>                              _boundaries;
+
+};
+
 template< typename ElementT, typename PatternT,
   typename PointerT   = GlobPtr<ElementT, PatternT>,
   typename ReferenceT = GlobRef<ElementT> >
@@ -698,15 +886,22 @@ public:
   using viewspec_t   = typename PatternT::viewspec_type;
   using halospec_t   = HaloSpec<NumDimensions>;
   using block_view_t = HaloBlockView<ElementT, PatternT>;
+  using boundary_spec_t = HaloBoundarySpec<
+                            ElementT, NumDimensions, index_type>;
 
 public:
   /**
    * Creates a new instance of HaloBlock that extends a given pattern block
    * by halo semantics.
+   * Halo regions exceeding the global extents of the pattern are only
+   * part of the block if their boundary mode in \c boundary is not
+   * \c HaloBoundary::NONE.
    */
   HaloBlock(GlobMem_t & globmem, const PatternT & pattern, const viewspec_t &  view,
-    const halospec_t & halospec)
-  : _globmem(globmem), _pattern(pattern), _view(view), _halospec(halospec)
+    const halospec_t & halospec,
+    const boundary_spec_t & boundary = boundary_spec_t())
+  : _globmem(globmem), _pattern(pattern), _view(view), _halospec(halospec),
+    _boundary(boundary)
   {
     _halo_regions.reserve(NumDimensions * 2);
     _boundary_regions.reserve(NumDimensions * 2);
@@ -726,7 +921,9 @@ public:
       auto view_offset    = view.offset(d);
       auto view_extent    = view.extent(d);
 
-      if(halo_offs_minus == 0 || view_offset < halo_offs_minus)
+      if(halo_offs_minus == 0 ||
+          (view_offset < halo_offs_minus &&
+           _boundary.mode(d, HaloRegion::MINUS) == HaloBoundary::NONE))
       {
         _view_save.resize_dim(d, view_offset + halo_offs_minus, view_extent - halo_offs_minus);
         _view_inner.resize_dim(d, view_offset + halo_offs_minus, view_extent - halo_offs_minus);
@@ -750,11 +947,12 @@ public:
       }
 
       if(halo_offs_plus == 0 ||
-          std::abs(
-            static_cast<index_type>(view_offset) +
-            static_cast<index_type>(view_extent) +
-            static_cast<index_type>(halo_offs_plus)
-          ) > static_cast<index_type>(_pattern.extent(d)))
+          (std::abs(
+             static_cast<index_type>(view_offset) +
+             static_cast<index_type>(view_extent) +
+             static_cast<index_type>(halo_offs_plus)
+           ) > static_cast<index_type>(_pattern.extent(d)) &&
+           _boundary.mode(d, HaloRegion::PLUS) == HaloBoundary::NONE))
       {
         _view_save.resize_dim(d, _view_save.offset(d), _view_save.extent(d) - halo_offs_plus);
         _view_inner.resize_dim(d, _view_inner.offset(d), _view_inner.extent(d) - halo_offs_plus);
@@ -816,6 +1014,11 @@ public:
     return _halospec;
   }
 
+  const boundary_spec_t & boundary() const
+  {
+    return _boundary;
+  }
+
   /**
    * Creates view on halo region for a given dimension and halo region.
    * For example, the east halo region in a two-dimensional block
@@ -899,12 +1102,15 @@ private:
         auto halo_off_minus = std::abs(_halospec.halo_offset(d).minus);
         auto halo_off_plus = _halospec.halo_offset(d).plus;
 
-        if(offsets[d] < halo_off_minus)
+        // Elements at global boundaries without halo are not computed:
+        if(offsets[d] < halo_off_minus &&
+            _boundary.mode(d, HaloRegion::MINUS) == HaloBoundary::NONE)
         {
           offsets[d] += halo_off_minus;
           extents[d] -= halo_off_minus;
         }
-        if(offsets[d] + extents[d] + halo_off_plus > _pattern.extent(d))
+        if(offsets[d] + extents[d] + halo_off_plus > _pattern.extent(d) &&
+            _boundary.mode(d, HaloRegion::PLUS) == HaloBoundary::NONE)
           extents[d] -= halo_off_plus;
       }
     }
@@ -930,6 +1136,8 @@ private:
 
   const halospec_t &        _halospec;
 
+  const boundary_spec_t     _boundary;
+
   viewspec_t                _view_save;
 
   viewspec_t                _view_inner;
@@ -0,0 +1,820 @@
+#ifndef DASH__EXPERIMENTAL__HALO_EXCHANGE_PLAN_H__INCLUDED
+#define DASH__EXPERIMENTAL__HALO_EXCHANGE_PLAN_H__INCLUDED
+
+#include <dash/dart/if/dart.h>
+
+#include <dash/Init.h>
+#include <dash/Types.h>
+#include <dash/Cartesian.h>
+#include <dash/Exception.h>
+
+#include <dash/experimental/Halo.h>
+
+#include <dash/internal/Logging.h>
+
+#include <algorithm>
+#include <array>
+#include <cstdint>
+#include <map>
+#include <sstream>
+#include <string>
+#include <utility>
+#include <vector>
+
+
+namespace dash {
+namespace experimental {
+
+/**
+ * Direction of a halo region relative to the local block, \c -1, \c 0 or
+ * \c 1 in every dimension.
+ * For example, the north-west corner of a two-dimensional block has
+ * direction { -1, -1 } and its east halo region has direction { 0, 1 }.
+ */
+template<dim_t NumDimensions>
+using HaloDirection = std::array<int, NumDimensions>;
+
+/**
+ * Halo regions exchanged by a \c HaloExchangePlan.
+ */
+enum class HaloExchangeScope : std::uint8_t {
+  /// Halo regions adjacent to the faces of the local block only, as
+  /// required by star-shaped stencils
+  FACES,
+  /// Halo regions at faces, edges and corners of the local block, as
+  /// required by box stencils like the 27-point stencil in three
+  /// dimensions
+  ALL
+};
+
+namespace internal {
+
+/**
+ * Transfer of a contiguous range of elements from a neighbor unit's local
+ * memory to a halo buffer.
+ */
+template<typename ElementT>
+struct HaloTransfer
+{
+  /// Global address of the first element at the neighbor unit
+  dart_gptr_t    gptr;
+  /// Address of the first element in the halo buffer
+  ElementT     * dest;
+  /// Number of elements and DART data type of the transfer
+  dart_storage_t ds;
+};
+
+/**
+ * Transfer of all halo elements from a single neighbor unit, issued in a
+ * single get operation in every exchange.
+ * Elements in non-contiguous blocks are described by indexed DART data
+ * types at the neighbor unit and in the halo buffer which are created
+ * once with the exchange plan.
+ */
+template<typename ElementT>
+struct HaloNeighborTransfer
+{
+  /// Global address of the neighbor's first element transferred
+  dart_gptr_t     gptr;
+  /// Address of the first element in the halo buffer
+  ElementT      * dest;
+  /// Number of elements and DART data type of a contiguous transfer
+  dart_storage_t  ds;
+  /// Layout of the elements at the neighbor unit, \c DART_TYPE_UNDEFINED
+  /// for contiguous transfers
+  dart_datatype_t src_type;
+  /// Layout of the elements in the halo buffer, \c DART_TYPE_UNDEFINED
+  /// for contiguous transfers
+  dart_datatype_t dest_type;
+};
+
+/**
+ * Combines the contiguous transfers from every neighbor unit in a
+ * single transfer.
+ */
+template<typename ElementT>
+std::vector<HaloNeighborTransfer<ElementT>> combine_halo_transfers(
+  const std::vector<HaloTransfer<ElementT>> & transfers)
+{
+  // Number of DART data type values in a single element:
+  const size_t elem_nvalues = dash::dart_storage<ElementT>(1).nelem;
+  const size_t value_size   = sizeof(ElementT) / elem_nvalues;
+
+  std::map<std::pair<dart_unit_t, int16_t>, std::vector<size_t>> neighbors;
+  for (size_t t = 0; t < transfers.size(); ++t) {
+    neighbors[std::make_pair(transfers[t].gptr.unitid,
+                             transfers[t].gptr.segid)].push_back(t);
+  }
+  std::vector<HaloNeighborTransfer<ElementT>> neighbor_transfers;
+  for (const auto & neighbor : neighbors) {
+    const auto & t_idcs = neighbor.second;
+    const auto & first  = transfers[t_idcs.front()];
+    HaloNeighborTransfer<ElementT> neighbor_transfer {
+      first.gptr, first.dest, first.ds,
+      DART_TYPE_UNDEFINED, DART_TYPE_UNDEFINED };
+    if (t_idcs.size() > 1) {
+      // Block displacements are relative to the lowest addresses:
+      for (size_t t : t_idcs) {
+        const auto & transfer = transfers[t];
+        if (transfer.gptr.addr_or_offs.offset <
+              neighbor_transfer.gptr.addr_or_offs.offset) {
+          neighbor_transfer.gptr = transfer.gptr;
+        }
+        neighbor_transfer.dest = std::min(neighbor_transfer.dest,
+                                          transfer.dest);
+      }
+      std::vector<size_t> blocklens;
+      std::vector<size_t> src_displs;
+      std::vector<size_t> dest_displs;
+      for (size_t t : t_idcs) {
+        const auto & transfer = transfers[t];
+        blocklens.push_back(transfer.ds.nelem);
+        src_displs.push_back(
+          (transfer.gptr.addr_or_offs.offset -
+           neighbor_transfer.gptr.addr_or_offs.offset) / value_size);
+        dest_displs.push_back(
+          (transfer.dest - neighbor_transfer.dest) * elem_nvalues);
+      }
+      DASH_ASSERT_RETURNS(
+        dart_type_create_indexed(
+          first.ds.dtype, t_idcs.size(), blocklens.data(),
+          src_displs.data(), &neighbor_transfer.src_type),
+        DART_OK);
+      DASH_ASSERT_RETURNS(
+        dart_type_create_indexed(
+          first.ds.dtype, t_idcs.size(), blocklens.data(),
+          dest_displs.data(), &neighbor_transfer.dest_type),
+        DART_OK);
+    }
+    DASH_LOG_TRACE("HaloExchangePlan.combine_halo_transfers",
+                   "unit:", neighbor.first.first,
+                   "blocks:", t_idcs.size());
+    neighbor_transfers.push_back(neighbor_transfer);
+  }
+  return neighbor_transfers;
+}
+
+/**
+ * Resolves transfers of elements in the region with given global
+ * offsets and extents to halo buffer \c dest, which stores the region's
+ * elements in the pattern's memory order.
+ * Coordinates exceeding the global extents are wrapped around to the
+ * opposite boundary of the global domain.
+ * Elements that are contiguous in the local memory of a single unit are
+ * merged into a single transfer.
+ */
+template<
+  typename ElementT,
+  typename PatternT,
+  typename GlobMemT >
+void append_halo_transfers(
+  std::vector<HaloTransfer<ElementT>>                         & transfers,
+  GlobMemT                                                    & globmem,
+  const PatternT                                              & pattern,
+  const std::array<typename PatternT::index_type,
+                   PatternT::ndim()>                          & offsets,
+  const std::array<typename PatternT::size_type,
+                   PatternT::ndim()>                          & extents,
+  ElementT                                                    * dest)
+{
+  using index_type = typename PatternT::index_type;
+  using region_space_t = CartesianIndexSpace<
+                           PatternT::ndim(),
+                           PatternT::memory_order(),
+                           index_type>;
+
+  region_space_t region_space(extents);
+  index_type     size        = region_space.size();
+  team_unit_t    last_unit   = UNDEFINED_TEAM_UNIT_ID;
+  index_type     last_lindex = -1;
+  for (index_type i = 0; i < size; ++i) {
+    auto coords = region_space.coords(i);
+    for (dim_t d = 0; d < PatternT::ndim(); ++d) {
+      index_type extent = pattern.extent(d);
+      coords[d] = ((coords[d] + offsets[d]) % extent + extent) % extent;
+    }
+    auto lpos = pattern.local_index(coords);
+    if (lpos.unit == last_unit && lpos.index == last_lindex + 1) {
+      transfers.back().ds.nelem += dash::dart_storage<ElementT>(1).nelem;
+    } else {
+      transfers.push_back(
+        HaloTransfer<ElementT> {
+          globmem.at(lpos.unit, lpos.index).dart_gptr(),
+          dest + i,
+          dash::dart_storage<ElementT>(1) });
+    }
+    last_unit   = lpos.unit;
+    last_lindex = lpos.index;
+  }
+}
+
+/**
+ * Fills halo buffer \c dest of the region with given global offsets and
+ * extents at a boundary of mode \c HaloBoundary::FIXED or
+ * \c HaloBoundary::CUSTOM. The buffer stores the region's elements in
+ * the pattern's memory order.
+ */
+template<
+  typename PatternT,
+  typename BoundaryT,
+  typename ElementT >
+void fill_halo_boundary(
+  const BoundaryT                                             & boundary,
+  const std::array<typename PatternT::index_type,
+                   PatternT::ndim()>                          & offsets,
+  const std::array<typename PatternT::size_type,
+                   PatternT::ndim()>                          & extents,
+  ElementT                                                    * dest)
+{
+  using index_type = typename PatternT::index_type;
+  using region_space_t = CartesianIndexSpace<
+                           PatternT::ndim(),
+                           PatternT::memory_order(),
+                           index_type>;
+
+  region_space_t region_space(extents);
+  index_type     size = region_space.size();
+  if (boundary.mode == HaloBoundary::FIXED) {
+    std::fill(dest, dest + size, boundary.value);
+    return;
+  }
+  for (index_type i = 0; i < size; ++i) {
+    auto gcoords = region_space.coords(i);
+    for (dim_t d = 0; d < PatternT::ndim(); ++d) {
+      gcoords[d] += offsets[d];
+    }
+    dest[i] = boundary.function(gcoords);
+  }
+}
+
+} // namespace internal
+
+/**
+ * Exchange plan for the halo regions of the local block of a matrix,
+ * computed once for a matrix and a \c HaloSpec.
+ *
+ * The constructor resolves all halo regions, the neighbor units owning
+ * their elements and the contiguous transfers required to copy them to a
+ * halo buffer. Transfers from the same neighbor unit are combined in a
+ * single transfer of indexed blocks. Updating the halo regions in a
+ * timestep then only issues one precomputed transfer per neighbor unit
+ * in \c start() and completes them in \c wait().
+ *
+ * Halo regions exceeding the global extents of the matrix are handled
+ * as specified in an optional \c HaloBoundarySpec: periodic halo regions
+ * are fetched from units at the opposite boundary in the same exchange,
+ * halo regions with fixed values are filled once on construction, and
+ * halo regions filled by a user-defined function are filled locally in
+ * \c start() while transfers are in flight.
+ *
+ * Halo regions are fetched from the neighbors' local memory, so units
+ * must be synchronized (e.g. by \c dash::Matrix::barrier) after the
+ * neighbors' boundary elements have been written and before \c start()
+ * is called.
+ *
+ * Example:
+ *
+ * \code
+ *   HaloSpec<3> halospec({ { { -1, 1 }, { -1, 1 }, { -1, 1 } } });
+ *   HaloExchangePlan<matrix_t, HaloSpec<3>> plan(matrix, halospec);
+ *   for (int t = 0; t < timesteps; ++t) {
+ *     plan.start();
+ *     // ... compute inner elements ...
+ *     plan.wait();
+ *     // ... compute boundary elements using plan.at({ x, y, z }) ...
+ *     matrix.barrier();
+ *   }
+ * \endcode
+ */
+template<typename MatrixT, typename HaloSpecT>
+class HaloExchangePlan
+{
+  static_assert(MatrixT::ndim() == HaloSpecT::ndim(),
+                "Number of dimensions of Matrix and HaloSpec not equal.");
+
+private:
+  using self_t         = HaloExchangePlan<MatrixT, HaloSpecT>;
+  using pattern_t      = typename MatrixT::pattern_type;
+
+  static constexpr dim_t      NumDimensions = pattern_t::ndim();
+  static constexpr MemArrange MemoryArrange = pattern_t::memory_order();
+
+public:
+  using index_type     = typename MatrixT::index_type;
+  using size_type      = typename MatrixT::size_type;
+  using value_t        = typename MatrixT::value_type;
+  using coords_t       = std::array<index_type, NumDimensions>;
+  using extents_t      = std::array<size_type, NumDimensions>;
+  using direction_t    = HaloDirection<NumDimensions>;
+  using ViewSpec_t     = ViewSpec<NumDimensions, index_type>;
+  using boundary_spec_t = HaloBoundarySpec<value_t, NumDimensions, index_type>;
+
+  /**
+   * Halo region of the local block in a single direction.
+   */
+  struct Region
+  {
+    /// Direction of the region relative to the local block
+    direction_t direction;
+    /// Global coordinates of the region's first element, exceeding the
+    /// global extents for regions at the global boundary
+    coords_t    offsets;
+    /// Extents of the region
+    extents_t   extents;
+    /// Strides of the region's elements in the halo buffer
+    extents_t   strides;
+    /// First element of the region in the halo buffer
+    value_t   * begin;
+    /// Number of elements in the region
+    size_type   size;
+    /// \c HaloBoundary::NONE if the region is in the global domain,
+    /// otherwise the boundary mode the region is filled with
+    HaloBoundary boundary;
+    /// Dimension of the boundary determining the region's content if
+    /// the region is filled locally
+    dim_t        boundary_dim;
+  };
+
+private:
+  using transfer_t          = internal::HaloTransfer<value_t>;
+  using neighbor_transfer_t = internal::HaloNeighborTransfer<value_t>;
+
+public:
+  /**
+   * Creates the halo exchange plan of the calling unit's local block.
+   * Regions exceeding the global matrix extents are not exchanged.
+   */
+  HaloExchangePlan(
+    MatrixT           & matrix,
+    const HaloSpecT   & halospec,
+    HaloExchangeScope   scope = HaloExchangeScope::ALL)
+  : HaloExchangePlan(matrix, halospec, boundary_spec_t(), scope)
+  { }
+
+  /**
+   * Creates the halo exchange plan of the calling unit's local block.
+   * Regions exceeding the global matrix extents are handled as specified
+   * in \c boundary.
+   *
+   * \throws  dash::exception::InvalidArgument  if a halo region at a
+   *          global boundary of mode \c FIXED or \c CUSTOM exceeds the
+   *          global extents only partially, i.e. a halo width is greater
+   *          than the extent of a neighbor's block
+   */
+  HaloExchangePlan(
+    MatrixT                 & matrix,
+    const HaloSpecT         & halospec,
+    const boundary_spec_t   & boundary,
+    HaloExchangeScope         scope = HaloExchangeScope::ALL)
+  : _matrix(matrix),
+    _halospec(halospec),
+    _boundary(boundary),
+    _scope(scope),
+    _view(matrix.local.offsets(), matrix.local.extents()),
+    _lbegin(matrix.lbegin()),
+    _region_index(num_directions(), -1)
+  {
+    DASH_LOG_DEBUG("HaloExchangePlan()", "view:", _view);
+    init_regions();
+    init_transfers();
+    DASH_LOG_DEBUG("HaloExchangePlan >",
+                   "regions:",   _regions.size(),
+                   "transfers:", _transfers.size(),
+                   "elements:",  _halobuffer.size());
+  }
+
+  ~HaloExchangePlan()
+  {
+    wait();
+    if (!dash::is_initialized()) {
+      return;
+    }
+    for (auto & transfer : _neighbor_transfers) {
+      if (transfer.src_type != DART_TYPE_UNDEFINED) {
+        dart_type_destroy(&transfer.src_type);
+        dart_type_destroy(&transfer.dest_type);
+      }
+    }
+  }
+
+  HaloExchangePlan(const self_t & other)       = delete;
+  self_t & operator=(const self_t & other)     = delete;
+
+  /**
+   * Issues the transfers of all halo regions, non-blocking, and fills
+   * halo regions at boundaries of mode \c HaloBoundary::CUSTOM.
+   */
+  void start()
+  {
+    DASH_ASSERT_MSG(!_started,
+                    "HaloExchangePlan.start: exchange already started");
+    for (size_type t = 0; t < _neighbor_transfers.size(); ++t) {
+      const auto & transfer = _neighbor_transfers[t];
+      if (transfer.src_type == DART_TYPE_UNDEFINED) {
+        DASH_ASSERT_RETURNS(
+          dart_get_handle(
+            transfer.dest,
+            transfer.gptr,
+            transfer.ds.nelem,
+            transfer.ds.dtype,
+            &_handles[t]),
+          DART_OK);
+      } else {
+        DASH_ASSERT_RETURNS(
+          dart_get_typed_handle(
+            transfer.dest,
+            transfer.dest_type,
+            transfer.gptr,
+            transfer.src_type,
+            &_handles[t]),
+          DART_OK);
+      }
+    }
+    for (const auto & region : _regions) {
+      if (region.boundary == HaloBoundary::CUSTOM) {
+        fill_region(region);
+      }
+    }
+    _started = true;
+  }
+
+  /**
+   * Waits for completion of the transfers issued in \c start().
+   */
+  void wait()
+  {
+    if (!_started) {
+      return;
+    }
+    _started = false;
+    if (_handles.empty()) {
+      return;
+    }
+    DASH_ASSERT_RETURNS(
+      dart_waitall(_handles.data(), _handles.size()),
+      DART_OK);
+  }
+
+  /**
+   * Updates all halo regions, blocking.
+   */
+  void update()
+  {
+    start();
+    wait();
+  }
+
+  /**
+   * Whether transfers have been started and not been waited for.
+   */
+  bool started() const noexcept
+  {
+    return _started;
+  }
+
+  /**
+   * Global view of the calling unit's local block.
+   */
+  const ViewSpec_t & view() const noexcept
+  {
+    return _view;
+  }
+
+  const HaloSpecT & halospec() const noexcept
+  {
+    return _halospec;
+  }
+
+  const boundary_spec_t & boundary() const noexcept
+  {
+    return _boundary;
+  }
+
+  HaloExchangeScope scope() const noexcept
+  {
+    return _scope;
+  }
+
+  /**
+   * All halo regions exchanged by this plan.
+   */
+  const std::vector<Region> & regions() const noexcept
+  {
+    return _regions;
+  }
+
+  /**
+   * Halo region in the given direction, or \c nullptr if no halo region
+   * is exchanged in this direction.
+   */
+  const Region * region(const direction_t & direction) const
+  {
+    auto r_idx = _region_index[direction_index(direction)];
+    return (r_idx < 0 ? nullptr : &_regions[r_idx]);
+  }
+
+  /**
+   * Number of contiguous blocks transferred in every update.
+   */
+  size_type num_transfers() const noexcept
+  {
+    return _transfers.size();
+  }
+
+  /**
+   * Number of transfers issued in every update, one per neighbor unit.
+   */
+  size_type num_neighbor_transfers() const noexcept
+  {
+    return _neighbor_transfers.size();
+  }
+
+  /**
+   * Buffer containing the elements of all halo regions.
+   */
+  const std::vector<value_t> & halo_buffer() const noexcept
+  {
+    return _halobuffer;
+  }
+
+  /**
+   * Element at the given coordinates relative to the local block.
+   * Coordinates may exceed the local block by the halo widths, the
+   * element is then read from the halo buffer.
+   */
+  const value_t & at(const coords_t & coords) const
+  {
+    const value_t * element = element_ptr(coords);
+    DASH_ASSERT_MSG(element != nullptr,
+                    "HaloExchangePlan.at: no halo region in direction of "
+                    "coordinates " << coords_str(coords));
+    return *element;
+  }
+
+  /**
+   * Pointer to the element at the given coordinates relative to the local
+   * block, or \c nullptr if the coordinates are neither in the local block
+   * nor in an exchanged halo region.
+   */
+  const value_t * element_ptr(const coords_t & coords) const
+  {
+    direction_t direction;
+    coords_t    region_coords;
+    bool        in_block = true;
+    for (dim_t d = 0; d < NumDimensions; ++d) {
+      index_type extent = _view.extent(d);
+      if (coords[d] < 0) {
+        direction[d]     = -1;
+        region_coords[d] = coords[d] + std::abs(
+                                         _halospec.halo_offset(d).minus);
+        in_block         = false;
+      } else if (coords[d] >= extent) {
+        direction[d]     = 1;
+        region_coords[d] = coords[d] - extent;
+        in_block         = false;
+      } else {
+        direction[d]     = 0;
+        region_coords[d] = coords[d];
+      }
+    }
+    if (in_block) {
+      return _lbegin + _matrix.pattern().local_memory_layout().at(coords);
+    }
+    const Region * halo_region = region(direction);
+    if (halo_region == nullptr) {
+      return nullptr;
+    }
+    size_type offset = 0;
+    for (dim_t d = 0; d < NumDimensions; ++d) {
+      if (region_coords[d] < 0 ||
+          region_coords[d] >= static_cast<index_type>(
+                                halo_region->extents[d])) {
+        return nullptr;
+      }
+      offset += region_coords[d] * halo_region->strides[d];
+    }
+    return halo_region->begin + offset;
+  }
+
+private:
+  /**
+   * Number of directions in \c ndim dimensions, including the center.
+   */
+  static constexpr size_type num_directions(dim_t ndim = NumDimensions)
+  {
+    return (ndim == 0 ? 1 : 3 * num_directions(ndim - 1));
+  }
+
+  static size_type direction_index(const direction_t & direction)
+  {
+    size_type index = 0;
+    for (dim_t d = 0; d < NumDimensions; ++d) {
+      index = index * 3 + (direction[d] + 1);
+    }
+    return index;
+  }
+
+  /**
+   * Coordinates in the format \c (c0, c1, ...), for log and error
+   * messages.
+   */
+  static std::string coords_str(const coords_t & coords)
+  {
+    std::ostringstream ss;
+    ss << "(";
+    for (dim_t d = 0; d < NumDimensions; ++d) {
+      ss << (d > 0 ? ", " : "") << coords[d];
+    }
+    ss << ")";
+    return ss.str();
+  }
+
+  /**
+   * Resolves all halo regions with non-zero halo width in every
+   * direction, in ascending order of direction index.
+   * Regions exceeding the global extents are resolved if the boundary
+   * mode in every exceeded dimension is not \c HaloBoundary::NONE.
+   */
+  void init_regions()
+  {
+    const auto & pattern = _matrix.pattern();
+    size_type buffer_size = 0;
+    for (size_type dir_idx = 0; dir_idx < num_directions(); ++dir_idx) {
+      Region region;
+      // Direction index to direction:
+      size_type dir_rest = dir_idx;
+      int       nonzero  = 0;
+      for (dim_t d = NumDimensions; d > 0; --d) {
+        region.direction[d-1] = static_cast<int>(dir_rest % 3) - 1;
+        dir_rest /= 3;
+        nonzero  += (region.direction[d-1] != 0);
+      }
+      if (nonzero == 0 ||
+          (_scope == HaloExchangeScope::FACES && nonzero > 1)) {
+        continue;
+      }
+      region.boundary     = HaloBoundary::NONE;
+      region.boundary_dim = 0;
+      bool exchanged = true;
+      for (dim_t d = 0; d < NumDimensions && exchanged; ++d) {
+        index_type view_offset = _view.offset(d);
+        index_type view_extent = _view.extent(d);
+        index_type width_minus = std::abs(_halospec.halo_offset(d).minus);
+        index_type width_plus  = _halospec.halo_offset(d).plus;
+        switch (region.direction[d]) {
+          case -1:
+            region.offsets[d] = view_offset - width_minus;
+            region.extents[d] = width_minus;
+            break;
+          case 1:
+            region.offsets[d] = view_offset + view_extent;
+            region.extents[d] = width_plus;
+            break;
+          default:
+            region.offsets[d] = view_offset;
+            region.extents[d] = view_extent;
+            break;
+        }
+        index_type extent = pattern.extent(d);
+        exchanged = region.extents[d] > 0;
+        if (!exchanged ||
+            (region.offsets[d] >= 0 &&
+             region.offsets[d] + static_cast<index_type>(region.extents[d])
+               <= extent)) {
+          continue;
+        }
+        // Region exceeds the global extents:
+        HaloRegion   side = (region.direction[d] < 0)
+                            ? HaloRegion::MINUS
+                            : HaloRegion::PLUS;
+        HaloBoundary mode = _boundary.mode(d, side);
+        if (mode == HaloBoundary::NONE) {
+          exchanged = false;
+        } else if (mode == HaloBoundary::PERIODIC) {
+          if (region.boundary == HaloBoundary::NONE) {
+            region.boundary = HaloBoundary::PERIODIC;
+          }
+        } else {
+          bool at_boundary = (region.direction[d] < 0)
+                             ? view_offset == 0
+                             : view_offset + view_extent == extent;
+          if (!at_boundary) {
+            DASH_THROW(
+              dash::exception::InvalidArgument,
+              "HaloExchangePlan: halo width " << region.extents[d] << " "
+              "in dimension " << d << " exceeds the extent of the block "
+              "at the global boundary");
+          }
+          // The boundary in the lowest dimension determines the content
+          // of locally filled regions:
+          if (region.boundary == HaloBoundary::NONE ||
+              region.boundary == HaloBoundary::PERIODIC) {
+            region.boundary     = mode;
+            region.boundary_dim = d;
+          }
+        }
+      }
+      if (!exchanged) {
+        continue;
+      }
+      // Strides of region elements in memory order:
+      size_type stride = 1;
+      if (MemoryArrange == ROW_MAJOR) {
+        for (dim_t d = NumDimensions; d > 0; --d) {
+          region.strides[d-1] = stride;
+          stride *= region.extents[d-1];
+        }
+      } else {
+        for (dim_t d = 0; d < NumDimensions; ++d) {
+          region.strides[d] = stride;
+          stride *= region.extents[d];
+        }
+      }
+      region.size   = stride;
+      region.begin  = nullptr;
+      buffer_size  += region.size;
+      _region_index[dir_idx] = _regions.size();
+      _regions.push_back(region);
+      DASH_LOG_TRACE("HaloExchangePlan.init_regions",
+                     "direction:", region.direction,
+                     "offsets:",   region.offsets,
+                     "extents:",   region.extents,
+                     "boundary:",  static_cast<int>(region.boundary));
+    }
+    _halobuffer.resize(buffer_size);
+    value_t * region_begin = _halobuffer.data();
+    for (auto & region : _regions) {
+      region.begin  = region_begin;
+      region_begin += region.size;
+    }
+  }
+
+  /**
+   * Resolves the transfers of all halo regions in the global domain or
+   * at periodic boundaries, and fills halo regions at boundaries of mode
+   * \c HaloBoundary::FIXED.
+   */
+  void init_transfers()
+  {
+    auto & globmem = _matrix.begin().globmem();
+    for (const auto & region : _regions) {
+      if (region.boundary == HaloBoundary::FIXED) {
+        fill_region(region);
+        continue;
+      }
+      if (region.boundary == HaloBoundary::CUSTOM) {
+        continue;
+      }
+      internal::append_halo_transfers(
+        _transfers, globmem, _matrix.pattern(),
+        region.offsets, region.extents, region.begin);
+    }
+    _neighbor_transfers = internal::combine_halo_transfers(_transfers);
+    _handles.resize(_neighbor_transfers.size(), nullptr);
+  }
+
+  /**
+   * Fills a halo region at a boundary of mode \c HaloBoundary::FIXED or
+   * \c HaloBoundary::CUSTOM.
+   */
+  void fill_region(const Region & region)
+  {
+    HaloRegion side = (region.direction[region.boundary_dim] < 0)
+                      ? HaloRegion::MINUS
+                      : HaloRegion::PLUS;
+    internal::fill_halo_boundary<pattern_t>(
+      _boundary.boundary(region.boundary_dim, side),
+      region.offsets, region.extents, region.begin);
+  }
+
+private:
+  MatrixT                   & _matrix;
+  const HaloSpecT           & _halospec;
+  const boundary_spec_t       _boundary;
+  HaloExchangeScope           _scope;
+  /// Global view of the local block
+  const ViewSpec_t            _view;
+  /// Native pointer to the first element of the local block
+  value_t                   * _lbegin;
+  /// Halo regions in ascending order of direction index
+  std::vector<Region>         _regions;
+  /// Offset of the region in every direction in _regions, -1 if the
+  /// region is not exchanged
+  std::vector<int>            _region_index;
+  /// Elements of all halo regions
+  std::vector<value_t>        _halobuffer;
+  /// Contiguous blocks of all halo regions
+  std::vector<transfer_t>     _transfers;
+  /// Precomputed transfers of the blocks from every neighbor unit
+  std::vector<neighbor_transfer_t> _neighbor_transfers;
+  /// Handles of the transfers in the current exchange
+  std::vector<dart_handle_t>  _handles;
+  /// Whether transfers have been started and not been waited for
+  bool                        _started = false;
+
+}; // class HaloExchangePlan
+
+}  // namespace experimental
+}  // namespace dash
+
+#endif  // DASH__EXPERIMENTAL__HALO_EXCHANGE_PLAN_H__INCLUDED
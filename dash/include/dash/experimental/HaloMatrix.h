@@ -6,8 +6,10 @@
 #include <dash/Pattern.h>
 #include <dash/GlobMem.h>
 #include <dash/Matrix.h>
+#include <dash/Exception.h>
 
 #include <dash/experimental/Halo.h>
+#include <dash/experimental/HaloExchangePlan.h>
 #include <dash/experimental/iterator/HaloMatrixIterator.h>
 
 #include <type_traits>
@@ -32,6 +34,7 @@ public:
   using HaloBlock_t          = HaloBlock<value_t, pattern_t>;
   using HaloBlockView_t      = typename HaloBlock_t::block_view_t;
   using HaloMemory_t         = HaloMemory<HaloBlock_t>;
+  using boundary_spec_t      = typename HaloBlock_t::boundary_spec_t;
 
   using iterator             = HaloMatrixIterator<
                                  value_t,
@@ -62,11 +65,31 @@ public:
    */
   //TODO adapt to more than one local block
   HaloMatrix(MatrixT & matrix, const HaloSpecT & halospec)
+    : HaloMatrix(matrix, halospec, boundary_spec_t())
+  { }
+
+  /**
+   * Creates the halo regions of the calling unit's local block.
+   * Halo regions exceeding the global extents of the matrix are handled
+   * as specified in \c boundary: periodic regions are fetched from the
+   * units at the opposite boundary, regions with fixed values are filled
+   * once on construction and regions filled by a user-defined function
+   * are filled in every halo update.
+   *
+   * \throws  dash::exception::InvalidArgument  if a halo region at a
+   *          global boundary of mode \c FIXED or \c CUSTOM exceeds the
+   *          global extents only partially
+   */
+  HaloMatrix(
+    MatrixT               & matrix,
+    const HaloSpecT       & halospec,
+    const boundary_spec_t & boundary)
     : _matrix(matrix),
       _halospec(halospec),
       _view_local(matrix.local.extents()),
       _view_global(ViewSpec_t(matrix.local.offsets(), matrix.local.extents())),
-      _haloblock(matrix.begin().globmem(), matrix.pattern(), _view_global, halospec),
+      _haloblock(matrix.begin().globmem(), matrix.pattern(), _view_global,
+                 halospec, boundary),
       _halomemory(_haloblock),
       _begin(_haloblock, _halomemory, 0),
       _end(_haloblock, _halomemory, _haloblock.view_save().size()),
@@ -87,12 +110,6 @@ public:
     }
   }
 
-  ~HaloMatrix()
-  {
-    for(auto & view : _blockview_data)
-      free(view.second.handle);
-  }
-
   iterator begin() noexcept
   {
     return _begin;
@@ -172,7 +189,7 @@ public:
   void waitHalosAsync()
   {
     for(auto & view : _blockview_data)
-      dart_waitall(view.second.handle, view.second.num_handles);
+      dart_waitall(view.second.handles.data(), view.second.handles.size());
   }
 
   void updateHalos()
@@ -192,33 +209,69 @@ public:
   }
 
 private:
+  /**
+   * Resolves the transfers of a halo region once, they are issued
+   * unmodified in every update. Regions at global boundaries of mode
+   * \c HaloBoundary::FIXED are filled instead.
+   */
   void initBlockViewData(dim_t dim, HaloRegion region)
   {
-    const auto blockview = _haloblock.halo_region(dim, region);
-    if(blockview.size() == 0)
+    const auto & region_view = _haloblock.halo_region(dim, region)
+                                         .region_view();
+    if(region_view.size() == 0)
       return;
 
-    // number of contiguous elements
-    size_type cont_elems;
-    size_type num_handle;
-    if((MemoryArrange == ROW_MAJOR && dim == 0) ||
-       (MemoryArrange == COL_MAJOR && dim == NumDimensions - 1))
+    Data data;
+    data.boundary = HaloBoundary::NONE;
+    index_type extent = _matrix.pattern().extent(dim);
+    if(region_view.offset(dim) < 0 ||
+       region_view.offset(dim) +
+         static_cast<index_type>(region_view.extent(dim)) > extent)
+      data.boundary = _haloblock.boundary().mode(dim, region);
+
+    if(data.boundary == HaloBoundary::FIXED ||
+       data.boundary == HaloBoundary::CUSTOM)
     {
-      cont_elems = blockview.size();
-      num_handle = 1;
+      bool at_boundary = (region == HaloRegion::MINUS)
+                         ? _view_global.offset(dim) == 0
+                         : _view_global.offset(dim) +
+                             static_cast<index_type>(
+                               _view_global.extent(dim)) == extent;
+      if(!at_boundary)
+      {
+        DASH_THROW(
+          dash::exception::InvalidArgument,
+          "HaloMatrix: halo width " << region_view.extent(dim) << " "
+          "in dimension " << dim << " exceeds the extent of the block "
+          "at the global boundary");
+      }
+      if(data.boundary == HaloBoundary::FIXED)
+        fillBoundary(dim, region);
     }
     else
     {
-      cont_elems = blockview.region_view().extent(dim);
-      num_handle = blockview.size() / cont_elems;
+      internal::append_halo_transfers(
+        data.transfers, _matrix.begin().globmem(), _matrix.pattern(),
+        region_view.offsets(), region_view.extents(),
+        _halomemory.haloPos(dim, region));
     }
-
-    auto nbytes = cont_elems * sizeof(value_t);
-    dart_handle_t * handle = (dart_handle_t*) malloc (sizeof (dart_handle_t) * num_handle);
-    for(auto i = 0; i < num_handle; ++i)
-      handle[i] = nullptr;
+    data.handles.resize(data.transfers.size(), nullptr);
     _blockview_data.insert(std::make_pair(
-          std::move(std::make_pair(dim, region)), Data{std::move(blockview), handle, num_handle, cont_elems, nbytes}));
+          std::make_pair(dim, region), std::move(data)));
+  }
+
+  /**
+   * Fills a halo region at a global boundary of mode
+   * \c HaloBoundary::FIXED or \c HaloBoundary::CUSTOM.
+   */
+  void fillBoundary(dim_t dim, HaloRegion region)
+  {
+    const auto & region_view = _haloblock.halo_region(dim, region)
+                                         .region_view();
+    internal::fill_halo_boundary<pattern_t>(
+      _haloblock.boundary().boundary(dim, region),
+      region_view.offsets(), region_view.extents(),
+      _halomemory.haloPos(dim, region));
   }
 
   void updateHaloIntern(dim_t dim, HaloRegion region, bool async)
@@ -227,14 +280,15 @@ private:
     if(it_find != _blockview_data.end())
     {
       auto & data = it_find->second;
-      auto off = _halomemory.haloPos(dim, region);
-      auto it = data.blockview.begin();
-      for(auto i = 0; i < data.num_handles; ++i, it += data.cont_elems){
-        dart_storage_t ds = dash::dart_storage<value_t>(data.cont_elems);
-        dart_get_handle (off + ds.nelem * i, it.dart_gptr(), ds.nelem, ds.dtype, &(data.handle[i]));
+      for(auto i = 0; i < data.transfers.size(); ++i){
+        const auto & transfer = data.transfers[i];
+        dart_get_handle (transfer.dest, transfer.gptr, transfer.ds.nelem,
+                         transfer.ds.dtype, &(data.handles[i]));
       }
+      if(data.boundary == HaloBoundary::CUSTOM)
+        fillBoundary(dim, region);
       if(!async)
-        dart_waitall(data.handle, data.num_handles);
+        dart_waitall(data.handles.data(), data.handles.size());
     }
   }
 
@@ -248,11 +302,10 @@ private:
 
   struct Data
   {
-    const HaloBlockView_t blockview;
-    dart_handle_t *       handle;
-    size_type             num_handles;
-    size_type             cont_elems;
-    std::uint64_t         nbytes;
+    std::vector<internal::HaloTransfer<value_t>> transfers;
+    std::vector<dart_handle_t>                   handles;
+    /// Boundary mode if the region exceeds the global extents
+    HaloBoundary                                 boundary;
   };
   std::map<std::pair<dim_t, HaloRegion>, Data> _blockview_data;
 
@@ -0,0 +1,461 @@
+#ifndef DASH__EXPERIMENTAL__STENCIL_OPERATOR_H__INCLUDED
+#define DASH__EXPERIMENTAL__STENCIL_OPERATOR_H__INCLUDED
+
+#include <dash/Types.h>
+#include <dash/Dimensional.h>
+
+#include <dash/experimental/Halo.h>
+#include <dash/experimental/HaloExchangePlan.h>
+
+#include <dash/internal/Logging.h>
+
+#include <array>
+#include <vector>
+
+
+namespace dash {
+namespace experimental {
+
+/**
+ * Access to the elements of a stencil centered at a single point, passed
+ * to stencil kernels by \c StencilOperator.
+ *
+ * Neighbor elements are addressed by their offset to the center in every
+ * dimension, e.g. <tt>p(-1, 0)</tt> is the north neighbor of the center
+ * point in a two-dimensional row-major matrix.
+ */
+template<
+  typename ElementT,
+  dim_t    NumDimensions,
+  typename IndexT >
+class StencilPoint
+{
+public:
+  using strides_t = std::array<IndexT, NumDimensions>;
+
+public:
+  StencilPoint(const ElementT * center, const strides_t & strides)
+  : _center(center), _strides(strides)
+  { }
+
+  /**
+   * The element at the stencil's center.
+   */
+  inline const ElementT & center() const
+  {
+    return *_center;
+  }
+
+  /**
+   * The element at the given offsets from the center.
+   */
+  template<typename... Args>
+  inline const ElementT & operator()(IndexT offset, Args... offsets) const
+  {
+    static_assert(sizeof...(Args) == NumDimensions-1,
+                  "Invalid number of offsets");
+    return _center[offset_of(0, offset, offsets...)];
+  }
+
+  /**
+   * The element at the given offsets from the center.
+   */
+  inline const ElementT & at(const std::array<IndexT, NumDimensions> & offsets)
+  const
+  {
+    IndexT offset = 0;
+    for (dim_t d = 0; d < NumDimensions; ++d) {
+      offset += offsets[d] * _strides[d];
+    }
+    return _center[offset];
+  }
+
+private:
+  inline IndexT offset_of(dim_t d, IndexT offset) const
+  {
+    return offset * _strides[d];
+  }
+
+  template<typename... Args>
+  inline IndexT offset_of(dim_t d, IndexT offset, Args... offsets) const
+  {
+    return offset * _strides[d] + offset_of(d + 1, offsets...);
+  }
+
+private:
+  const ElementT * _center;
+  strides_t        _strides;
+};
+
+/**
+ * Applies a stencil kernel to the local block of a matrix and overlaps
+ * the halo exchange with the computation of the block's inner region.
+ *
+ * The kernel is invoked for every point of the local block as
+ * <tt>kernel(const StencilPoint & p)</tt> and returns the point's new
+ * value, which is written to the result matrix.
+ * Points whose stencil does not reach into halo regions (the *inner
+ * region*) are computed while halo regions are transferred. Their
+ * stencils are read directly from local memory and the inner loop runs
+ * over elements that are contiguous in memory, so kernels can be
+ * vectorized by the compiler.
+ * Remaining points (the *boundary region*) are computed once the halo
+ * exchange has completed.
+ * Points whose stencil exceeds the global matrix extents are only
+ * computed at boundaries specified in a \c HaloBoundarySpec.
+ *
+ * Example:
+ *
+ * \code
+ *   HaloSpec<2> halospec({ { { -1, 1 }, { -1, 1 } } });
+ *   StencilOperator<matrix_t, HaloSpec<2>> op_a(matrix_a, halospec);
+ *   StencilOperator<matrix_t, HaloSpec<2>> op_b(matrix_b, halospec);
+ *   auto heat = [](const StencilPoint<double, 2, index_t> & p) {
+ *                 return p.center() + 0.1 * (p(-1,0) + p(1,0) +
+ *                                            p(0,-1) + p(0,1) -
+ *                                            4 * p.center());
+ *               };
+ *   for (int t = 0; t < timesteps; t += 2) {
+ *     op_a.apply(matrix_b, heat);
+ *     op_b.apply(matrix_a, heat);
+ *   }
+ * \endcode
+ */
+template<typename MatrixT, typename HaloSpecT>
+class StencilOperator
+{
+private:
+  using self_t         = StencilOperator<MatrixT, HaloSpecT>;
+  using pattern_t      = typename MatrixT::pattern_type;
+  using plan_t         = HaloExchangePlan<MatrixT, HaloSpecT>;
+
+  static constexpr dim_t      NumDimensions = pattern_t::ndim();
+  static constexpr MemArrange MemoryArrange = pattern_t::memory_order();
+  /// Dimension in which local elements are contiguous
+  static constexpr dim_t      FastestDim    = (MemoryArrange == ROW_MAJOR)
+                                              ? NumDimensions - 1
+                                              : 0;
+
+public:
+  using index_type     = typename MatrixT::index_type;
+  using size_type      = typename MatrixT::size_type;
+  using value_t        = typename MatrixT::value_type;
+  using coords_t       = std::array<index_type, NumDimensions>;
+  using stencil_point  = StencilPoint<value_t, NumDimensions, index_type>;
+  using boundary_spec_t = typename plan_t::boundary_spec_t;
+
+public:
+  /**
+   * Creates the stencil operator and the halo exchange plan of the
+   * calling unit's local block of \c matrix.
+   */
+  StencilOperator(
+    MatrixT           & matrix,
+    const HaloSpecT   & halospec,
+    HaloExchangeScope   scope = HaloExchangeScope::ALL)
+  : StencilOperator(matrix, halospec, boundary_spec_t(), scope)
+  { }
+
+  /**
+   * Creates the stencil operator and the halo exchange plan of the
+   * calling unit's local block of \c matrix, with halo regions at the
+   * global boundary handled as specified in \c boundary.
+   */
+  StencilOperator(
+    MatrixT                 & matrix,
+    const HaloSpecT         & halospec,
+    const boundary_spec_t   & boundary,
+    HaloExchangeScope         scope = HaloExchangeScope::ALL)
+  : _matrix(matrix),
+    _halospec(halospec),
+    _plan(matrix, halospec, boundary, scope)
+  {
+    const auto & view = _plan.view();
+    // Strides of the local block in memory order:
+    index_type stride = 1;
+    for (dim_t i = 0; i < NumDimensions; ++i) {
+      dim_t d = (MemoryArrange == ROW_MAJOR) ? NumDimensions - 1 - i : i;
+      _strides[d] = stride;
+      stride     *= view.extent(d);
+    }
+    // Stencil patch for boundary points:
+    index_type patch_stride = 1;
+    index_type center       = 0;
+    for (dim_t i = 0; i < NumDimensions; ++i) {
+      dim_t d = (MemoryArrange == ROW_MAJOR) ? NumDimensions - 1 - i : i;
+      index_type width_minus = std::abs(halospec.halo_offset(d).minus);
+      index_type width_plus  = halospec.halo_offset(d).plus;
+      _patch_strides[d]      = patch_stride;
+      _patch_extents[d]      = width_minus + 1 + width_plus;
+      center                += width_minus * patch_stride;
+      patch_stride          *= _patch_extents[d];
+    }
+    _patch.resize(patch_stride);
+    _patch_center = center;
+    init_regions();
+  }
+
+  StencilOperator(const self_t & other)        = delete;
+  self_t & operator=(const self_t & other)      = delete;
+
+  /**
+   * The halo exchange plan of the input matrix.
+   */
+  plan_t & plan() noexcept
+  {
+    return _plan;
+  }
+
+  /**
+   * Local coordinates of the first point in the region of points computed
+   * by this operator.
+   */
+  const coords_t & region_begin() const noexcept
+  {
+    return _region_begin;
+  }
+
+  /**
+   * Local coordinates past the last point in the region of points
+   * computed by this operator.
+   */
+  const coords_t & region_end() const noexcept
+  {
+    return _region_end;
+  }
+
+  /**
+   * Local coordinates of the first point in the inner region.
+   */
+  const coords_t & inner_begin() const noexcept
+  {
+    return _inner_begin;
+  }
+
+  /**
+   * Local coordinates past the last point in the inner region.
+   */
+  const coords_t & inner_end() const noexcept
+  {
+    return _inner_end;
+  }
+
+  /**
+   * Applies the kernel to all points of the local block and writes the
+   * results to \c result, which must have the same pattern as the input
+   * matrix.
+   *
+   * Collective operation: units are synchronized before halo regions are
+   * fetched from their neighbors.
+   */
+  template<class StencilKernel>
+  void apply(
+    MatrixT       & result,
+    StencilKernel   kernel)
+  {
+    DASH_ASSERT_MSG(result.pattern() == _matrix.pattern(),
+                    "StencilOperator.apply: "
+                    "patterns of input and result matrix differ");
+    // Neighbors must have finished updating their boundary elements:
+    _matrix.barrier();
+    _plan.start();
+    apply_inner(result, kernel);
+    _plan.wait();
+    apply_boundary(result, kernel);
+  }
+
+  /**
+   * Applies the kernel to all points of the inner region, independent of
+   * halo regions.
+   */
+  template<class StencilKernel>
+  void apply_inner(
+    MatrixT       & result,
+    StencilKernel   kernel)
+  {
+    const value_t * in  = _matrix.lbegin();
+    value_t       * out = result.lbegin();
+    const auto strides  = _strides;
+    for_each_row(_inner_begin, _inner_end,
+      [&](const coords_t & row, index_type nelem) {
+        index_type offset = offset_of(row);
+        const value_t * row_in  = in  + offset;
+        value_t       * row_out = out + offset;
+        for (index_type i = 0; i < nelem; ++i) {
+          row_out[i] = kernel(stencil_point(row_in + i, strides));
+        }
+      });
+  }
+
+  /**
+   * Applies the kernel to all points of the boundary region, halo regions
+   * must have been updated.
+   */
+  template<class StencilKernel>
+  void apply_boundary(
+    MatrixT       & result,
+    StencilKernel   kernel)
+  {
+    value_t * out = result.lbegin();
+    for_each_row(_region_begin, _region_end,
+      [&](const coords_t & row, index_type nelem) {
+        // Inner points in this row, if any:
+        bool       row_inner   = true;
+        for (dim_t d = 0; d < NumDimensions; ++d) {
+          if (d != FastestDim &&
+              (row[d] < _inner_begin[d] || row[d] >= _inner_end[d])) {
+            row_inner = false;
+          }
+        }
+        index_type inner_begin = row_inner
+                                 ? _inner_begin[FastestDim] - row[FastestDim]
+                                 : nelem;
+        index_type inner_end   = row_inner
+                                 ? _inner_end[FastestDim] - row[FastestDim]
+                                 : nelem;
+        inner_begin = std::max<index_type>(0, std::min(inner_begin, nelem));
+        inner_end   = std::max<index_type>(inner_begin,
+                                           std::min(inner_end, nelem));
+        coords_t point = row;
+        for (index_type i = 0; i < nelem; ++i) {
+          if (i == inner_begin && inner_end > inner_begin) {
+            i = inner_end - 1;
+            continue;
+          }
+          point[FastestDim] = row[FastestDim] + i;
+          load_patch(point);
+          out[offset_of(point)] = kernel(
+                                    stencil_point(
+                                      _patch.data() + _patch_center,
+                                      _patch_strides));
+        }
+      });
+  }
+
+private:
+  /**
+   * Resolves the region of computed points and the inner region in local
+   * coordinates.
+   */
+  void init_regions()
+  {
+    const auto & view = _plan.view();
+    for (dim_t d = 0; d < NumDimensions; ++d) {
+      index_type extent      = view.extent(d);
+      index_type width_minus = std::abs(_halospec.halo_offset(d).minus);
+      index_type width_plus  = _halospec.halo_offset(d).plus;
+      typename plan_t::direction_t dir_minus;
+      typename plan_t::direction_t dir_plus;
+      dir_minus.fill(0);
+      dir_plus.fill(0);
+      dir_minus[d] = -1;
+      dir_plus[d]  = 1;
+      bool halo_minus = (width_minus == 0 ||
+                         _plan.region(dir_minus) != nullptr);
+      bool halo_plus  = (width_plus  == 0 ||
+                         _plan.region(dir_plus)  != nullptr);
+      _region_begin[d] = halo_minus ? 0      : width_minus;
+      _region_end[d]   = halo_plus  ? extent : extent - width_plus;
+      _inner_begin[d]  = std::min(width_minus, extent);
+      _inner_end[d]    = std::max(_inner_begin[d], extent - width_plus);
+      _region_end[d]   = std::max(_region_begin[d], _region_end[d]);
+    }
+    DASH_LOG_DEBUG("StencilOperator.init_regions",
+                   "region:", _region_begin, _region_end,
+                   "inner:",  _inner_begin,  _inner_end);
+  }
+
+  /**
+   * Offset of the point with given local coordinates in local memory.
+   */
+  inline index_type offset_of(const coords_t & coords) const
+  {
+    index_type offset = 0;
+    for (dim_t d = 0; d < NumDimensions; ++d) {
+      offset += coords[d] * _strides[d];
+    }
+    return offset;
+  }
+
+  /**
+   * Invokes \c row_func(row_begin, nelem) on every row of points in the
+   * given region that are contiguous in local memory.
+   */
+  template<class RowFunction>
+  void for_each_row(
+    const coords_t & begin,
+    const coords_t & end,
+    RowFunction      row_func) const
+  {
+    index_type nrows = 1;
+    for (dim_t d = 0; d < NumDimensions; ++d) {
+      if (end[d] <= begin[d]) {
+        return;
+      }
+      if (d != FastestDim) {
+        nrows *= end[d] - begin[d];
+      }
+    }
+    index_type nelem = end[FastestDim] - begin[FastestDim];
+    coords_t   row   = begin;
+    for (index_type r = 0; r < nrows; ++r) {
+      index_type r_rest = r;
+      for (dim_t i = 0; i < NumDimensions; ++i) {
+        dim_t d = (MemoryArrange == ROW_MAJOR) ? NumDimensions - 1 - i : i;
+        if (d == FastestDim) {
+          continue;
+        }
+        index_type extent = end[d] - begin[d];
+        row[d]  = begin[d] + r_rest % extent;
+        r_rest /= extent;
+      }
+      row_func(row, nelem);
+    }
+  }
+
+  /**
+   * Copies the stencil of the given point from local memory and halo
+   * regions to the stencil patch. Stencil elements in halo regions that
+   * are not exchanged are default-initialized.
+   */
+  void load_patch(const coords_t & point)
+  {
+    coords_t coords;
+    for (size_type p = 0; p < _patch.size(); ++p) {
+      size_type p_rest = p;
+      for (dim_t i = 0; i < NumDimensions; ++i) {
+        dim_t d = (MemoryArrange == ROW_MAJOR) ? NumDimensions - 1 - i : i;
+        coords[d] = point[d] +
+                    static_cast<index_type>(p_rest % _patch_extents[d]) -
+                    std::abs(_halospec.halo_offset(d).minus);
+        p_rest   /= _patch_extents[d];
+      }
+      const value_t * element = _plan.element_ptr(coords);
+      _patch[p] = (element != nullptr) ? *element : value_t();
+    }
+  }
+
+private:
+  MatrixT                                 & _matrix;
+  const HaloSpecT                         & _halospec;
+  plan_t                                    _plan;
+  /// Strides of the local block in memory order
+  coords_t                                  _strides;
+  /// Region of computed points in local coordinates
+  coords_t                                  _region_begin;
+  coords_t                                  _region_end;
+  /// Inner region in local coordinates
+  coords_t                                  _inner_begin;
+  coords_t                                  _inner_end;
+  /// Dense copy of the stencil of a boundary point
+  std::vector<value_t>                      _patch;
+  std::array<size_type, NumDimensions>      _patch_extents;
+  coords_t                                  _patch_strides;
+  index_type                                _patch_center;
+
+}; // class StencilOperator
+
+}  // namespace experimental
+}  // namespace dash
+
+#endif  // DASH__EXPERIMENTAL__STENCIL_OPERATOR_H__INCLUDED
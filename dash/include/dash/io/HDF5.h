@@ -3,5 +3,6 @@
 
 #include <dash/io/hdf5/StorageDriver.h>
 #include <dash/io/hdf5/IOStream.h>
+#include <dash/io/hdf5/CheckpointEngine.h>
 
 #endif
@@ -0,0 +1,6 @@
+#ifndef DASH__IO__MPIIO_H__INCLUDED
+#define DASH__IO__MPIIO_H__INCLUDED
+
+#include <dash/io/mpiio/StorageDriver.h>
+
+#endif
@@ -0,0 +1,6 @@
+#ifndef DASH__IO__TEXT_H__INCLUDED
+#define DASH__IO__TEXT_H__INCLUDED
+
+#include <dash/io/text/Ingest.h>
+
+#endif
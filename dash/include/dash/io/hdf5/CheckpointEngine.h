@@ -0,0 +1,455 @@
+#ifndef DASH__IO__HDF5__CHECKPOINT_ENGINE_H__
+#define DASH__IO__HDF5__CHECKPOINT_ENGINE_H__
+
+#include <dash/internal/Config.h>
+
+#ifdef DASH_ENABLE_HDF5
+
+#include <dash/io/hdf5/StorageDriver.h>
+
+#include <dash/Team.h>
+#include <dash/Shared.h>
+#include <dash/Init.h>
+#include <dash/Exception.h>
+
+#include <dash/dart/if/dart_communication.h>
+#include <dash/dart/if/dart_team_group.h>
+
+#include <hdf5.h>
+
+#include <algorithm>
+#include <condition_variable>
+#include <deque>
+#include <list>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include <unistd.h>
+
+namespace dash {
+namespace io {
+namespace hdf5 {
+
+/**
+ * Writes checkpoints of dash containers to HDF5 files asynchronously.
+ *
+ * \c write takes a node-local copy of the local blocks of a container into
+ * a staging buffer and returns immediately. The copy is written to the file
+ * using collective MPI-IO by a persistent I/O thread, so the container can
+ * be modified as soon as \c write returns.
+ *
+ * The number of staging buffers is bounded: if all buffers are occupied by
+ * pending checkpoints, \c write blocks until the oldest checkpoint is
+ * written.
+ *
+ * As the HDF5 library is not thread-safe, all HDF5 calls of the engine are
+ * performed by the I/O thread and no other HDF5 operations may be issued
+ * while checkpoints are pending, see \c wait.
+ * Requires thread support in MPI. If multi-threaded access is not
+ * supported, checkpoints are written synchronously in \c write.
+ *
+ * If a checkpoint cannot be written at any unit, the units agree on the
+ * failure and skip the checkpoint, which is reported by \c wait, or by
+ * \c write if checkpoints are written synchronously, at all units.
+ *
+ * Failures are agreed on in collective DART operations of the I/O thread,
+ * concurrent to DART operations of the caller. As creating and destroying
+ * teams is not synchronized with collective operations in DART, no teams
+ * may be created or destroyed while checkpoints are pending, i.e. after
+ * \c write and until \c wait returns.
+ *
+ * Example:
+ * \code
+ *  dash::io::hdf5::CheckpointEngine engine;
+ *  for (int step = 0; step < nsteps; ++step) {
+ *    compute(matrix);
+ *    engine.write(matrix, "checkpoint.hdf5", "step/" + std::to_string(step));
+ *  }
+ *  engine.wait();
+ * \endcode
+ */
+class CheckpointEngine {
+  typedef CheckpointEngine           self_t;
+  typedef StoreHDF::hdf5_staging_buffer staging_buffer_t;
+
+ private:
+  /// A checkpoint waiting to be written by the I/O thread
+  struct job_t {
+    /// Index of the staging buffer holding the local elements
+    size_t buffer_idx;
+    std::string filename;
+    /// Groups in which the dataset is stored
+    std::vector<std::string> path_vec;
+    std::string dataset;
+    hdf5_options foptions;
+    /// Create (truncate) the file instead of opening it
+    bool create_file;
+    std::vector<hsize_t> chunk_dims;
+    /// Pattern metadata, empty if not stored
+    std::vector<long> pattern_spec;
+    type_converter_fun_type to_h5_dt_converter;
+  };
+
+ public:
+  /**
+   * Creates a checkpoint engine for containers allocated by the given team.
+   *
+   * Collective operation.
+   */
+  CheckpointEngine(
+      /// Team which allocated the containers to store
+      dash::Team& team = dash::Team::All(),
+      /// Number of staging buffers, i.e. maximum number of pending
+      /// checkpoints
+      size_t num_buffers = 2)
+      : _team(&team), _async(dash::is_multithreaded()) {
+    DASH_ASSERT_GT(num_buffers, 0, "CheckpointEngine requires a buffer");
+    for (size_t b = 0; b < num_buffers; ++b) {
+      _buffers.emplace_back(new staging_buffer_t());
+      _free_buffers.push_back(b);
+    }
+    // setup mpi access, the communicator is duplicated by HDF5
+    _fapl_id = H5Pcreate(H5P_FILE_ACCESS);
+    DASH_ASSERT_RETURNS(dart__io__hdf5__prep_mpio(_fapl_id, team.dart_id()),
+                        DART_OK);
+    // failures are agreed on in a separate team, so collective operations
+    // of the I/O thread do not interleave with those of the caller
+    dart_group_t group;
+    DASH_ASSERT_RETURNS(dart_team_get_group(team.dart_id(), &group),
+                        DART_OK);
+    DASH_ASSERT_RETURNS(dart_team_create(team.dart_id(), group, &_io_team),
+                        DART_OK);
+    dart_group_destroy(&group);
+    if (_async) {
+      _io_thread = std::thread(&self_t::_process_jobs, this);
+    } else {
+      DASH_LOG_WARN(
+          "CheckpointEngine: DART does not support multi-threaded "
+          "access, blocking IO is used as fallback");
+    }
+  }
+
+  CheckpointEngine(const self_t&) = delete;
+  self_t& operator=(const self_t&) = delete;
+
+  /**
+   * Waits for all pending checkpoints and terminates the I/O thread.
+   * Failures of pending checkpoints are not reported.
+   *
+   * Collective operation.
+   */
+  ~CheckpointEngine() {
+    if (_async) {
+      {
+        std::lock_guard<std::mutex> lock(_mutex);
+        _shutdown = true;
+      }
+      _jobs_cv.notify_one();
+      _io_thread.join();
+    }
+    H5Pclose(_fapl_id);
+    if (dash::is_initialized()) {
+      dart_team_destroy(&_io_team);
+    }
+  }
+
+  /**
+   * Stores a snapshot of a dash::Array or dash::Matrix in an HDF5 file.
+   * Returns as soon as the local elements are copied to a staging buffer.
+   *
+   * Collective operation, must be called in the same order on all units.
+   */
+  template <typename Container_t>
+  void write(
+      /// Container to store
+      Container_t& container,
+      /// Filename of HDF5 file including extension
+      std::string filename,
+      /// HDF5 Dataset in which the data is stored
+      std::string datapath,
+      /// options how to open and modify data
+      hdf5_options foptions = hdf5_options(),
+      /// \cstd::function to convert native type into h5 type
+      type_converter_fun_type to_h5_dt_converter =
+          get_h5_datatype<typename Container_t::value_type>) {
+    static_assert(StoreHDF::_is_origin_view<Container_t>(),
+                  "CheckpointEngine only supports containers, not views");
+    DASH_ASSERT_MSG(container.team() == *_team,
+                    "Container is not allocated by the engine's team");
+    StoreHDF::_verify_container_dims(container);
+
+    job_t job;
+    job.filename = filename;
+    job.path_vec = StoreHDF::_split_string(datapath, '/');
+    job.dataset = job.path_vec.back();
+    job.path_vec.pop_back();
+    job.foptions = foptions;
+    job.create_file = foptions.overwrite_file || !_file_exists(filename);
+    job.chunk_dims = StoreHDF::_chunk_extents(container, foptions);
+    if (foptions.store_pattern) {
+      job.pattern_spec = StoreHDF::_pattern_metadata(container.pattern());
+    }
+    job.to_h5_dt_converter = to_h5_dt_converter;
+    job.buffer_idx = _acquire_buffer();
+
+    StoreHDF::_pack_local_blocks(container, *_buffers[job.buffer_idx]);
+    if (job.create_file) {
+      _known_files.push_back(filename);
+    }
+
+    if (!_async) {
+      bool written = _write_checkpoint(job);
+      _release_buffer(job.buffer_idx);
+      if (!written) {
+        DASH_THROW(dash::exception::RuntimeError,
+                   "CheckpointEngine: could not write checkpoint " <<
+                   datapath << " to " << filename);
+      }
+      return;
+    }
+    {
+      std::lock_guard<std::mutex> lock(_mutex);
+      _jobs.push_back(std::move(job));
+      ++_num_pending;
+    }
+    _jobs_cv.notify_one();
+    DASH_LOG_DEBUG("CheckpointEngine.write", "enqueued", datapath);
+  }
+
+  /**
+   * Waits until all pending checkpoints of the calling unit are written.
+   * Collective HDF5 operations and creating or destroying teams are not
+   * allowed before this call returns.
+   *
+   * \throws  dash::exception::RuntimeError  if any checkpoint written
+   *          since the last call could not be written. Failures are
+   *          agreed on by all units, so all units throw.
+   */
+  void wait() {
+    size_t num_failed;
+    {
+      std::unique_lock<std::mutex> lock(_mutex);
+      _done_cv.wait(lock, [this]() { return _num_pending == 0; });
+      num_failed   = _num_failed;
+      _num_failed  = 0;
+    }
+    if (num_failed > 0) {
+      DASH_THROW(dash::exception::RuntimeError,
+                 "CheckpointEngine: " << num_failed << " checkpoint(s) "
+                 "could not be written");
+    }
+    DASH_LOG_DEBUG("CheckpointEngine.wait", "all checkpoints written");
+  }
+
+  /**
+   * Number of checkpoints not written yet.
+   */
+  size_t pending() const {
+    std::lock_guard<std::mutex> lock(_mutex);
+    return _num_pending;
+  }
+
+  /**
+   * Number of staging buffers.
+   */
+  size_t num_buffers() const {
+    return _buffers.size();
+  }
+
+ private:
+  /**
+   * Whether a file exists, either on disk or as pending checkpoint
+   * which will be written before a later one.
+   * Collective operation.
+   */
+  bool _file_exists(const std::string& filename) {
+    if (std::find(_known_files.begin(), _known_files.end(), filename) !=
+        _known_files.end()) {
+      return true;
+    }
+    dash::Shared<int> f_exists(dash::team_unit_t(0), *_team);
+    if (_team->myid() == 0) {
+      f_exists.set(access(filename.c_str(), F_OK) != -1 ? 1 : 0);
+    }
+    _team->barrier();
+    return f_exists.get() > 0;
+  }
+
+  size_t _acquire_buffer() {
+    std::unique_lock<std::mutex> lock(_mutex);
+    _done_cv.wait(lock, [this]() { return !_free_buffers.empty(); });
+    size_t buffer_idx = _free_buffers.front();
+    _free_buffers.pop_front();
+    return buffer_idx;
+  }
+
+  void _release_buffer(size_t buffer_idx) {
+    std::lock_guard<std::mutex> lock(_mutex);
+    _free_buffers.push_back(buffer_idx);
+  }
+
+  /**
+   * Main loop of the I/O thread, writes checkpoints in order of their
+   * submission.
+   */
+  void _process_jobs() {
+    while (true) {
+      job_t job;
+      {
+        std::unique_lock<std::mutex> lock(_mutex);
+        _jobs_cv.wait(lock, [this]() { return _shutdown || !_jobs.empty(); });
+        if (_jobs.empty()) {
+          // shutdown requested and all checkpoints written
+          return;
+        }
+        job = std::move(_jobs.front());
+        _jobs.pop_front();
+      }
+      bool written = _write_checkpoint(job);
+      {
+        std::lock_guard<std::mutex> lock(_mutex);
+        _free_buffers.push_back(job.buffer_idx);
+        --_num_pending;
+        if (!written) {
+          ++_num_failed;
+        }
+      }
+      _done_cv.notify_all();
+    }
+  }
+
+  /**
+   * Whether an operation succeeded at all units of the engine's team.
+   * Collective operation, only called by the thread writing checkpoints.
+   */
+  bool _all_succeeded(bool succeeded) {
+    int l_failed = succeeded ? 0 : 1;
+    int g_failed = 0;
+    DASH_ASSERT_RETURNS(dart_allreduce(&l_failed, &g_failed, 1,
+                                       DART_TYPE_INT, DART_OP_MAX,
+                                       _io_team),
+                        DART_OK);
+    return g_failed == 0;
+  }
+
+  /**
+   * Writes a staged checkpoint, performs all HDF5 calls.
+   * Collective operation on the engine's team.
+   *
+   * \returns  false if the checkpoint could not be written at any unit
+   */
+  bool _write_checkpoint(const job_t& job) {
+    const staging_buffer_t& staging = *_buffers[job.buffer_idx];
+    const hdf5_options& foptions = job.foptions;
+
+    if (foptions.alignment > 0) {
+      H5Pset_alignment(_fapl_id, foptions.alignment,
+                       foptions.alignment_threshold);
+    } else {
+      // restore defaults
+      H5Pset_alignment(_fapl_id, 1, 1);
+    }
+
+    hid_t file_id;
+    if (job.create_file) {
+      file_id = H5Fcreate(job.filename.c_str(), H5F_ACC_TRUNC, H5P_DEFAULT,
+                          _fapl_id);
+    } else {
+      file_id = H5Fopen(job.filename.c_str(), H5F_ACC_RDWR, _fapl_id);
+    }
+    if (file_id < 0) {
+      DASH_LOG_ERROR("CheckpointEngine", "could not open file", job.filename);
+    }
+    // further HDF5 operations are collective, skip the checkpoint at all
+    // units if the file could not be opened at any unit
+    if (!_all_succeeded(file_id >= 0)) {
+      if (file_id >= 0) {
+        H5Fclose(file_id);
+      }
+      return false;
+    }
+
+    std::list<hid_t> open_groups;
+    hid_t loc_id = StoreHDF::_open_groups(file_id, job.path_vec, open_groups);
+
+    hid_t internal_type = H5Tcopy(job.to_h5_dt_converter());
+    hid_t h5dset;
+    if (foptions.modify_dataset) {
+      // Open dataset in RW mode
+      h5dset = H5Dopen(loc_id, job.dataset.c_str(), H5P_DEFAULT);
+    } else {
+      hid_t filespace = H5Screate_simple(staging.ndim,
+                                         staging.data_extf.data(), NULL);
+      hid_t dcpl_id = StoreHDF::_create_dataset_plist(job.chunk_dims,
+                                                      foptions);
+      h5dset = H5Dcreate(loc_id, job.dataset.c_str(), internal_type,
+                         filespace, H5P_DEFAULT, dcpl_id, H5P_DEFAULT);
+      H5Pclose(dcpl_id);
+      H5Sclose(filespace);
+    }
+
+    if (h5dset < 0) {
+      DASH_LOG_ERROR("CheckpointEngine", "could not open dataset",
+                     job.dataset);
+    }
+    bool written = _all_succeeded(h5dset >= 0);
+    if (written) {
+      StoreHDF::_write_staging_buffer(staging, h5dset, internal_type);
+
+      if (!job.pattern_spec.empty()) {
+        StoreHDF::_write_pattern_metadata(h5dset, job.pattern_spec,
+                                          foptions);
+      }
+    }
+
+    if (h5dset >= 0) {
+      H5Dclose(h5dset);
+    }
+    H5Tclose(internal_type);
+    std::for_each(open_groups.rbegin(), open_groups.rend(),
+                  [](hid_t& group_id) { H5Gclose(group_id); });
+    H5Fclose(file_id);
+    if (written) {
+      DASH_LOG_DEBUG("CheckpointEngine", "written",
+                     job.filename, job.dataset);
+    }
+    return written;
+  }
+
+ private:
+  dash::Team* _team;
+  /// Whether checkpoints are written by the I/O thread
+  bool _async;
+  /// File access property list using the team's communicator
+  hid_t _fapl_id;
+  /// Team of the engine's units used to agree on failed checkpoints
+  dart_team_t _io_team = DART_TEAM_NULL;
+
+  std::vector<std::unique_ptr<staging_buffer_t>> _buffers;
+  std::deque<size_t> _free_buffers;
+  /// Files written by this engine
+  std::vector<std::string> _known_files;
+
+  std::deque<job_t> _jobs;
+  size_t _num_pending = 0;
+  /// Number of checkpoints which could not be written since the last wait
+  size_t _num_failed = 0;
+  bool _shutdown = false;
+  mutable std::mutex _mutex;
+  /// Signals new jobs and shutdown to the I/O thread
+  std::condition_variable _jobs_cv;
+  /// Signals written checkpoints and released buffers
+  std::condition_variable _done_cv;
+  std::thread _io_thread;
+};
+
+}  // namespace hdf5
+}  // namespace io
+}  // namespace dash
+
+#endif  // DASH_ENABLE_HDF5
+
+#endif  // DASH__IO__HDF5__CHECKPOINT_ENGINE_H__
@@ -77,6 +77,49 @@ class modify_dataset {
   modify_dataset(bool modify = true) : _modify(modify) {}
 };
 
+/**
+ * Stream manipulator class to set the implementation
+ * used to write datasets.
+ */
+class driver {
+ public:
+  hdf5_driver _driver;
+
+ public:
+  driver(hdf5_driver drv = hdf5_driver::AUTO) : _driver(drv) {}
+};
+
+/**
+ * Stream manipulator class to store datasets in chunks
+ * matching the pattern's blocks, compressed using the
+ * deflate filter with the given level and optionally
+ * the shuffle filter.
+ */
+class compression {
+ public:
+  int _deflate_level;
+  bool _shuffle;
+
+ public:
+  compression(int deflate_level = 6, bool shuffle = true)
+      : _deflate_level(deflate_level), _shuffle(shuffle) {}
+};
+
+/**
+ * Stream manipulator class to align file objects of at
+ * least the given threshold size, e.g. to the stripe size
+ * of a parallel file system.
+ */
+class alignment {
+ public:
+  hsize_t _alignment;
+  hsize_t _threshold;
+
+ public:
+  alignment(hsize_t align, hsize_t threshold = 0)
+      : _alignment(align), _threshold(threshold) {}
+};
+
 /**
  * Converter function to convert non-POT types and especially structs to
  * HDF5 types.
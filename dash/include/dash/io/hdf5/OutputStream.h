@@ -136,6 +136,27 @@ class OutputStream : public ::dash::io::IOSBase<StreamMode> {
     return os;
   }
 
+  /// set implementation used to write datasets
+  friend OutputStream& operator<<(OutputStream& os, const driver drv) {
+    os._foptions.driver = drv._driver;
+    return os;
+  }
+
+  /// store chunked and compressed datasets
+  friend OutputStream& operator<<(OutputStream& os, const compression cmp) {
+    os._foptions.chunked = true;
+    os._foptions.deflate_level = cmp._deflate_level;
+    os._foptions.shuffle = cmp._shuffle;
+    return os;
+  }
+
+  /// set alignment of file objects
+  friend OutputStream& operator<<(OutputStream& os, const alignment algn) {
+    os._foptions.alignment = algn._alignment;
+    os._foptions.alignment_threshold = algn._threshold;
+    return os;
+  }
+
   /// custom type converter function to convert native type to HDF5 type
   friend OutputStream& operator<<(OutputStream& os, const type_converter conv) {
     os._converter = conv;
@@ -27,6 +27,7 @@
 #include <type_traits>
 #include <functional>
 #include <utility>
+#include <algorithm>
 
 #ifndef MPI_IMPL_ID
 #pragma error "HDF5 module requires dart-mpi"
@@ -45,6 +46,25 @@ hid_t get_h5_datatype();
 /// Type of converter function from native type to hdf5 datatype
 using type_converter_fun_type = std::function<hid_t()>;
 
+/**
+ * Implementations used to write a dataset.
+ */
+enum class hdf5_driver : uint8_t {
+  /// Select driver from pattern properties and number of hyperslabs
+  AUTO,
+  /**
+   * Write local memory of units directly, in one collective write per
+   * hyperslab. Requires patterns with linear layout, falls back to the
+   * buffered driver otherwise.
+   */
+  ZERO_COPY,
+  /**
+   * Pack local blocks into a staging buffer and write all blocks in a
+   * single collective write.
+   */
+  BUFFERED
+};
+
 /**
  * Options which can be passed to dash::io::StoreHDF::write
  * to specify how existing structures are treated and what
@@ -66,14 +86,46 @@ struct hdf5_options {
   bool restore_pattern = true;
   /// Metadata attribute key in HDF5 file.
   std::string pattern_metadata_key = "DASH_PATTERN";
+  /// Implementation used to write the dataset
+  hdf5_driver driver = hdf5_driver::AUTO;
+  /**
+   * Maximum size of the staging buffer of the buffered driver in bytes
+   * per unit, when selected automatically.
+   */
+  size_t buffered_max_bytes = 256 * 1024 * 1024;
+  /**
+   * Store dataset in chunks with the extents of the pattern's blocks, so
+   * every block of a unit is mapped to a whole chunk.
+   * Chunked layout is required for filters and is enabled implicitly if
+   * any filter is set.
+   * Ignored when modifying an existing dataset.
+   */
+  bool chunked = false;
+  /// Compression level of the deflate filter (1-9), 0 to disable
+  int deflate_level = 0;
+  /// Apply the shuffle filter before compression
+  bool shuffle = false;
+  /**
+   * Alignment of file objects in bytes, e.g. the stripe size of the
+   * parallel file system, 0 to disable.
+   * Only objects of at least \c alignment_threshold bytes are aligned.
+   */
+  hsize_t alignment = 0;
+  /// Minimum size of file objects in bytes to be aligned
+  hsize_t alignment_threshold = 0;
 };
 
+/** forward declaration */
+class CheckpointEngine;
+
 /**
  * DASH wrapper to store an dash::Array or dash::Matrix
  * in an HDF5 file using parallel IO.
  * All operations are collective.
  */
 class StoreHDF {
+  friend class CheckpointEngine;
+
   /**
    * test at compile time if pattern is compatible
    * \return true if pattern is compatible
@@ -167,6 +219,10 @@ class StoreHDF {
     plist_id = H5Pcreate(H5P_FILE_ACCESS);
     DASH_ASSERT_RETURNS(dart__io__hdf5__prep_mpio(plist_id, team.dart_id()),
                         DART_OK);
+    if (foptions.alignment > 0) {
+      H5Pset_alignment(plist_id, foptions.alignment,
+                       foptions.alignment_threshold);
+    }
 
     dash::Shared<int> f_exists;
     if (team.myid() == 0) {
@@ -192,22 +248,7 @@ class StoreHDF {
     H5Pclose(plist_id);
 
     // Traverse path
-    loc_id = file_id;
-    for (std::string elem : path_vec) {
-      if (H5Lexists(loc_id, elem.c_str(), H5P_DEFAULT)) {
-        // open group
-        DASH_LOG_DEBUG("Open Group", elem);
-        loc_id = H5Gopen2(loc_id, elem.c_str(), H5P_DEFAULT);
-      } else {
-        // create group
-        DASH_LOG_DEBUG("Create Group", elem);
-        loc_id = H5Gcreate2(loc_id, elem.c_str(), H5P_DEFAULT, H5P_DEFAULT,
-                            H5P_DEFAULT);
-      }
-      if (loc_id != file_id) {
-        open_groups.push_back(loc_id);
-      }
-    }
+    loc_id = _open_groups(file_id, path_vec, open_groups);
 
     // view extents are relevant (instead of pattern extents)
     auto filespace_extents = _get_container_extents(array);
@@ -221,8 +262,11 @@ class StoreHDF {
       h5dset = H5Dopen(loc_id, dataset.c_str(), H5P_DEFAULT);
     } else {
       // Create dataset
+      hid_t dcpl_id =
+          _create_dataset_plist(_chunk_extents(array, foptions), foptions);
       h5dset = H5Dcreate(loc_id, dataset.c_str(), internal_type, filespace,
-                         H5P_DEFAULT, H5P_DEFAULT, H5P_DEFAULT);
+                         H5P_DEFAULT, dcpl_id, H5P_DEFAULT);
+      H5Pclose(dcpl_id);
     }
 
     // Close global dataspace
@@ -230,7 +274,7 @@ class StoreHDF {
 
     // ----------- prepare and write dataset --------------
 
-    _write_dataset_impl(array, h5dset, internal_type);
+    _write_dataset_impl(array, h5dset, internal_type, foptions);
 
     // ----------- end prepare and write dataset --------------
 
@@ -439,6 +483,25 @@ class StoreHDF {
     hdf5_hyperslab_spec() {};
   };
 
+  /**
+   * Local elements of a unit packed in file order and the local blocks
+   * they are written to, as used by the buffered driver.
+   */
+  struct hdf5_staging_buffer {
+    /// Number of dimensions of the dataset
+    int ndim = 0;
+    /// Extents of the dataset
+    std::vector<hsize_t> data_extf;
+    /// Offsets of all local blocks in the dataset, ndim values per block
+    std::vector<hsize_t> block_offsets;
+    /// Extents of all local blocks, ndim values per block
+    std::vector<hsize_t> block_extents;
+    /// Number of packed elements
+    hsize_t nelem = 0;
+    /// Packed elements
+    std::vector<char> data;
+  };
+
  private:
   enum class Mode : uint16_t {
     READ = 0x1,
@@ -625,38 +688,127 @@ class StoreHDF {
     return;
   }
 
+  /**
+   * Open or create the groups in a path in an HDF5 file.
+   * \return  the innermost group, or the file if the path is empty
+   */
+  static hid_t _open_groups(hid_t file_id,
+                            const std::vector<std::string>& path_vec,
+                            std::list<hid_t>& open_groups) {
+    hid_t loc_id = file_id;
+    for (const std::string& elem : path_vec) {
+      if (H5Lexists(loc_id, elem.c_str(), H5P_DEFAULT)) {
+        // open group
+        DASH_LOG_DEBUG("Open Group", elem);
+        loc_id = H5Gopen2(loc_id, elem.c_str(), H5P_DEFAULT);
+      } else {
+        // create group
+        DASH_LOG_DEBUG("Create Group", elem);
+        loc_id = H5Gcreate2(loc_id, elem.c_str(), H5P_DEFAULT, H5P_DEFAULT,
+                            H5P_DEFAULT);
+      }
+      if (loc_id != file_id) {
+        open_groups.push_back(loc_id);
+      }
+    }
+    return loc_id;
+  }
+
+  /**
+   * Chunk extents of a container's dataset: the extents of the pattern's
+   * blocks if chunked layout is specified in the options, otherwise empty.
+   */
   template <typename Container_t>
   typename std::enable_if<
       _is_origin_view<Container_t>(),
-      void>::type static _store_pattern(Container_t& container, hid_t h5dset,
-                                        hdf5_options& foptions) {
-    using pattern_t = typename Container_t::pattern_type;
-    using extent_t = typename pattern_t::size_type;
-    constexpr auto ndim = pattern_t::ndim();
+      std::vector<hsize_t>>::type static _chunk_extents(
+          Container_t& container, const hdf5_options& foptions) {
+    constexpr auto ndim = Container_t::pattern_type::ndim();
 
+    std::vector<hsize_t> chunk_dims;
+    if (!foptions.chunked && foptions.deflate_level <= 0 &&
+        !foptions.shuffle) {
+      return chunk_dims;
+    }
     auto& pattern = container.pattern();
+    for (int i = 0; i < ndim; ++i) {
+      // chunks must not exceed the extents of fixed size datasets
+      chunk_dims.push_back(std::max<hsize_t>(
+          1, std::min<hsize_t>(pattern.blocksize(i), pattern.extent(i))));
+      DASH_LOG_DEBUG("chunk_dims", i, chunk_dims.back());
+    }
+    return chunk_dims;
+  }
 
-    auto pat_key = foptions.pattern_metadata_key.c_str();
-    extent_t pattern_spec[ndim * 4];
+  template <typename Container_t>
+  typename std::enable_if<
+      !_is_origin_view<Container_t>(),
+      std::vector<hsize_t>>::type static _chunk_extents(
+          Container_t& container, const hdf5_options& foptions) {
+    return std::vector<hsize_t>();
+  }
 
-    // Delete old attribute when overwriting dataset
-    if (foptions.modify_dataset) {
-      H5Adelete(h5dset, pat_key);
+  /**
+   * Create the dataset creation property list with chunked layout and
+   * filters as specified in the options.
+   */
+  static hid_t _create_dataset_plist(const std::vector<hsize_t>& chunk_dims,
+                                     const hdf5_options& foptions) {
+    hid_t dcpl_id = H5Pcreate(H5P_DATASET_CREATE);
+    if (chunk_dims.empty()) {
+      return dcpl_id;
     }
-    // Structure is
-    // sizespec, teamspec, blockspec, blocksize
+    H5Pset_chunk(dcpl_id, chunk_dims.size(), chunk_dims.data());
+    // Filters are applied in the order they are set
+    if (foptions.shuffle) {
+      H5Pset_shuffle(dcpl_id);
+    }
+    if (foptions.deflate_level > 0) {
+      H5Pset_deflate(dcpl_id, std::min(foptions.deflate_level, 9));
+    }
+    return dcpl_id;
+  }
+
+  template <typename Container_t>
+  typename std::enable_if<
+      _is_origin_view<Container_t>(),
+      void>::type static _store_pattern(Container_t& container, hid_t h5dset,
+                                        hdf5_options& foptions) {
+    _write_pattern_metadata(h5dset, _pattern_metadata(container.pattern()),
+                            foptions);
+  }
+
+  /**
+   * Pattern characteristics stored as metadata.
+   * Structure is sizespec, teamspec, blockspec, blocksize
+   */
+  template <class pattern_t>
+  static std::vector<long> _pattern_metadata(const pattern_t& pattern) {
+    constexpr auto ndim = pattern_t::ndim();
+    std::vector<long> pattern_spec(ndim * 4);
     for (int i = 0; i < ndim; ++i) {
       pattern_spec[i] = pattern.sizespec().extent(i);
       pattern_spec[i + ndim] = pattern.teamspec().extent(i);
       pattern_spec[i + (ndim * 2)] = pattern.blockspec().extent(i);
       pattern_spec[i + (ndim * 3)] = pattern.blocksize(i);
     }
+    return pattern_spec;
+  }
 
-    hsize_t attr_len[] = {static_cast<hsize_t>(ndim * 4)};
+  static void _write_pattern_metadata(hid_t h5dset,
+                                      const std::vector<long>& pattern_spec,
+                                      const hdf5_options& foptions) {
+    auto pat_key = foptions.pattern_metadata_key.c_str();
+
+    // Delete old attribute when overwriting dataset
+    if (foptions.modify_dataset) {
+      H5Adelete(h5dset, pat_key);
+    }
+    hsize_t attr_len[] = {static_cast<hsize_t>(pattern_spec.size())};
     hid_t attrspace = H5Screate_simple(1, attr_len, NULL);
     hid_t attribute_id = H5Acreate(h5dset, pat_key, H5T_NATIVE_LONG, attrspace,
                                    H5P_DEFAULT, H5P_DEFAULT);
-    H5Awrite(attribute_id, H5T_NATIVE_LONG, &pattern_spec);
+    H5Awrite(attribute_id, H5T_NATIVE_LONG, pattern_spec.data());
     H5Aclose(attribute_id);
     H5Sclose(attrspace);
   }
@@ -720,7 +872,11 @@ class StoreHDF {
    * Switches between different write implementations based on pattern
    * and container types.
    *
-   * Specializes for cases which can be zero-copy implemented
+   * Specializes for cases which can be zero-copy implemented.
+   * The zero-copy implementation issues one collective write per
+   * hyperslab, which is replaced by a single collective write of the
+   * buffered implementation if any unit contributes more than one
+   * hyperslab and no unit exceeds \c hdf5_options::buffered_max_bytes.
    */
   template <class Container_t>
   typename std::enable_if<
@@ -728,9 +884,14 @@ class StoreHDF {
           _compatible_pattern<typename Container_t::pattern_type>(),
       void>::type static _write_dataset_impl(Container_t& container,
                                              const hid_t& h5dset,
-                                             const hid_t& internal_type) {
-    _process_dataset_impl_zero_copy(StoreHDF::Mode::WRITE, container, h5dset,
-                                    internal_type);
+                                             const hid_t& internal_type,
+                                             const hdf5_options& foptions) {
+    if (_use_buffered_driver(container, foptions)) {
+      _write_dataset_impl_buffered(container, h5dset, internal_type);
+    } else {
+      _process_dataset_impl_zero_copy(StoreHDF::Mode::WRITE, container,
+                                      h5dset, internal_type);
+    }
   }
 
   /**
@@ -741,14 +902,64 @@ class StoreHDF {
   */
   template <class Container_t>
   typename std::enable_if<
-      !(_is_origin_view<Container_t>() &&
-        _compatible_pattern<typename Container_t::pattern_type>()),
+      _is_origin_view<Container_t>() &&
+          !_compatible_pattern<typename Container_t::pattern_type>(),
       void>::type static _write_dataset_impl(Container_t& container,
                                              const hid_t& h5dset,
-                                             const hid_t& internal_type) {
+                                             const hid_t& internal_type,
+                                             const hdf5_options& foptions) {
     _write_dataset_impl_buffered(container, h5dset, internal_type);
   }
 
+  /**
+  * Switches between different write implementations based on pattern
+  * and container types.
+  *
+  * Specializes for views
+  */
+  template <class Container_t>
+  typename std::enable_if<
+      !_is_origin_view<Container_t>(),
+      void>::type static _write_dataset_impl(Container_t& container,
+                                             const hid_t& h5dset,
+                                             const hid_t& internal_type,
+                                             const hdf5_options& foptions) {
+    DASH_THROW(dash::exception::NotImplemented,
+               "StoreHDF.write: writing views is not supported");
+  }
+
+  /**
+   * Whether a container with compatible pattern is written using the
+   * buffered implementation.
+   *
+   * Collective operation.
+   */
+  template <class Container_t>
+  static bool _use_buffered_driver(Container_t& container,
+                                   const hdf5_options& foptions) {
+    using value_t = typename Container_t::value_type;
+
+    if (foptions.driver != hdf5_driver::AUTO) {
+      return foptions.driver == hdf5_driver::BUFFERED;
+    }
+    // Number of hyperslabs and whether the staging buffer exceeds its
+    // maximum size:
+    long local_params[2] = {
+      static_cast<long>(_get_hdf_slabs(container.pattern()).size()),
+      (container.pattern().local_size() * sizeof(value_t) >
+       foptions.buffered_max_bytes) ? 1 : 0 };
+    long max_params[2];
+    DASH_ASSERT_RETURNS(dart_allreduce(local_params, max_params, 2,
+                                       dart_datatype<long>::value,
+                                       DART_OP_MAX,
+                                       container.team().dart_id()),
+                        DART_OK);
+    DASH_LOG_DEBUG("StoreHDF._use_buffered_driver",
+                   "max. hyperslabs:", max_params[0],
+                   "exceeds buffer:",  max_params[1]);
+    return max_params[0] > 1 && max_params[1] == 0;
+  }
+
   template <class Container_t>
   static void _process_dataset_impl_zero_copy(StoreHDF::Mode io_mode,
                                               Container_t& container,
@@ -760,6 +971,21 @@ class StoreHDF {
                                            const hid_t& h5dset,
                                            const hid_t& internal_type);
 
+  /**
+   * Pack the local elements of a container into a staging buffer.
+   * Does not call HDF5 or communicate.
+   */
+  template <class Container_t>
+  static void _pack_local_blocks(Container_t& container,
+                                 hdf5_staging_buffer& staging);
+
+  /**
+   * Write a staging buffer to a dataset in a single collective write.
+   */
+  static void _write_staging_buffer(const hdf5_staging_buffer& staging,
+                                    const hid_t& h5dset,
+                                    const hid_t& internal_type);
+
   template <typename ElementT, typename PatternT, dim_t NDim, dim_t NViewDim>
   static void _write_dataset_impl_nd_block(
       dash::MatrixRef<ElementT, NDim, NViewDim, PatternT>& container,
@@ -3,20 +3,138 @@
 
 #include <hdf5.h>
 #include <hdf5_hl.h>
+#include <vector>
+#include <utility>
+#include <algorithm>
+#include <cstring>
 
 namespace dash {
 namespace io {
 namespace hdf5 {
 
+/**
+ * Concept:
+ *  ______________
+ * |__|  |__|  |__|
+ * |  |__|  |__|  |
+ * |__|  |__|  |__|
+ * |  |__|  |__|  |
+ * |______________|
+ *
+ * 1. select the union of all local blocks in the file space
+ * 2. pack local elements into a staging buffer in the order of the
+ *    selection, i.e. in row-major order of their file coordinates
+ * 3. perform a single collective write
+ *
+ * Supports arbitrary patterns, in particular patterns with non-linear
+ * local memory layout like TilePattern.
+ */
 template <class Container_t>
 void StoreHDF::_write_dataset_impl_buffered(Container_t& container,
                                             const hid_t& h5dset,
                                             const hid_t& internal_type) {
-  // TODO
+  DASH_LOG_DEBUG("Use buffered impl");
+
+  hdf5_staging_buffer staging;
+  _pack_local_blocks(container, staging);
+  _write_staging_buffer(staging, h5dset, internal_type);
 }
 
-#endif  // DASH__IO__HDF5__INTERNAL_IMPL_BUFFERED_H__
+template <class Container_t>
+void StoreHDF::_pack_local_blocks(Container_t& container,
+                                  hdf5_staging_buffer& staging) {
+  using pattern_t = typename Container_t::pattern_type;
+  using index_t = typename pattern_t::index_type;
+  using value_t = typename Container_t::value_type;
+  constexpr auto ndim = pattern_t::ndim();
+
+  auto& pattern = container.pattern();
+  auto fs = _get_container_extents(container);
+  hsize_t local_size = pattern.local_size();
+
+  staging.ndim = ndim;
+  staging.nelem = local_size;
+  staging.data_extf.assign(fs.extent, fs.extent + ndim);
+  staging.block_offsets.clear();
+  staging.block_extents.clear();
+
+  // Offsets of local elements in the file space and their local indices
+  std::vector<std::pair<hsize_t, index_t>> file_offsets;
+  file_offsets.reserve(local_size);
+  for (index_t lidx = 0; lidx < static_cast<index_t>(local_size); ++lidx) {
+    auto gcoords = pattern.coords(pattern.global(lidx));
+    hsize_t file_offset = 0;
+    for (int i = 0; i < ndim; ++i) {
+      file_offset = file_offset * fs.extent[i] + gcoords[i];
+    }
+    file_offsets.push_back(std::make_pair(file_offset, lidx));
+  }
+  // Local elements are already in file order for most linear layouts
+  if (!std::is_sorted(file_offsets.begin(), file_offsets.end())) {
+    std::sort(file_offsets.begin(), file_offsets.end());
+  }
+
+  // Pack staging buffer, capacity is retained when buffers are reused
+  staging.data.resize(local_size * sizeof(value_t));
+  value_t* buffer = reinterpret_cast<value_t*>(staging.data.data());
+  const value_t* lbegin = container.lbegin();
+  for (hsize_t i = 0; i < local_size; ++i) {
+    std::memcpy(buffer + i, lbegin + file_offsets[i].second,
+                sizeof(value_t));
+  }
+
+  // Local blocks in file space
+  auto num_lblocks = pattern.local_blockspec().size();
+  for (index_t lblckidx = 0; lblckidx < num_lblocks; ++lblckidx) {
+    auto lblock = pattern.local_block(lblckidx);
+    if (lblock.size() == 0) {
+      continue;
+    }
+    for (int i = 0; i < ndim; ++i) {
+      staging.block_offsets.push_back(lblock.offset(i));
+      staging.block_extents.push_back(lblock.extent(i));
+    }
+  }
+  DASH_LOG_DEBUG("packed local blocks", num_lblocks,
+                 "local elements", local_size);
+}
+
+inline void StoreHDF::_write_staging_buffer(
+    const hdf5_staging_buffer& staging, const hid_t& h5dset,
+    const hid_t& internal_type) {
+  hid_t filespace = H5Dget_space(h5dset);
+
+  // Select union of local blocks in file space
+  H5Sselect_none(filespace);
+  auto ndim = staging.ndim;
+  for (size_t b = 0; b < staging.block_offsets.size(); b += ndim) {
+    H5Sselect_hyperslab(filespace, H5S_SELECT_OR,
+                        staging.block_offsets.data() + b, NULL,
+                        staging.block_extents.data() + b, NULL);
+  }
+
+  // Memory space of staging buffer, units without local elements
+  // contribute an empty selection
+  hsize_t data_dimsm[1] = {std::max<hsize_t>(staging.nelem, 1)};
+  hid_t memspace = H5Screate_simple(1, data_dimsm, NULL);
+  if (staging.nelem == 0) {
+    H5Sselect_none(memspace);
+  }
+
+  // Create property list for collective writes
+  hid_t plist_id = H5Pcreate(H5P_DATASET_XFER);
+  H5Pset_dxpl_mpio(plist_id, H5FD_MPIO_COLLECTIVE);
+
+  H5Dwrite(h5dset, internal_type, memspace, filespace, plist_id,
+           staging.data.data());
+
+  H5Sclose(memspace);
+  H5Sclose(filespace);
+  H5Pclose(plist_id);
+}
 
 }  // namespace hdf5
 }  // namespace io
-}  // namespace dash
\ No newline at end of file
+}  // namespace dash
+
+#endif  // DASH__IO__HDF5__INTERNAL_IMPL_BUFFERED_H__
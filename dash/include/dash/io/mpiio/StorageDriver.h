@@ -0,0 +1,414 @@
+#ifndef DASH__IO__MPIIO__STORAGEDRIVER_H__
+#define DASH__IO__MPIIO__STORAGEDRIVER_H__
+
+#include <dash/internal/Config.h>
+
+#include <dash/Exception.h>
+#include <dash/Types.h>
+#include <dash/Team.h>
+#include <dash/Array.h>
+#include <dash/Matrix.h>
+
+#include <dash/dart/if/dart_io.h>
+
+#include <algorithm>
+#include <array>
+#include <cstdint>
+#include <cstring>
+#include <string>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+#ifndef MPI_IMPL_ID
+#pragma error "MPI-IO module requires dart-mpi"
+#endif
+
+namespace dash {
+namespace io {
+namespace mpiio {
+
+/**
+ * Options which can be passed to dash::io::mpiio::StoreMPIIO to specify
+ * how containers are stored and restored.
+ */
+struct mpiio_options {
+  /**
+   * Restore the pattern stored in the file when reading into a container
+   * which is not allocated yet. The pattern can only be restored if the
+   * number of units did not change, otherwise a default pattern is used.
+   */
+  bool restore_pattern = true;
+  /// Alignment of the data section in the file in bytes
+  size_t alignment = 4096;
+};
+
+/**
+ * DASH wrapper to store a dash::Array or dash::Matrix in a binary file
+ * using MPI-IO, without dependency on HDF5.
+ *
+ * The file consists of a header describing the element type, extents and
+ * pattern of the container, followed by the elements in canonical
+ * (row-major) order at an aligned offset. The file is independent of the
+ * number of units and the pattern, so a container can be restored onto a
+ * different number of units: every unit reads its local elements
+ * according to the pattern of the restored container.
+ *
+ * Elements are stored in native byte order.
+ *
+ * Example:
+ * \code
+ *  dash::Matrix<double, 2> matrix(1000, 1000);
+ *  StoreMPIIO::write(matrix, "checkpoint.bin");
+ *  // ... restart, possibly with a different number of units
+ *  dash::Matrix<double, 2> restored;
+ *  StoreMPIIO::read(restored, "checkpoint.bin");
+ * \endcode
+ *
+ * All operations are collective.
+ */
+class StoreMPIIO {
+ public:
+  /**
+   * Fixed-size part of the file header, followed by the pattern
+   * specification of \c ndim * 4 values: sizespec, teamspec, blockspec
+   * and blocksize.
+   */
+  struct file_header {
+    char magic[8];
+    uint64_t version;
+    uint64_t ndim;
+    uint64_t element_size;
+    /// \c dart_datatype_t of the element type, undefined for custom types
+    int64_t element_type;
+    /// Offset of the first element in the file
+    uint64_t data_offset;
+  };
+
+ private:
+  /// Identifies DASH binary files
+  static const char* _magic() { return "DASHBIN"; }
+  /// Version of the file format
+  static uint64_t _version() { return 1; }
+
+  template <class ViewType>
+  static constexpr bool _is_origin_view() {
+    return dash::view_traits<ViewType>::is_origin::value;
+  }
+
+ public:
+  /**
+   * Store a dash::Array or dash::Matrix in a binary file using parallel
+   * IO. An existing file is overwritten.
+   *
+   * Collective operation.
+   */
+  template <typename Container_t>
+  static void write(
+      /// Container to store
+      Container_t& container,
+      /// Filename of the binary file
+      std::string filename,
+      /// options how to store the data
+      mpiio_options foptions = mpiio_options()) {
+    using pattern_t = typename Container_t::pattern_type;
+    using value_t = typename Container_t::value_type;
+    constexpr auto ndim = pattern_t::ndim();
+
+    static_assert(_is_origin_view<Container_t>(),
+                  "StoreMPIIO only supports containers, not views");
+
+    auto& pattern = container.pattern();
+    auto& team = container.team();
+
+    auto pattern_spec = _pattern_metadata(pattern);
+    file_header header;
+    std::memset(&header, 0, sizeof(file_header));
+    std::strncpy(header.magic, _magic(), sizeof(header.magic));
+    header.version = _version();
+    header.ndim = ndim;
+    header.element_size = sizeof(value_t);
+    header.element_type = dash::dart_datatype<value_t>::value;
+    header.data_offset =
+        _data_offset(_header_size(ndim), foptions.alignment);
+
+    dart_file_t file;
+    DASH_ASSERT_RETURNS(
+        dart__io__file_open(team.dart_id(), filename.c_str(),
+                            DART_FILE_WRITE | DART_FILE_CREATE, &file),
+        DART_OK);
+
+    if (team.myid() == 0) {
+      std::vector<char> hbuf(_header_size(ndim));
+      std::memcpy(hbuf.data(), &header, sizeof(file_header));
+      std::memcpy(hbuf.data() + sizeof(file_header), pattern_spec.data(),
+                  pattern_spec.size() * sizeof(int64_t));
+      DASH_ASSERT_RETURNS(
+          dart__io__file_write_at(file, 0, hbuf.data(), hbuf.size()),
+          DART_OK);
+    }
+
+    // File view consisting of the local elements in file order
+    std::vector<std::pair<size_t, size_t>> file_order;
+    std::vector<size_t> run_offsets;
+    std::vector<size_t> run_nbytes;
+    bool in_order =
+        _local_file_order(pattern, file_order, run_offsets, run_nbytes,
+                          sizeof(value_t));
+    DASH_ASSERT_RETURNS(
+        dart__io__file_set_view(file, header.data_offset, run_offsets.size(),
+                                run_offsets.data(), run_nbytes.data()),
+        DART_OK);
+
+    size_t nbytes = file_order.size() * sizeof(value_t);
+    const value_t* lbegin = container.lbegin();
+    if (in_order) {
+      // Local memory order matches file order, write without staging
+      DASH_ASSERT_RETURNS(
+          dart__io__file_write_at_all(file, 0, lbegin, nbytes), DART_OK);
+    } else {
+      std::vector<value_t> staging(file_order.size());
+      for (size_t i = 0; i < file_order.size(); ++i) {
+        staging[i] = lbegin[file_order[i].second];
+      }
+      DASH_ASSERT_RETURNS(
+          dart__io__file_write_at_all(file, 0, staging.data(), nbytes),
+          DART_OK);
+    }
+    DASH_LOG_DEBUG("StoreMPIIO.write", "written bytes", nbytes,
+                   "runs", run_offsets.size());
+
+    DASH_ASSERT_RETURNS(dart__io__file_close(&file), DART_OK);
+    team.barrier();
+  }
+
+  /**
+   * Read a binary file into a dash container using parallel IO.
+   * If the container is already allocated, its extents have to match
+   * the extents stored in the file. Otherwise the container is allocated
+   * with the stored pattern or, if the number of units differs, with a
+   * default pattern.
+   *
+   * Collective operation.
+   */
+  template <typename Container_t>
+  static void read(
+      /// Import data in this container
+      Container_t& container,
+      /// Filename of the binary file
+      std::string filename,
+      /// options how to restore the data
+      mpiio_options foptions = mpiio_options()) {
+    using pattern_t = typename Container_t::pattern_type;
+    using extent_t = typename pattern_t::size_type;
+    using value_t = typename Container_t::value_type;
+    constexpr auto ndim = pattern_t::ndim();
+
+    static_assert(_is_origin_view<Container_t>(),
+                  "StoreMPIIO only supports containers, not views");
+
+    // Check if container is already allocated
+    bool is_alloc = (container.size() != 0);
+    // Team of the allocated container, or the team to allocate it
+    dash::Team& team = dash::Team::All();
+    dart_team_t teamid =
+        is_alloc ? container.team().dart_id() : team.dart_id();
+
+    dart_file_t file;
+    DASH_ASSERT_RETURNS(dart__io__file_open(teamid, filename.c_str(),
+                                            DART_FILE_READ, &file),
+                        DART_OK);
+
+    // All units read the header
+    std::vector<char> hbuf(_header_size(ndim));
+    size_t file_size;
+    DASH_ASSERT_RETURNS(dart__io__file_size(file, &file_size), DART_OK);
+    if (file_size < hbuf.size()) {
+      dart__io__file_close(&file);
+      DASH_THROW(dash::exception::InvalidArgument,
+                 "File " << filename << " is not a DASH binary file");
+    }
+    DASH_ASSERT_RETURNS(
+        dart__io__file_read_at_all(file, 0, hbuf.data(), hbuf.size()),
+        DART_OK);
+    file_header header;
+    std::vector<int64_t> pattern_spec(ndim * 4);
+    std::memcpy(&header, hbuf.data(), sizeof(file_header));
+    std::memcpy(pattern_spec.data(), hbuf.data() + sizeof(file_header),
+                pattern_spec.size() * sizeof(int64_t));
+    _verify_header<value_t>(header, ndim, filename);
+
+    std::array<extent_t, ndim> size_extents;
+    std::array<extent_t, ndim> team_extents;
+    std::array<dash::Distribution, ndim> dist_extents;
+    size_t num_stored_units = 1;
+    for (int i = 0; i < ndim; ++i) {
+      size_extents[i] = static_cast<extent_t>(pattern_spec[i]);
+      team_extents[i] = static_cast<extent_t>(pattern_spec[i + ndim]);
+      dist_extents[i] = dash::TILE(pattern_spec[i + (ndim * 3)]);
+      num_stored_units *= team_extents[i];
+    }
+
+    if (is_alloc) {
+      DASH_LOG_DEBUG("StoreMPIIO.read", "container already allocated");
+      for (int i = 0; i < ndim; ++i) {
+        DASH_ASSERT_EQ(size_extents[i], container.pattern().extent(i),
+                       "Container extents do not match data extents");
+      }
+    } else if (foptions.restore_pattern && num_stored_units == team.size()) {
+      DASH_LOG_DEBUG("StoreMPIIO.read", "restore pattern");
+      const pattern_t pattern(dash::SizeSpec<ndim>(size_extents),
+                              dash::DistributionSpec<ndim>(dist_extents),
+                              dash::TeamSpec<ndim>(team_extents), team);
+      container.allocate(pattern);
+    } else {
+      DASH_LOG_DEBUG("StoreMPIIO.read", "redistribute from",
+                     num_stored_units, "to", team.size(), "units");
+      const pattern_t pattern(dash::SizeSpec<ndim>(size_extents),
+                              dash::DistributionSpec<ndim>(),
+                              dash::TeamSpec<ndim>(team), team);
+      container.allocate(pattern);
+    }
+
+    // File view consisting of the local elements in file order
+    std::vector<std::pair<size_t, size_t>> file_order;
+    std::vector<size_t> run_offsets;
+    std::vector<size_t> run_nbytes;
+    bool in_order =
+        _local_file_order(container.pattern(), file_order, run_offsets,
+                          run_nbytes, sizeof(value_t));
+    DASH_ASSERT_RETURNS(
+        dart__io__file_set_view(file, header.data_offset, run_offsets.size(),
+                                run_offsets.data(), run_nbytes.data()),
+        DART_OK);
+
+    size_t nbytes = file_order.size() * sizeof(value_t);
+    value_t* lbegin = container.lbegin();
+    if (in_order) {
+      DASH_ASSERT_RETURNS(
+          dart__io__file_read_at_all(file, 0, lbegin, nbytes), DART_OK);
+    } else {
+      std::vector<value_t> staging(file_order.size());
+      DASH_ASSERT_RETURNS(
+          dart__io__file_read_at_all(file, 0, staging.data(), nbytes),
+          DART_OK);
+      for (size_t i = 0; i < file_order.size(); ++i) {
+        lbegin[file_order[i].second] = staging[i];
+      }
+    }
+    DASH_LOG_DEBUG("StoreMPIIO.read", "read bytes", nbytes,
+                   "runs", run_offsets.size());
+
+    DASH_ASSERT_RETURNS(dart__io__file_close(&file), DART_OK);
+    container.team().barrier();
+  }
+
+ private:
+  static constexpr size_t _header_size(dim_t ndim) {
+    return sizeof(file_header) + ndim * 4 * sizeof(int64_t);
+  }
+
+  static size_t _data_offset(size_t header_size, size_t alignment) {
+    if (alignment <= 1) {
+      return header_size;
+    }
+    return ((header_size + alignment - 1) / alignment) * alignment;
+  }
+
+  /**
+   * Pattern characteristics stored in the header.
+   * Structure is sizespec, teamspec, blockspec, blocksize
+   */
+  template <class pattern_t>
+  static std::vector<int64_t> _pattern_metadata(const pattern_t& pattern) {
+    constexpr auto ndim = pattern_t::ndim();
+    std::vector<int64_t> pattern_spec(ndim * 4);
+    for (int i = 0; i < ndim; ++i) {
+      pattern_spec[i] = pattern.sizespec().extent(i);
+      pattern_spec[i + ndim] = pattern.teamspec().extent(i);
+      pattern_spec[i + (ndim * 2)] = pattern.blockspec().extent(i);
+      pattern_spec[i + (ndim * 3)] = pattern.blocksize(i);
+    }
+    return pattern_spec;
+  }
+
+  template <typename value_t>
+  static void _verify_header(const file_header& header, dim_t ndim,
+                             const std::string& filename) {
+    if (std::strncmp(header.magic, _magic(), sizeof(header.magic)) != 0 ||
+        header.version != _version()) {
+      DASH_THROW(dash::exception::InvalidArgument,
+                 "File " << filename << " is not a DASH binary file "
+                 "of version " << _version());
+    }
+    if (header.ndim != static_cast<uint64_t>(ndim)) {
+      DASH_THROW(dash::exception::InvalidArgument,
+                 "Data dimension " << header.ndim << " in " << filename
+                 << " does not match container dimension " << ndim);
+    }
+    dart_datatype_t dtype = dash::dart_datatype<value_t>::value;
+    if (header.element_size != sizeof(value_t) ||
+        (dtype != DART_TYPE_UNDEFINED &&
+         header.element_type != DART_TYPE_UNDEFINED &&
+         header.element_type != dtype)) {
+      DASH_THROW(dash::exception::InvalidArgument,
+                 "Element type in " << filename
+                 << " does not match container element type");
+    }
+  }
+
+  /**
+   * Offsets of the local elements in the file, in file order, and the
+   * contiguous byte runs they form.
+   *
+   * \return  true if the local elements are stored in file order
+   */
+  template <class pattern_t>
+  static bool _local_file_order(
+      const pattern_t& pattern,
+      /// (file offset, local index) of all local elements
+      std::vector<std::pair<size_t, size_t>>& file_order,
+      std::vector<size_t>& run_offsets, std::vector<size_t>& run_nbytes,
+      size_t element_size) {
+    using index_t = typename pattern_t::index_type;
+    constexpr auto ndim = pattern_t::ndim();
+
+    size_t local_size = pattern.local_size();
+    file_order.clear();
+    file_order.reserve(local_size);
+    for (size_t lidx = 0; lidx < local_size; ++lidx) {
+      auto gcoords =
+          pattern.coords(pattern.global(static_cast<index_t>(lidx)));
+      size_t file_offset = 0;
+      for (int i = 0; i < ndim; ++i) {
+        file_offset = file_offset * pattern.extent(i) + gcoords[i];
+      }
+      file_order.push_back(std::make_pair(file_offset, lidx));
+    }
+    bool in_order = std::is_sorted(file_order.begin(), file_order.end());
+    if (!in_order) {
+      std::sort(file_order.begin(), file_order.end());
+    }
+
+    // Merge consecutive elements to runs
+    run_offsets.clear();
+    run_nbytes.clear();
+    for (size_t i = 0; i < file_order.size(); ++i) {
+      size_t offset = file_order[i].first * element_size;
+      if (!run_offsets.empty() &&
+          run_offsets.back() + run_nbytes.back() == offset) {
+        run_nbytes.back() += element_size;
+      } else {
+        run_offsets.push_back(offset);
+        run_nbytes.push_back(element_size);
+      }
+    }
+    return in_order;
+  }
+};
+
+}  // namespace mpiio
+}  // namespace io
+}  // namespace dash
+
+#endif  // DASH__IO__MPIIO__STORAGEDRIVER_H__
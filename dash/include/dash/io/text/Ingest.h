@@ -0,0 +1,568 @@
+#ifndef DASH__IO__TEXT__INGEST_H__
+#define DASH__IO__TEXT__INGEST_H__
+
+#include <dash/internal/Config.h>
+
+#include <dash/Exception.h>
+#include <dash/Types.h>
+#include <dash/Team.h>
+#include <dash/Array.h>
+#include <dash/UnorderedMap.h>
+#include <dash/ExecutionPolicy.h>
+
+#include <dash/algorithm/internal/ParallelFor.h>
+
+#include <dash/internal/Logging.h>
+
+#include <dash/dart/if/dart_io.h>
+
+#include <algorithm>
+#include <cstring>
+#include <string>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+#ifndef MPI_IMPL_ID
+#pragma error "Text ingest module requires dart-mpi"
+#endif
+
+namespace dash {
+namespace io {
+namespace text {
+
+/**
+ * Options which can be passed to \c dash::io::text::ingest to specify
+ * how records are read from a text file.
+ */
+struct ingest_options {
+  /// Character terminating a record, the delimiter is not part of the
+  /// record passed to the parser
+  char record_delimiter = '\n';
+  /// Number of records at the beginning of the file to skip, e.g. header
+  /// lines of a CSV file
+  size_t skip_records = 0;
+  /// Number of bytes read by a unit in a single round. Bounds the memory
+  /// of buffers used for reading and routing records, unless a single
+  /// record exceeds it
+  size_t buffer_size = 4 * 1024 * 1024;
+};
+
+namespace internal {
+
+/// A record in the read buffer, excluding the delimiter
+typedef std::pair<const char *, const char *> record_t;
+
+/**
+ * Offset following the \c ndelim -th record delimiter at or after the
+ * given offset, or the file size if the file contains less delimiters.
+ */
+inline size_t find_record_start(
+  dart_file_t              file,
+  size_t                   file_size,
+  size_t                   offset,
+  size_t                   ndelim,
+  const ingest_options   & options)
+{
+  std::vector<char> buffer(std::min(options.buffer_size, file_size));
+  while (ndelim > 0 && offset < file_size) {
+    size_t nbytes = std::min(buffer.size(), file_size - offset);
+    DASH_ASSERT_RETURNS(
+      dart__io__file_read_at(file, offset, buffer.data(), nbytes),
+      DART_OK);
+    const char * pos = buffer.data();
+    const char * end = buffer.data() + nbytes;
+    while (ndelim > 0 && pos != end) {
+      const char * delim = static_cast<const char *>(
+                             std::memchr(pos, options.record_delimiter,
+                                         end - pos));
+      if (delim == nullptr) {
+        pos = end;
+        break;
+      }
+      pos = delim + 1;
+      --ndelim;
+    }
+    offset += pos - buffer.data();
+  }
+  return std::min(offset, file_size);
+}
+
+/**
+ * Reads the records starting in a byte range of a file in blocks of at
+ * most \c ingest_options::buffer_size bytes.
+ */
+class record_reader {
+ public:
+  /**
+   * Creates a reader of records starting in the byte range
+   * \c [range_begin, range_end). Records not starting at \c range_begin
+   * are skipped, records starting in the range are read beyond its end.
+   */
+  record_reader(
+    dart_file_t              file,
+    size_t                   file_size,
+    size_t                   data_begin,
+    size_t                   range_begin,
+    size_t                   range_end,
+    const ingest_options   & options)
+  : _file(file),
+    _file_size(file_size),
+    _range_end(range_end),
+    _options(options)
+  {
+    // Align begin of range to the first record starting in the range:
+    _pos = (range_begin <= data_begin)
+           ? data_begin
+           : find_record_start(file, file_size, range_begin - 1, 1, options);
+    DASH_LOG_TRACE("dash::io::text::record_reader", "range:",
+                   range_begin, "-", range_end, "aligned:", _pos);
+  }
+
+  /**
+   * Reads the next block of complete records into the read buffer.
+   * Records are valid until the next call.
+   *
+   * \return  \c false if all records in the range have been read.
+   */
+  bool next(std::vector<record_t> & records)
+  {
+    records.clear();
+    size_t nread = _options.buffer_size;
+    while (_pos < _range_end && _pos < _file_size) {
+      nread = std::min(nread, _file_size - _pos);
+      _buffer.resize(nread);
+      DASH_ASSERT_RETURNS(
+        dart__io__file_read_at(_file, _pos, _buffer.data(), nread),
+        DART_OK);
+      bool         at_eof = (_pos + nread == _file_size);
+      const char * begin  = _buffer.data();
+      const char * end    = begin + nread;
+      const char * rec    = begin;
+      while (rec != end &&
+             _pos + static_cast<size_t>(rec - begin) < _range_end) {
+        const char * delim = static_cast<const char *>(
+                               std::memchr(rec, _options.record_delimiter,
+                                           end - rec));
+        if (delim == nullptr) {
+          if (!at_eof) {
+            // Incomplete record, read again in next block
+            break;
+          }
+          // Last record in the file is not terminated
+          delim = end;
+        }
+        records.push_back(record_t(rec, delim));
+        rec = (delim == end) ? end : delim + 1;
+      }
+      if (!records.empty()) {
+        _pos += rec - begin;
+        return true;
+      }
+      // Record exceeds the buffer size
+      nread *= 2;
+    }
+    return false;
+  }
+
+ private:
+  dart_file_t              _file;
+  size_t                   _file_size;
+  size_t                   _range_end;
+  const ingest_options   & _options;
+  /// Offset of the next record to read
+  size_t                   _pos;
+  std::vector<char>        _buffer;
+};
+
+/**
+ * Reads records of a text file in parallel and routes them to their
+ * owning units.
+ *
+ * Every unit reads the records starting in its byte range of the file in
+ * rounds of at most \c ingest_options::buffer_size bytes. Records are
+ * converted to messages by \c parse_fun in parallel threads, messages are
+ * exchanged in a single alltoallv per round and passed to \c apply_fun at
+ * the receiving unit.
+ *
+ * \c parse_fun(record_index, first, last, message, unit) returns \c false
+ * for records to discard, \c record_index is the index of the record in
+ * the file excluding skipped records and is only valid if
+ * \c count_records is set.
+ *
+ * Messages are exchanged as bytes and must be trivially copyable.
+ *
+ * Collective operation.
+ */
+template <
+  class Message,
+  class ExecutionPolicy,
+  class ParseFun,
+  class ApplyFun,
+  class TotalFun >
+void ingest_records(
+  ExecutionPolicy        && policy,
+  const dash::Team        & team,
+  const std::string       & filename,
+  const ingest_options    & options,
+  bool                      count_records,
+  /// Called with the total number of records in the file before records
+  /// are parsed, if \c count_records is set. Records are not read if it
+  /// returns \c false
+  TotalFun                  total_fun,
+  ParseFun                  parse_fun,
+  ApplyFun                  apply_fun)
+{
+  static_assert(std::is_trivially_copyable<Message>::value,
+                "dash::io::text::ingest_records: messages are transferred "
+                "as bytes and must be trivially copyable");
+  DASH_ASSERT_GT(options.buffer_size, 0, "ingest requires a buffer");
+  size_t nunits = team.size();
+  size_t myid   = team.myid().id;
+
+  dart_file_t file;
+  DASH_ASSERT_RETURNS(
+    dart__io__file_open(team.dart_id(), filename.c_str(), DART_FILE_READ,
+                        &file),
+    DART_OK);
+  size_t file_size;
+  DASH_ASSERT_RETURNS(dart__io__file_size(file, &file_size), DART_OK);
+
+  size_t data_begin = 0;
+  if (options.skip_records > 0) {
+    if (myid == 0) {
+      data_begin = find_record_start(file, file_size, 0,
+                                     options.skip_records, options);
+    }
+    DASH_ASSERT_RETURNS(
+      dart_bcast(&data_begin, 1, dash::dart_datatype<size_t>::value,
+                 dart_team_unit_t { 0 }, team.dart_id()),
+      DART_OK);
+  }
+  size_t data_size   = file_size - data_begin;
+  size_t range_begin = data_begin + (data_size * myid) / nunits;
+  size_t range_end   = data_begin + (data_size * (myid + 1)) / nunits;
+
+  std::vector<record_t> records;
+  size_t record_offset = 0;
+  if (count_records) {
+    // Number records by counting the records in the ranges of preceding
+    // units:
+    size_t nlocal = 0;
+    record_reader counter(file, file_size, data_begin,
+                          range_begin, range_end, options);
+    while (counter.next(records)) {
+      nlocal += records.size();
+    }
+    std::vector<size_t> counts(nunits);
+    DASH_ASSERT_RETURNS(
+      dart_allgather(&nlocal, counts.data(), 1,
+                     dash::dart_datatype<size_t>::value, team.dart_id()),
+      DART_OK);
+    size_t total = 0;
+    for (size_t u = 0; u < nunits; ++u) {
+      if (u == myid) {
+        record_offset = total;
+      }
+      total += counts[u];
+    }
+    DASH_LOG_DEBUG("dash::io::text::ingest_records", "records:", total,
+                   "local:", nlocal, "offset:", record_offset);
+    // The total is known at all units, so all units stop before the
+    // first exchange:
+    if (!total_fun(total)) {
+      DASH_ASSERT_RETURNS(dart__io__file_close(&file), DART_OK);
+      return;
+    }
+  }
+
+  record_reader reader(file, file_size, data_begin,
+                       range_begin, range_end, options);
+  std::vector<std::vector<std::vector<Message>>> buckets;
+  std::vector<Message>                           send_buf;
+  std::vector<Message>                           recv_buf;
+  std::vector<size_t> send_counts(nunits), send_displs(nunits);
+  std::vector<size_t> recv_counts(nunits), recv_displs(nunits);
+  while (true) {
+    int active_local = reader.next(records) ? 1 : 0;
+    int active;
+    DASH_ASSERT_RETURNS(
+      dart_allreduce(&active_local, &active, 1, DART_TYPE_INT, DART_OP_MAX,
+                     team.dart_id()),
+      DART_OK);
+    if (!active) {
+      break;
+    }
+    // Parse records in parallel, messages are sorted into buckets of
+    // target units per thread:
+    int nchunks = dash::internal::num_parallel_chunks(
+                    policy, records.size(), sizeof(record_t));
+    buckets.resize(nchunks);
+    for (auto & chunk_buckets : buckets) {
+      chunk_buckets.resize(nunits);
+      for (auto & bucket : chunk_buckets) {
+        bucket.clear();
+      }
+    }
+    dash::internal::parallel_for(
+      policy, records.size(), sizeof(record_t),
+      [&](int c, size_t c_begin, size_t c_end) {
+        Message message;
+        size_t  unit;
+        for (size_t r = c_begin; r < c_end; ++r) {
+          if (parse_fun(record_offset + r,
+                        records[r].first, records[r].second,
+                        message, unit)) {
+            buckets[c][unit].push_back(message);
+          }
+        }
+      });
+    record_offset += records.size();
+
+    send_buf.clear();
+    for (size_t u = 0; u < nunits; ++u) {
+      send_displs[u] = send_buf.size() * sizeof(Message);
+      for (auto & chunk_buckets : buckets) {
+        send_buf.insert(send_buf.end(),
+                        chunk_buckets[u].begin(), chunk_buckets[u].end());
+      }
+      send_counts[u] = send_buf.size() * sizeof(Message) - send_displs[u];
+    }
+    DASH_ASSERT_RETURNS(
+      dart_alltoall(send_counts.data(), recv_counts.data(), 1,
+                    dash::dart_datatype<size_t>::value, team.dart_id()),
+      DART_OK);
+    size_t recv_bytes = 0;
+    for (size_t u = 0; u < nunits; ++u) {
+      recv_displs[u] = recv_bytes;
+      recv_bytes    += recv_counts[u];
+    }
+    recv_buf.resize(recv_bytes / sizeof(Message));
+    DASH_ASSERT_RETURNS(
+      dart_alltoallv(send_buf.data(), send_counts.data(), send_displs.data(),
+                     DART_TYPE_BYTE,
+                     recv_buf.data(), recv_counts.data(), recv_displs.data(),
+                     team.dart_id()),
+      DART_OK);
+    DASH_LOG_TRACE("dash::io::text::ingest_records", "round",
+                   "records:", records.size(),
+                   "sent:", send_buf.size(), "received:", recv_buf.size());
+    apply_fun(recv_buf);
+  }
+  DASH_ASSERT_RETURNS(dart__io__file_close(&file), DART_OK);
+}
+
+/// Element of a dash::Array routed to its owning unit
+template <typename IndexType, typename ValueType>
+struct array_message {
+  IndexType lindex;
+  ValueType value;
+};
+
+/// Key-value pair of a dash::UnorderedMap routed to its owning unit
+template <typename Key, typename Mapped>
+struct map_message {
+  Key    key;
+  Mapped mapped;
+};
+
+} // namespace internal
+
+/**
+ * Reads records of a text file into a \c dash::Array in parallel.
+ *
+ * Every unit reads a byte range of the file aligned to record boundaries
+ * and converts its records to elements by calling
+ * \c parse(first, last, value) on the characters \c [first, last) of every
+ * record, in multiple threads if permitted by the execution policy.
+ * Records that cannot be parsed are signaled by returning \c false, the
+ * corresponding element is not assigned.
+ *
+ * The i-th record of the file is stored in the element at global index
+ * \c i. Elements are routed to their owning units in bulk, so the file is
+ * read in bounded memory regardless of its size, see
+ * \c ingest_options::buffer_size. Records are numbered in an additional
+ * pass counting record delimiters.
+ *
+ * \c parse is called concurrently and has to be thread-safe.
+ *
+ * Example:
+ * \code
+ *  dash::Array<double> values(nrecords);
+ *  dash::io::text::ingest(
+ *    dash::execution::par_unseq, "values.csv", values,
+ *    [](const char * first, const char * last, double & value) {
+ *      value = std::strtod(first, nullptr);
+ *      return true;
+ *    });
+ * \endcode
+ *
+ * Collective operation.
+ *
+ * \return  The number of elements assigned.
+ * \throws  dash::exception::InvalidArgument  if the file contains more
+ *          records than the array elements.
+ */
+template <
+  class ExecutionPolicy,
+  typename ElementType,
+  typename IndexType,
+  class PatternType,
+  class ParseFun >
+dash::internal::enable_if_execution_policy<ExecutionPolicy, size_t>
+ingest(
+  ExecutionPolicy                                    && policy,
+  /// Path of the text file
+  const std::string                                   & filename,
+  /// Array to store parsed records
+  dash::Array<ElementType, IndexType, PatternType>    & array,
+  /// Converts a record to an element
+  ParseFun                                              parse,
+  ingest_options                                        options
+    = ingest_options())
+{
+  typedef internal::array_message<IndexType, ElementType> message_t;
+  const PatternType & pattern = array.pattern();
+  size_t total   = 0;
+  size_t nstored = 0;
+  internal::ingest_records<message_t>(
+    std::forward<ExecutionPolicy>(policy), array.team(), filename, options,
+    true,
+    [&](size_t nrecords) {
+      total = nrecords;
+      return total <= array.size();
+    },
+    [&](size_t record_idx, const char * first, const char * last,
+        message_t & message, size_t & unit) {
+      if (!parse(first, last, message.value)) {
+        return false;
+      }
+      auto lpos      = pattern.local(static_cast<IndexType>(record_idx));
+      message.lindex = lpos.index;
+      unit           = lpos.unit.id;
+      return true;
+    },
+    [&](const std::vector<message_t> & messages) {
+      ElementType * lbegin = array.lbegin();
+      for (const auto & message : messages) {
+        lbegin[message.lindex] = message.value;
+      }
+      nstored += messages.size();
+    });
+  if (total > array.size()) {
+    DASH_THROW(
+      dash::exception::InvalidArgument,
+      "dash::io::text::ingest: " << filename << " contains " << total
+      << " records, exceeding array size " << array.size());
+  }
+  size_t nstored_total;
+  DASH_ASSERT_RETURNS(
+    dart_allreduce(&nstored, &nstored_total, 1,
+                   dash::dart_datatype<size_t>::value,
+                   DART_OP_SUM, array.team().dart_id()),
+    DART_OK);
+  array.barrier();
+  return nstored_total;
+}
+
+/**
+ * Reads records of a text file into a \c dash::UnorderedMap in parallel.
+ *
+ * Every unit reads a byte range of the file aligned to record boundaries
+ * and converts its records to key-value pairs by calling
+ * \c parse(first, last, kv) on the characters \c [first, last) of every
+ * record, in multiple threads if permitted by the execution policy.
+ * Records that cannot be parsed are signaled by returning \c false.
+ *
+ * Pairs are routed in bulk to the units their keys are mapped to by the
+ * map's hash function and inserted locally, so the file is read in
+ * bounded memory regardless of its size, see
+ * \c ingest_options::buffer_size. Pairs with keys existing in the map
+ * are not inserted.
+ *
+ * \c parse is called concurrently and has to be thread-safe.
+ *
+ * Collective operation.
+ *
+ * \return  The number of elements inserted.
+ */
+template <
+  class ExecutionPolicy,
+  typename Key,
+  typename Mapped,
+  typename Hash,
+  typename Pred,
+  typename Alloc,
+  class ParseFun >
+dash::internal::enable_if_execution_policy<ExecutionPolicy, size_t>
+ingest(
+  ExecutionPolicy                                      && policy,
+  /// Path of the text file
+  const std::string                                     & filename,
+  /// Map to insert parsed records
+  dash::UnorderedMap<Key, Mapped, Hash, Pred, Alloc>    & map,
+  /// Converts a record to a key-value pair
+  ParseFun                                                parse,
+  ingest_options                                          options
+    = ingest_options())
+{
+  typedef internal::map_message<Key, Mapped> message_t;
+  Hash   hash      = map.hash_function();
+  size_t ninserted = 0;
+  internal::ingest_records<message_t>(
+    std::forward<ExecutionPolicy>(policy), map.team(), filename, options,
+    false,
+    [](size_t) { return true; },
+    [&](size_t, const char * first, const char * last,
+        message_t & message, size_t & unit) {
+      std::pair<Key, Mapped> kv;
+      if (!parse(first, last, kv)) {
+        return false;
+      }
+      message.key    = kv.first;
+      message.mapped = kv.second;
+      unit = hash(message.key).id;
+      return true;
+    },
+    [&](const std::vector<message_t> & messages) {
+      for (const auto & message : messages) {
+        if (map.local.insert(
+              std::make_pair(message.key, message.mapped)).second) {
+          ++ninserted;
+        }
+      }
+    });
+  // Commit local insertions:
+  map.barrier();
+  size_t ninserted_total;
+  DASH_ASSERT_RETURNS(
+    dart_allreduce(&ninserted, &ninserted_total, 1,
+                   dash::dart_datatype<size_t>::value,
+                   DART_OP_SUM, map.team().dart_id()),
+    DART_OK);
+  return ninserted_total;
+}
+
+/**
+ * Reads records of a text file into a \c dash::Array or
+ * \c dash::UnorderedMap, parsing records in a single thread per unit.
+ *
+ * \see dash::io::text::ingest(ExecutionPolicy, ...)
+ */
+template <
+  class ContainerType,
+  class ParseFun >
+size_t ingest(
+  const std::string & filename,
+  ContainerType     & container,
+  ParseFun            parse,
+  ingest_options      options = ingest_options())
+{
+  return ingest(dash::execution::seq, filename, container, parse, options);
+}
+
+} // namespace text
+} // namespace io
+} // namespace dash
+
+#endif // DASH__IO__TEXT__INGEST_H__
@@ -0,0 +1,173 @@
+#ifndef DASH__UTIL__COMM_MATRIX_H__INCLUDED
+#define DASH__UTIL__COMM_MATRIX_H__INCLUDED
+
+#include <dash/dart/if/dart_types.h>
+#include <dash/dart/if/dart_globmem.h>
+
+#include <atomic>
+#include <memory>
+#include <vector>
+#include <cstddef>
+
+
+namespace dash {
+
+class Team;
+
+namespace util {
+
+/**
+ * Matrix of the number of elements accessed by the units of a team in
+ * the global memory of every unit, with the locality of every pair of
+ * units.
+ *
+ * While recording is enabled, element accesses of \c dash::GlobRef
+ * (and thus of dereferenced \c dash::GlobIter) and element transfers in
+ * \c dash::copy are counted per target unit by every unit.
+ * Constructing a \c CommMatrix gathers the counters of all units in a
+ * team, it can be printed using \c dash::util::LocalityJSONPrinter.
+ *
+ * Example:
+ *
+ * \code
+ *   dash::util::CommMatrix::on();
+ *   // ... access containers ...
+ *   dash::util::CommMatrix::off();
+ *
+ *   dash::util::CommMatrix matrix(dash::Team::All());
+ *   if (dash::myid() == 0) {
+ *     dash::util::LocalityJSONPrinter printer;
+ *     std::cout << (printer << matrix).str() << std::endl;
+ *   }
+ * \endcode
+ */
+class CommMatrix
+{
+public:
+  /**
+   * Locality of the memory of a target unit relative to an accessing
+   * unit.
+   */
+  enum class Scope : int {
+    /// Memory of the accessing unit
+    Local  = 0,
+    /// Memory of a unit on the same node, accessible via shared memory
+    Node   = 1,
+    /// Memory of a unit on a different node
+    Remote = 2
+  };
+
+public:
+  /**
+   * Enable recording of element accesses of the calling unit.
+   */
+  static void on();
+
+  /**
+   * Disable recording of element accesses of the calling unit.
+   */
+  static void off();
+
+  /**
+   * Whether element accesses of the calling unit are recorded.
+   */
+  static bool enabled() {
+    return _enabled;
+  }
+
+  /**
+   * Reset the recorded counters of the calling unit.
+   */
+  static void clear();
+
+  /**
+   * Record access of \c nelem elements in the global memory referenced
+   * by \c gptr.
+   */
+  static inline void record(dart_gptr_t gptr, size_t nelem) {
+    if (_enabled) {
+      _counts[gptr.unitid].fetch_add(nelem, std::memory_order_relaxed);
+    }
+  }
+
+  /**
+   * Record access of \c nelem elements in local memory of the calling
+   * unit, e.g. in local fast paths of algorithms.
+   */
+  static inline void record_local(size_t nelem) {
+    if (_enabled) {
+      _counts[_myid].fetch_add(nelem, std::memory_order_relaxed);
+    }
+  }
+
+public:
+  /**
+   * Gathers the counters recorded by all units in the specified team.
+   * Collective operation.
+   */
+  explicit CommMatrix(dash::Team & team);
+
+  /**
+   * Gathers the counters recorded by all units.
+   * Collective operation.
+   */
+  CommMatrix();
+
+  /**
+   * Number of units in the matrix.
+   */
+  size_t size() const {
+    return _units.size();
+  }
+
+  /**
+   * Global id of the unit at the specified index in the team.
+   */
+  dart_global_unit_t unit(size_t index) const {
+    return _units[index];
+  }
+
+  /**
+   * Number of elements accessed by the unit at index \c from in the
+   * memory of the unit at index \c to.
+   */
+  size_t elements(size_t from, size_t to) const {
+    return _elements[from * size() + to];
+  }
+
+  /**
+   * Locality of the memory of the unit at index \c to relative to the
+   * unit at index \c from.
+   */
+  Scope scope(size_t from, size_t to) const {
+    return _scopes[from * size() + to];
+  }
+
+  /**
+   * Number of elements accessed by the unit at index \c from in memory
+   * of the specified locality.
+   */
+  size_t elements(size_t from, Scope scope) const;
+
+  /**
+   * Number of elements accessed by all units in memory of the specified
+   * locality.
+   */
+  size_t elements(Scope scope) const;
+
+private:
+  std::vector<dart_global_unit_t>        _units;
+  std::vector<size_t>                    _elements;
+  std::vector<Scope>                     _scopes;
+
+  static bool                            _enabled;
+  static dart_unit_t                     _myid;
+  static size_t                          _nunits;
+  static std::unique_ptr<std::atomic<size_t>[]>
+                                         _counts;
+};
+
+} // namespace util
+} // namespace dash
+
+#endif // DASH__UTIL__COMM_MATRIX_H__INCLUDED
@@ -5,6 +5,7 @@
 #include <dash/util/LocalityDomain.h>
 #include <dash/util/UnitLocality.h>
 #include <dash/util/TeamLocality.h>
+#include <dash/util/CommMatrix.h>
 
 #include <string>
 #include <iostream>
@@ -49,6 +50,12 @@ public:
     return *this << (static_cast<dart_locality_scope_t>(scope));
   }
 
+  self_t & operator<<(
+    dash::util::CommMatrix::Scope scope);
+
+  self_t & operator<<(
+    const dash::util::CommMatrix & matrix);
+
   std::string str() const {
     return _os.str();
   }
@@ -34,6 +34,7 @@ namespace dash {
 #include <dash/Onesided.h>
 
 #include <dash/LaunchPolicy.h>
+#include <dash/ExecutionPolicy.h>
 
 #include <dash/Container.h>
 #include <dash/Shared.h>
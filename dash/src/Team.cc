@@ -105,25 +105,25 @@ Team::split(
   DASH_ASSERT_RETURNS(
     dart_group_split(group, num_parts, &num_split, sub_groups),
     DART_OK);
-  dart_team_t oldteam = _dartid;
-  // Create a child Team for every part with parent set to
-  // this instance:
-  for(unsigned i = 0; i < num_parts; i++) {
-    dart_team_t newteam = DART_TEAM_NULL;
-    DASH_ASSERT_RETURNS(
-      dart_team_create(
-        oldteam,
-        sub_groups[i],
-        &newteam),
-      DART_OK);
+  // Create the child Teams of all parts in a single collective operation,
+  // with parent set to this instance:
+  dart_team_t newteam   = DART_TEAM_NULL;
+  size_t      group_idx = num_parts;
+  DASH_ASSERT_RETURNS(
+    dart_team_split(
+      _dartid,
+      num_parts,
+      sub_groups,
+      &newteam,
+      &group_idx),
+    DART_OK);
+  for (unsigned i = 0; i < num_parts; i++) {
     dart_group_destroy(&sub_groups[i]);
-    if(newteam != DART_TEAM_NULL) {
-      // Create team instance of child team:
-      DASH_ASSERT_EQ(
-        &(dash::Team::Null()), result,
-        "Team.split assigned unit assigned to more than one team");
-      result = new Team(newteam, this, i, num_split);
-    }
+  }
+  dart_group_destroy(&group);
+  if (newteam != DART_TEAM_NULL) {
+    // Create team instance of child team:
+    result = new Team(newteam, this, group_idx, num_split);
   }
   DASH_LOG_DEBUG("Team.split >");
   return *result;
@@ -176,7 +176,6 @@ Team::locality_split(
     dart_group_locality_split(
       group, domain, dart_scope, num_parts, &num_split, sub_groups),
     DART_OK);
-  dart_team_t oldteam = _dartid;
 #if DASH_ENABLE_TRACE_LOGGING
   for(unsigned i = 0; i < num_parts; i++) {
     size_t sub_group_size = 0;
@@ -188,23 +187,24 @@ Team::locality_split(
   }
 #endif
 
-  // Create a child Team for every part with parent set to
-  // this instance:
-  for(unsigned i = 0; i < num_parts; i++) {
-    dart_team_t newteam = DART_TEAM_NULL;
-    DASH_ASSERT_RETURNS(
-      dart_team_create(
-        oldteam,
-        sub_groups[i],
-        &newteam),
-      DART_OK);
+  // Create the child Teams of all parts in a single collective operation,
+  // with parent set to this instance:
+  dart_team_t newteam   = DART_TEAM_NULL;
+  size_t      group_idx = num_parts;
+  DASH_ASSERT_RETURNS(
+    dart_team_split(
+      _dartid,
+      num_parts,
+      sub_groups,
+      &newteam,
+      &group_idx),
+    DART_OK);
+  for (unsigned i = 0; i < num_parts; i++) {
     dart_group_destroy(&sub_groups[i]);
-    if(newteam != DART_TEAM_NULL) {
-      DASH_ASSERT_EQ(
-        &(dash::Team::Null()), result,
-        "Team.split assigned unit assigned to more than one team");
-      result = new Team(newteam, this, i, num_split);
-    }
+  }
+  dart_group_destroy(&group);
+  if (newteam != DART_TEAM_NULL) {
+    result = new Team(newteam, this, group_idx, num_split);
   }
   DASH_LOG_DEBUG("Team.locality_split >");
   return *result;
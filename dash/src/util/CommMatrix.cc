@@ -0,0 +1,122 @@
+#include <dash/util/CommMatrix.h>
+
+#include <dash/Team.h>
+#include <dash/Exception.h>
+#include <dash/internal/Logging.h>
+
+#include <dash/dart/if/dart.h>
+
+#include <vector>
+
+
+bool dash::util::CommMatrix::_enabled
+  = false;
+
+dart_unit_t dash::util::CommMatrix::_myid
+  = -1;
+
+size_t dash::util::CommMatrix::_nunits
+  = 0;
+
+std::unique_ptr<std::atomic<size_t>[]> dash::util::CommMatrix::_counts;
+
+void dash::util::CommMatrix::on()
+{
+  dart_global_unit_t myid;
+  size_t             nunits;
+  DASH_ASSERT_RETURNS(dart_myid(&myid),    DART_OK);
+  DASH_ASSERT_RETURNS(dart_size(&nunits), DART_OK);
+  if (_counts == nullptr || _nunits != nunits) {
+    _counts.reset(new std::atomic<size_t>[nunits]);
+    _nunits = nunits;
+    _myid   = myid.id;
+    clear();
+  }
+  _enabled = true;
+}
+
+void dash::util::CommMatrix::off()
+{
+  _enabled = false;
+}
+
+void dash::util::CommMatrix::clear()
+{
+  for (size_t u = 0; u < _nunits; ++u) {
+    _counts[u].store(0, std::memory_order_relaxed);
+  }
+}
+
+dash::util::CommMatrix::CommMatrix()
+: CommMatrix(dash::Team::All())
+{ }
+
+dash::util::CommMatrix::CommMatrix(dash::Team & team)
+{
+  DASH_LOG_DEBUG("CommMatrix(team)", "team:", team.dart_id());
+
+  size_t nunits = team.size();
+  _units.reserve(nunits);
+  for (size_t u = 0; u < nunits; ++u) {
+    _units.push_back(team.global_id(dash::team_unit_t(u)));
+  }
+
+  dart_global_unit_t myid = team.global_id(team.myid());
+
+  // Row of the calling unit:
+  std::vector<size_t> elements(nunits, 0);
+  std::vector<int>    scopes(nunits, static_cast<int>(Scope::Remote));
+  for (size_t u = 0; u < nunits; ++u) {
+    dart_unit_t target = _units[u].id;
+    if (_counts != nullptr && static_cast<size_t>(target) < _nunits) {
+      elements[u] = _counts[target].load(std::memory_order_relaxed);
+    }
+    if (target == myid.id) {
+      scopes[u] = static_cast<int>(Scope::Local);
+    } else {
+      int32_t is_shmem_local = 0;
+      DASH_ASSERT_RETURNS(
+        dart_unit_shmem_local(_units[u], &is_shmem_local),
+        DART_OK);
+      if (is_shmem_local) {
+        scopes[u] = static_cast<int>(Scope::Node);
+      }
+    }
+  }
+
+  _elements.resize(nunits * nunits);
+  std::vector<int> all_scopes(nunits * nunits);
+  DASH_ASSERT_RETURNS(
+    dart_allgather(elements.data(), _elements.data(), nunits,
+                   DART_TYPE_SIZET, team.dart_id()),
+    DART_OK);
+  DASH_ASSERT_RETURNS(
+    dart_allgather(scopes.data(), all_scopes.data(), nunits,
+                   DART_TYPE_INT, team.dart_id()),
+    DART_OK);
+
+  _scopes.reserve(nunits * nunits);
+  for (auto s : all_scopes) {
+    _scopes.push_back(static_cast<Scope>(s));
+  }
+}
+
+size_t dash::util::CommMatrix::elements(size_t from, Scope scope) const
+{
+  size_t nelem = 0;
+  for (size_t to = 0; to < size(); ++to) {
+    if (this->scope(from, to) == scope) {
+      nelem += elements(from, to);
+    }
+  }
+  return nelem;
+}
+
+size_t dash::util::CommMatrix::elements(Scope scope) const
+{
+  size_t nelem = 0;
+  for (size_t from = 0; from < size(); ++from) {
+    nelem += elements(from, scope);
+  }
+  return nelem;
+}
@@ -71,6 +71,56 @@ LocalityJSONPrinter & LocalityJSONPrinter::operator<<(
   return *this;
 }
 
+LocalityJSONPrinter & LocalityJSONPrinter::operator<<(
+  dash::util::CommMatrix::Scope scope)
+{
+  switch(scope) {
+    case CommMatrix::Scope::Local:    *this << "'LOCAL'";     break;
+    case CommMatrix::Scope::Node:     *this << "'NODE'";      break;
+    case CommMatrix::Scope::Remote:   *this << "'REMOTE'";    break;
+    default:                          *this << "'UNDEFINED'"; break;
+  }
+  return *this;
+}
+
+LocalityJSONPrinter & LocalityJSONPrinter::operator<<(
+  const dash::util::CommMatrix & matrix)
+{
+  typedef CommMatrix::Scope scope_t;
+
+  auto nunits = matrix.size();
+  *this << "{\n";
+  *this << "  'units'    : [";
+  for (size_t from = 0; from < nunits; ++from) {
+    *this << (from > 0 ? ", " : "") << matrix.unit(from).id;
+  }
+  *this << "],\n";
+  *this << "  'elements' : [";
+  for (size_t from = 0; from < nunits; ++from) {
+    *this << (from > 0 ? ",\n                 [" : "[");
+    for (size_t to = 0; to < nunits; ++to) {
+      *this << (to > 0 ? ", " : "") << matrix.elements(from, to);
+    }
+    *this << "]";
+  }
+  *this << "],\n";
+  *this << "  'scopes'   : [";
+  for (size_t from = 0; from < nunits; ++from) {
+    *this << (from > 0 ? ",\n                 [" : "[");
+    for (size_t to = 0; to < nunits; ++to) {
+      *this << (to > 0 ? ", " : "") << matrix.scope(from, to);
+    }
+    *this << "]";
+  }
+  *this << "],\n";
+  *this << "  'totals'   : { "
+        << "'LOCAL':"  << matrix.elements(scope_t::Local)  << ", "
+        << "'NODE':"   << matrix.elements(scope_t::Node)   << ", "
+        << "'REMOTE':" << matrix.elements(scope_t::Remote) << " }\n";
+  *this << "}";
+  return *this;
+}
+
 LocalityJSONPrinter & LocalityJSONPrinter::print_domain(
   dart_team_t                    team,
   const dart_domain_locality_t * domain,
@@ -9,6 +9,7 @@
 #include <dash/algorithm/Fill.h>
 
 #include <array>
+#include <algorithm>
 
 
 TEST_F(AccumulateTest, SimpleConstructor) {
@@ -57,3 +58,97 @@ TEST_F(AccumulateTest, StringConcatOperaton) {
     ASSERT_STREQ("1-2-3-4", result.c_str());
   }
 }
+TEST_F(AccumulateTest, ParallelUnsequenced) {
+  const size_t num_elem_local = 4 * 1024 + 7;
+  size_t num_elem_total       = _dash_size * num_elem_local;
+
+  dash::Array<int> target(num_elem_total, dash::BLOCKED);
+  dash::fill(dash::par_unseq, target.begin(), target.end(), 3);
+  dash::barrier();
+
+  int result = dash::accumulate(
+                 dash::execution::parallel_unsequenced_policy(4),
+                 target.begin(),
+                 target.end(),
+                 5);
+  // Result is available at all units:
+  ASSERT_EQ_U(num_elem_total * 3 + 5, result);
+}
+
+
+namespace {
+
+struct min_max_t {
+  int min;
+  int max;
+};
+
+struct min_max_op {
+  min_max_t operator()(const min_max_t & lhs, const min_max_t & rhs) const {
+    return min_max_t { std::min(lhs.min, rhs.min),
+                       std::max(lhs.max, rhs.max) };
+  }
+};
+
+} // namespace
+
+TEST_F(AccumulateTest, UserDefinedType) {
+  const size_t num_elem_local = 100;
+  size_t num_elem_total       = _dash_size * num_elem_local;
+
+  dash::Array<min_max_t> target(num_elem_total, dash::BLOCKED);
+  for (size_t l = 0; l < num_elem_local; ++l) {
+    int value = static_cast<int>(dash::myid() * num_elem_local + l);
+    target.local[l] = min_max_t { value, value };
+  }
+  dash::barrier();
+
+  min_max_t init   { 10, 20 };
+  min_max_t result = dash::accumulate(
+                       target.begin(), target.end(), init, min_max_op());
+  // Result is available at all units:
+  ASSERT_EQ_U(0,                                     result.min);
+  ASSERT_EQ_U(static_cast<int>(num_elem_total - 1), result.max);
+
+  // Operation on the struct type is registered in DART:
+  dash::DartReduceOperation<min_max_t, min_max_op> op((min_max_op()));
+  EXPECT_NE_U(DART_OP_UNDEFINED, op.dart_operation());
+  EXPECT_NE_U(DART_TYPE_UNDEFINED, op.dart_type());
+  // Predefined operation on predefined type:
+  dash::DartReduceOperation<int, dash::plus<int>> plus_op(
+    (dash::plus<int>()));
+  EXPECT_EQ_U(DART_OP_SUM,  plus_op.dart_operation());
+  EXPECT_EQ_U(DART_TYPE_INT, plus_op.dart_type());
+}
+
+TEST_F(AccumulateTest, PredefinedOperationsEmptyUnits) {
+  const size_t num_elem_local = 4;
+  size_t num_elem_total       = _dash_size * num_elem_local;
+
+  dash::Array<long> target(num_elem_total, dash::BLOCKED);
+  for (size_t l = 0; l < num_elem_local; ++l) {
+    target.local[l] = static_cast<long>(
+                        dash::myid() * num_elem_local + l + 1);
+  }
+  dash::barrier();
+
+  // Only the first unit holds elements in the range:
+  auto first = target.begin();
+  auto last  = target.begin() + num_elem_local;
+  EXPECT_EQ_U(1 + 2 + 3 + 4 + 10,
+              dash::accumulate(dash::par_unseq, first, last, 10L,
+                               dash::plus<long>()));
+  EXPECT_EQ_U(1 * 2 * 3 * 4 * 3,
+              dash::accumulate(dash::par_unseq, first, last, 3L,
+                               dash::multiply<long>()));
+  EXPECT_EQ_U(1,
+              dash::accumulate(dash::par_unseq, first, last, 5L,
+                               dash::min<long>()));
+  EXPECT_EQ_U(5,
+              dash::accumulate(dash::par_unseq, first, last, 5L,
+                               dash::max<long>()));
+  // Empty range:
+  EXPECT_EQ_U(7,
+              dash::accumulate(dash::par_unseq, first, first, 7L,
+                               dash::multiply<long>()));
+}
@@ -0,0 +1,105 @@
+
+#include "CommMatrixTest.h"
+
+#include <dash/Array.h>
+#include <dash/algorithm/Copy.h>
+#include <dash/util/CommMatrix.h>
+#include <dash/util/LocalityJSONPrinter.h>
+
+#include <string>
+#include <vector>
+
+
+TEST_F(CommMatrixTest, GlobRefAccess)
+{
+  typedef int value_t;
+  const size_t block_size = 10;
+  dash::Array<value_t> array(_dash_size * block_size, dash::BLOCKED);
+  for (size_t l = 0; l < block_size; ++l) {
+    array.local[l] = dash::myid();
+  }
+  array.barrier();
+
+  dash::util::CommMatrix::on();
+  ASSERT_TRUE_U(dash::util::CommMatrix::enabled());
+  dash::util::CommMatrix::clear();
+
+  // Read block of next unit element-wise, write first element of own
+  // block:
+  size_t target = (_dash_id + 1) % _dash_size;
+  for (size_t l = 0; l < block_size; ++l) {
+    value_t value = array[target * block_size + l];
+    ASSERT_EQ_U(target, value);
+  }
+  array[_dash_id * block_size] = _dash_id;
+
+  dash::util::CommMatrix::off();
+  // Not recorded:
+  value_t value = array[target * block_size];
+  ASSERT_EQ_U(target, value);
+  array.barrier();
+
+  dash::util::CommMatrix matrix(dash::Team::All());
+  ASSERT_EQ_U(_dash_size, matrix.size());
+  for (size_t from = 0; from < _dash_size; ++from) {
+    size_t from_target = (from + 1) % _dash_size;
+    EXPECT_EQ_U(dash::util::CommMatrix::Scope::Local,
+                matrix.scope(from, from));
+    for (size_t to = 0; to < _dash_size; ++to) {
+      size_t exp_elem = 0;
+      if (to == from_target) {
+        exp_elem += block_size;
+      }
+      if (to == from) {
+        exp_elem += 1;
+      }
+      EXPECT_EQ_U(exp_elem, matrix.elements(from, to));
+      if (to != from) {
+        EXPECT_NE_U(dash::util::CommMatrix::Scope::Local,
+                    matrix.scope(from, to));
+      }
+    }
+  }
+  size_t total = matrix.elements(dash::util::CommMatrix::Scope::Local) +
+                 matrix.elements(dash::util::CommMatrix::Scope::Node) +
+                 matrix.elements(dash::util::CommMatrix::Scope::Remote);
+  EXPECT_EQ_U(_dash_size * (block_size + 1), total);
+}
+
+TEST_F(CommMatrixTest, CopyAccess)
+{
+  typedef int value_t;
+  const size_t block_size = 10;
+  dash::Array<value_t> array(_dash_size * block_size, dash::BLOCKED);
+  for (size_t l = 0; l < block_size; ++l) {
+    array.local[l] = dash::myid();
+  }
+  array.barrier();
+
+  dash::util::CommMatrix::on();
+  dash::util::CommMatrix::clear();
+
+  // Copy entire array, local block is copied in local fast path:
+  std::vector<value_t> local_copy(array.size());
+  dash::copy(array.begin(), array.end(), local_copy.data());
+  for (size_t i = 0; i < array.size(); ++i) {
+    ASSERT_EQ_U(i / block_size, local_copy[i]);
+  }
+  dash::util::CommMatrix::off();
+  array.barrier();
+
+  dash::util::CommMatrix matrix;
+  for (size_t from = 0; from < _dash_size; ++from) {
+    for (size_t to = 0; to < _dash_size; ++to) {
+      EXPECT_EQ_U(block_size, matrix.elements(from, to));
+    }
+    EXPECT_EQ_U(block_size,
+                matrix.elements(from, dash::util::CommMatrix::Scope::Local));
+  }
+
+  dash::util::LocalityJSONPrinter printer;
+  std::string json = (printer << matrix).str();
+  DASH_LOG_DEBUG("CommMatrixTest.CopyAccess", json);
+  EXPECT_NE_U(std::string::npos, json.find("'elements'"));
+  EXPECT_NE_U(std::string::npos, json.find("'LOCAL'"));
+}
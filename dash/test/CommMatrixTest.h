@@ -0,0 +1,40 @@
+#ifndef DASH__TEST__COMM_MATRIX_TEST_H_
+#define DASH__TEST__COMM_MATRIX_TEST_H_
+
+#include "TestBase.h"
+
+#include <dash/util/CommMatrix.h>
+
+
+/**
+ * Test fixture for class dash::util::CommMatrix
+ */
+class CommMatrixTest : public dash::test::TestBase {
+protected:
+  size_t _dash_id;
+  size_t _dash_size;
+
+  CommMatrixTest()
+  : _dash_id(0),
+    _dash_size(0) {
+    LOG_MESSAGE(">>> Test suite: CommMatrixTest");
+  }
+
+  virtual ~CommMatrixTest() {
+    LOG_MESSAGE("<<< Closing test suite: CommMatrixTest");
+  }
+
+  virtual void SetUp() {
+    dash::test::TestBase::SetUp();
+    _dash_id   = dash::myid();
+    _dash_size = dash::size();
+  }
+
+  virtual void TearDown() {
+    dash::util::CommMatrix::off();
+    dash::util::CommMatrix::clear();
+    dash::test::TestBase::TearDown();
+  }
+};
+
+#endif // DASH__TEST__COMM_MATRIX_TEST_H_
@@ -3,6 +3,8 @@
 
 #include <dash/dart/if/dart.h>
 
+#include <vector>
+
 
 TEST_F(DARTCollectiveTest, Send_Recv) {
   // we need an even amount of participating units
@@ -50,3 +52,128 @@ TEST_F(DARTCollectiveTest, Sendrecv) {
     ASSERT_EQ(recv, data[partner]);
   }
 }
+
+namespace {
+
+typedef struct {
+  double value;
+  int    unit;
+} value_unit_t;
+
+// Maximum value, ties resolved by lowest unit id:
+void value_unit_max(
+  const void * invec,
+  void       * inoutvec,
+  size_t       len,
+  void       * userdata)
+{
+  const value_unit_t * in    = static_cast<const value_unit_t *>(invec);
+  value_unit_t       * inout = static_cast<value_unit_t *>(inoutvec);
+  int                * calls = static_cast<int *>(userdata);
+  for (size_t i = 0; i < len; ++i) {
+    if (in[i].value > inout[i].value ||
+        (in[i].value == inout[i].value && in[i].unit < inout[i].unit)) {
+      inout[i] = in[i];
+    }
+  }
+  ++(*calls);
+}
+
+} // namespace
+
+TEST_F(DARTCollectiveTest, AllreduceUserOperation) {
+  // Struct type with padding:
+  size_t          blocklens[] = { 1, 1 };
+  size_t          offsets[]   = { offsetof(value_unit_t, value),
+                                  offsetof(value_unit_t, unit) };
+  dart_datatype_t types[]     = { DART_TYPE_DOUBLE, DART_TYPE_INT };
+  dart_datatype_t dtype;
+  ASSERT_EQ_U(DART_OK,
+              dart_type_create_struct(2, blocklens, offsets, types,
+                                      sizeof(value_unit_t), &dtype));
+
+  int              calls = 0;
+  dart_operation_t op;
+  ASSERT_EQ_U(DART_OK,
+              dart_op_create(&value_unit_max, &calls, true, dtype, &op));
+
+  value_unit_t l_values[2];
+  value_unit_t g_values[2];
+  // Maximum value at last unit:
+  l_values[0].value = static_cast<double>(_dash_id);
+  l_values[0].unit  = _dash_id;
+  // Same value at all units:
+  l_values[1].value = 1.5;
+  l_values[1].unit  = _dash_id;
+  ASSERT_EQ_U(DART_OK,
+              dart_allreduce(l_values, g_values, 2, dtype, op,
+                             DART_TEAM_ALL));
+  EXPECT_EQ_U(_dash_size - 1, g_values[0].value);
+  EXPECT_EQ_U(_dash_size - 1, g_values[0].unit);
+  EXPECT_EQ_U(1.5,            g_values[1].value);
+  EXPECT_EQ_U(0,              g_values[1].unit);
+
+  // Operation is bound to its operand type:
+  ASSERT_NE(DART_OK,
+            dart_allreduce(l_values, g_values, 2 * sizeof(value_unit_t),
+                           DART_TYPE_BYTE, op, DART_TEAM_ALL));
+
+  ASSERT_EQ_U(DART_OK, dart_op_destroy(&op));
+  ASSERT_EQ_U(DART_OP_UNDEFINED, op);
+  ASSERT_EQ_U(DART_OK, dart_type_destroy(&dtype));
+  ASSERT_EQ_U(DART_TYPE_UNDEFINED, dtype);
+}
+
+TEST_F(DARTCollectiveTest, AllreduceHandle) {
+  long l_values[2] = { static_cast<long>(_dash_id) + 1,
+                       static_cast<long>(_dash_id) };
+  long g_values[2] = { 0, 0 };
+  dart_handle_t handle;
+  ASSERT_EQ_U(DART_OK,
+              dart_allreduce_handle(l_values, g_values, 2, DART_TYPE_LONG,
+                                    DART_OP_SUM, DART_TEAM_ALL, &handle));
+  int32_t finished = 0;
+  while (!finished) {
+    ASSERT_EQ_U(DART_OK, dart_test_local(handle, &finished));
+  }
+  ASSERT_EQ_U(DART_OK, dart_wait(handle));
+  long sum_ids = (_dash_size * (_dash_size - 1)) / 2;
+  EXPECT_EQ_U(sum_ids + _dash_size, g_values[0]);
+  EXPECT_EQ_U(sum_ids,              g_values[1]);
+}
+
+TEST_F(DARTCollectiveTest, Exscan) {
+  long l_value = static_cast<long>(_dash_id) + 1;
+  long g_value = -1;
+  ASSERT_EQ_U(DART_OK,
+              dart_exscan(&l_value, &g_value, 1, DART_TYPE_LONG,
+                          DART_OP_SUM, DART_TEAM_ALL));
+  if (_dash_id > 0) {
+    // Sum of 1 ... id:
+    EXPECT_EQ_U((_dash_id * (_dash_id + 1)) / 2, g_value);
+  }
+}
+
+TEST_F(DARTCollectiveTest, ReduceScatter) {
+  // Unit i receives i + 1 elements:
+  std::vector<size_t> nrecv(_dash_size);
+  size_t nelem = 0;
+  for (size_t u = 0; u < _dash_size; ++u) {
+    nrecv[u] = u + 1;
+    nelem   += nrecv[u];
+  }
+  std::vector<long> l_values(nelem);
+  for (size_t i = 0; i < nelem; ++i) {
+    l_values[i] = static_cast<long>(i * (_dash_id + 1));
+  }
+  std::vector<long> g_values(_dash_id + 1, -1);
+  ASSERT_EQ_U(DART_OK,
+              dart_reduce_scatter(l_values.data(), g_values.data(),
+                                  nrecv.data(), DART_TYPE_LONG,
+                                  DART_OP_SUM, DART_TEAM_ALL));
+  size_t offset  = (_dash_id * (_dash_id + 1)) / 2;
+  long   sum_ids = (_dash_size * (_dash_size + 1)) / 2;
+  for (size_t i = 0; i <= _dash_id; ++i) {
+    EXPECT_EQ_U(static_cast<long>(offset + i) * sum_ids, g_values[i]);
+  }
+}
@@ -0,0 +1,133 @@
+
+#include "DARTTraceTest.h"
+
+#include <dash/Array.h>
+#include <dash/Onesided.h>
+
+#include <cstdio>
+#include <string>
+#include <vector>
+
+
+TEST_F(DARTTraceTest, CountersPerTarget)
+{
+  typedef int value_t;
+  const size_t block_size = 10;
+  dash::Array<value_t> array(_dash_size * block_size, dash::BLOCKED);
+  for (size_t l = 0; l < block_size; ++l) {
+    array.local[l] = dash::myid();
+  }
+  array.barrier();
+
+  dart_trace_level_t level;
+  ASSERT_EQ_U(DART_OK, dart_trace_set_level(DART_TRACE_COUNTERS));
+  ASSERT_EQ_U(DART_OK, dart_trace_level(&level));
+  ASSERT_EQ_U(DART_TRACE_COUNTERS, level);
+  ASSERT_EQ_U(DART_OK, dart_trace_reset());
+
+  dart_global_unit_t target;
+  target.id = (dash::myid() + 1) % _dash_size;
+  value_t local_array[block_size];
+  dart_storage_t ds = dash::dart_storage<value_t>(block_size);
+  dart_get_blocking(
+    local_array,
+    (array.begin() + target.id * block_size).dart_gptr(),
+    ds.nelem,
+    ds.dtype);
+  for (size_t l = 0; l < block_size; ++l) {
+    ASSERT_EQ_U(target.id, local_array[l]);
+  }
+  array.barrier();
+
+  dart_trace_counter_t counter;
+  ASSERT_EQ_U(DART_OK,
+              dart_trace_counter(DART_TRACE_OP_GET, target, &counter));
+  EXPECT_EQ_U(1, counter.count);
+  EXPECT_EQ_U(block_size * sizeof(value_t), counter.nbytes);
+
+  // Puts have not been issued:
+  ASSERT_EQ_U(DART_OK,
+              dart_trace_counter(DART_TRACE_OP_PUT, target, &counter));
+  EXPECT_EQ_U(0, counter.count);
+
+  // The barrier is accounted to operations without target:
+  dart_global_unit_t no_target;
+  no_target.id = -1;
+  ASSERT_EQ_U(DART_OK,
+              dart_trace_counter(DART_TRACE_OP_COLLECTIVE, no_target,
+                                 &counter));
+  EXPECT_GE_U(counter.count, 1);
+
+  // 40 bytes are in bin 6, i.e. [32, 64):
+  uint64_t bins[DART_TRACE_HISTOGRAM_BINS];
+  ASSERT_EQ_U(DART_OK, dart_trace_histogram(DART_TRACE_OP_GET, bins));
+  EXPECT_EQ_U(1, bins[6]);
+
+  // Nothing is recorded when disabled:
+  ASSERT_EQ_U(DART_OK, dart_trace_set_level(DART_TRACE_OFF));
+  dart_get_blocking(
+    local_array,
+    (array.begin() + target.id * block_size).dart_gptr(),
+    ds.nelem,
+    ds.dtype);
+  ASSERT_EQ_U(DART_OK,
+              dart_trace_counter(DART_TRACE_OP_GET, target, &counter));
+  EXPECT_EQ_U(1, counter.count);
+
+  array.barrier();
+}
+
+TEST_F(DARTTraceTest, WriteEvents)
+{
+  typedef int value_t;
+  dash::Array<value_t> array(_dash_size, dash::BLOCKED);
+  array.local[0] = dash::myid();
+  array.barrier();
+
+  ASSERT_EQ_U(DART_OK, dart_trace_set_level(DART_TRACE_EVENTS));
+  ASSERT_EQ_U(DART_OK, dart_trace_reset());
+
+  dart_global_unit_t target;
+  target.id = (dash::myid() + 1) % _dash_size;
+  value_t value = dash::myid();
+  dart_put_blocking(
+    array[target.id].dart_gptr(), &value, 1, DART_TYPE_INT);
+  array.barrier();
+  ASSERT_EQ_U(DART_OK, dart_trace_set_level(DART_TRACE_OFF));
+
+  std::string filename = "dart_trace_test." + std::to_string(dash::myid());
+  ASSERT_EQ_U(DART_OK, dart_trace_write(filename.c_str()));
+
+  FILE * file = fopen(filename.c_str(), "rb");
+  ASSERT_NE_U(nullptr, file);
+  uint64_t header[6];
+  ASSERT_EQ_U(6, fread(header, sizeof(uint64_t), 6, file));
+  EXPECT_EQ_U(0x3230435254524144ULL, header[0]);
+  EXPECT_EQ_U(static_cast<uint64_t>(dash::myid()), header[1]);
+  EXPECT_EQ_U(_dash_size, header[2]);
+  EXPECT_EQ_U(DART_TRACE_OP_COUNT, header[3]);
+  EXPECT_EQ_U(DART_TRACE_HISTOGRAM_BINS, header[4]);
+  uint64_t num_events = header[5];
+  // Put and barrier:
+  EXPECT_GE_U(num_events, 2);
+
+  // Skip counters and histograms:
+  fseek(file,
+        (header[3] * (header[2] + 1)) * sizeof(dart_trace_counter_t) +
+        header[3] * header[4] * sizeof(uint64_t),
+        SEEK_CUR);
+  std::vector<dart_trace_event_t> events(num_events);
+  ASSERT_EQ_U(num_events,
+              fread(events.data(), sizeof(dart_trace_event_t), num_events,
+                    file));
+  fclose(file);
+  std::remove(filename.c_str());
+
+  EXPECT_EQ_U(DART_TRACE_OP_PUT, events[0].op);
+  EXPECT_EQ_U(target.id, events[0].target);
+  EXPECT_EQ_U(sizeof(value_t), events[0].nbytes);
+  EXPECT_EQ_U(array[target.id].dart_gptr().segid, events[0].id);
+  for (size_t e = 1; e < num_events; ++e) {
+    EXPECT_GE_U(events[e].timestamp_ns, events[e-1].timestamp_ns);
+  }
+}
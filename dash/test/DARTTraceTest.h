@@ -0,0 +1,38 @@
+#ifndef DASH__TEST__DART_TRACE_TEST_H_
+#define DASH__TEST__DART_TRACE_TEST_H_
+
+#include "TestBase.h"
+
+
+/**
+ * Test fixture for communication counters and tracing provided by DART.
+ */
+class DARTTraceTest : public dash::test::TestBase {
+protected:
+  size_t _dash_id;
+  size_t _dash_size;
+
+  DARTTraceTest()
+  : _dash_id(0),
+    _dash_size(0) {
+    LOG_MESSAGE(">>> Test suite: DARTTraceTest");
+  }
+
+  virtual ~DARTTraceTest() {
+    LOG_MESSAGE("<<< Closing test suite: DARTTraceTest");
+  }
+
+  virtual void SetUp() {
+    dash::test::TestBase::SetUp();
+    _dash_id   = dash::myid();
+    _dash_size = dash::size();
+  }
+
+  virtual void TearDown() {
+    dart_trace_set_level(DART_TRACE_OFF);
+    dart_trace_reset();
+    dash::test::TestBase::TearDown();
+  }
+};
+
+#endif // DASH__TEST__DART_TRACE_TEST_H_
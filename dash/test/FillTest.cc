@@ -42,3 +42,21 @@ TEST_F(FillTest, TestAllItemsFilled)
     EXPECT_EQ_U(17, static_cast<value_t>(*lbegin));
   }
 }
+TEST_F(FillTest, ParallelUnsequenced)
+{
+  typedef double                                      Element_t;
+  typedef dash::Array<Element_t>                        Array_t;
+
+  // Sufficiently large for several page-aligned chunks per unit:
+  size_t num_local_elem = 5 * 1024 + 3;
+
+  Array_t array(num_local_elem * dash::size());
+  dash::fill(dash::execution::parallel_unsequenced_policy(4),
+             array.begin(), array.end(), 23.0);
+  array.barrier();
+
+  for (auto l = array.lbegin(); l != array.lend(); ++l) {
+    EXPECT_EQ_U(23.0, *l);
+  }
+}
+
@@ -4,6 +4,10 @@
 #include <dash/Team.h>
 #include <dash/Array.h>
 #include <dash/algorithm/Find.h>
+#include <dash/algorithm/AllOf.h>
+#include <dash/algorithm/AnyOf.h>
+#include <dash/algorithm/None_of.h>
+#include <dash/algorithm/Fill.h>
 
 #include <limits>
 
@@ -320,3 +324,109 @@ TEST_F(FindTest, LessElementsThanUnits)
   array.barrier();
 }
 
+TEST_F(FindTest, ParallelUnsequenced)
+{
+  // Sufficiently large for several page-aligned chunks per unit:
+  size_t    num_local_elem = 4 * 1024 + 1;
+  Element_t find_me        = 42;
+
+  Array_t array(num_local_elem * dash::size());
+  dash::fill(array.begin(), array.end(), 0);
+  // Matches in the second half of the local ranges of all but unit 0:
+  if (dash::myid() > 0) {
+    array.local[num_local_elem - 10] = find_me;
+  }
+  array.barrier();
+
+  auto found_gptr = dash::find(
+                      dash::execution::parallel_unsequenced_policy(4),
+                      array.begin(), array.end(), find_me);
+  if (dash::size() > 1) {
+    EXPECT_EQ_U(2 * num_local_elem - 10, found_gptr.pos());
+  } else {
+    EXPECT_EQ_U(array.end(), found_gptr);
+  }
+
+  auto found_none = dash::find_if(
+                      dash::par_unseq,
+                      array.begin(), array.end(),
+                      [](const Element_t & v) { return v < 0; });
+  EXPECT_EQ_U(array.end(), found_none);
+
+  array.barrier();
+}
+
+
+TEST_F(FindTest, CooperativeSearch)
+{
+  // Several search rounds per unit:
+  size_t    num_local_elem = 4 * dash::internal::find_round_bytes /
+                             sizeof(Element_t) + 3;
+  Element_t find_me        = 42;
+
+  Array_t array(num_local_elem * dash::size());
+  dash::fill(array.begin(), array.end(), 0);
+  // Hits in the first round of unit 0 and in all rounds of all other
+  // units:
+  if (dash::myid() == 0) {
+    array.local[100] = find_me;
+  } else {
+    for (size_t l = 10; l < num_local_elem; l += num_local_elem / 8) {
+      array.local[l] = find_me;
+    }
+  }
+  array.barrier();
+
+  auto found_gptr = dash::find(array.begin(), array.end(), find_me);
+  EXPECT_EQ_U(100, found_gptr.pos());
+
+  // Excluding the hit at unit 0, the first hit of unit 1 is expected:
+  auto found_last = dash::find(dash::par_unseq,
+                               array.begin() + 101, array.end(),
+                               find_me);
+  if (dash::size() > 1) {
+    EXPECT_EQ_U(num_local_elem + 10, found_last.pos());
+  } else {
+    EXPECT_EQ_U(array.end(), found_last);
+  }
+
+  auto found_none = dash::find_if(
+                      array.begin(), array.end(),
+                      [](const Element_t & v) { return v < 0; });
+  EXPECT_EQ_U(array.end(), found_none);
+
+  array.barrier();
+}
+
+TEST_F(FindTest, AnyAllNoneOf)
+{
+  Array_t array(_num_elem);
+  dash::fill(array.begin(), array.end(), 1);
+  array.barrier();
+  if (dash::myid() == 0) {
+    array[_num_elem - 1] = -1;
+  }
+  array.barrier();
+
+  auto negative = [](const Element_t & v) { return v < 0; };
+  auto positive = [](const Element_t & v) { return v > 0; };
+
+  EXPECT_TRUE_U(dash::any_of(array.begin(), array.end(), negative));
+  EXPECT_FALSE_U(dash::all_of(array.begin(), array.end(), positive));
+  EXPECT_FALSE_U(dash::none_of(array.begin(), array.end(), negative));
+
+  EXPECT_FALSE_U(dash::any_of(dash::par_unseq,
+                              array.begin(), array.end() - 1, negative));
+  EXPECT_TRUE_U(dash::all_of(dash::par_unseq,
+                             array.begin(), array.end() - 1, positive));
+  EXPECT_TRUE_U(dash::none_of(array.begin(), array.end() - 1, negative));
+
+  EXPECT_EQ_U(array.end() - 1,
+              dash::find_if_not(array.begin(), array.end(), positive));
+
+  // Empty range:
+  EXPECT_FALSE_U(dash::any_of(array.begin(), array.begin(), positive));
+  EXPECT_TRUE_U(dash::all_of(array.begin(), array.begin(), negative));
+
+  array.barrier();
+}
@@ -6,6 +6,8 @@
 #include <dash/algorithm/ForEach.h>
 #include <dash/algorithm/Fill.h>
 #include <dash/SharedCounter.h>
+#include <dash/Shared.h>
+#include <dash/Atomic.h>
 
 #include <functional>
 
@@ -131,3 +133,80 @@ TEST_F(ForEachTest, ModifyValues)
   // Verify
   dash::for_each(array.begin(), array.end(), verify);
 }
+
+TEST_F(ForEachTest, WorkStealingAllInvoked)
+{
+  // Small chunks to cause stealing on imbalanced units:
+  dash::WorkStealing policy(dash::Team::All(), 7);
+  dash::Array<int> array(_num_elem * dash::size(), dash::CYCLIC);
+  // Number of units that stole a chunk, held by unit 0:
+  dash::Shared<int> num_thieves;
+  if (dash::myid() == 0) {
+    num_thieves.set(0);
+  }
+  // Number of elements visited by every unit:
+  dash::Array<size_t> num_visited(dash::size());
+  dash::fill(array.begin(), array.end(), 0);
+  array.barrier();
+
+  dash::Atomic<int> thieves(num_thieves);
+  int    num_idle  = dash::size() - 1;
+  bool   held      = false;
+  size_t l_visited = 0;
+  std::function<void(int &)>
+    incr = [&](int & el) {
+      bool stolen = (&el < array.lbegin() || &el >= array.lend());
+      // Skew the work: unit 0 holds its first chunk and every other unit
+      // holds the first chunk it stole until all other units stole a
+      // chunk, so every unit but unit 0 is idle and must steal:
+      if (!held && (dash::myid() == 0 || stolen)) {
+        held = true;
+        if (stolen) {
+          thieves.add(1);
+        }
+        while (thieves.fetch_and_add(0) < num_idle) { }
+      }
+      ++l_visited;
+      el = el + 1;
+  };
+  dash::for_each(policy, array.begin(), array.end(), incr);
+  num_visited.local[0] = l_visited;
+  num_visited.barrier();
+
+  // Every element must have been incremented exactly once:
+  for (auto l_it = array.lbegin(); l_it != array.lend(); ++l_it) {
+    EXPECT_EQ_U(1, *l_it);
+  }
+  size_t total_visited = 0;
+  for (size_t u = 0; u < dash::size(); ++u) {
+    total_visited += num_visited[u];
+  }
+  EXPECT_EQ_U(array.size(), total_visited);
+  if (dash::myid() != 0) {
+    EXPECT_GT_U(policy.num_stolen(), 0);
+  }
+  // Unit 0 waited for all thieves within its first chunk:
+  if (dash::size() > 1) {
+    EXPECT_GT_U(policy.busy_time(dash::team_unit_t(0)), 0);
+  }
+  LOG_MESSAGE("Chunks stolen: %lu", policy.num_stolen());
+  num_visited.barrier();
+}
+
+TEST_F(ForEachTest, ParallelUnsequencedModifyValues)
+{
+  typedef dash::Array<int> array_t;
+  // Sufficiently large for several page-aligned chunks per unit:
+  size_t  num_elem_local = 5 * 1024 + 11;
+  array_t array(num_elem_local * dash::size());
+  dash::fill(array.begin(), array.end(), dash::myid().id);
+  dash::barrier();
+
+  dash::for_each(dash::execution::parallel_unsequenced_policy(4),
+                 array.begin(), array.end(),
+                 [](int & v) { v = 2 * v + 1; });
+  // for_each(par_unseq, ...) is collective and synchronizes units:
+  for (size_t l = 0; l < num_elem_local; ++l) {
+    EXPECT_EQ_U(2 * dash::myid().id + 1, array.local[l]);
+  }
+}
@@ -405,6 +405,210 @@ TEST_F(HDF5MatrixTest, UnderfilledPatMultipleBlocks) {
   verify_matrix(matrix_b);
 }
 
+TEST_F(HDF5MatrixTest, UnderfilledPatZeroCopy) {
+  typedef dash::Pattern<2, dash::ROW_MAJOR> pattern_t;
+  typedef typename pattern_t::index_type index_t;
+
+  size_t team_size = dash::Team::All().size();
+
+  dash::TeamSpec<2> teamspec_2d(team_size, 1);
+  teamspec_2d.balance_extents();
+
+  auto block_size_x = 3;
+  auto block_size_y = 4;
+  auto ext_x = (block_size_x * (teamspec_2d.num_units(0) * 2 + 1)) + 2;
+  auto ext_y = (block_size_y * ((teamspec_2d.num_units(1) * 3))) + 3;
+
+  auto size_spec = dash::SizeSpec<2>(ext_x, ext_y);
+
+  const pattern_t pattern(size_spec,
+                          dash::DistributionSpec<2>(dash::TILE(block_size_x),
+                                                    dash::TILE(block_size_y)),
+                          teamspec_2d, dash::Team::All());
+
+  {
+    dash::Matrix<int, 2, index_t, pattern_t> matrix_a;
+    matrix_a.allocate(pattern);
+
+    fill_matrix(matrix_a);
+
+    // Write one hyperslab at a time instead of buffering
+    dio::OutputStream os(_filename);
+    os << dio::dataset(_dataset)
+       << dio::driver(dio::hdf5_driver::ZERO_COPY)
+       << matrix_a;
+  }
+  dash::barrier();
+
+  dash::Matrix<int, 2, index_t, pattern_t> matrix_b(ext_x, ext_y);
+  dio::InputStream is(_filename);
+  is >> dio::dataset(_dataset) >> matrix_b;
+
+  verify_matrix(matrix_b);
+}
+
+TEST_F(HDF5MatrixTest, TilePatternBuffered) {
+  typedef dash::TilePattern<2> tile_pattern_t;
+  typedef dash::Pattern<2> pattern_t;
+  typedef typename pattern_t::index_type index_t;
+
+  size_t team_size = dash::Team::All().size();
+
+  dash::TeamSpec<2> teamspec_2d(team_size, 1);
+  teamspec_2d.balance_extents();
+
+  // Small tiles, several tiles per unit in every dimension
+  auto tile_size_x = 2;
+  auto tile_size_y = 3;
+  auto ext_x = tile_size_x * teamspec_2d.num_units(0) * 4;
+  auto ext_y = tile_size_y * teamspec_2d.num_units(1) * 3;
+
+  const tile_pattern_t tile_pattern(
+      dash::SizeSpec<2>(ext_x, ext_y),
+      dash::DistributionSpec<2>(dash::TILE(tile_size_x),
+                                dash::TILE(tile_size_y)),
+      teamspec_2d, dash::Team::All());
+
+  {
+    dash::Matrix<int, 2, index_t, tile_pattern_t> matrix_a(tile_pattern);
+    // Local memory of tile patterns is not linear, fill by local index
+    for (index_t lidx = 0; lidx < tile_pattern.local_size(); ++lidx) {
+      auto coords = tile_pattern.coords(tile_pattern.global(lidx));
+      matrix_a.lbegin()[lidx] = cantorpi(coords);
+    }
+    dash::barrier();
+
+    dio::OutputStream os(_filename);
+    os << dio::dataset(_dataset) << dio::store_pattern(false) << matrix_a;
+  }
+  dash::barrier();
+
+  // restore to blocked pattern
+  dash::Matrix<int, 2, index_t, pattern_t> matrix_b(ext_x, ext_y);
+  dio::InputStream is(_filename);
+  is >> dio::dataset(_dataset) >> matrix_b;
+
+  verify_matrix(matrix_b);
+}
+
+#if H5_VERSION_GE(1, 10, 2)
+// Parallel writes to filtered datasets require HDF5 1.10.2
+TEST_F(HDF5MatrixTest, ChunkedCompressed) {
+  typedef dash::Pattern<2> pattern_t;
+  typedef typename pattern_t::index_type index_t;
+
+  dash::TeamSpec<2> teamspec_2d(dash::Team::All());
+  teamspec_2d.balance_extents();
+
+  auto ext_x = 8 * teamspec_2d.num_units(0);
+  auto ext_y = 6 * teamspec_2d.num_units(1);
+
+  const pattern_t pattern(dash::SizeSpec<2>(ext_x, ext_y),
+                          dash::DistributionSpec<2>(dash::BLOCKED,
+                                                    dash::BLOCKED),
+                          teamspec_2d, dash::Team::All());
+  {
+    dash::Matrix<int, 2, index_t, pattern_t> matrix_a(pattern);
+    fill_matrix(matrix_a);
+
+    dio::OutputStream os(_filename);
+    os << dio::dataset(_dataset)
+       << dio::compression(6, true)
+       << dio::alignment(4096)
+       << matrix_a;
+  }
+  dash::barrier();
+
+  if (dash::myid() == 0) {
+    // Chunks match the blocks of the pattern
+    hid_t file_id = H5Fopen(_filename.c_str(), H5F_ACC_RDONLY, H5P_DEFAULT);
+    hid_t h5dset = H5Dopen(file_id, _dataset.c_str(), H5P_DEFAULT);
+    hid_t dcpl_id = H5Dget_create_plist(h5dset);
+    hsize_t chunk_dims[2];
+    EXPECT_EQ_U(H5D_CHUNKED, H5Pget_layout(dcpl_id));
+    EXPECT_EQ_U(2, H5Pget_chunk(dcpl_id, 2, chunk_dims));
+    EXPECT_EQ_U(pattern.blocksize(0), chunk_dims[0]);
+    EXPECT_EQ_U(pattern.blocksize(1), chunk_dims[1]);
+    EXPECT_EQ_U(2, H5Pget_nfilters(dcpl_id));
+    H5Pclose(dcpl_id);
+    H5Dclose(h5dset);
+    H5Fclose(file_id);
+  }
+  dash::barrier();
+
+  dash::Matrix<int, 2, index_t, pattern_t> matrix_b(pattern);
+  dio::InputStream is(_filename);
+  is >> dio::dataset(_dataset) >> matrix_b;
+
+  verify_matrix(matrix_b);
+}
+#endif
+
+TEST_F(HDF5MatrixTest, CheckpointEngine) {
+  typedef dash::TilePattern<2> pattern_t;
+  typedef typename pattern_t::index_type index_t;
+
+  dash::TeamSpec<2> teamspec_2d(dash::Team::All());
+  teamspec_2d.balance_extents();
+
+  auto ext_x = 4 * teamspec_2d.num_units(0) * 2;
+  auto ext_y = 3 * teamspec_2d.num_units(1) * 2;
+  int  num_checkpoints = 3;
+
+  const pattern_t pattern(dash::SizeSpec<2>(ext_x, ext_y),
+                          dash::DistributionSpec<2>(dash::TILE(4),
+                                                    dash::TILE(3)),
+                          teamspec_2d, dash::Team::All());
+  dash::Matrix<int, 2, index_t, pattern_t> matrix_a(pattern);
+  {
+    // Single staging buffer, checkpoints are written in sequence
+    dio::CheckpointEngine engine(dash::Team::All(), 1);
+    for (int secret = 0; secret < num_checkpoints; ++secret) {
+      for (index_t lidx = 0; lidx < pattern.local_size(); ++lidx) {
+        auto coords = pattern.coords(pattern.global(lidx));
+        matrix_a.lbegin()[lidx] = cantorpi(coords) + secret;
+      }
+      dio::hdf5_options foptions;
+      foptions.overwrite_file = (secret == 0);
+      foptions.store_pattern  = false;
+      engine.write(matrix_a, _filename,
+                   "checkpoints/" + std::to_string(secret), foptions);
+      // Modifying the container does not affect the checkpoint
+      std::fill(matrix_a.lbegin(), matrix_a.lend(), -1);
+    }
+    engine.wait();
+    EXPECT_EQ_U(0, engine.pending());
+  }
+  dash::barrier();
+
+  for (int secret = 0; secret < num_checkpoints; ++secret) {
+    dash::Matrix<int, 2> matrix_b;
+    dio::InputStream is(_filename);
+    is >> dio::dataset("checkpoints/" + std::to_string(secret)) >> matrix_b;
+    verify_matrix(matrix_b, secret);
+  }
+}
+
+TEST_F(HDF5MatrixTest, CheckpointEngineFailure) {
+  dash::Matrix<int, 2> matrix(dash::SizeSpec<2>(dash::size() * 4, 3));
+  fill_matrix(matrix);
+  dash::barrier();
+
+  bool failed = false;
+  {
+    dio::CheckpointEngine engine;
+    try {
+      // Directory does not exist, file cannot be created at any unit
+      engine.write(matrix, "non-existing-dir/" + _filename, _dataset);
+      engine.wait();
+    } catch (const dash::exception::RuntimeError &) {
+      failed = true;
+    }
+    EXPECT_EQ_U(0, engine.pending());
+  }
+  EXPECT_TRUE_U(failed);
+}
+
 TEST_F(HDF5MatrixTest, MultipleDatasets) {
   int ext_x = dash::size() * 5;
   int ext_y = dash::size() * 3;
@@ -0,0 +1,243 @@
+#include "HaloExchangePlanTest.h"
+#include "HaloTestHelpers.h"
+
+#include <dash/Matrix.h>
+#include <dash/experimental/HaloExchangePlan.h>
+
+#include <array>
+
+
+using dash::test::element_value;
+using dash::test::init_matrix;
+
+namespace {
+
+/**
+ * Element type that is not a DART basic type, transferred as bytes.
+ */
+struct halo_point_t
+{
+  long   value;
+  double scaled;
+  int    sign;
+};
+
+} // namespace
+
+TEST_F(HaloExchangePlanTest, BoxStencil3D)
+{
+  using dash::experimental::HaloSpec;
+  using dash::experimental::HaloExchangePlan;
+  using pattern_t = dash::Pattern<3>;
+  using matrix_t  = dash::Matrix<long, 3, long, pattern_t>;
+  using plan_t    = HaloExchangePlan<matrix_t, HaloSpec<3>>;
+
+  dash::TeamSpec<3> teamspec;
+  teamspec.balance_extents();
+  pattern_t pattern(dash::SizeSpec<3>(8, 8, 8),
+                    dash::DistributionSpec<3>(
+                      dash::BLOCKED, dash::BLOCKED, dash::BLOCKED),
+                    teamspec);
+  matrix_t matrix(pattern);
+  init_matrix(matrix);
+
+  HaloSpec<3> halospec({ { { -1, 1 }, { -1, 1 }, { -1, 1 } } });
+  plan_t plan(matrix, halospec);
+
+  // Every halo region in the global domain is exchanged, including edges
+  // and corners:
+  for (const auto & region : plan.regions()) {
+    for (auto d = 0; d < 3; ++d) {
+      EXPECT_GE_U(region.offsets[d], 0);
+      EXPECT_LE_U(region.offsets[d] + region.extents[d], 8);
+    }
+  }
+  if (dash::size() > 1) {
+    EXPECT_GT_U(plan.regions().size(), 0);
+  }
+
+  // Exchange twice to validate that the plan can be reused:
+  for (int t = 0; t < 2; ++t) {
+    plan.start();
+    plan.wait();
+    const auto & view = plan.view();
+    for (const auto & region : plan.regions()) {
+      for (long i = 0; i < region.extents[0]; ++i) {
+      for (long j = 0; j < region.extents[1]; ++j) {
+      for (long k = 0; k < region.extents[2]; ++k) {
+        std::array<long, 3> gcoords {{ region.offsets[0] + i,
+                                       region.offsets[1] + j,
+                                       region.offsets[2] + k }};
+        std::array<long, 3> lcoords {{ gcoords[0] - view.offset(0),
+                                       gcoords[1] - view.offset(1),
+                                       gcoords[2] - view.offset(2) }};
+        EXPECT_EQ_U(element_value(gcoords), plan.at(lcoords));
+      }}}
+    }
+    matrix.barrier();
+  }
+  // Elements in the local block:
+  EXPECT_EQ_U(element_value(pattern.global({{ 0, 0, 0 }})),
+              plan.at({{ 0, 0, 0 }}));
+}
+
+TEST_F(HaloExchangePlanTest, StarStencil2DFaces)
+{
+  using dash::experimental::HaloSpec;
+  using dash::experimental::HaloExchangePlan;
+  using dash::experimental::HaloExchangeScope;
+  using pattern_t = dash::Pattern<2>;
+  using matrix_t  = dash::Matrix<long, 2, long, pattern_t>;
+  using plan_t    = HaloExchangePlan<matrix_t, HaloSpec<2>>;
+
+  dash::TeamSpec<2> teamspec;
+  teamspec.balance_extents();
+  pattern_t pattern(dash::SizeSpec<2>(16, 12),
+                    dash::DistributionSpec<2>(dash::BLOCKED, dash::BLOCKED),
+                    teamspec);
+  matrix_t matrix(pattern);
+  init_matrix(matrix);
+
+  HaloSpec<2> halospec({ { { -2, 1 }, { -1, 2 } } });
+  plan_t plan(matrix, halospec, HaloExchangeScope::FACES);
+
+  const auto & view = plan.view();
+  size_t num_faces = 0;
+  for (auto d = 0; d < 2; ++d) {
+    num_faces += (view.offset(d) > 0);
+    num_faces += (view.offset(d) + view.extent(d) < pattern.extent(d));
+  }
+  EXPECT_EQ_U(num_faces, plan.regions().size());
+  // No corner regions:
+  EXPECT_TRUE_U(plan.region({{ -1, -1 }}) == nullptr);
+
+  plan.update();
+  for (const auto & region : plan.regions()) {
+    // Face regions have a single non-zero direction:
+    EXPECT_EQ_U(1, std::abs(region.direction[0]) +
+                   std::abs(region.direction[1]));
+    EXPECT_EQ_U(&region, plan.region(region.direction));
+    for (long i = 0; i < region.extents[0]; ++i) {
+      for (long j = 0; j < region.extents[1]; ++j) {
+        std::array<long, 2> gcoords {{ region.offsets[0] + i,
+                                       region.offsets[1] + j }};
+        EXPECT_EQ_U(element_value(gcoords),
+                    plan.at({{ gcoords[0] - view.offset(0),
+                               gcoords[1] - view.offset(1) }}));
+      }
+    }
+  }
+  matrix.barrier();
+}
+
+TEST_F(HaloExchangePlanTest, BoundaryModes2D)
+{
+  using dash::experimental::HaloSpec;
+  using dash::experimental::HaloBoundary;
+  using dash::experimental::HaloExchangePlan;
+  using dash::experimental::HaloRegion;
+  using pattern_t  = dash::Pattern<2>;
+  using matrix_t   = dash::Matrix<long, 2, long, pattern_t>;
+  using plan_t     = HaloExchangePlan<matrix_t, HaloSpec<2>>;
+  using coords_t   = std::array<long, 2>;
+
+  const long fixed_value = -5;
+  long       step        = 0;
+
+  dash::TeamSpec<2> teamspec;
+  teamspec.balance_extents();
+  pattern_t pattern(dash::SizeSpec<2>(16, 12),
+                    dash::DistributionSpec<2>(dash::BLOCKED, dash::BLOCKED),
+                    teamspec);
+  matrix_t matrix(pattern);
+  init_matrix(matrix);
+
+  auto custom_value = [&](const coords_t & gcoords) {
+                        return -1000 * step - 100 * gcoords[0] - gcoords[1];
+                      };
+  plan_t::boundary_spec_t boundary;
+  boundary.set_periodic(0)
+          .set_fixed(1, HaloRegion::MINUS, fixed_value)
+          .set_custom(1, HaloRegion::PLUS, custom_value);
+
+  HaloSpec<2> halospec({ { { -1, 1 }, { -1, 2 } } });
+  plan_t plan(matrix, halospec, boundary);
+
+  // Halo regions exist in all directions:
+  EXPECT_EQ_U(8, plan.regions().size());
+
+  const auto & view = plan.view();
+  for (step = 0; step < 2; ++step) {
+    plan.update();
+    for (const auto & region : plan.regions()) {
+      for (long i = 0; i < region.extents[0]; ++i) {
+        for (long j = 0; j < region.extents[1]; ++j) {
+          coords_t gcoords {{ region.offsets[0] + i,
+                              region.offsets[1] + j }};
+          long expected;
+          if (gcoords[1] < 0) {
+            expected = fixed_value;
+          } else if (gcoords[1] >= 12) {
+            expected = custom_value(gcoords);
+          } else {
+            expected = element_value<2>({{ (gcoords[0] + 16) % 16,
+                                           gcoords[1] }});
+          }
+          EXPECT_EQ_U(expected,
+                      plan.at({{ gcoords[0] - view.offset(0),
+                                 gcoords[1] - view.offset(1) }}));
+        }
+      }
+    }
+    matrix.barrier();
+  }
+}
+
+TEST_F(HaloExchangePlanTest, BoxStencil2DStruct)
+{
+  using dash::experimental::HaloSpec;
+  using dash::experimental::HaloExchangePlan;
+  using pattern_t = dash::Pattern<2>;
+  using matrix_t  = dash::Matrix<halo_point_t, 2, long, pattern_t>;
+  using plan_t    = HaloExchangePlan<matrix_t, HaloSpec<2>>;
+
+  dash::TeamSpec<2> teamspec;
+  teamspec.balance_extents();
+  pattern_t pattern(dash::SizeSpec<2>(16, 12),
+                    dash::DistributionSpec<2>(dash::BLOCKED, dash::BLOCKED),
+                    teamspec);
+  matrix_t matrix(pattern);
+  for (long l = 0; l < matrix.local_size(); ++l) {
+    auto lcoords = pattern.local_memory_layout().coords(l);
+    long value   = element_value(pattern.global(lcoords));
+    matrix.lbegin()[l] = halo_point_t { value, 0.5 * value, -1 };
+  }
+  matrix.barrier();
+
+  // Blocks of several contiguous elements are merged into transfers:
+  HaloSpec<2> halospec({ { { -2, 2 }, { -2, 2 } } });
+  plan_t plan(matrix, halospec);
+  if (dash::size() > 1) {
+    EXPECT_GT_U(plan.num_transfers(), 0);
+    EXPECT_LE_U(plan.num_neighbor_transfers(), plan.num_transfers());
+  }
+
+  plan.update();
+  const auto & view = plan.view();
+  for (const auto & region : plan.regions()) {
+    for (long i = 0; i < region.extents[0]; ++i) {
+      for (long j = 0; j < region.extents[1]; ++j) {
+        std::array<long, 2> gcoords {{ region.offsets[0] + i,
+                                       region.offsets[1] + j }};
+        const halo_point_t & point = plan.at(
+                                       {{ gcoords[0] - view.offset(0),
+                                          gcoords[1] - view.offset(1) }});
+        long value = element_value(gcoords);
+        EXPECT_EQ_U(value,       point.value);
+        EXPECT_EQ_U(0.5 * value, point.scaled);
+        EXPECT_EQ_U(-1,          point.sign);
+      }
+    }
+  }
+  matrix.barrier();
+}
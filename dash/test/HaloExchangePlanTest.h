@@ -0,0 +1,19 @@
+#ifndef DASH__TEST__HALO_EXCHANGE_PLAN_TEST_H_
+#define DASH__TEST__HALO_EXCHANGE_PLAN_TEST_H_
+
+#include "TestBase.h"
+
+/**
+ * Test fixture for class dash::experimental::HaloExchangePlan
+ */
+class HaloExchangePlanTest : public dash::test::TestBase {
+protected:
+
+  HaloExchangePlanTest() {
+  }
+
+  virtual ~HaloExchangePlanTest() {
+  }
+};
+
+#endif // DASH__TEST__HALO_EXCHANGE_PLAN_TEST_H_
@@ -0,0 +1,112 @@
+#include "HaloMatrixTest.h"
+#include "HaloTestHelpers.h"
+
+#include <dash/Matrix.h>
+#include <dash/experimental/HaloMatrix.h>
+
+#include <array>
+
+
+using dash::test::element_value;
+using dash::test::init_matrix;
+
+TEST_F(HaloMatrixTest, BoundaryModes2D)
+{
+  using dash::experimental::HaloSpec;
+  using dash::experimental::HaloMatrix;
+  using dash::experimental::HaloRegion;
+  using pattern_t  = dash::Pattern<2>;
+  using matrix_t   = dash::Matrix<long, 2, long, pattern_t>;
+  using halo_t     = HaloMatrix<matrix_t, HaloSpec<2>>;
+  using coords_t   = std::array<long, 2>;
+
+  const long fixed_value = -5;
+  long       step        = 0;
+
+  dash::TeamSpec<2> teamspec;
+  teamspec.balance_extents();
+  pattern_t pattern(dash::SizeSpec<2>(16, 12),
+                    dash::DistributionSpec<2>(dash::BLOCKED, dash::BLOCKED),
+                    teamspec);
+  matrix_t matrix(pattern);
+  init_matrix(matrix);
+
+  auto custom_value = [&](const coords_t & gcoords) {
+                        return -1000 * step - 100 * gcoords[0] - gcoords[1];
+                      };
+  halo_t::boundary_spec_t boundary;
+  boundary.set_periodic(0)
+          .set_fixed(1, HaloRegion::MINUS, fixed_value)
+          .set_custom(1, HaloRegion::PLUS, custom_value);
+
+  HaloSpec<2> halospec({ { { -1, 1 }, { -1, 1 } } });
+  halo_t halomatrix(matrix, halospec, boundary);
+
+  // Elements at the global boundaries are computed:
+  EXPECT_EQ_U(matrix.local_size(),
+              halomatrix.haloBlock().view_save().size());
+
+  for (step = 0; step < 2; ++step) {
+    halomatrix.updateHalos();
+    for (auto it = halomatrix.begin(); it != halomatrix.end(); ++it) {
+      auto lcoords = pattern.local_memory_layout().coords(it.lpos());
+      auto gcoords = pattern.global(lcoords);
+      for (int d = 0; d < 2; ++d) {
+        for (int offset = -1; offset <= 1; offset += 2) {
+          coords_t ncoords = gcoords;
+          ncoords[d] += offset;
+          long expected;
+          if (ncoords[1] < 0) {
+            expected = fixed_value;
+          } else if (ncoords[1] >= 12) {
+            expected = custom_value(ncoords);
+          } else {
+            expected = element_value<2>({{ (ncoords[0] + 16) % 16,
+                                           ncoords[1] }});
+          }
+          EXPECT_EQ_U(expected, it.halo_value(d, offset));
+        }
+      }
+    }
+    matrix.barrier();
+  }
+}
+
+TEST_F(HaloMatrixTest, NoBoundary2D)
+{
+  using dash::experimental::HaloSpec;
+  using dash::experimental::HaloMatrix;
+  using pattern_t  = dash::Pattern<2>;
+  using matrix_t   = dash::Matrix<long, 2, long, pattern_t>;
+  using halo_t     = HaloMatrix<matrix_t, HaloSpec<2>>;
+
+  dash::TeamSpec<2> teamspec;
+  teamspec.balance_extents();
+  pattern_t pattern(dash::SizeSpec<2>(16, 12),
+                    dash::DistributionSpec<2>(dash::BLOCKED, dash::BLOCKED),
+                    teamspec);
+  matrix_t matrix(pattern);
+  init_matrix(matrix);
+
+  HaloSpec<2> halospec({ { { -1, 1 }, { -1, 1 } } });
+  halo_t halomatrix(matrix, halospec);
+  halomatrix.updateHalos();
+
+  // Elements at the global boundaries are not computed:
+  long nelem = 0;
+  for (auto it = halomatrix.begin(); it != halomatrix.end(); ++it, ++nelem) {
+    auto lcoords = pattern.local_memory_layout().coords(it.lpos());
+    auto gcoords = pattern.global(lcoords);
+    for (int d = 0; d < 2; ++d) {
+      EXPECT_GT_U(gcoords[d], 0);
+      EXPECT_LT_U(gcoords[d], static_cast<long>(pattern.extent(d)) - 1);
+      for (int offset = -1; offset <= 1; offset += 2) {
+        auto ncoords = gcoords;
+        ncoords[d] += offset;
+        EXPECT_EQ_U(element_value(ncoords), it.halo_value(d, offset));
+      }
+    }
+  }
+  EXPECT_EQ_U(halomatrix.haloBlock().view_save().size(), nelem);
+  matrix.barrier();
+}
@@ -0,0 +1,19 @@
+#ifndef DASH__TEST__HALO_MATRIX_TEST_H_
+#define DASH__TEST__HALO_MATRIX_TEST_H_
+
+#include "TestBase.h"
+
+/**
+ * Test fixture for class dash::experimental::HaloMatrix
+ */
+class HaloMatrixTest : public dash::test::TestBase {
+protected:
+
+  HaloMatrixTest() {
+  }
+
+  virtual ~HaloMatrixTest() {
+  }
+};
+
+#endif // DASH__TEST__HALO_MATRIX_TEST_H_
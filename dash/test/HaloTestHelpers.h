@@ -0,0 +1,42 @@
+#ifndef DASH__TEST__HALO_TEST_HELPERS_H__
+#define DASH__TEST__HALO_TEST_HELPERS_H__
+
+#include <array>
+#include <cstddef>
+
+namespace dash {
+namespace test {
+
+/**
+ * Value of the element at the given global coordinates, linear in every
+ * coordinate.
+ */
+template<std::size_t NumDimensions>
+long element_value(const std::array<long, NumDimensions> & gcoords)
+{
+  long value = 0;
+  for (std::size_t d = 0; d < NumDimensions; ++d) {
+    value = value * 100 + gcoords[d];
+  }
+  return value;
+}
+
+/**
+ * Initializes the local elements of the matrix with values derived from
+ * their global coordinates.
+ */
+template<typename MatrixT>
+void init_matrix(MatrixT & matrix)
+{
+  auto & pattern = matrix.pattern();
+  for (long l = 0; l < matrix.local_size(); ++l) {
+    auto lcoords = pattern.local_memory_layout().coords(l);
+    matrix.lbegin()[l] = element_value(pattern.global(lcoords));
+  }
+  matrix.barrier();
+}
+
+} // namespace test
+} // namespace dash
+
+#endif // DASH__TEST__HALO_TEST_HELPERS_H__
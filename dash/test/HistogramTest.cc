@@ -0,0 +1,103 @@
+#include "HistogramTest.h"
+
+#include <dash/Array.h>
+#include <dash/algorithm/Histogram.h>
+
+#include <vector>
+
+
+namespace {
+
+/**
+ * Key of the element at global index \c i, also negative and exceeding
+ * the number of bins.
+ */
+long key_at(long i, long nbins)
+{
+  return (i * 7) % (nbins + 11) - 3;
+}
+
+/**
+ * Initializes the local elements of \c values with their global index and
+ * checks the histogram of keys in the range [\c begin, \c end).
+ */
+template <
+  class ExecutionPolicy,
+  class BinArrayType >
+void test_histogram(
+  ExecutionPolicy && policy,
+  dash::Array<long> & values,
+  long                begin,
+  long                end,
+  BinArrayType      & bins)
+{
+  long nbins = bins.size();
+  for (size_t l = 0; l < values.lsize(); ++l) {
+    values.local[l] = values.pattern().global(l);
+  }
+  values.barrier();
+
+  dash::histogram(policy, values.begin() + begin, values.begin() + end,
+                  bins, [nbins](long v) { return key_at(v, nbins); });
+
+  std::vector<long> expected(nbins, 0);
+  for (long i = begin; i < end; ++i) {
+    long key = key_at(i, nbins);
+    if (key >= 0 && key < nbins) {
+      ++expected[key];
+    }
+  }
+  for (size_t l = 0; l < bins.lsize(); ++l) {
+    long b = bins.pattern().global(l);
+    EXPECT_EQ_U(expected[b], static_cast<long>(bins.local[l]));
+  }
+  // Bins are readable by all units after completion:
+  EXPECT_EQ_U(expected[nbins - 1], static_cast<long>(bins[nbins - 1]));
+  bins.barrier();
+}
+
+} // namespace
+
+TEST_F(HistogramTest, SmallBlockedBins)
+{
+  dash::Array<long> values(_num_elem, dash::CYCLIC);
+  dash::Array<int>  bins(37);
+  test_histogram(dash::execution::seq, values, 0, _num_elem, bins);
+  test_histogram(dash::execution::par_unseq, values, 5, _num_elem - 3,
+                 bins);
+}
+
+TEST_F(HistogramTest, LargeBlockedBins)
+{
+  // Reduced and scattered to the owners of bins:
+  dash::Array<long>          values(_num_elem);
+  dash::Array<unsigned long> bins(10007);
+  test_histogram(dash::execution::par_unseq, values, 0, _num_elem, bins);
+  test_histogram(dash::execution::seq, values, 11, 12000, bins);
+}
+
+TEST_F(HistogramTest, LargeCyclicBins)
+{
+  dash::Array<long>   values(_num_elem, dash::BLOCKCYCLIC(13));
+  dash::Array<double> bins(5003, dash::CYCLIC);
+  test_histogram(dash::execution::par_unseq, values, 0, _num_elem, bins);
+}
+
+TEST_F(HistogramTest, BinCount)
+{
+  dash::Array<int>  values(_num_elem);
+  dash::Array<long> bins(100);
+  for (size_t l = 0; l < values.lsize(); ++l) {
+    values.local[l] = values.pattern().global(l) % 101;
+  }
+  values.barrier();
+  dash::histogram(values.begin(), values.end(), bins);
+
+  for (size_t l = 0; l < bins.lsize(); ++l) {
+    long b = bins.pattern().global(l);
+    // Values 0 ... 100 repeated, value 100 is not counted:
+    long expected = _num_elem / 101 +
+                    (b < static_cast<long>(_num_elem % 101) ? 1 : 0);
+    EXPECT_EQ_U(expected, bins.local[l]);
+  }
+}
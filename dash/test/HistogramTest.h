@@ -0,0 +1,23 @@
+#ifndef DASH__TEST__HISTOGRAM_TEST_H_
+#define DASH__TEST__HISTOGRAM_TEST_H_
+
+#include "TestBase.h"
+
+/**
+ * Test fixture for algorithm dash::histogram.
+ */
+class HistogramTest : public dash::test::TestBase {
+protected:
+  /// Using a prime to cause inconvenient strides
+  const size_t _num_elem = 20011;
+
+  HistogramTest() {
+    LOG_MESSAGE(">>> Test suite: HistogramTest");
+  }
+
+  virtual ~HistogramTest() {
+    LOG_MESSAGE("<<< Closing test suite: HistogramTest");
+  }
+};
+
+#endif // DASH__TEST__HISTOGRAM_TEST_H_
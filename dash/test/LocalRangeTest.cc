@@ -266,3 +266,31 @@ TEST_F(LocalRangeTest, View2DimRange)
 }
 
 #endif
+
+TEST_F(LocalRangeTest, ArrayCyclicSubrange)
+{
+  const size_t num_elem_local = 10;
+  const size_t num_elem_total = dash::size() * num_elem_local;
+  // Subrange not aligned to the cyclic distribution:
+  const size_t g_begin        = 3;
+  const size_t g_end          = num_elem_total - 2;
+
+  dash::Array<int> array(num_elem_total, dash::CYCLIC);
+
+  auto l_idx_range = dash::local_index_range(
+                       array.begin() + g_begin,
+                       array.begin() + g_end);
+  LOG_MESSAGE("local index range: begin:%d - end:%d",
+              l_idx_range.begin, l_idx_range.end);
+
+  ASSERT_LE_U(l_idx_range.begin, l_idx_range.end);
+  ASSERT_LE_U(l_idx_range.end, array.lsize());
+  // Local elements are in the range exactly if their global index is:
+  for (size_t l = 0; l < array.lsize(); ++l) {
+    size_t g = array.pattern().global(l);
+    bool in_range   = g >= g_begin && g < g_end;
+    bool in_l_range = l >= static_cast<size_t>(l_idx_range.begin) &&
+                      l <  static_cast<size_t>(l_idx_range.end);
+    EXPECT_EQ_U(in_range, in_l_range);
+  }
+}
@@ -0,0 +1,58 @@
+#include "LowerBoundTest.h"
+
+#include <dash/algorithm/LowerBound.h>
+
+#include <dash/Array.h>
+
+#include <algorithm>
+#include <functional>
+#include <vector>
+
+
+TEST_F(LowerBoundTest, SortedBlockcyclic)
+{
+  size_t num_elem = 97 * dash::size();
+  dash::Array<int> array(num_elem, dash::BLOCKCYCLIC(5));
+  // Sorted values with duplicates: [ 0 0 0 2 2 2 4 4 4 ... ]
+  std::vector<int> values(num_elem);
+  for (size_t g = 0; g < num_elem; ++g) {
+    values[g] = 2 * (g / 3);
+  }
+  for (size_t l = 0; l < array.lsize(); ++l) {
+    array.local[l] = values[array.pattern().global(l)];
+  }
+  array.barrier();
+
+  for (int v = -1; v <= values.back() + 2; ++v) {
+    auto lb     = dash::lower_bound(array.begin(), array.end(), v);
+    auto ub     = dash::upper_bound(array.begin(), array.end(), v);
+    auto exp_lb = std::lower_bound(values.begin(), values.end(), v);
+    auto exp_ub = std::upper_bound(values.begin(), values.end(), v);
+    EXPECT_EQ_U(exp_lb - values.begin(), lb - array.begin());
+    EXPECT_EQ_U(exp_ub - values.begin(), ub - array.begin());
+  }
+}
+
+TEST_F(LowerBoundTest, SubrangeCompare)
+{
+  size_t num_elem = 64 * dash::size();
+  dash::Array<long> array(num_elem, dash::CYCLIC);
+  // Sorted in descending order:
+  for (size_t l = 0; l < array.lsize(); ++l) {
+    array.local[l] = num_elem - array.pattern().global(l);
+  }
+  array.barrier();
+
+  auto first = array.begin() + 3;
+  auto last  = array.end()   - 5;
+  // Bound in subrange:
+  auto lb = dash::lower_bound(first, last, 10L, std::greater<long>());
+  EXPECT_EQ_U(num_elem - 10, lb - array.begin());
+  // Value greater than all elements in subrange:
+  lb = dash::lower_bound(first, last, static_cast<long>(num_elem),
+                         std::greater<long>());
+  EXPECT_EQ_U(3, lb - array.begin());
+  // Value less than all elements in subrange:
+  lb = dash::lower_bound(first, last, 2L, std::greater<long>());
+  EXPECT_EQ_U(last - array.begin(), lb - array.begin());
+}
@@ -0,0 +1,21 @@
+#ifndef DASH__TEST__LOWER_BOUND_TEST_H_
+#define DASH__TEST__LOWER_BOUND_TEST_H_
+
+#include "TestBase.h"
+
+/**
+ * Test fixture for algorithms dash::lower_bound and dash::upper_bound.
+ */
+class LowerBoundTest : public dash::test::TestBase {
+protected:
+
+  LowerBoundTest() {
+    LOG_MESSAGE(">>> Test suite: LowerBoundTest");
+  }
+
+  virtual ~LowerBoundTest() {
+    LOG_MESSAGE("<<< Closing test suite: LowerBoundTest");
+  }
+};
+
+#endif // DASH__TEST__LOWER_BOUND_TEST_H_
@@ -0,0 +1,138 @@
+#include "MPIIOTest.h"
+
+#include <dash/io/MPIIO.h>
+#include <dash/Array.h>
+#include <dash/Matrix.h>
+#include <dash/pattern/TilePattern.h>
+
+#include <array>
+
+using dash::io::mpiio::StoreMPIIO;
+using dash::io::mpiio::mpiio_options;
+
+namespace {
+
+/**
+ * Value of the element at the given global coordinates.
+ */
+template <size_t NumDimensions>
+long element_value(const std::array<long, NumDimensions>& gcoords,
+                   long secret = 0) {
+  long value = 0;
+  for (auto d = 0; d < NumDimensions; ++d) {
+    value = value * 1000 + gcoords[d];
+  }
+  return value + secret;
+}
+
+/**
+ * Initializes the local elements of a container with values derived from
+ * their global coordinates.
+ */
+template <typename ContainerT>
+void fill_container(ContainerT& container, long secret = 0) {
+  auto& pattern = container.pattern();
+  for (long l = 0; l < static_cast<long>(pattern.local_size()); ++l) {
+    container.lbegin()[l] =
+        element_value(pattern.coords(pattern.global(l)), secret);
+  }
+  container.barrier();
+}
+
+template <typename ContainerT>
+void verify_container(ContainerT& container, long secret = 0) {
+  auto& pattern = container.pattern();
+  for (long l = 0; l < static_cast<long>(pattern.local_size()); ++l) {
+    EXPECT_EQ_U(element_value(pattern.coords(pattern.global(l)), secret),
+                container.lbegin()[l]);
+  }
+}
+
+} // namespace
+
+TEST_F(MPIIOTest, StoreArray) {
+  long ext = dash::size() * 7 + 3;
+  {
+    dash::Array<long> array_a(ext, dash::BLOCKCYCLIC(3));
+    fill_container(array_a, 42);
+    StoreMPIIO::write(array_a, _filename);
+  }
+  dash::Array<long> array_b;
+  StoreMPIIO::read(array_b, _filename);
+
+  ASSERT_EQ_U(ext, array_b.size());
+  // pattern has been restored
+  EXPECT_EQ_U(3, array_b.pattern().blocksize(0));
+  verify_container(array_b, 42);
+
+  // Read into allocated array with different pattern
+  dash::Array<long> array_c(ext, dash::BLOCKED);
+  StoreMPIIO::read(array_c, _filename);
+  verify_container(array_c, 42);
+}
+
+TEST_F(MPIIOTest, StoreTiledMatrix) {
+  typedef dash::TilePattern<2> tile_pattern_t;
+  typedef dash::Pattern<2>     pattern_t;
+
+  dash::TeamSpec<2> teamspec;
+  teamspec.balance_extents();
+  auto ext_x = 3 * teamspec.num_units(0) * 2 + 1;
+  auto ext_y = 2 * teamspec.num_units(1) * 3;
+
+  {
+    // Local memory of tile patterns is not in file order
+    tile_pattern_t pattern(dash::SizeSpec<2>(ext_x, ext_y),
+                           dash::DistributionSpec<2>(dash::TILE(3),
+                                                     dash::TILE(2)),
+                           teamspec);
+    dash::Matrix<long, 2, long, tile_pattern_t> matrix_a(pattern);
+    fill_container(matrix_a);
+    StoreMPIIO::write(matrix_a, _filename);
+  }
+
+  dash::Matrix<long, 2, long, pattern_t> matrix_b(
+    dash::SizeSpec<2>(ext_x, ext_y),
+    dash::DistributionSpec<2>(dash::BLOCKED, dash::NONE));
+  StoreMPIIO::read(matrix_b, _filename);
+  verify_container(matrix_b);
+
+  // Element type and dimensions are validated
+  dash::Matrix<int, 2> matrix_c;
+  EXPECT_THROW(StoreMPIIO::read(matrix_c, _filename),
+               dash::exception::InvalidArgument);
+}
+
+TEST_F(MPIIOTest, RedistributeOnRead) {
+  auto& team_all = dash::Team::All();
+  if (team_all.size() < 4) {
+    SKIP_TEST_MSG("requires at least 4 units");
+  }
+  if (!team_all.is_leaf()) {
+    SKIP_TEST_MSG("team is already split");
+  }
+  long ext = team_all.size() * 5 + 1;
+
+  // Store from a subset of the units
+  auto& sub_team = team_all.split(2);
+  std::string filename = _filename + std::to_string(sub_team.position());
+  {
+    dash::Array<long> array_a(ext, dash::BLOCKED, sub_team);
+    fill_container(array_a, 7);
+    StoreMPIIO::write(array_a, filename);
+  }
+  team_all.barrier();
+
+  // Restore onto all units
+  dash::Array<long> array_b;
+  StoreMPIIO::read(array_b, _filename + "0");
+
+  ASSERT_EQ_U(ext, array_b.size());
+  ASSERT_EQ_U(team_all.size(), array_b.team().size());
+  verify_container(array_b, 7);
+
+  team_all.barrier();
+  if (sub_team.myid() == 0) {
+    remove(filename.c_str());
+  }
+}
@@ -0,0 +1,37 @@
+#ifndef DASH__TEST__MPIIO_TEST_H__INCLUDED
+#define DASH__TEST__MPIIO_TEST_H__INCLUDED
+
+#include "TestBase.h"
+
+#include <cstdio>
+#include <string>
+
+/**
+ * Test fixture for class dash::io::mpiio::StoreMPIIO
+ */
+class MPIIOTest : public dash::test::TestBase {
+ protected:
+  std::string _filename = "test_mpiio.bin";
+
+  MPIIOTest() { LOG_MESSAGE(">>> Test suite: MPIIOTest"); }
+
+  virtual ~MPIIOTest() { LOG_MESSAGE("<<< Closing test suite: MPIIOTest"); }
+
+  virtual void SetUp() {
+    dash::test::TestBase::SetUp();
+    if (dash::myid() == 0) {
+      remove(_filename.c_str());
+    }
+    dash::Team::All().barrier();
+  }
+
+  virtual void TearDown() {
+    dash::Team::All().barrier();
+    if (dash::myid() == 0) {
+      remove(_filename.c_str());
+    }
+    dash::test::TestBase::TearDown();
+  }
+};
+
+#endif  // DASH__TEST__MPIIO_TEST_H__INCLUDED
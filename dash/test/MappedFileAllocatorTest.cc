@@ -0,0 +1,152 @@
+
+#include "MappedFileAllocatorTest.h"
+
+#include <dash/Array.h>
+#include <dash/allocator/MappedFileAllocator.h>
+#include <dash/algorithm/Fill.h>
+#include <dash/algorithm/MinMax.h>
+
+#include <cstdio>
+#include <fstream>
+#include <string>
+
+#include <sys/stat.h>
+#include <unistd.h>
+
+using dash::allocator::MappedFileAllocator;
+using dash::allocator::MappedFileMode;
+
+namespace {
+
+/// Whether a file is mapped in the address space of the calling process
+bool file_is_mapped(const std::string & filename)
+{
+  std::ifstream maps("/proc/self/maps");
+  std::string   line;
+  while (std::getline(maps, line)) {
+    if (line.find(filename) != std::string::npos) {
+      return true;
+    }
+  }
+  return false;
+}
+
+} // namespace
+
+TEST_F(MappedFileAllocatorTest, SharedFile)
+{
+  typedef dash::Array<long>              array_t;
+  typedef typename array_t::pattern_type pattern_t;
+
+  const size_t nlocal = 3000;
+  pattern_t pattern(nlocal * dash::size());
+
+  {
+    MappedFileAllocator<long> mapped(_filename);
+    array_t array(pattern, mapped);
+    ASSERT_EQ_U(nlocal, array.lsize());
+
+    dash::fill(array.begin(), array.end(), 1);
+    array.barrier();
+    if (dash::myid().id == 0) {
+      // Remote access to mapped memory
+      array[array.size() - 1] = -1;
+    }
+    array.barrier();
+    for (size_t l = 0; l < array.lsize(); ++l) {
+      array.local[l] += array.pattern().global(l);
+    }
+    array.barrier();
+    EXPECT_EQ_U(array.size() - 1,
+                static_cast<long>(*dash::max_element(array.begin(),
+                                                     array.end())));
+  }
+  dash::barrier();
+
+  if (dash::myid().id == 0) {
+    struct stat st;
+    ASSERT_EQ_U(0, stat(_filename.c_str(), &st));
+    EXPECT_GE_U(st.st_size, nlocal * dash::size() * sizeof(long));
+  }
+
+  {
+    // Existing data is mapped without initialization
+    MappedFileAllocator<long> mapped(_filename);
+    array_t array(pattern, mapped);
+    for (size_t l = 0; l < array.lsize(); ++l) {
+      long gidx = array.pattern().global(l);
+      long expected = (gidx == static_cast<long>(array.size()) - 1)
+                      ? gidx - 1
+                      : gidx + 1;
+      EXPECT_EQ_U(expected, array.local[l]);
+    }
+  }
+  dash::barrier();
+
+  if (dash::myid().id == 0) {
+    remove(_filename.c_str());
+  }
+}
+
+TEST_F(MappedFileAllocatorTest, FilePerUnit)
+{
+  typedef dash::Array<int>               array_t;
+  typedef typename array_t::pattern_type pattern_t;
+
+  pattern_t pattern(17 * dash::size(), dash::BLOCKCYCLIC(5));
+  std::string unit_file = _filename + "." + std::to_string(dash::myid().id);
+
+  {
+    MappedFileAllocator<int> mapped(
+      _filename, dash::Team::All(), MappedFileMode::FILE_PER_UNIT);
+    array_t array(pattern, mapped);
+    for (size_t l = 0; l < array.lsize(); ++l) {
+      array.local[l] = dash::myid().id;
+    }
+    array.barrier();
+    for (size_t g = 0; g < array.size(); ++g) {
+      EXPECT_EQ_U(static_cast<int>(pattern.unit_at(g)),
+                  static_cast<int>(array[g]));
+    }
+    array.barrier();
+  }
+  dash::barrier();
+
+  // Every unit wrote its local elements to a separate file
+  FILE * f = fopen(unit_file.c_str(), "rb");
+  ASSERT_NE_U(nullptr, f);
+  std::vector<int> values(pattern.local_size());
+  EXPECT_EQ_U(values.size(),
+              fread(values.data(), sizeof(int), values.size(), f));
+  fclose(f);
+  for (auto v : values) {
+    EXPECT_EQ_U(dash::myid().id, v);
+  }
+  remove(unit_file.c_str());
+}
+
+TEST_F(MappedFileAllocatorTest, ReleaseOnDeallocate)
+{
+  typedef dash::Array<double>            array_t;
+  typedef typename array_t::pattern_type pattern_t;
+
+  pattern_t pattern(1000 * dash::size());
+
+  {
+    MappedFileAllocator<double> mapped(_filename);
+    array_t array(pattern, mapped);
+    EXPECT_TRUE_U(file_is_mapped(_filename));
+    array.deallocate();
+    // Mapping is released by the array, before the allocator is destroyed
+    EXPECT_FALSE_U(file_is_mapped(_filename));
+
+    array.allocate(pattern, mapped);
+    EXPECT_TRUE_U(file_is_mapped(_filename));
+  }
+  EXPECT_FALSE_U(file_is_mapped(_filename));
+  dash::barrier();
+
+  if (dash::myid().id == 0) {
+    remove(_filename.c_str());
+  }
+}
@@ -0,0 +1,24 @@
+#ifndef DASH__TEST__MAPPED_FILE_ALLOCATOR_TEST_H_
+#define DASH__TEST__MAPPED_FILE_ALLOCATOR_TEST_H_
+
+#include "TestBase.h"
+
+#include <string>
+
+/**
+ * Test fixture for class dash::allocator::MappedFileAllocator
+ */
+class MappedFileAllocatorTest : public dash::test::TestBase {
+protected:
+  std::string _filename = "test_mapped_file.bin";
+
+  MappedFileAllocatorTest() {
+    LOG_MESSAGE(">>> Test suite: MappedFileAllocatorTest");
+  }
+
+  virtual ~MappedFileAllocatorTest() {
+    LOG_MESSAGE("<<< Closing test suite: MappedFileAllocatorTest");
+  }
+};
+
+#endif // DASH__TEST__MAPPED_FILE_ALLOCATOR_TEST_H_
@@ -107,3 +107,90 @@ TEST_F(MaxElementTest, TestFindArrayUnderfilled)
               max_value, found_max);
   EXPECT_EQ(max_value, found_max);
 }
+
+TEST_F(MaxElementTest, TestMinMaxElement)
+{
+  Array_t array(_num_elem);
+  for (auto l = 0; l < array.lsize(); ++l) {
+    array.local[l] = 1000 + ((l * 37) % 101);
+  }
+  array.barrier();
+  index_t last_pos = array.size() - 1;
+  if (dash::myid() == 0) {
+    // Minimum at the first position and duplicated, the first occurrence
+    // is expected:
+    array[0]            = 3;
+    array[last_pos / 2] = 3;
+    // Maximum duplicated, the last occurrence is expected:
+    array[1]            = 5000;
+    array[last_pos]     = 5000;
+  }
+  array.barrier();
+
+  auto minmax_git = dash::minmax_element(array.begin(), array.end());
+  EXPECT_EQ_U(0,        minmax_git.first.gpos());
+  EXPECT_EQ_U(last_pos, minmax_git.second.gpos());
+  EXPECT_EQ_U(3,        static_cast<Element_t>(*minmax_git.first));
+  EXPECT_EQ_U(5000,     static_cast<Element_t>(*minmax_git.second));
+
+  // Single reduction results must agree with min_element / max_element:
+  EXPECT_EQ_U(minmax_git.first,
+              dash::min_element(array.begin(), array.end()));
+  EXPECT_EQ_U(1, dash::max_element(array.begin(), array.end()).gpos());
+
+  // Sub-range excluding both bounds:
+  auto sub_git = dash::minmax_element(dash::par_unseq,
+                                      array.begin() + 2,
+                                      array.begin() + last_pos / 2);
+  EXPECT_NE_U(sub_git.first, array.begin() + last_pos / 2);
+  EXPECT_LT_U(static_cast<Element_t>(3),
+              static_cast<Element_t>(*sub_git.first));
+  EXPECT_GT_U(static_cast<Element_t>(5000),
+              static_cast<Element_t>(*sub_git.second));
+
+  // Empty range:
+  auto empty_git = dash::minmax_element(array.begin() + 1,
+                                        array.begin() + 1);
+  EXPECT_EQ_U(array.begin() + 1, empty_git.first);
+  EXPECT_EQ_U(array.begin() + 1, empty_git.second);
+}
+
+TEST_F(MaxElementTest, TestMinMaxElementCompare)
+{
+  struct point_t {
+    int  x;
+    long weight;
+  };
+  struct by_weight {
+    bool operator()(const point_t & a, const point_t & b) const {
+      return a.weight < b.weight;
+    }
+  };
+
+  dash::Array<point_t> array(_num_elem);
+  for (auto l = 0; l < array.lsize(); ++l) {
+    array.local[l] = point_t { static_cast<int>(l),
+                               static_cast<long>(100 + (l % 13)) };
+  }
+  array.barrier();
+  index_t min_pos = array.size() / 3;
+  index_t max_pos = array.size() / 2;
+  if (dash::myid() == 0) {
+    array[min_pos] = point_t { -1, 1 };
+    array[max_pos] = point_t { -2, 1000 };
+  }
+  array.barrier();
+
+  auto minmax_git = dash::minmax_element(array.begin(), array.end(),
+                                         by_weight());
+  EXPECT_EQ_U(min_pos, minmax_git.first.gpos());
+  EXPECT_EQ_U(max_pos, minmax_git.second.gpos());
+  EXPECT_EQ_U(-1, static_cast<point_t>(*minmax_git.first).x);
+
+  auto max_git = dash::max_element(
+                   array.begin(), array.end(),
+                   [](const point_t & a, const point_t & b) {
+                     return a.weight > b.weight;
+                   });
+  EXPECT_EQ_U(max_pos, max_git.gpos());
+}
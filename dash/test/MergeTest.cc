@@ -0,0 +1,75 @@
+#include "MergeTest.h"
+
+#include <dash/algorithm/Merge.h>
+#include <dash/algorithm/Unique.h>
+
+#include <dash/Array.h>
+
+#include <algorithm>
+#include <vector>
+
+
+TEST_F(MergeTest, MergeDifferentDistributions)
+{
+  size_t num_elem_a = 113 * dash::size();
+  size_t num_elem_b =  71 * dash::size() + 3;
+  dash::Array<int> array_a(num_elem_a, dash::CYCLIC);
+  dash::Array<int> array_b(num_elem_b, dash::BLOCKED);
+  dash::Array<int> array_out(num_elem_a + num_elem_b, dash::BLOCKCYCLIC(9));
+
+  std::vector<int> values_a(num_elem_a);
+  std::vector<int> values_b(num_elem_b);
+  for (size_t g = 0; g < num_elem_a; ++g) {
+    values_a[g] = 3 * g;
+  }
+  for (size_t g = 0; g < num_elem_b; ++g) {
+    values_b[g] = 2 * g + 1;
+  }
+  for (size_t l = 0; l < array_a.lsize(); ++l) {
+    array_a.local[l] = values_a[array_a.pattern().global(l)];
+  }
+  for (size_t l = 0; l < array_b.lsize(); ++l) {
+    array_b.local[l] = values_b[array_b.pattern().global(l)];
+  }
+  array_a.barrier();
+
+  auto out_last = dash::merge(array_a.begin(), array_a.end(),
+                              array_b.begin(), array_b.end(),
+                              array_out.begin());
+  EXPECT_EQ_U(array_out.end(), out_last);
+
+  std::vector<int> expected;
+  std::merge(values_a.begin(), values_a.end(),
+             values_b.begin(), values_b.end(),
+             std::back_inserter(expected));
+  for (size_t l = 0; l < array_out.lsize(); ++l) {
+    EXPECT_EQ_U(expected[array_out.pattern().global(l)],
+                array_out.local[l]);
+  }
+}
+
+TEST_F(MergeTest, UniqueInPlace)
+{
+  size_t num_elem = 250 * dash::size();
+  dash::Array<long> array(num_elem, dash::BLOCKCYCLIC(7));
+  // Sorted values, duplicates in groups of decreasing size:
+  std::vector<long> values(num_elem);
+  for (size_t g = 0; g < num_elem; ++g) {
+    values[g] = (g * g) / 97;
+  }
+  for (size_t l = 0; l < array.lsize(); ++l) {
+    array.local[l] = values[array.pattern().global(l)];
+  }
+  array.barrier();
+
+  auto last = dash::unique(array.begin(), array.end());
+
+  values.erase(std::unique(values.begin(), values.end()), values.end());
+  EXPECT_EQ_U(values.size(), last - array.begin());
+  for (size_t l = 0; l < array.lsize(); ++l) {
+    size_t g = array.pattern().global(l);
+    if (g < values.size()) {
+      EXPECT_EQ_U(values[g], array.local[l]);
+    }
+  }
+}
@@ -0,0 +1,21 @@
+#ifndef DASH__TEST__MERGE_TEST_H_
+#define DASH__TEST__MERGE_TEST_H_
+
+#include "TestBase.h"
+
+/**
+ * Test fixture for algorithms dash::merge and dash::unique.
+ */
+class MergeTest : public dash::test::TestBase {
+protected:
+
+  MergeTest() {
+    LOG_MESSAGE(">>> Test suite: MergeTest");
+  }
+
+  virtual ~MergeTest() {
+    LOG_MESSAGE("<<< Closing test suite: MergeTest");
+  }
+};
+
+#endif // DASH__TEST__MERGE_TEST_H_
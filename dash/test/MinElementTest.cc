@@ -255,3 +255,35 @@ TEST_F(MinElementTest, TestFindMatrixDefault)
   EXPECT_EQ(min_value, found_min);
 }
 
+
+TEST_F(MinElementTest, ParallelUnsequenced)
+{
+  // Sufficiently large for several page-aligned chunks per unit:
+  size_t num_local_elem = 3 * 1024 + 5;
+  Element_t min_value   = -17;
+  Array_t array(num_local_elem * dash::size());
+  for (size_t l = 0; l < num_local_elem; ++l) {
+    array.local[l] = 100 + (l % 97);
+  }
+  // Minimum in the last chunk of the last unit, and a second occurrence
+  // of the minimum value after it:
+  if (dash::myid() == dash::size() - 1) {
+    array.local[num_local_elem - 3] = min_value;
+    array.local[num_local_elem - 1] = min_value;
+  }
+  array.barrier();
+
+  auto found_gptr = dash::min_element(
+                      dash::execution::parallel_unsequenced_policy(4),
+                      array.begin(),
+                      array.end());
+  EXPECT_EQ_U(array.size() - 3, found_gptr.pos());
+  EXPECT_EQ_U(min_value, static_cast<Element_t>(*found_gptr));
+
+  auto max_gptr   = dash::max_element(
+                      dash::execution::parallel_unsequenced_policy(4),
+                      array.begin(),
+                      array.end());
+  EXPECT_EQ_U(196, static_cast<Element_t>(*max_gptr));
+  EXPECT_EQ_U(96, max_gptr.pos());
+}
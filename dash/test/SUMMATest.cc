@@ -5,6 +5,7 @@
 #include <dash/Matrix.h>
 
 #include <sstream>
+#include <vector>
 #include <iomanip>
 
 
@@ -16,6 +17,60 @@
   do { } while(0)
 
 
+namespace {
+
+/**
+ * Compares the built-in GEMM kernel to naive multiplication of matrices
+ * with small integer values, so results are exact.
+ */
+template <typename ValueType, dash::MemArrange Storage>
+void test_local_gemm(long long m, long long n, long long k)
+{
+  bool row_major = (Storage == dash::ROW_MAJOR);
+  std::vector<ValueType> a(m * k);
+  std::vector<ValueType> b(k * n);
+  std::vector<ValueType> c(m * n);
+  for (long long i = 0; i < m * k; ++i) {
+    a[i] = static_cast<ValueType>((i * 7) % 9) - 4;
+  }
+  for (long long i = 0; i < k * n; ++i) {
+    b[i] = static_cast<ValueType>((i * 5) % 7) - 3;
+  }
+  for (long long i = 0; i < m * n; ++i) {
+    c[i] = static_cast<ValueType>(i % 3);
+  }
+  std::vector<ValueType> expect(c);
+  for (long long i = 0; i < m; ++i) {
+    for (long long j = 0; j < n; ++j) {
+      ValueType sum = 0;
+      for (long long p = 0; p < k; ++p) {
+        sum += row_major ? a[i * k + p] * b[p * n + j]
+                         : a[p * m + i] * b[j * k + p];
+      }
+      expect[row_major ? i * n + j : j * m + i] += sum;
+    }
+  }
+  dash::internal::gemm_local<ValueType, Storage>(
+    dash::execution::par_unseq, a.data(), b.data(), c.data(), m, n, k);
+  for (long long i = 0; i < m * n; ++i) {
+    ASSERT_EQ_U(expect[i], c[i]);
+  }
+}
+
+} // namespace
+
+
+TEST_F(SUMMATest, LocalGemm)
+{
+  // Extents are not multiples of the register tile and cache blocks:
+  test_local_gemm<double, dash::ROW_MAJOR>(137, 83, 301);
+  test_local_gemm<double, dash::COL_MAJOR>(137, 83, 301);
+  test_local_gemm<float,  dash::ROW_MAJOR>(61, 130, 259);
+  test_local_gemm<float,  dash::COL_MAJOR>(61, 130, 259);
+  test_local_gemm<double, dash::ROW_MAJOR>(1, 1, 1);
+}
+
+
 TEST_F(SUMMATest, Deduction)
 {
   SKIP_TEST_IF_NO_SUMMA();
@@ -253,7 +308,7 @@ TEST_F(SUMMATest, SeqTilePatternMatrix)
   dash::barrier();
 
   // Verify multiplication result (A x id = A):
-  if (false && dash::myid().id == 0) {
+  if (dash::myid().id == 0) {
     // Multiplication of matrix A with identity matrix B should be identical
     // to matrix A:
     for (index_t row = 0; row < static_cast<index_t>(extent_rows); ++row) {
@@ -269,3 +324,107 @@ TEST_F(SUMMATest, SeqTilePatternMatrix)
 
   dash::barrier();
 }
+
+TEST_F(SUMMATest, BcastTilePattern)
+{
+  typedef double                                value_t;
+  typedef dash::TilePattern<2>                  pattern_t;
+  typedef pattern_t::index_type                 index_t;
+  typedef dash::Matrix<value_t, 2, index_t, pattern_t> matrix_t;
+
+  size_t   tile_size = 3;
+  dash::SizeSpec<2> size_spec(dash::size() * tile_size * 2,
+                              dash::size() * tile_size * 2);
+  auto team_spec = dash::make_team_spec<
+                     dash::summa_pattern_partitioning_constraints,
+                     dash::summa_pattern_mapping_constraints,
+                     dash::summa_pattern_layout_constraints >(
+                       size_spec);
+  pattern_t pattern(size_spec,
+                    dash::DistributionSpec<2>(dash::TILE(tile_size),
+                                              dash::TILE(tile_size)),
+                    team_spec);
+  index_t n  = size_spec.extent(0);
+  size_t  t0 = team_spec.extent(0);
+  size_t  t1 = team_spec.extent(1);
+
+  auto value_a = [](index_t i, index_t j) -> value_t {
+                   return static_cast<value_t>((i * 3 + j * 7) % 5) - 2;
+                 };
+  auto value_b = [](index_t i, index_t j) -> value_t {
+                   return static_cast<value_t>((i * 5 + j) % 3) - 1;
+                 };
+
+  for (int layers = 1; layers <= static_cast<int>(dash::size()); ++layers) {
+    bool valid_layers = false;
+    for (int s0 = 1; s0 <= layers; ++s0) {
+      if (layers % s0 == 0 && t0 % s0 == 0 && t1 % (layers / s0) == 0) {
+        valid_layers = true;
+      }
+    }
+    if (!valid_layers) {
+      continue;
+    }
+    for (int node_aware = 0; node_aware < 2; ++node_aware) {
+      LOG_MESSAGE("layers:%d node_aware:%d", layers, node_aware);
+      matrix_t matrix_a(pattern);
+      matrix_t matrix_b(pattern);
+      matrix_t matrix_c(pattern);
+      for (index_t i = 0; i < n; ++i) {
+        for (index_t j = 0; j < n; ++j) {
+          if (pattern.unit_at(std::array<index_t, 2> {{ i, j }}) ==
+              dash::Team::All().myid()) {
+            matrix_a[i][j] = value_a(i, j);
+            matrix_b[i][j] = value_b(i, j);
+            matrix_c[i][j] = 0;
+          }
+        }
+      }
+      dash::barrier();
+
+      dash::summa_bcast(matrix_a, matrix_b, matrix_c, layers, node_aware);
+
+      if (dash::myid().id == 0) {
+        for (index_t i = 0; i < n; ++i) {
+          for (index_t j = 0; j < n; ++j) {
+            value_t expect = 0;
+            for (index_t k = 0; k < n; ++k) {
+              expect += value_a(i, k) * value_b(k, j);
+            }
+            value_t actual = matrix_c[i][j];
+            ASSERT_EQ_U(expect, actual);
+          }
+        }
+      }
+      dash::barrier();
+    }
+  }
+}
+
+TEST_F(SUMMATest, PanelBcastHierarchical)
+{
+  // Assign pairs of units to pretended nodes to broadcast hierarchically
+  // on a single node:
+  std::vector<int32_t> node_ids(dash::size());
+  std::vector<std::vector<dash::global_unit_t>> groups(1);
+  for (size_t u = 0; u < dash::size(); ++u) {
+    node_ids[u] = static_cast<int32_t>(u - u % 2);
+    groups[0].push_back(dash::global_unit_t(u));
+  }
+  dash::internal::PanelBcastTeam bcast_team(
+    dash::Team::All(), groups, node_ids);
+
+  for (size_t root = 0; root < dash::size(); ++root) {
+    std::vector<int> values(5, -1);
+    if (dash::myid().id == static_cast<int>(root)) {
+      for (int v = 0; v < 5; ++v) {
+        values[v] = static_cast<int>(root) * 10 + v;
+      }
+    }
+    bcast_team.bcast(values.data(), values.size(),
+                     dash::global_unit_t(root));
+    for (int v = 0; v < 5; ++v) {
+      ASSERT_EQ_U(static_cast<int>(root) * 10 + v, values[v]);
+    }
+  }
+}
@@ -0,0 +1,186 @@
+#include "ScanTest.h"
+
+#include <dash/Array.h>
+#include <dash/Matrix.h>
+#include <dash/algorithm/Scan.h>
+#include <dash/algorithm/Fill.h>
+
+#include <vector>
+
+
+namespace {
+
+/// Affine map x -> mul * x + add, composed by a non-commutative
+/// associative operation
+struct affine_t {
+  long mul;
+  long add;
+};
+
+struct affine_compose {
+  affine_t operator()(const affine_t & f, const affine_t & g) const {
+    // Apply f, then g:
+    return affine_t { (g.mul * f.mul) % 1009, (g.mul * f.add + g.add) % 1009 };
+  }
+};
+
+affine_t affine_value(long g_index) {
+  return affine_t { 1 + (g_index % 7), g_index % 13 };
+}
+
+} // namespace
+
+TEST_F(ScanTest, InclusiveScanBlocked)
+{
+  dash::Array<long> in(_num_elem * dash::size());
+  dash::Array<long> out(_num_elem * dash::size());
+  dash::fill(in.begin(), in.end(), 1);
+  in.barrier();
+
+  auto out_end = dash::inclusive_scan(in.begin(), in.end(), out.begin());
+  EXPECT_EQ_U(out.end(), out_end);
+  out.barrier();
+
+  for (size_t l = 0; l < out.lsize(); ++l) {
+    auto g = out.pattern().global(l);
+    EXPECT_EQ_U(g + 1, static_cast<long>(out.local[l]));
+  }
+}
+
+TEST_F(ScanTest, ExclusiveScanBlockcyclic)
+{
+  dash::Array<long> in(_num_elem, dash::BLOCKCYCLIC(3));
+  dash::Array<long> out(_num_elem, dash::BLOCKCYCLIC(3));
+  for (size_t l = 0; l < in.lsize(); ++l) {
+    in.local[l] = in.pattern().global(l);
+  }
+  in.barrier();
+
+  dash::exclusive_scan(dash::par_unseq,
+                       in.begin(), in.end(), out.begin(), 5L);
+  out.barrier();
+
+  for (size_t l = 0; l < out.lsize(); ++l) {
+    long g = out.pattern().global(l);
+    EXPECT_EQ_U(5 + (g * (g - 1)) / 2, static_cast<long>(out.local[l]));
+  }
+}
+
+TEST_F(ScanTest, NonCommutativeInPlace)
+{
+  std::vector<affine_t> expected(_num_elem);
+  expected[0] = affine_value(0);
+  for (size_t i = 1; i < _num_elem; ++i) {
+    expected[i] = affine_compose()(expected[i-1], affine_value(i));
+  }
+
+  // Interleaved runs in cyclic distribution, contiguous runs in blocked
+  // distribution:
+  for (auto dist : { dash::CYCLIC, dash::BLOCKED }) {
+    dash::Array<affine_t> arr(_num_elem, dist);
+    for (size_t l = 0; l < arr.lsize(); ++l) {
+      arr.local[l] = affine_value(arr.pattern().global(l));
+    }
+    arr.barrier();
+
+    dash::inclusive_scan(arr.begin(), arr.end(), arr.begin(),
+                         affine_compose());
+    arr.barrier();
+
+    for (size_t l = 0; l < arr.lsize(); ++l) {
+      auto     g     = arr.pattern().global(l);
+      affine_t value = arr.local[l];
+      EXPECT_EQ_U(expected[g].mul, value.mul);
+      EXPECT_EQ_U(expected[g].add, value.add);
+    }
+    arr.barrier();
+  }
+}
+
+TEST_F(ScanTest, NonCommutativeBlockcyclicSubrange)
+{
+  // Range starts and ends within blocks:
+  size_t first = 5;
+  size_t last  = _num_elem - 3;
+  std::vector<affine_t> expected(_num_elem);
+  expected[first] = affine_value(first);
+  for (size_t i = first + 1; i < last; ++i) {
+    expected[i] = affine_compose()(expected[i-1], affine_value(i));
+  }
+
+  dash::Array<affine_t> arr(_num_elem, dash::BLOCKCYCLIC(4));
+  for (size_t l = 0; l < arr.lsize(); ++l) {
+    arr.local[l] = affine_value(arr.pattern().global(l));
+  }
+  arr.barrier();
+
+  dash::inclusive_scan(dash::par_unseq,
+                       arr.begin() + first, arr.begin() + last,
+                       arr.begin() + first, affine_compose());
+  arr.barrier();
+
+  for (size_t l = 0; l < arr.lsize(); ++l) {
+    size_t   g     = arr.pattern().global(l);
+    affine_t value = arr.local[l];
+    affine_t exp   = (g < first || g >= last) ? affine_value(g)
+                                              : expected[g];
+    EXPECT_EQ_U(exp.mul, value.mul);
+    EXPECT_EQ_U(exp.add, value.add);
+  }
+}
+
+TEST_F(ScanTest, PartialSumSubrange)
+{
+  dash::Array<int> in(_num_elem);
+  dash::Array<int> out(_num_elem);
+  dash::fill(in.begin(), in.end(), 2);
+  dash::fill(out.begin(), out.end(), -1);
+  in.barrier();
+
+  size_t first = 3;
+  size_t last  = _num_elem - 2;
+  dash::partial_sum(in.begin() + first, in.begin() + last,
+                    out.begin() + first);
+  out.barrier();
+
+  for (size_t l = 0; l < out.lsize(); ++l) {
+    size_t g = out.pattern().global(l);
+    if (g < first || g >= last) {
+      EXPECT_EQ_U(-1, out.local[l]);
+    } else {
+      EXPECT_EQ_U(2 * (g - first + 1), out.local[l]);
+    }
+  }
+}
+
+TEST_F(ScanTest, InclusiveScanTiled)
+{
+  typedef dash::TilePattern<2>                       pattern_t;
+  typedef dash::Matrix<long, 2, long, pattern_t>     matrix_t;
+
+  // Local rows of tiles are not ordered by global index:
+  const size_t tilesize = 2;
+  const size_t ntiles   = 2;
+  dash::TeamSpec<2> teamspec;
+  teamspec.balance_extents();
+  pattern_t pattern(
+    dash::SizeSpec<2>(teamspec.extent(0) * ntiles * tilesize,
+                      teamspec.extent(1) * ntiles * tilesize),
+    dash::DistributionSpec<2>(dash::TILE(tilesize), dash::TILE(tilesize)),
+    teamspec);
+  matrix_t in(pattern);
+  matrix_t out(pattern);
+  for (size_t l = 0; l < in.local_size(); ++l) {
+    in.lbegin()[l] = in.pattern().global(l);
+  }
+  in.barrier();
+
+  dash::inclusive_scan(dash::par_unseq,
+                       in.begin(), in.end(), out.begin());
+  out.barrier();
+
+  for (size_t l = 0; l < out.local_size(); ++l) {
+    long g = out.pattern().global(l);
+    EXPECT_EQ_U((g * (g + 1)) / 2, out.lbegin()[l]);
+  }
+}
@@ -0,0 +1,24 @@
+#ifndef DASH__TEST__SCAN_TEST_H_
+#define DASH__TEST__SCAN_TEST_H_
+
+#include "TestBase.h"
+
+/**
+ * Test fixture for algorithms dash::inclusive_scan, dash::exclusive_scan
+ * and dash::partial_sum.
+ */
+class ScanTest : public dash::test::TestBase {
+protected:
+  /// Using a prime to cause inconvenient strides
+  const size_t _num_elem = 251;
+
+  ScanTest() {
+    LOG_MESSAGE(">>> Test suite: ScanTest");
+  }
+
+  virtual ~ScanTest() {
+    LOG_MESSAGE("<<< Closing test suite: ScanTest");
+  }
+};
+
+#endif // DASH__TEST__SCAN_TEST_H_
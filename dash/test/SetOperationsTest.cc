@@ -0,0 +1,92 @@
+#include "SetOperationsTest.h"
+
+#include <dash/algorithm/SetOperations.h>
+
+#include <dash/Array.h>
+
+#include <algorithm>
+#include <vector>
+
+
+namespace {
+
+/**
+ * Fills arrays with sorted values that contain duplicates:
+ * a: [ 0 0 2 2 4 4 ... ], b: [ 0 3 6 9 ... ]
+ */
+void fill_sorted(
+  dash::Array<int> & array_a,
+  dash::Array<int> & array_b,
+  std::vector<int> & values_a,
+  std::vector<int> & values_b)
+{
+  values_a.resize(array_a.size());
+  values_b.resize(array_b.size());
+  for (size_t g = 0; g < values_a.size(); ++g) {
+    values_a[g] = 2 * (g / 2);
+  }
+  for (size_t g = 0; g < values_b.size(); ++g) {
+    values_b[g] = 3 * g;
+  }
+  for (size_t l = 0; l < array_a.lsize(); ++l) {
+    array_a.local[l] = values_a[array_a.pattern().global(l)];
+  }
+  for (size_t l = 0; l < array_b.lsize(); ++l) {
+    array_b.local[l] = values_b[array_b.pattern().global(l)];
+  }
+  array_a.barrier();
+}
+
+} // namespace
+
+TEST_F(SetOperationsTest, Union)
+{
+  dash::Array<int> array_a(131 * dash::size(), dash::BLOCKED);
+  dash::Array<int> array_b( 57 * dash::size(), dash::CYCLIC);
+  dash::Array<int> array_out(array_a.size() + array_b.size());
+  std::vector<int> values_a;
+  std::vector<int> values_b;
+  fill_sorted(array_a, array_b, values_a, values_b);
+
+  auto out_last = dash::set_union(array_a.begin(), array_a.end(),
+                                  array_b.begin(), array_b.end(),
+                                  array_out.begin());
+
+  std::vector<int> expected;
+  std::set_union(values_a.begin(), values_a.end(),
+                 values_b.begin(), values_b.end(),
+                 std::back_inserter(expected));
+  EXPECT_EQ_U(expected.size(), out_last - array_out.begin());
+  for (size_t l = 0; l < array_out.lsize(); ++l) {
+    size_t g = array_out.pattern().global(l);
+    if (g < expected.size()) {
+      EXPECT_EQ_U(expected[g], array_out.local[l]);
+    }
+  }
+}
+
+TEST_F(SetOperationsTest, Intersection)
+{
+  dash::Array<int> array_a(131 * dash::size(), dash::BLOCKCYCLIC(4));
+  dash::Array<int> array_b( 57 * dash::size(), dash::BLOCKED);
+  dash::Array<int> array_out(array_b.size(), dash::CYCLIC);
+  std::vector<int> values_a;
+  std::vector<int> values_b;
+  fill_sorted(array_a, array_b, values_a, values_b);
+
+  auto out_last = dash::set_intersection(array_a.begin(), array_a.end(),
+                                         array_b.begin(), array_b.end(),
+                                         array_out.begin());
+
+  std::vector<int> expected;
+  std::set_intersection(values_a.begin(), values_a.end(),
+                        values_b.begin(), values_b.end(),
+                        std::back_inserter(expected));
+  EXPECT_EQ_U(expected.size(), out_last - array_out.begin());
+  for (size_t l = 0; l < array_out.lsize(); ++l) {
+    size_t g = array_out.pattern().global(l);
+    if (g < expected.size()) {
+      EXPECT_EQ_U(expected[g], array_out.local[l]);
+    }
+  }
+}
@@ -0,0 +1,21 @@
+#ifndef DASH__TEST__SET_OPERATIONS_TEST_H_
+#define DASH__TEST__SET_OPERATIONS_TEST_H_
+
+#include "TestBase.h"
+
+/**
+ * Test fixture for algorithms dash::set_union and dash::set_intersection.
+ */
+class SetOperationsTest : public dash::test::TestBase {
+protected:
+
+  SetOperationsTest() {
+    LOG_MESSAGE(">>> Test suite: SetOperationsTest");
+  }
+
+  virtual ~SetOperationsTest() {
+    LOG_MESSAGE("<<< Closing test suite: SetOperationsTest");
+  }
+};
+
+#endif // DASH__TEST__SET_OPERATIONS_TEST_H_
@@ -0,0 +1,191 @@
+#include "SparseMatrixTest.h"
+
+#include <dash/SparseMatrix.h>
+
+#include <vector>
+
+
+namespace {
+
+typedef dash::SparseMatrix<double, long> sparse_matrix_t;
+
+/**
+ * Value of element \c i of the vector multiplied with test matrices,
+ * products are exact in double precision.
+ */
+double x_value(long i)
+{
+  return static_cast<double>(i % 7 - 3);
+}
+
+/**
+ * Local rows of a matrix with \c ncols columns in CSR format, row \c r
+ * has entries in columns \c r - 1, \c r + 1 and in a distant column,
+ * in descending order of columns.
+ */
+struct LocalRows {
+  LocalRows(long row_begin, long nrows_l, long ncols)
+  : row_ptr(1, 0)
+  {
+    for (long r = row_begin; r < row_begin + nrows_l; ++r) {
+      long cols[] = { (r * 5 + 3) % ncols, r + 1, r % ncols, r - 1 };
+      for (long col : cols) {
+        if (col >= 0 && col < ncols) {
+          col_idx.push_back(col);
+          values.push_back(static_cast<double>((r + 2 * col) % 5 - 2));
+        }
+      }
+      row_ptr.push_back(static_cast<long>(values.size()));
+    }
+  }
+
+  /**
+   * Product of local row \c r and the vector with elements \c x_value.
+   */
+  double product(long r) const
+  {
+    double result = 0;
+    for (long j = row_ptr[r]; j < row_ptr[r + 1]; ++j) {
+      result += values[j] * x_value(col_idx[j]);
+    }
+    return result;
+  }
+
+  std::vector<long>   row_ptr;
+  std::vector<long>   col_idx;
+  std::vector<double> values;
+};
+
+/**
+ * Computes the product of a matrix with irregular row distribution and
+ * checks the local elements of the result.
+ */
+template<class ExecutionPolicy>
+void test_multiply(ExecutionPolicy && policy, long ncols)
+{
+  long myid      = dash::myid().id;
+  long nrows_l   = 3 * (myid + 1) + (myid % 2) * 700;
+  long row_begin = 0;
+  for (long u = 0; u < myid; ++u) {
+    row_begin += 3 * (u + 1) + (u % 2) * 700;
+  }
+  long nrows     = row_begin;
+  for (long u = myid; u < static_cast<long>(dash::size()); ++u) {
+    nrows += 3 * (u + 1) + (u % 2) * 700;
+  }
+  if (ncols == 0) {
+    ncols = nrows;
+  }
+  LocalRows rows(row_begin, nrows_l, ncols);
+  sparse_matrix_t matrix(ncols, rows.row_ptr, rows.col_idx, rows.values);
+
+  EXPECT_EQ_U(nrows, matrix.nrows());
+  EXPECT_EQ_U(ncols, matrix.ncols());
+  EXPECT_EQ_U(nrows_l, matrix.row_pattern().local_size());
+  EXPECT_EQ_U(rows.values.size(), matrix.values().lsize());
+  if (ncols == nrows) {
+    EXPECT_TRUE_U(matrix.col_pattern() == matrix.row_pattern());
+  }
+  // Transfers merge contiguous ghost elements of the same unit:
+  EXPECT_LE_U(matrix.num_transfers(), matrix.ghost_cols().size());
+
+  sparse_matrix_t::vector_type x(matrix.col_pattern());
+  sparse_matrix_t::vector_type y(matrix.row_pattern());
+  for (int iter = 0; iter < 3; ++iter) {
+    auto x_begin = matrix.col_pattern().lbegin();
+    for (size_t l = 0; l < x.lsize(); ++l) {
+      x.lbegin()[l] = x_value(x_begin + l) * (iter + 1);
+    }
+    matrix.multiply(policy, x, y);
+    for (long r = 0; r < nrows_l; ++r) {
+      EXPECT_EQ_U(rows.product(r) * (iter + 1), y.lbegin()[r]);
+    }
+  }
+}
+
+} // namespace
+
+TEST_F(SparseMatrixTest, MultiplySquare)
+{
+  test_multiply(dash::execution::seq, 0);
+}
+
+TEST_F(SparseMatrixTest, MultiplySquareParallel)
+{
+  test_multiply(dash::execution::par_unseq, 0);
+}
+
+TEST_F(SparseMatrixTest, MultiplyRectangular)
+{
+  test_multiply(dash::execution::par_unseq, 1033);
+}
+
+TEST_F(SparseMatrixTest, GlobalAccess)
+{
+  long myid = dash::myid().id;
+  // Tridiagonal matrix with two rows per unit:
+  long nrows = 2 * dash::size();
+  std::vector<long>   row_ptr { 0 };
+  std::vector<long>   col_idx;
+  std::vector<double> values;
+  for (long r = 2 * myid; r < 2 * myid + 2; ++r) {
+    for (long col = r + 1; col >= r - 1; --col) {
+      if (col >= 0 && col < nrows) {
+        col_idx.push_back(col);
+        values.push_back(col == r ? 2.0 : -1.0);
+      }
+    }
+    row_ptr.push_back(col_idx.size());
+  }
+  sparse_matrix_t matrix(nrows, row_ptr, col_idx, values);
+  EXPECT_EQ_U(3 * nrows - 2, matrix.nnz());
+
+  if (myid == 0) {
+    // Row pointers are local offsets, entries of the diagonal block are
+    // stored first within every row:
+    long entry_base = 0;
+    for (long u = 0; u < static_cast<long>(dash::size()); ++u) {
+      for (long l = 0; l < 2; ++l) {
+        long r       = 2 * u + l;
+        long r_begin = matrix.row_ptr()[3 * u + l];
+        long r_end   = matrix.row_ptr()[3 * u + l + 1];
+        long n       = (r == 0 || r == nrows - 1) ? 2 : 3;
+        EXPECT_EQ_U(n, r_end - r_begin);
+        bool seen_ghost = false;
+        long col_sum    = 0;
+        for (long j = entry_base + r_begin; j < entry_base + r_end; ++j) {
+          long   col   = matrix.col_indices()[j];
+          double value = matrix.values()[j];
+          bool   diag  = col / 2 == u;
+          EXPECT_FALSE_U(seen_ghost && diag);
+          EXPECT_EQ_U(col == r ? 2.0 : -1.0, value);
+          seen_ghost = seen_ghost || !diag;
+          col_sum   += col;
+        }
+        EXPECT_EQ_U(n * r + (r == 0 ? 1 : 0) - (r == nrows - 1 ? 1 : 0),
+                    col_sum);
+      }
+      entry_base += matrix.row_ptr()[3 * u + 2];
+    }
+  }
+  // Ghost columns are the neighbors of the local row range:
+  std::vector<long> expected_ghosts;
+  if (myid > 0) {
+    expected_ghosts.push_back(2 * myid - 1);
+  }
+  if (myid < static_cast<long>(dash::size()) - 1) {
+    expected_ghosts.push_back(2 * myid + 2);
+  }
+  EXPECT_EQ_U(expected_ghosts, matrix.ghost_cols());
+  EXPECT_EQ_U(expected_ghosts.size(), matrix.num_transfers());
+}
+
+TEST_F(SparseMatrixTest, InvalidColumn)
+{
+  std::vector<long>   row_ptr { 0, 1 };
+  std::vector<long>   col_idx { static_cast<long>(dash::size()) };
+  std::vector<double> values  { 1.0 };
+  EXPECT_THROW(
+    sparse_matrix_t(dash::size(), row_ptr, col_idx, values),
+    dash::exception::InvalidArgument);
+}
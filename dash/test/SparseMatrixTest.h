@@ -0,0 +1,19 @@
+#ifndef DASH__TEST__SPARSE_MATRIX_TEST_H_
+#define DASH__TEST__SPARSE_MATRIX_TEST_H_
+
+#include "TestBase.h"
+
+/**
+ * Test fixture for class dash::SparseMatrix
+ */
+class SparseMatrixTest : public dash::test::TestBase {
+protected:
+
+  SparseMatrixTest() {
+  }
+
+  virtual ~SparseMatrixTest() {
+  }
+};
+
+#endif // DASH__TEST__SPARSE_MATRIX_TEST_H_
@@ -0,0 +1,155 @@
+#include "StencilOperatorTest.h"
+#include "HaloTestHelpers.h"
+
+#include <dash/Matrix.h>
+#include <dash/experimental/StencilOperator.h>
+
+#include <array>
+
+
+using dash::test::element_value;
+using dash::test::init_matrix;
+
+TEST_F(StencilOperatorTest, StarStencil2D)
+{
+  using dash::experimental::HaloSpec;
+  using dash::experimental::StencilOperator;
+  using pattern_t  = dash::Pattern<2>;
+  using matrix_t   = dash::Matrix<long, 2, long, pattern_t>;
+  using operator_t = StencilOperator<matrix_t, HaloSpec<2>>;
+  using point_t    = operator_t::stencil_point;
+
+  const long sentinel = -1;
+
+  dash::TeamSpec<2> teamspec;
+  teamspec.balance_extents();
+  pattern_t pattern(dash::SizeSpec<2>(16, 20),
+                    dash::DistributionSpec<2>(dash::BLOCKED, dash::BLOCKED),
+                    teamspec);
+  matrix_t matrix(pattern);
+  matrix_t result(pattern);
+  init_matrix(matrix);
+
+  HaloSpec<2> halospec({ { { -1, 1 }, { -1, 1 } } });
+  operator_t stencil_op(matrix, halospec);
+
+  // Inner region is enclosed in the region of computed points:
+  for (auto d = 0; d < 2; ++d) {
+    EXPECT_LE_U(stencil_op.region_begin()[d], stencil_op.inner_begin()[d]);
+    EXPECT_GE_U(stencil_op.region_end()[d],   stencil_op.inner_end()[d]);
+  }
+
+  // Apply twice to validate that the operator can be reused:
+  for (int t = 0; t < 2; ++t) {
+    std::fill(result.lbegin(), result.lend(), sentinel);
+    stencil_op.apply(result,
+                     [](const point_t & p) {
+                       return p.center() + p(-1, 0) + p(1, 0) +
+                              p(0, -1) + p(0, 1);
+                     });
+    for (long l = 0; l < result.local_size(); ++l) {
+      auto lcoords = pattern.local_memory_layout().coords(l);
+      auto gcoords = pattern.global(lcoords);
+      bool computed = gcoords[0] > 0 && gcoords[0] < 15 &&
+                      gcoords[1] > 0 && gcoords[1] < 19;
+      EXPECT_EQ_U(computed ? 5 * element_value(gcoords) : sentinel,
+                  result.lbegin()[l]);
+    }
+    result.barrier();
+  }
+}
+
+TEST_F(StencilOperatorTest, AsymmetricStencil3DFaces)
+{
+  using dash::experimental::HaloSpec;
+  using dash::experimental::HaloExchangeScope;
+  using dash::experimental::StencilOperator;
+  using pattern_t  = dash::Pattern<3>;
+  using matrix_t   = dash::Matrix<long, 3, long, pattern_t>;
+  using operator_t = StencilOperator<matrix_t, HaloSpec<3>>;
+  using point_t    = operator_t::stencil_point;
+
+  const long sentinel = -1;
+
+  dash::TeamSpec<3> teamspec;
+  teamspec.balance_extents();
+  pattern_t pattern(dash::SizeSpec<3>(8, 12, 10),
+                    dash::DistributionSpec<3>(
+                      dash::BLOCKED, dash::BLOCKED, dash::BLOCKED),
+                    teamspec);
+  matrix_t matrix(pattern);
+  matrix_t result(pattern);
+  init_matrix(matrix);
+  std::fill(result.lbegin(), result.lend(), sentinel);
+
+  HaloSpec<3> halospec({ { { -1, 0 }, { 0, 2 }, { -1, 1 } } });
+  operator_t stencil_op(matrix, halospec, HaloExchangeScope::FACES);
+
+  stencil_op.apply(result,
+                   [](const point_t & p) {
+                     return p.center() + p(-1, 0, 0) + p(0, 2, 0) +
+                            p.at({{ 0, 0, -1 }}) + p.at({{ 0, 0, 1 }});
+                   });
+
+  for (long l = 0; l < result.local_size(); ++l) {
+    auto lcoords = pattern.local_memory_layout().coords(l);
+    auto gcoords = pattern.global(lcoords);
+    bool computed = gcoords[0] > 0 &&
+                    gcoords[1] < 10 &&
+                    gcoords[2] > 0 && gcoords[2] < 9;
+    // Offsets sum up to -10000 + 200 - 1 + 1:
+    EXPECT_EQ_U(computed ? 5 * element_value(gcoords) - 9800 : sentinel,
+                result.lbegin()[l]);
+  }
+  result.barrier();
+}
+
+TEST_F(StencilOperatorTest, PeriodicStencil2D)
+{
+  using dash::experimental::HaloSpec;
+  using dash::experimental::StencilOperator;
+  using pattern_t  = dash::Pattern<2>;
+  using matrix_t   = dash::Matrix<long, 2, long, pattern_t>;
+  using operator_t = StencilOperator<matrix_t, HaloSpec<2>>;
+  using point_t    = operator_t::stencil_point;
+
+  dash::TeamSpec<2> teamspec;
+  teamspec.balance_extents();
+  pattern_t pattern(dash::SizeSpec<2>(16, 20),
+                    dash::DistributionSpec<2>(dash::BLOCKED, dash::BLOCKED),
+                    teamspec);
+  matrix_t matrix(pattern);
+  matrix_t result(pattern);
+  init_matrix(matrix);
+
+  operator_t::boundary_spec_t boundary;
+  boundary.set_periodic(0)
+          .set_periodic(1);
+  HaloSpec<2> halospec({ { { -1, 1 }, { -1, 1 } } });
+  operator_t stencil_op(matrix, halospec, boundary);
+
+  // All points are computed:
+  for (auto d = 0; d < 2; ++d) {
+    EXPECT_EQ_U(0, stencil_op.region_begin()[d]);
+    EXPECT_EQ_U(result.local.extent(d), stencil_op.region_end()[d]);
+  }
+
+  stencil_op.apply(result,
+                   [](const point_t & p) {
+                     return p.center() + p(-1, 0) + p(1, 0) +
+                            p(0, -1) + p(0, 1);
+                   });
+  for (long l = 0; l < result.local_size(); ++l) {
+    auto lcoords = pattern.local_memory_layout().coords(l);
+    auto g       = pattern.global(lcoords);
+    long x       = g[0];
+    long y       = g[1];
+    long expected = element_value<2>({{ x, y }}) +
+                    element_value<2>({{ (x + 15) % 16, y }}) +
+                    element_value<2>({{ (x + 1)  % 16, y }}) +
+                    element_value<2>({{ x, (y + 19) % 20 }}) +
+                    element_value<2>({{ x, (y + 1)  % 20 }});
+    EXPECT_EQ_U(expected, result.lbegin()[l]);
+  }
+  result.barrier();
+}
@@ -106,3 +106,35 @@ TEST_F(TeamTest, SplitTeamSync)
   }
 }
 
+
+TEST_F(TeamTest, SplitRepeated)
+{
+  auto & team_all = dash::Team::All();
+
+  if (team_all.size() < 2) {
+    SKIP_TEST_MSG("requires at least 2 units");
+  }
+  if (!team_all.is_leaf()) {
+    SKIP_TEST_MSG("team is already splitted. Skip test");
+  }
+
+  // Create and destroy more teams than the initial number of team slots,
+  // communication resources of destroyed teams are reused:
+  int num_iterations = 300;
+  for (int i = 0; i < num_iterations; ++i) {
+    auto & team_sub = team_all.split(2);
+    ASSERT_NE_U(DART_TEAM_NULL, team_sub.dart_id());
+
+    {
+      dash::Array<int> array(team_sub.size(), team_sub);
+      array.local[0] = i;
+      array.barrier();
+      auto next = (team_sub.myid().id + 1) % team_sub.size();
+      EXPECT_EQ_U(i, static_cast<int>(array[next]));
+      array.barrier();
+    }
+
+    delete &team_sub;
+    ASSERT_TRUE_U(team_all.is_leaf());
+  }
+}
@@ -0,0 +1,124 @@
+#include "TextIngestTest.h"
+
+#include <dash/io/Text.h>
+#include <dash/Array.h>
+#include <dash/UnorderedMap.h>
+#include <dash/algorithm/Fill.h>
+
+#include <algorithm>
+#include <cstdlib>
+#include <fstream>
+#include <string>
+
+using dash::io::text::ingest_options;
+
+namespace {
+
+/**
+ * Writes a CSV file with a header line followed by \c nrecords lines
+ * "<index>,<value>" with value = index * 3, at unit 0.
+ */
+void write_csv(const std::string& filename, size_t nrecords,
+               bool trailing_newline = true) {
+  if (dash::myid() == 0) {
+    std::ofstream out(filename);
+    out << "index,value\n";
+    for (size_t r = 0; r < nrecords; ++r) {
+      // Vary record lengths to misalign byte ranges and buffers:
+      out << r << "," << std::string(r % 7, ' ') << (r * 3);
+      if (r + 1 < nrecords || trailing_newline) {
+        out << "\n";
+      }
+    }
+  }
+  dash::Team::All().barrier();
+}
+
+/**
+ * Parses the value field of a record "<index>,<value>".
+ */
+bool parse_value(const char* first, const char* last, long& value) {
+  const char* sep = std::find(first, last, ',');
+  if (sep == last) {
+    return false;
+  }
+  value = std::strtol(std::string(sep + 1, last).c_str(), nullptr, 10);
+  return true;
+}
+
+}  // namespace
+
+TEST_F(TextIngestTest, ArrayRecords) {
+  size_t nrecords = 97 * dash::size() + 3;
+  write_csv(_filename, nrecords);
+
+  dash::Array<long> array(nrecords);
+  dash::fill(array.begin(), array.end(), -1);
+
+  ingest_options options;
+  options.skip_records = 1;
+  // Force many rounds and records exceeding the buffer:
+  options.buffer_size = 8;
+  size_t nstored = dash::io::text::ingest(dash::execution::par_unseq,
+                                          _filename, array, parse_value,
+                                          options);
+  EXPECT_EQ_U(nrecords, nstored);
+
+  auto& pattern = array.pattern();
+  for (size_t l = 0; l < array.lsize(); ++l) {
+    EXPECT_EQ_U(static_cast<long>(pattern.global(l) * 3), array.local[l]);
+  }
+}
+
+TEST_F(TextIngestTest, ArrayUnterminatedRecord) {
+  size_t nrecords = 13 * dash::size();
+  write_csv(_filename, nrecords, false);
+
+  dash::Array<long> array(nrecords);
+  ingest_options options;
+  options.skip_records = 1;
+  size_t nstored = dash::io::text::ingest(_filename, array, parse_value,
+                                          options);
+  EXPECT_EQ_U(nrecords, nstored);
+  if (dash::myid() == 0) {
+    EXPECT_EQ_U(static_cast<long>((nrecords - 1) * 3),
+                static_cast<long>(array[nrecords - 1]));
+  }
+  dash::Team::All().barrier();
+
+  // File contains more records than elements:
+  dash::Array<long> too_small(nrecords - 1);
+  EXPECT_THROW(dash::io::text::ingest(_filename, too_small, parse_value,
+                                      options),
+               dash::exception::InvalidArgument);
+}
+
+TEST_F(TextIngestTest, UnorderedMapRecords) {
+  typedef dash::UnorderedMap<int, long> map_t;
+  size_t nrecords = 53 * dash::size();
+  write_csv(_filename, nrecords);
+
+  map_t map;
+  ingest_options options;
+  options.skip_records = 1;
+  options.buffer_size = 64;
+  size_t ninserted = dash::io::text::ingest(
+      dash::execution::par_unseq, _filename, map,
+      [](const char* first, const char* last, std::pair<int, long>& kv) {
+        long value;
+        if (!parse_value(first, last, value)) {
+          return false;
+        }
+        kv.first = std::atoi(std::string(first, last).c_str());
+        kv.second = value;
+        return true;
+      },
+      options);
+  EXPECT_EQ_U(nrecords, ninserted);
+  EXPECT_EQ_U(nrecords, map.size());
+
+  for (auto it = map.lbegin(); it != map.lend(); ++it) {
+    std::pair<int, long> kv = *it;
+    EXPECT_EQ_U(static_cast<long>(kv.first) * 3, kv.second);
+  }
+}
@@ -0,0 +1,31 @@
+#ifndef DASH__TEST__TEXT_INGEST_TEST_H__INCLUDED
+#define DASH__TEST__TEXT_INGEST_TEST_H__INCLUDED
+
+#include "TestBase.h"
+
+#include <cstdio>
+#include <string>
+
+/**
+ * Test fixture for dash::io::text::ingest
+ */
+class TextIngestTest : public dash::test::TestBase {
+ protected:
+  std::string _filename = "test_text_ingest.csv";
+
+  TextIngestTest() { LOG_MESSAGE(">>> Test suite: TextIngestTest"); }
+
+  virtual ~TextIngestTest() {
+    LOG_MESSAGE("<<< Closing test suite: TextIngestTest");
+  }
+
+  virtual void TearDown() {
+    dash::Team::All().barrier();
+    if (dash::myid() == 0) {
+      remove(_filename.c_str());
+    }
+    dash::test::TestBase::TearDown();
+  }
+};
+
+#endif  // DASH__TEST__TEXT_INGEST_TEST_H__INCLUDED
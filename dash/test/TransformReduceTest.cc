@@ -0,0 +1,55 @@
+#include "TransformReduceTest.h"
+
+#include <dash/Array.h>
+#include <dash/algorithm/TransformReduce.h>
+#include <dash/algorithm/Fill.h>
+
+#include <functional>
+
+
+TEST_F(TransformReduceTest, SumOfSquares)
+{
+  dash::Array<int> arr(_num_elem, dash::BLOCKCYCLIC(7));
+  for (size_t l = 0; l < arr.lsize(); ++l) {
+    arr.local[l] = arr.pattern().global(l);
+  }
+  arr.barrier();
+
+  long n        = _num_elem;
+  long expected = 10 + ((n - 1) * n * (2 * n - 1)) / 6;
+  auto square   = [](int v) { return static_cast<long>(v) * v; };
+
+  EXPECT_EQ_U(expected,
+              dash::transform_reduce(arr.begin(), arr.end(), 10L,
+                                     dash::plus<long>(), square));
+  EXPECT_EQ_U(expected,
+              dash::transform_reduce(dash::par_unseq,
+                                     arr.begin(), arr.end(), 10L,
+                                     dash::plus<long>(), square));
+  // Empty range:
+  EXPECT_EQ_U(10L,
+              dash::transform_reduce(arr.begin(), arr.begin(), 10L,
+                                     dash::plus<long>(), square));
+}
+
+TEST_F(TransformReduceTest, InnerProduct)
+{
+  dash::Array<double> a(_num_elem);
+  dash::Array<double> b(_num_elem);
+  dash::fill(a.begin(), a.end(), 0.5);
+  dash::fill(b.begin(), b.end(), 4.0);
+  a.barrier();
+
+  double dot = dash::transform_reduce(a.begin(), a.end(), b.begin(), 1.0,
+                                      dash::plus<double>(),
+                                      std::multiplies<double>());
+  EXPECT_EQ_U(1.0 + 2.0 * _num_elem, dot);
+
+  // Maximum of differences in a subrange:
+  double max_diff = dash::transform_reduce(
+                      dash::par_unseq,
+                      a.begin() + 1, a.end() - 1, b.begin() + 1, 0.0,
+                      dash::max<double>(),
+                      [](double x, double y) { return y - x; });
+  EXPECT_EQ_U(3.5, max_diff);
+}
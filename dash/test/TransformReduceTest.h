@@ -0,0 +1,23 @@
+#ifndef DASH__TEST__TRANSFORM_REDUCE_TEST_H_
+#define DASH__TEST__TRANSFORM_REDUCE_TEST_H_
+
+#include "TestBase.h"
+
+/**
+ * Test fixture for algorithm dash::transform_reduce.
+ */
+class TransformReduceTest : public dash::test::TestBase {
+protected:
+  /// Using a prime to cause inconvenient strides
+  const size_t _num_elem = 251;
+
+  TransformReduceTest() {
+    LOG_MESSAGE(">>> Test suite: TransformReduceTest");
+  }
+
+  virtual ~TransformReduceTest() {
+    LOG_MESSAGE("<<< Closing test suite: TransformReduceTest");
+  }
+};
+
+#endif // DASH__TEST__TRANSFORM_REDUCE_TEST_H_
@@ -211,3 +211,132 @@ TEST_F(TransformTest, MatrixGlobalPlusGlobalBlocking)
   EXPECT_EQ_U(first_l_block_a_begin,
               first_l_block_a_offsets);
 }
+
+TEST_F(TransformTest, ArrayWorkStealing)
+{
+  const size_t num_elem_local = 100;
+  size_t num_elem_total       = dash::size() * num_elem_local;
+  dash::Array<int> array_a(num_elem_total, dash::BLOCKED);
+  dash::Array<int> array_b(num_elem_total, dash::BLOCKED);
+  dash::Array<int> array_c(num_elem_total, dash::BLOCKED);
+
+  for (size_t l_idx = 0; l_idx < num_elem_local; ++l_idx) {
+    array_a.local[l_idx] = l_idx;
+    array_b.local[l_idx] = (dash::myid() + 1) * 1000;
+    array_c.local[l_idx] = 0;
+  }
+
+  dash::WorkStealing policy(dash::Team::All(), 3);
+  dash::transform<int>(policy,
+                       array_a.begin(), array_a.end(), // A
+                       array_b.begin(),                // B
+                       array_c.begin(),                // C = op(A,B)
+                       dash::plus<int>());             // op
+
+  for (size_t l_idx = 0; l_idx < num_elem_local; ++l_idx) {
+    int expected = l_idx + (dash::myid() + 1) * 1000;
+    EXPECT_EQ_U(expected, array_c.local[l_idx]);
+  }
+}
+
+TEST_F(TransformTest, ArrayParallelUnsequenced)
+{
+  // Sufficiently large for several page-aligned chunks per unit:
+  const size_t num_elem_local = 5 * 1024;
+  size_t num_elem_total       = dash::size() * num_elem_local;
+  dash::Array<int> array_a(num_elem_total, dash::BLOCKED);
+  dash::Array<int> array_b(num_elem_total, dash::BLOCKED);
+  dash::Array<int> array_c(num_elem_total, dash::BLOCKED);
+
+  for (size_t l_idx = 0; l_idx < num_elem_local; ++l_idx) {
+    array_a.local[l_idx] = l_idx;
+    array_b.local[l_idx] = (dash::myid() + 1) * 100000;
+    array_c.local[l_idx] = 0;
+  }
+  dash::barrier();
+
+  dash::transform(dash::execution::parallel_unsequenced_policy(4),
+                  array_a.begin(), array_a.end(), // A
+                  array_b.begin(),                // B
+                  array_c.begin(),                // C = op(A,B)
+                  dash::plus<int>());             // op
+
+  for (size_t l_idx = 0; l_idx < num_elem_local; ++l_idx) {
+    int expected = l_idx + (dash::myid() + 1) * 100000;
+    EXPECT_EQ_U(expected, array_c.local[l_idx]);
+  }
+}
+
+TEST_F(TransformTest, ArrayGlobalPlusGlobalLocalRanges)
+{
+  // Ranges with identical distribution and start offset are transformed
+  // in local memory, also if output and rhs input range differ
+  const size_t num_elem_local = 1000;
+  size_t num_elem_total       = dash::size() * num_elem_local;
+  dash::Array<double> array_a(num_elem_total, dash::BLOCKCYCLIC(7));
+  dash::Array<double> array_b(num_elem_total, dash::BLOCKCYCLIC(7));
+  dash::Array<double> array_c(num_elem_total, dash::BLOCKCYCLIC(7));
+
+  for (size_t l_idx = 0; l_idx < array_a.lsize(); ++l_idx) {
+    array_a.local[l_idx] = 0.5 * array_a.pattern().global(l_idx);
+    array_b.local[l_idx] = dash::myid() + 1;
+    array_c.local[l_idx] = -1;
+  }
+  dash::barrier();
+
+  // C = A + B on a subrange:
+  size_t offset = 3;
+  dash::transform<double>(array_a.begin() + offset, array_a.end(), // A
+                          array_b.begin() + offset,                // B
+                          array_c.begin() + offset,                // C
+                          dash::plus<double>());
+  // A += A on the full range:
+  dash::transform<double>(array_a.begin(), array_a.end(),          // A
+                          array_a.begin(),                         // A
+                          array_a.begin(),                         // A
+                          dash::plus<double>());
+  dash::barrier();
+
+  for (size_t l_idx = 0; l_idx < array_a.lsize(); ++l_idx) {
+    size_t g_idx      = array_a.pattern().global(l_idx);
+    double exp_c      = (g_idx < offset)
+                        ? -1
+                        : 0.5 * g_idx + dash::myid() + 1;
+    EXPECT_EQ_U(exp_c, array_c.local[l_idx]);
+    EXPECT_EQ_U(static_cast<double>(g_idx), array_a.local[l_idx]);
+  }
+}
+
+TEST_F(TransformTest, ArrayCyclicPlusBlocked)
+{
+  // Input and output ranges with different distribution, local input
+  // elements are accumulated to remote output segments
+  const size_t num_elem_local = 100;
+  size_t num_elem_total       = dash::size() * num_elem_local;
+  dash::Array<int> array_values(num_elem_total, dash::CYCLIC);
+  dash::Array<int> array_dest(num_elem_total, dash::BLOCKED);
+
+  for (size_t l_idx = 0; l_idx < num_elem_local; ++l_idx) {
+    array_values.local[l_idx] = array_values.pattern().global(l_idx);
+    array_dest.local[l_idx]   = 1000000;
+  }
+  dash::barrier();
+
+  // Accumulate values to the output range, shifted by one block so that
+  // every unit accumulates to segments at all units:
+  size_t n_shift = num_elem_local / 2;
+  dash::transform<int>(array_values.begin(), array_values.end() - n_shift,
+                       array_dest.begin() + n_shift,
+                       array_dest.begin() + n_shift,
+                       dash::plus<int>());
+  dash::barrier();
+
+  for (size_t l_idx = 0; l_idx < num_elem_local; ++l_idx) {
+    int g_idx    = array_dest.pattern().global(l_idx);
+    int expected = 1000000;
+    if (g_idx >= static_cast<int>(n_shift)) {
+      expected += g_idx - n_shift;
+    }
+    EXPECT_EQ_U(expected, array_dest.local[l_idx]);
+  }
+}